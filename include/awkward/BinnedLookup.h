@@ -0,0 +1,76 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_BINNEDLOOKUP_H_
+#define AWKWARD_BINNEDLOOKUP_H_
+
+#include <vector>
+
+#include "awkward/Content.h"
+
+namespace awkward {
+  /// @class BinnedLookup
+  ///
+  /// @brief Dense N-dimensional table of values with bin edges on each
+  /// axis, such as a table of scale factors binned in pT and eta, which can
+  /// be evaluated on N aligned arrays of coordinates.
+  ///
+  /// Coordinates below the first edge or above the last edge of an axis
+  /// are clamped to the first or last bin; NaN coordinates evaluate to NaN.
+  class EXPORT_SYMBOL BinnedLookup {
+  public:
+    /// @brief Maximum number of axes: `8`.
+    static const int64_t maxaxes = 8;
+
+    /// @brief Creates a BinnedLookup.
+    ///
+    /// @param edges For each axis, at least two bin edges in increasing
+    /// order.
+    /// @param table Values in C order: the last axis varies fastest. Its
+    /// length must be the product of the number of bins on each axis.
+    BinnedLookup(const std::vector<std::vector<double>>& edges,
+                 const std::vector<double>& table);
+
+    /// @brief Number of axes.
+    int64_t
+      numaxes() const;
+
+    /// @brief The bin edges of each axis.
+    const std::vector<std::vector<double>>
+      edges() const;
+
+    /// @brief Number of bins on each axis.
+    const std::vector<int64_t>
+      shape() const;
+
+    /// @brief The table of values, in C order.
+    const std::vector<double>
+      table() const;
+
+    /// @brief Looks up a value for each set of coordinates.
+    ///
+    /// @param inputs One NumpyArray of numbers for each axis, all with the
+    /// same shape.
+    /// @param interpolate If `false`, return the value of the bin that
+    /// contains the coordinates; if `true`, interpolate linearly between
+    /// bin centers on every axis (holding the value constant beyond the
+    /// first and last bin centers).
+    ///
+    /// Returns a double-precision NumpyArray with the same shape as the
+    /// `inputs`.
+    const ContentPtr
+      evaluate(const ContentPtrVec& inputs, bool interpolate) const;
+
+  private:
+    /// @brief See #edges.
+    const std::vector<std::vector<double>> edges_;
+    /// @brief See #table.
+    const std::vector<double> table_;
+    /// @brief The #edges of all axes, concatenated.
+    std::vector<double> flatedges_;
+    /// @brief Where each axis starts in #flatedges_, with the total length
+    /// at the end.
+    std::vector<int64_t> edgesoffsets_;
+  };
+}
+
+#endif // AWKWARD_BINNEDLOOKUP_H_
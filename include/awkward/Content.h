@@ -4,6 +4,7 @@
 #define AWKWARD_CONTENT_H_
 
 #include <cstdio>
+#include <functional>
 #include <map>
 
 #include "awkward/common.h"
@@ -20,6 +21,7 @@ namespace awkward {
   using ContentPtrVec = std::vector<std::shared_ptr<Content>>;
   class Form;
   using FormPtr       = std::shared_ptr<Form>;
+  class ArrayCache;
 
   /// @class Form
   ///
@@ -328,6 +330,13 @@ namespace awkward {
     virtual void
       nbytes_part(std::map<size_t, int64_t>& largest) const = 0;
 
+    /// @brief Internal function used to calculate #fingerprint.
+    ///
+    /// @param hash The running fingerprint, into which this node mixes its
+    /// length and the hashes of the buffer ranges it can reach.
+    virtual void
+      fingerprint_part(uint64_t& hash) const = 0;
+
     /// @brief The number of elements in the array.
     virtual int64_t
       length() const = 0;
@@ -481,6 +490,24 @@ namespace awkward {
     virtual const ContentPtr
       carry(const Index64& carry) const = 0;
 
+    /// @brief Same as #carry, with a 32-bit `carry`.
+    ///
+    /// Lists with 32-bit offsets pass 32-bit carries to their content (see
+    /// util::carry_of). By default, the `carry` is widened to 64 bits;
+    /// NumpyArray, RecordArray, and the list nodes use it as it is.
+    virtual const ContentPtr
+      carry(const Index32& carry) const;
+
+    /// @brief Same as #carry, except that a `carry` that selects a
+    /// contiguous interval, such as `0, 1, ..., length - 1`, returns a
+    /// #getitem_range_nowrap view instead of a copy.
+    ///
+    /// The check is one pass over `carry`, so it is used where a carry is
+    /// often the identity, such as projecting an option-type or union node
+    /// that has no missing values or only one content.
+    const ContentPtr
+      carry_or_range(const Index64& carry) const;
+
     /// @brief The parameter associated with `key` at the first level
     /// that has a non-null value, descending only as deep as the first
     /// RecordArray.
@@ -591,6 +618,16 @@ namespace awkward {
     virtual const std::pair<Index64, ContentPtr>
       offsets_and_flattened(int64_t axis, int64_t depth) const = 0;
 
+    /// @brief This array as an ordinary layout node: a VirtualArray is
+    /// generated, a ConstantArray, RangeArray, BitPackedArray, or
+    /// QuantizedArray becomes a NumpyArray, and an InterleavedArray becomes
+    /// a RecordArray. Other nodes return a #shallow_copy.
+    ///
+    /// Each #mergeable and #merge applies this to `other` first, so that
+    /// the ordinary nodes need not recognize these representations.
+    virtual const ContentPtr
+      materialized() const;
+
     /// @brief Returns `true` if this array can be merged with the `other`;
     /// `false` otherwise.
     ///
@@ -775,6 +812,22 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const = 0;
 
+    /// @brief An equivalent array whose buffers only contain data that
+    /// this array can reach.
+    ///
+    /// Slicing, masking, and carrying return views that keep the original
+    /// buffers alive, even if they only reference a small part of them.
+    /// This rewrites the tree in a minimal form: lists become a
+    /// {@link ListOffsetArrayOf ListOffsetArray64} with offsets starting at
+    /// zero, {@link IndexedArrayOf IndexedArrays} are projected if that is
+    /// not larger than keeping their index, fields and masked contents are
+    /// trimmed to the array length, and NumpyArrays are copied contiguously.
+    ///
+    /// All data buffers are copied, so the output never pins memory that
+    /// this array does not use. A VirtualArray is materialized.
+    virtual const ContentPtr
+      packed() const = 0;
+
     /// @brief Returns a string representation of this array (multi-line XML).
     ///
     /// Although this XML string has detail about every node in the tree,
@@ -826,6 +879,51 @@ namespace awkward {
     int64_t
       nbytes() const;
 
+    /// @brief A 64-bit hash of this array's Form and all of the buffer
+    /// ranges it can reach, not including Identities.
+    ///
+    /// Arrays with equal fingerprints have the same structure and the same
+    /// buffer contents, so the fingerprint can key caches by content (e.g.
+    /// across processes) instead of by object identity. The hash is not
+    /// cryptographic, and the same data in a different layout (such as a
+    /// {@link ListArrayOf ListArray} and a
+    /// {@link ListOffsetArrayOf ListOffsetArray}) has a different
+    /// fingerprint.
+    ///
+    /// Buffer hashes are remembered while the buffers are alive (see
+    /// util::buffer_fingerprint), so fingerprinting an array again, or a
+    /// view of the same buffers, does not rescan them. A VirtualArray is
+    /// materialized.
+    uint64_t
+      fingerprint() const;
+
+    /// @brief Sets the process-wide cache in which #memoized keeps results;
+    /// `nullptr` (the default) turns memoization off.
+    static void
+      setmemocache(const std::shared_ptr<ArrayCache>& cache);
+
+    /// @brief The process-wide cache in which #memoized keeps results;
+    /// may be `nullptr`.
+    static const std::shared_ptr<ArrayCache>
+      memocache();
+
+    /// @brief Returns the result of `compute`, which must be a pure
+    /// function of this array, remembering it in #memocache under a key
+    /// made of `operation` and this array's #fingerprint.
+    ///
+    /// The `operation` string must spell out every argument of the
+    /// operation (e.g. axis, flags, or the fingerprint of a Slice).
+    /// If there is no #memocache or this array has Identities (which are
+    /// not part of the #fingerprint), `compute` is simply called.
+    /// Otherwise, the result is a #shallow_copy of the cached node, so
+    /// setting its parameters or identities does not change the cache.
+    ///
+    /// #reduce is memoized this way, as are the Python bindings of
+    /// #getitem (with array slices), #num, and #combinations.
+    const ContentPtr
+      memoized(const std::string& operation,
+               const std::function<const ContentPtr()>& compute) const;
+
     /// @brief This array with one axis removed by applying a Reducer
     /// (e.g. "sum", "max", "any", "all).
     ///
@@ -954,7 +1052,8 @@ namespace awkward {
     /// @brief Internal function to handle the `axis = 0` case of #localindex.
     ///
     /// The `axis = 0` case does not depend on array node type, so it is
-    /// defined universally in the Content class.
+    /// defined universally in the Content class. It returns a RangeArray,
+    /// so no index is allocated.
     const ContentPtr
       localindex_axis0() const;
 
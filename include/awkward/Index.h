@@ -182,6 +182,10 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const;
 
+    /// @brief Internal function used to calculate Content#fingerprint.
+    void
+      fingerprint_part(uint64_t& hash) const;
+
     const std::shared_ptr<Index>
       shallow_copy() const override;
 
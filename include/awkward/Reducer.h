@@ -4,6 +4,7 @@
 #define AWKWARD_REDUCER_H_
 
 #include <memory>
+#include <vector>
 
 #include "awkward/Index.h"
 
@@ -21,6 +22,11 @@ namespace awkward {
     virtual const std::string
       name() const = 0;
 
+    /// @brief Settings of the reducer algorithm, if it has any, as a string
+    /// (e.g. for caching results); empty by default.
+    virtual const std::string
+      options() const;
+
     /// @brief Data type to prefer, as a pybind11 format string, if the array
     /// has UnknownType.
     virtual const std::string
@@ -235,6 +241,204 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of boolean values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of signed 8-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of unsigned 8-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of signed 16-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of unsigned 16-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of signed 32-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of unsigned 32-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of signed 64-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of unsigned 64-bit integer values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of 32-bit floating-point values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const = 0;
+
+    /// @brief Apply the reducer algorithm along one axis of a strided,
+    /// multidimensional array of 64-bit floating-point values.
+    ///
+    /// @param data The array to reduce.
+    /// @param offset The location of the first item in the array.
+    /// @param shape The size of each dimension of the array.
+    /// @param strides The step size of each dimension, in items (not bytes).
+    /// @param axis The dimension of `shape` to reduce.
+    /// @param outlength The length of the output array (equal to the product
+    /// of all dimensions other than `axis`).
+    virtual const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const = 0;
   };
 
   /// @class ReducerCount
@@ -352,6 +556,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerCountNonzero
@@ -471,6 +763,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerSum
@@ -588,6 +968,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerProd
@@ -707,6 +1175,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerAny
@@ -823,6 +1379,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerAll
@@ -939,6 +1583,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerMin
@@ -1043,6 +1775,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerMax
@@ -1147,6 +1967,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerArgmin
@@ -1267,6 +2175,94 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
   };
 
   /// @class ReducerArgmax
@@ -1387,6 +2383,697 @@ namespace awkward {
                     const Index64& starts,
                     const Index64& parents,
                     int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+  };
+
+  /// @class QuantileSketch
+  ///
+  /// @brief Mergeable summary of a stream of numbers from which approximate
+  /// quantiles can be read, using the KLL algorithm (Karnin, Lang, and
+  /// Liberty, 2016).
+  ///
+  /// The sketch keeps about `3*k` numbers in a stack of compactors:
+  /// whenever one fills up, it is sorted and every other number moves to
+  /// the next compactor, with twice the weight. The rank error of a
+  /// #quantile is about `2/k` of the #count, regardless of how many
+  /// numbers have been added, and sketches built from different pieces of
+  /// a dataset (e.g. partitions) can be combined with #merge.
+  ///
+  /// Compaction keeps either the odd or the even numbers, chosen by a
+  /// pseudorandom sequence with a fixed seed, so the result is
+  /// deterministic for a given order of updates and merges.
+  class EXPORT_SYMBOL QuantileSketch {
+  public:
+    /// @brief Creates an empty QuantileSketch.
+    ///
+    /// @param k Accuracy parameter: the capacity of the largest compactor.
+    /// Must be at least `2`.
+    QuantileSketch(int64_t k);
+
+    /// @brief Accuracy parameter: the capacity of the largest compactor.
+    int64_t
+      k() const;
+
+    /// @brief The number of values that have been added (including through
+    /// #merge).
+    int64_t
+      count() const;
+
+    /// @brief The number of values retained by the sketch.
+    int64_t
+      size() const;
+
+    /// @brief Adds one value; `NaN` is ignored.
+    void
+      update(double x);
+
+    /// @brief Adds all of the values summarized by `other`.
+    ///
+    /// The two sketches need not have the same #k; the result has this
+    /// sketch's #k.
+    void
+      merge(const QuantileSketch& other);
+
+    /// @brief The retained value at weighted rank `q` times the #count,
+    /// rounded down (NumPy's `interpolation="lower"`, applied to the
+    /// retained values); `NaN` if no values have been added.
+    ///
+    /// @param q Fraction of the distribution, from `0` to `1`.
+    double
+      quantile(double q) const;
+
+  private:
+    /// @brief The number of values that the compactor at `level` may hold
+    /// before it is compacted.
+    int64_t
+      capacity(size_t level) const;
+
+    /// @brief Compacts every compactor that is over capacity.
+    void
+      compress();
+
+    /// @brief Returns `0` or `1` pseudorandomly, from a fixed seed.
+    int64_t
+      flip();
+
+    /// @brief See #k.
+    const int64_t k_;
+    /// @brief See #count.
+    int64_t count_;
+    /// @brief See #size.
+    int64_t size_;
+    /// @brief Sum of the #capacity of all levels.
+    int64_t maxsize_;
+    /// @brief State of the pseudorandom choice between keeping the even
+    /// or the odd values in a compaction.
+    uint64_t coins_;
+    /// @brief Compactors; values at level `h` have weight `2**h`.
+    std::vector<std::vector<double>> levels_;
+  };
+
+  /// @class ReducerQuantile
+  ///
+  /// @brief Reducer algorithm that returns an approximate quantile (e.g.
+  /// the median for `q = 0.5`) as a `double`, from a QuantileSketch of each
+  /// group. Empty groups are `NaN`.
+  ///
+  /// Unlike the other reducers, this one has parameters: `q` and the
+  /// accuracy of the sketches, `k`. Groups with fewer than `k` values are
+  /// never compacted, so their quantiles are exact.
+  class EXPORT_SYMBOL ReducerQuantile: public Reducer {
+  public:
+    /// @brief Creates a ReducerQuantile.
+    ///
+    /// @param q Fraction of the distribution, from `0` to `1`.
+    /// @param k Accuracy of each QuantileSketch.
+    ReducerQuantile(double q, int64_t k);
+
+    /// @brief Fraction of the distribution, from `0` to `1`.
+    double
+      q() const;
+
+    /// @brief Accuracy of each QuantileSketch.
+    int64_t
+      k() const;
+
+    /// @brief Name of the reducer algorithm: `"quantile"`.
+    const std::string
+      name() const override;
+
+    /// @brief The #q and #k of this reducer.
+    const std::string
+      options() const override;
+
+    /// @copydoc Reducer::preferred_type()
+    ///
+    /// The preferred type for ReducerQuantile is `double`: `"d"`, 8 bytes.
+    const std::string
+      preferred_type() const override;
+
+    /// @copydoc Reducer::preferred_typesize()
+    ///
+    /// The preferred type for ReducerQuantile is `double`: `"d"`, 8 bytes.
+    ssize_t
+      preferred_typesize() const override;
+
+    /// @copydoc Reducer::return_type()
+    ///
+    /// The return type for ReducerQuantile is `double`: `"d"`, 8 bytes.
+    const std::string
+      return_type(const std::string& given_type) const override;
+
+    /// @copydoc Reducer::return_typesize()
+    ///
+    /// The return type for ReducerQuantile is `double`: `"d"`, 8 bytes.
+    ssize_t
+      return_typesize(const std::string& given_type) const override;
+
+    const std::shared_ptr<void>
+      apply_bool(const bool* data,
+                 int64_t offset,
+                 const Index64& starts,
+                 const Index64& parents,
+                 int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8(const int8_t* data,
+                 int64_t offset,
+                 const Index64& starts,
+                 const Index64& parents,
+                 int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8(const uint8_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16(const int16_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16(const uint16_t* data,
+                   int64_t offset,
+                   const Index64& starts,
+                   const Index64& parents,
+                   int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32(const int32_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32(const uint32_t* data,
+                   int64_t offset,
+                   const Index64& starts,
+                   const Index64& parents,
+                   int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64(const int64_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64(const uint64_t* data,
+                   int64_t offset,
+                   const Index64& starts,
+                   const Index64& parents,
+                   int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32(const float* data,
+                    int64_t offset,
+                    const Index64& starts,
+                    const Index64& parents,
+                    int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64(const double* data,
+                    int64_t offset,
+                    const Index64& starts,
+                    const Index64& parents,
+                    int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+  private:
+    /// @brief See #q.
+    const double q_;
+    /// @brief See #k.
+    const int64_t k_;
+  };
+
+  /// @class HyperLogLog
+  ///
+  /// @brief Mergeable summary of a stream of hashes from which the number
+  /// of distinct values can be estimated, using the HyperLogLog algorithm
+  /// (Flajolet, Fusy, Gandouet, and Meunier, 2007).
+  ///
+  /// The sketch has `2**precision` one-byte registers, and the standard
+  /// error of the #estimate is about `1.04/sqrt(2**precision)`. Until the
+  /// sketch has seen about `2**precision / 16` distinct hashes, it keeps
+  /// the hashes themselves instead (no larger than the registers), so small
+  /// counts are exact up to hash collisions and many small sketches are
+  /// cheap.
+  ///
+  /// Values must be hashed first, for instance with
+  /// {@link NumpyArray#hash64 NumpyArray::hash64} or the `hash64` of a list
+  /// of strings.
+  class EXPORT_SYMBOL HyperLogLog {
+  public:
+    /// @brief Creates an empty HyperLogLog.
+    ///
+    /// @param precision Base-2 logarithm of the number of registers, from
+    /// `4` to `18`.
+    HyperLogLog(int64_t precision);
+
+    /// @brief Base-2 logarithm of the number of registers.
+    int64_t
+      precision() const;
+
+    /// @brief Adds one hashed value.
+    void
+      update(uint64_t hash);
+
+    /// @brief Adds all of the hashes summarized by `other`, which must have
+    /// the same #precision.
+    void
+      merge(const HyperLogLog& other);
+
+    /// @brief Estimated number of distinct hashes that have been added.
+    double
+      estimate() const;
+
+  private:
+    /// @brief Sorts and deduplicates #sparse_, switching to #registers_ if
+    /// it is still too large.
+    void
+      normalize();
+
+    /// @brief Moves the hashes in #sparse_ into #registers_.
+    void
+      densify();
+
+    /// @brief Updates the register for one hash.
+    void
+      update_register(uint64_t hash);
+
+    /// @brief See #precision.
+    const int64_t precision_;
+    /// @brief Hashes seen so far, while the sketch is sparse.
+    std::vector<uint64_t> sparse_;
+    /// @brief Maximum rank per register; empty while the sketch is sparse.
+    std::vector<uint8_t> registers_;
+  };
+
+  /// @class ReducerCountDistinct
+  ///
+  /// @brief Reducer algorithm that estimates the number of distinct values,
+  /// from a HyperLogLog of each group. The identity is `0`.
+  ///
+  /// Unlike most reducers, this one has a parameter: the `precision` of the
+  /// sketches. Values are hashed with {@link NumpyArray#hash64
+  /// NumpyArray::hash64}'s kernels, so integers are counted by value,
+  /// regardless of their type.
+  class EXPORT_SYMBOL ReducerCountDistinct: public Reducer {
+  public:
+    /// @brief Creates a ReducerCountDistinct.
+    ///
+    /// @param precision Precision of each HyperLogLog.
+    ReducerCountDistinct(int64_t precision);
+
+    /// @brief Precision of each HyperLogLog.
+    int64_t
+      precision() const;
+
+    /// @brief Name of the reducer algorithm: `"count_distinct"`.
+    const std::string
+      name() const override;
+
+    /// @brief The #precision of this reducer.
+    const std::string
+      options() const override;
+
+    /// @copydoc Reducer::preferred_type()
+    ///
+    /// The preferred type for ReducerCountDistinct is `double`: `"d"`, 8
+    /// bytes.
+    const std::string
+      preferred_type() const override;
+
+    /// @copydoc Reducer::preferred_typesize()
+    ///
+    /// The preferred type for ReducerCountDistinct is `double`: `"d"`, 8
+    /// bytes.
+    ssize_t
+      preferred_typesize() const override;
+
+    /// @copydoc Reducer::return_type()
+    ///
+    /// The return type for ReducerCountDistinct is `int64`: `"q"` (32-bit
+    /// systems or Windows) or `"l"` (other systems), 8 bytes.
+    const std::string
+      return_type(const std::string& given_type) const override;
+
+    /// @copydoc Reducer::return_typesize()
+    ///
+    /// The return type for ReducerCountDistinct is `int64`: `"q"` (32-bit
+    /// systems or Windows) or `"l"` (other systems), 8 bytes.
+    ssize_t
+      return_typesize(const std::string& given_type) const override;
+
+    const std::shared_ptr<void>
+      apply_bool(const bool* data,
+                 int64_t offset,
+                 const Index64& starts,
+                 const Index64& parents,
+                 int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int8(const int8_t* data,
+                 int64_t offset,
+                 const Index64& starts,
+                 const Index64& parents,
+                 int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint8(const uint8_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int16(const int16_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint16(const uint16_t* data,
+                   int64_t offset,
+                   const Index64& starts,
+                   const Index64& parents,
+                   int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int32(const int32_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint32(const uint32_t* data,
+                   int64_t offset,
+                   const Index64& starts,
+                   const Index64& parents,
+                   int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_int64(const int64_t* data,
+                  int64_t offset,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_uint64(const uint64_t* data,
+                   int64_t offset,
+                   const Index64& starts,
+                   const Index64& parents,
+                   int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float32(const float* data,
+                    int64_t offset,
+                    const Index64& starts,
+                    const Index64& parents,
+                    int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_float64(const double* data,
+                    int64_t offset,
+                    const Index64& starts,
+                    const Index64& parents,
+                    int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_bool(const bool* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int8(const int8_t* data,
+                         int64_t offset,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides,
+                         int64_t axis,
+                         int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int16(const int16_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int32(const int32_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_int64(const int64_t* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const std::vector<ssize_t>& shape,
+                           const std::vector<ssize_t>& strides,
+                           int64_t axis,
+                           int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float32(const float* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+    const std::shared_ptr<void>
+      apply_strided_float64(const double* data,
+                            int64_t offset,
+                            const std::vector<ssize_t>& shape,
+                            const std::vector<ssize_t>& strides,
+                            int64_t axis,
+                            int64_t outlength) const override;
+
+  private:
+    /// @brief See #precision.
+    const int64_t precision_;
   };
 
 }
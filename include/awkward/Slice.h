@@ -649,6 +649,19 @@ namespace awkward {
     bool
       isadvanced() const;
 
+    /// @brief Returns `true` if any of the #items is a SliceArrayOf,
+    /// SliceMissingOf, or SliceJaggedOf; `false` otherwise.
+    bool
+      hasarrays() const;
+
+    /// @brief A 64-bit hash of this Slice, including the full contents of
+    /// its arrays (which #tostring abbreviates).
+    ///
+    /// Used to memoize {@link Content#getitem Content::getitem} (see
+    /// {@link Content#memoized Content::memoized}).
+    uint64_t
+      fingerprint() const;
+
   private:
     /// @brief See #items.
     std::vector<SliceItemPtr> items_;
@@ -235,6 +235,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// @copydoc Content::length()
     ///
     /// Note that this is an input parameter.
@@ -355,6 +358,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
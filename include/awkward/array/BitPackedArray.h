@@ -0,0 +1,311 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_BITPACKEDARRAY_H_
+#define AWKWARD_BITPACKEDARRAY_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/Slice.h"
+#include "awkward/Index.h"
+#include "awkward/Content.h"
+
+namespace awkward {
+  /// @class BitPackedArray
+  ///
+  /// @brief Represents an array of booleans with one bit per value, rather
+  /// than one byte, using the same bit conventions as BitMaskedArray.
+  ///
+  /// It has the same type and Form as the NumpyArray of `bool` it
+  /// represents. Used as a slice (a mask), it selects elements without
+  /// being unpacked (see #asslice). Ranges that start on a byte boundary
+  /// and carrying (any selection of elements) return another
+  /// BitPackedArray; other operations unpack the values with
+  /// #toNumpyArray.
+  ///
+  /// A boolean NumpyArray can be packed with
+  /// {@link NumpyArray#toBitPackedArray NumpyArray::toBitPackedArray}.
+  ///
+  /// See #BitPackedArray for the meaning of each parameter.
+  class EXPORT_SYMBOL BitPackedArray: public Content {
+  public:
+    /// @brief Creates a BitPackedArray from a full set of parameters.
+    ///
+    /// @param identities Optional Identities for each element of the array
+    /// (may be `nullptr`).
+    /// @param parameters String-to-JSON map that augments the meaning of this
+    /// array.
+    /// @param bits Bit-packed values; must have at least `ceil(length / 8.0)`
+    /// bytes.
+    /// @param length Number of elements in the array.
+    /// @param lsb_order If `true`, the bits in each byte of #bits are
+    /// taken to be in
+    /// [Least Significant Bit (LSB)](https://en.wikipedia.org/wiki/Bit_numbering#LSB_0_bit_numbering)
+    /// order; if `false`, they are taken to be in
+    /// [Most Significant Bit (MSB)](https://en.wikipedia.org/wiki/Bit_numbering#MSB_0_bit_numbering)
+    /// order.
+    BitPackedArray(const IdentitiesPtr& identities,
+                   const util::Parameters& parameters,
+                   const IndexU8& bits,
+                   int64_t length,
+                   bool lsb_order);
+
+    /// @brief Bit-packed values; must have at least `ceil(length / 8.0)`
+    /// bytes.
+    const IndexU8
+      bits() const;
+
+    /// @brief If `true`, the bits in each byte of #bits are
+    /// taken to be in
+    /// [Least Significant Bit (LSB)](https://en.wikipedia.org/wiki/Bit_numbering#LSB_0_bit_numbering)
+    /// order; if `false`, they are taken to be in
+    /// [Most Significant Bit (MSB)](https://en.wikipedia.org/wiki/Bit_numbering#MSB_0_bit_numbering)
+    /// order.
+    bool
+      lsb_order() const;
+
+    /// @brief The number of `true` values.
+    int64_t
+      numtrue() const;
+
+    /// @brief The array as a NumpyArray of `bool`, which allocates a buffer
+    /// of one byte per value.
+    const ContentPtr
+      toNumpyArray() const;
+
+    /// @brief Same as #toNumpyArray, for symmetry with the other arrays that
+    /// are materialized on demand.
+    const ContentPtr
+      array() const;
+
+    /// @brief User-friendly name of this class: `"BitPackedArray"`.
+    const std::string
+      classname() const override;
+
+    void
+      setidentities() override;
+
+    void
+      setidentities(const IdentitiesPtr& identities) override;
+
+    const TypePtr
+      type(const util::TypeStrs& typestrs) const override;
+
+    const FormPtr
+      form(bool materialize) const override;
+
+    bool
+      has_virtual_form() const override;
+
+    bool
+      has_virtual_length() const override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+    void
+      tojson_part(ToJson& builder, bool include_beginendlist) const override;
+
+    void
+      nbytes_part(std::map<size_t, int64_t>& largest) const override;
+
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
+    int64_t
+      length() const override;
+
+    const ContentPtr
+      shallow_copy() const override;
+
+    const ContentPtr
+      deep_copy(bool copyarrays,
+                bool copyindexes,
+                bool copyidentities) const override;
+
+    void
+      check_for_iteration() const override;
+
+    const ContentPtr
+      getitem_nothing() const override;
+
+    const ContentPtr
+      getitem_at(int64_t at) const override;
+
+    const ContentPtr
+      getitem_at_nowrap(int64_t at) const override;
+
+    const ContentPtr
+      getitem_range(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_range_nowrap(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_field(const std::string& key) const override;
+
+    const ContentPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
+    const ContentPtr
+      getitem_next(const SliceItemPtr& head,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      carry(const Index64& carry) const override;
+
+    const std::string
+      purelist_parameter(const std::string& key) const override;
+
+    int64_t
+      numfields() const override;
+
+    int64_t
+      fieldindex(const std::string& key) const override;
+
+    const std::string
+      key(int64_t fieldindex) const override;
+
+    bool
+      haskey(const std::string& key) const override;
+
+    const std::vector<std::string>
+      keys() const override;
+
+    // operations
+    const std::string
+      validityerror(const std::string& path) const override;
+
+    const ContentPtr
+      shallow_simplify() const override;
+
+    const ContentPtr
+      num(int64_t axis, int64_t depth) const override;
+
+    const std::pair<Index64, ContentPtr>
+      offsets_and_flattened(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      materialized() const override;
+
+    bool
+      mergeable(const ContentPtr& other, bool mergebool) const override;
+
+    /// @copydoc Content::merge
+    ///
+    /// If the merge of #toNumpyArray is boolean, it is packed again with
+    /// this array's #lsb_order.
+    const ContentPtr
+      merge(const ContentPtr& other) const override;
+
+    /// @copydoc Content::asslice
+    ///
+    /// Counts the true values with a population count of each word of
+    /// #bits and finds them by scanning for set bits, skipping words with
+    /// none, without unpacking the array.
+    const SliceItemPtr
+      asslice() const override;
+
+    const ContentPtr
+      fillna(const ContentPtr& value) const override;
+
+    const ContentPtr
+      rpad(int64_t target, int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      rpad_and_clip(int64_t target,
+                    int64_t axis,
+                    int64_t depth) const override;
+
+    const ContentPtr
+      reduce_next(const Reducer& reducer,
+                  int64_t negaxis,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength,
+                  bool mask,
+                  bool keepdims) const override;
+
+    const ContentPtr
+      localindex(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      combinations(int64_t n,
+                   bool replacement,
+                   const util::RecordLookupPtr& recordlookup,
+                   const util::Parameters& parameters,
+                   int64_t axis,
+                   int64_t depth) const override;
+
+    /// @copydoc Content::packed
+    ///
+    /// Returns a BitPackedArray whose #bits have exactly
+    /// `ceil(length / 8.0)` bytes.
+    const ContentPtr
+      packed() const override;
+
+    const ContentPtr
+      getitem_next(const SliceAt& at,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceRange& range,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceArray64& array,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceField& field,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceFields& fields,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceJagged64& jagged,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceArray64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceMissing64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceJagged64& slicecontent,
+                          const Slice& tail) const override;
+
+  private:
+    /// @brief See #bits.
+    const IndexU8 bits_;
+    /// @brief See #length.
+    const int64_t length_;
+    /// @brief See #lsb_order.
+    const bool lsb_order_;
+  };
+
+}
+
+#endif // AWKWARD_BITPACKEDARRAY_H_
@@ -204,6 +204,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// @copydoc Content::length()
     ///
     /// Equal to `len(mask)`.
@@ -324,6 +327,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -0,0 +1,292 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_CONSTANTARRAY_H_
+#define AWKWARD_CONSTANTARRAY_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/Slice.h"
+#include "awkward/Content.h"
+
+namespace awkward {
+  class NumpyArray;
+
+  /// @class ConstantArray
+  ///
+  /// @brief Represents an array in which every element has the same value,
+  /// storing the value only once.
+  ///
+  /// It has the same type and Form as the NumpyArray it represents; the
+  /// difference is only in storage. Slicing and carrying (any selection of
+  /// elements) return another ConstantArray, merging with an equal constant
+  /// returns a ConstantArray, and `count`, `sum`, `min`, and `max` are
+  /// computed in closed form. Other operations see #array, a NumpyArray
+  /// view with a zero stride, so a buffer of repeated values is only
+  /// allocated by #toNumpyArray, when an operation really needs one.
+  ///
+  /// See #ConstantArray for the meaning of each parameter.
+  class EXPORT_SYMBOL ConstantArray: public Content {
+  public:
+    /// @brief Creates a ConstantArray from a full set of parameters.
+    ///
+    /// @param identities Optional Identities for each element of the array
+    /// (may be `nullptr`).
+    /// @param parameters String-to-JSON map that augments the meaning of this
+    /// array.
+    /// @param value NumpyArray of length `1` whose only element is repeated.
+    /// @param length Number of elements in the array.
+    ConstantArray(const IdentitiesPtr& identities,
+                  const util::Parameters& parameters,
+                  const ContentPtr& value,
+                  int64_t length);
+
+    /// @brief NumpyArray of length `1` whose only element is repeated.
+    const ContentPtr
+      value() const;
+
+    /// @brief The array as a NumpyArray whose first dimension has a zero
+    /// stride; nothing is allocated.
+    const ContentPtr
+      array() const;
+
+    /// @brief The array as a contiguous NumpyArray, which allocates a buffer
+    /// of #length copies of the #value.
+    const ContentPtr
+      toNumpyArray() const;
+
+    /// @brief User-friendly name of this class: `"ConstantArray"`.
+    const std::string
+      classname() const override;
+
+    void
+      setidentities() override;
+
+    void
+      setidentities(const IdentitiesPtr& identities) override;
+
+    const TypePtr
+      type(const util::TypeStrs& typestrs) const override;
+
+    const FormPtr
+      form(bool materialize) const override;
+
+    bool
+      has_virtual_form() const override;
+
+    bool
+      has_virtual_length() const override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+    void
+      tojson_part(ToJson& builder, bool include_beginendlist) const override;
+
+    /// @copydoc Content::nbytes_part
+    ///
+    /// Only the #value is counted, not #length copies of it.
+    void
+      nbytes_part(std::map<size_t, int64_t>& largest) const override;
+
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
+    int64_t
+      length() const override;
+
+    const ContentPtr
+      shallow_copy() const override;
+
+    const ContentPtr
+      deep_copy(bool copyarrays,
+                bool copyindexes,
+                bool copyidentities) const override;
+
+    void
+      check_for_iteration() const override;
+
+    const ContentPtr
+      getitem_nothing() const override;
+
+    const ContentPtr
+      getitem_at(int64_t at) const override;
+
+    const ContentPtr
+      getitem_at_nowrap(int64_t at) const override;
+
+    const ContentPtr
+      getitem_range(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_range_nowrap(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_field(const std::string& key) const override;
+
+    const ContentPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
+    const ContentPtr
+      getitem_next(const SliceItemPtr& head,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      carry(const Index64& carry) const override;
+
+    const std::string
+      purelist_parameter(const std::string& key) const override;
+
+    int64_t
+      numfields() const override;
+
+    int64_t
+      fieldindex(const std::string& key) const override;
+
+    const std::string
+      key(int64_t fieldindex) const override;
+
+    bool
+      haskey(const std::string& key) const override;
+
+    const std::vector<std::string>
+      keys() const override;
+
+    // operations
+    const std::string
+      validityerror(const std::string& path) const override;
+
+    const ContentPtr
+      shallow_simplify() const override;
+
+    const ContentPtr
+      num(int64_t axis, int64_t depth) const override;
+
+    const std::pair<Index64, ContentPtr>
+      offsets_and_flattened(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      materialized() const override;
+
+    bool
+      mergeable(const ContentPtr& other, bool mergebool) const override;
+
+    /// @copydoc Content::merge
+    ///
+    /// If `other` is a ConstantArray with an equal #value and parameters,
+    /// the result is a ConstantArray; otherwise, it is the merge of #array.
+    const ContentPtr
+      merge(const ContentPtr& other) const override;
+
+    const SliceItemPtr
+      asslice() const override;
+
+    const ContentPtr
+      fillna(const ContentPtr& value) const override;
+
+    const ContentPtr
+      rpad(int64_t target, int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      rpad_and_clip(int64_t target,
+                    int64_t axis,
+                    int64_t depth) const override;
+
+    /// @copydoc Content::reduce_next
+    ///
+    /// If the #value is one-dimensional, `count`, `sum`, `min`, and `max`
+    /// only count the number of elements in each group; other reducers are
+    /// applied to #array.
+    const ContentPtr
+      reduce_next(const Reducer& reducer,
+                  int64_t negaxis,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength,
+                  bool mask,
+                  bool keepdims) const override;
+
+    const ContentPtr
+      localindex(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      combinations(int64_t n,
+                   bool replacement,
+                   const util::RecordLookupPtr& recordlookup,
+                   const util::Parameters& parameters,
+                   int64_t axis,
+                   int64_t depth) const override;
+
+    /// @copydoc Content::packed
+    ///
+    /// Returns #toNumpyArray.
+    const ContentPtr
+      packed() const override;
+
+    const ContentPtr
+      getitem_next(const SliceAt& at,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceRange& range,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceArray64& array,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceField& field,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceFields& fields,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceJagged64& jagged,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceArray64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceMissing64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceJagged64& slicecontent,
+                          const Slice& tail) const override;
+
+  private:
+    /// @brief Returns `true` if `other` has an equal #value.
+    bool
+      value_equal(const ConstantArray& other) const;
+
+    /// @brief See #value.
+    const ContentPtr value_;
+    /// @brief See #length.
+    const int64_t length_;
+  };
+
+}
+
+#endif // AWKWARD_CONSTANTARRAY_H_
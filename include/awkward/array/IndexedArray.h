@@ -266,6 +266,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// @copydoc Content::length()
     ///
     /// Equal to `len(index)`.
@@ -388,6 +391,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -0,0 +1,299 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_INTERLEAVEDARRAY_H_
+#define AWKWARD_INTERLEAVEDARRAY_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/Slice.h"
+#include "awkward/Content.h"
+
+namespace awkward {
+  /// @class InterleavedArray
+  ///
+  /// @brief Represents an array of records or tuples whose fields are all
+  /// numbers of the same type, stored interleaved: all fields of the first
+  /// record, then all fields of the second, and so on.
+  ///
+  /// It has the same type and Form as the equivalent RecordArray; the
+  /// difference is only in storage. The #data is a two-dimensional
+  /// NumpyArray with a row for each record and a column for each field, so
+  /// reading several fields of one record touches one cache line, rather
+  /// than one per field.
+  ///
+  /// Extracting a field (#getitem_field) is a strided NumpyArray view of
+  /// one column, and ranges and carries of the array select whole rows, so
+  /// they remain interleaved. Other operations are performed on
+  /// #toRecordArray, which is a RecordArray of views into the #data.
+  ///
+  /// See #InterleavedArray for the meaning of each parameter.
+  class EXPORT_SYMBOL InterleavedArray: public Content {
+  public:
+    /// @brief Creates an InterleavedArray from a full set of parameters.
+    ///
+    /// @param identities Optional Identities for each element of the array
+    /// (may be `nullptr`).
+    /// @param parameters String-to-JSON map that augments the meaning of this
+    /// array.
+    /// @param data Two-dimensional NumpyArray of numbers with a row for each
+    /// record and a column for each field.
+    /// @param recordlookup A `std::shared_ptr<std::vector<std::string>>`
+    /// optional list of key names.
+    /// If absent (`nullptr`), the data are tuples; otherwise, they are
+    /// records. The number of names must match the number of columns.
+    InterleavedArray(const IdentitiesPtr& identities,
+                     const util::Parameters& parameters,
+                     const ContentPtr& data,
+                     const util::RecordLookupPtr& recordlookup);
+
+    /// @brief Two-dimensional NumpyArray of numbers with a row for each
+    /// record and a column for each field.
+    const ContentPtr
+      data() const;
+
+    /// @brief A `std::shared_ptr<std::vector<std::string>>`
+    /// optional list of key names.
+    /// If absent (`nullptr`), the data are tuples; otherwise, they are
+    /// records. The number of names must match the number of columns.
+    const util::RecordLookupPtr
+      recordlookup() const;
+
+    /// @brief Returns `true` if #recordlookup is `nullptr`; `false` otherwise.
+    bool
+      istuple() const;
+
+    /// @brief Returns the field at a given index as a strided NumpyArray
+    /// view of one column of the #data.
+    const ContentPtr
+      field(int64_t fieldindex) const;
+
+    /// @brief The array as a RecordArray whose fields are views of the
+    /// columns of the #data; nothing is copied.
+    const ContentPtr
+      toRecordArray() const;
+
+    /// @brief User-friendly name of this class: `"InterleavedArray"`.
+    const std::string
+      classname() const override;
+
+    void
+      setidentities() override;
+
+    void
+      setidentities(const IdentitiesPtr& identities) override;
+
+    const TypePtr
+      type(const util::TypeStrs& typestrs) const override;
+
+    const FormPtr
+      form(bool materialize) const override;
+
+    bool
+      has_virtual_form() const override;
+
+    bool
+      has_virtual_length() const override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+    void
+      tojson_part(ToJson& builder, bool include_beginendlist) const override;
+
+    void
+      nbytes_part(std::map<size_t, int64_t>& largest) const override;
+
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
+    int64_t
+      length() const override;
+
+    const ContentPtr
+      shallow_copy() const override;
+
+    const ContentPtr
+      deep_copy(bool copyarrays,
+                bool copyindexes,
+                bool copyidentities) const override;
+
+    void
+      check_for_iteration() const override;
+
+    const ContentPtr
+      getitem_nothing() const override;
+
+    const ContentPtr
+      getitem_at(int64_t at) const override;
+
+    const ContentPtr
+      getitem_at_nowrap(int64_t at) const override;
+
+    const ContentPtr
+      getitem_range(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_range_nowrap(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_field(const std::string& key) const override;
+
+    const ContentPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
+    const ContentPtr
+      getitem_next(const SliceItemPtr& head,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      carry(const Index64& carry) const override;
+
+    const std::string
+      purelist_parameter(const std::string& key) const override;
+
+    int64_t
+      numfields() const override;
+
+    int64_t
+      fieldindex(const std::string& key) const override;
+
+    const std::string
+      key(int64_t fieldindex) const override;
+
+    bool
+      haskey(const std::string& key) const override;
+
+    const std::vector<std::string>
+      keys() const override;
+
+    // operations
+    const std::string
+      validityerror(const std::string& path) const override;
+
+    const ContentPtr
+      shallow_simplify() const override;
+
+    const ContentPtr
+      num(int64_t axis, int64_t depth) const override;
+
+    const std::pair<Index64, ContentPtr>
+      offsets_and_flattened(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      materialized() const override;
+
+    bool
+      mergeable(const ContentPtr& other, bool mergebool) const override;
+
+    /// @copydoc Content::merge
+    ///
+    /// If `other` is an InterleavedArray with the same keys and parameters,
+    /// the result is an InterleavedArray; otherwise, it is the merge of
+    /// #toRecordArray.
+    const ContentPtr
+      merge(const ContentPtr& other) const override;
+
+    const SliceItemPtr
+      asslice() const override;
+
+    const ContentPtr
+      fillna(const ContentPtr& value) const override;
+
+    const ContentPtr
+      rpad(int64_t target, int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      rpad_and_clip(int64_t target,
+                    int64_t axis,
+                    int64_t depth) const override;
+
+    const ContentPtr
+      reduce_next(const Reducer& reducer,
+                  int64_t negaxis,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength,
+                  bool mask,
+                  bool keepdims) const override;
+
+    const ContentPtr
+      localindex(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      combinations(int64_t n,
+                   bool replacement,
+                   const util::RecordLookupPtr& recordlookup,
+                   const util::Parameters& parameters,
+                   int64_t axis,
+                   int64_t depth) const override;
+
+    /// @copydoc Content::packed
+    ///
+    /// Returns an InterleavedArray with contiguous #data.
+    const ContentPtr
+      packed() const override;
+
+    const ContentPtr
+      getitem_next(const SliceAt& at,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceRange& range,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceArray64& array,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceField& field,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceFields& fields,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceJagged64& jagged,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceArray64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceMissing64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceJagged64& slicecontent,
+                          const Slice& tail) const override;
+
+  private:
+    /// @brief See #data.
+    const ContentPtr data_;
+    /// @brief See #recordlookup.
+    const util::RecordLookupPtr recordlookup_;
+  };
+
+}
+
+#endif // AWKWARD_INTERLEAVEDARRAY_H_
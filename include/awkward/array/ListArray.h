@@ -198,6 +198,31 @@ namespace awkward {
     const ContentPtr
       toListOffsetArray64(bool start_at_zero) const;
 
+    /// @brief Returns this array as a
+    /// {@link ListOffsetArrayOf ListOffsetArray} with
+    /// {@link ListOffsetArrayOf#offsets offsets} of the same type `T` as
+    /// #starts and #stops, starting with `offsets[0] = 0`.
+    ///
+    /// If the total length of the lists does not fit in `T`, this falls back
+    /// to #toListOffsetArray64.
+    ///
+    /// @param start_at_zero If `true`, the first offset will be `0`, meaning
+    /// there are no "unreachable" elements in the `content` that corresponds
+    /// to these offsets.
+    const ContentPtr
+      toListOffsetArray(bool start_at_zero) const;
+
+    /// @brief A NumpyArray of 64-bit hashes of the bytes of each list, for
+    /// lists of strings (or of any one-dimensional NumpyArray).
+    ///
+    /// Equal lists of equal type have equal hashes, so these can stand in
+    /// for strings when counting distinct values (see HyperLogLog).
+    ///
+    /// @exception std::invalid_argument is thrown if the #content is not a
+    /// one-dimensional NumpyArray.
+    const ContentPtr
+      hash64() const;
+
     /// @brief User-friendly name of this class: `"ListArray32"`,
     /// `"ListArrayU32"`, or `"ListArray64"`.
     const std::string
@@ -232,6 +257,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// @copydoc Content::length()
     ///
     /// Equal to `len(starts)`.
@@ -273,6 +301,9 @@ namespace awkward {
     const ContentPtr
       carry(const Index64& carry) const override;
 
+    const ContentPtr
+      carry(const Index32& carry) const override;
+
     int64_t
       numfields() const override;
 
@@ -345,6 +376,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -383,6 +417,13 @@ namespace awkward {
                           const SliceJagged64& slicecontent,
                           const Slice& tail) const override;
 
+  protected:
+    /// @brief Internal function that implements #carry for 32-bit and
+    /// 64-bit `carry` indexes.
+    template <typename C>
+    const ContentPtr
+      carry_generic(const IndexOf<C>& carry) const;
+
   private:
     /// @brief See #starts.
     const IndexOf<T> starts_;
@@ -156,6 +156,18 @@ namespace awkward {
     Index64
       compact_offsets64(bool start_at_zero) const;
 
+    /// @brief Returns offsets with the same integer type as #offsets,
+    /// possibly starting with `offsets[0] = 0`.
+    ///
+    /// Like #compact_offsets64, this does not copy #offsets if they already
+    /// satisfy the constraint, but 32-bit offsets stay 32-bit.
+    ///
+    /// @param start_at_zero If `true`, the first offset will be `0`, meaning
+    /// there are no "unreachable" elements in the `content` that corresponds
+    /// to these offsets.
+    IndexOf<T>
+      compact_offsets(bool start_at_zero) const;
+
     /// @brief Moves #content elements if necessary to match a given set of
     /// `offsets` and return a {@link ListOffsetArrayOf ListOffsetArray} that
     /// matches.
@@ -179,6 +191,39 @@ namespace awkward {
     const ContentPtr
       toListOffsetArray64(bool start_at_zero) const;
 
+    /// @brief A NumpyArray of 64-bit hashes of the bytes of each list, for
+    /// lists of strings (or of any one-dimensional NumpyArray).
+    ///
+    /// Equal lists of equal type have equal hashes, so these can stand in
+    /// for strings when counting distinct values (see HyperLogLog).
+    ///
+    /// @exception std::invalid_argument is thrown if the #content is not a
+    /// one-dimensional NumpyArray.
+    const ContentPtr
+      hash64() const;
+
+    /// @brief Sliding-window reduction within each list: a
+    /// ListOffsetArray64 of the same lengths whose item `j` reduces the
+    /// last `window` items of its list up to and including `j` (fewer at
+    /// the start of each list).
+    ///
+    /// Each list is a single pass: `"sum"` and `"mean"` add the item
+    /// entering and subtract the item leaving the window (with compensated
+    /// summation) and `"min"` and `"max"` keep a monotonic deque, so the
+    /// cost does not depend on `window`.
+    ///
+    /// @param reducer One of `"sum"`, `"mean"`, `"min"`, or `"max"`.
+    /// @param window Number of items in a full window; must be positive.
+    ///
+    /// The values are reduced as float64. Any NaN in a window makes its
+    /// sum or mean NaN; `"min"` and `"max"` skip NaN (and are NaN only if
+    /// the window has nothing else).
+    ///
+    /// @exception std::invalid_argument is thrown if the #content is not a
+    /// one-dimensional NumpyArray.
+    const ContentPtr
+      rolling(const std::string& reducer, int64_t window) const;
+
     /// @brief User-friendly name of this class: `"ListOffsetArray32"`,
     /// `"ListOffsetArrayU32"`, or `"ListOffsetArray64"`.
     const std::string
@@ -213,6 +258,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// @copydoc Content::length()
     ///
     /// Equal to `len(offsets) - 1`.
@@ -260,6 +308,9 @@ namespace awkward {
     const ContentPtr
       carry(const Index64& carry) const override;
 
+    const ContentPtr
+      carry(const Index32& carry) const override;
+
     int64_t
       numfields() const override;
 
@@ -332,6 +383,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -370,6 +424,13 @@ namespace awkward {
                           const SliceJagged64& slicecontent,
                           const Slice& tail) const override;
 
+  protected:
+    /// @brief Internal function that implements #carry for 32-bit and
+    /// 64-bit `carry` indexes.
+    template <typename C>
+    const ContentPtr
+      carry_generic(const IndexOf<C>& carry) const;
+
   private:
     /// @brief See #offsets.
     const IndexOf<T> offsets_;
@@ -67,6 +67,10 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    /// @exception std::runtime_error is always thrown
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// Always returns `-1`.
     int64_t
       length() const override;
@@ -201,6 +205,10 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    /// @exception std::runtime_error is always thrown
+    const ContentPtr
+      packed() const override;
+
     /// @exception std::runtime_error is always thrown
     const ContentPtr
       getitem_next(const SliceAt& at,
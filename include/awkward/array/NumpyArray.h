@@ -362,6 +362,60 @@ namespace awkward {
     const ContentPtr
       toRegularArray() const;
 
+    /// @brief This one-dimensional boolean array as a BitPackedArray, with
+    /// one bit per value, rather than one byte.
+    ///
+    /// @param lsb_order If `true`, the bits in each byte are in
+    /// Least Significant Bit (LSB) order; if `false`, they are in
+    /// Most Significant Bit (MSB) order.
+    const ContentPtr
+      toBitPackedArray(bool lsb_order) const;
+
+    /// @brief A contiguous copy of this array with its values converted to
+    /// another `format`, without going through NumPy.
+    ///
+    /// Any boolean, integer, or floating-point format (including `"e"`,
+    /// float16) may be converted to any other, with C's conversion rules,
+    /// like NumPy's `astype`: narrowing integers wraps around and
+    /// floating-point numbers are truncated toward zero, except that
+    /// unsigned 64-bit integers larger than the largest signed 64-bit
+    /// integer raise an error instead of wrapping, as #merge requires.
+    ///
+    /// Conversions to `"e"` round to the nearest value (from `"d"`
+    /// directly, not through `"f"`). On x86 CPUs with F16C instructions,
+    /// detected at run time, conversions from `"e"` and from `"f"` to
+    /// `"e"` are vectorized.
+    ///
+    /// If `format` is already the #format, this array is returned without
+    /// copying, unless it is not contiguous, in which case it is a
+    /// #contiguous copy.
+    const ContentPtr
+      astype(const std::string& format) const;
+
+    /// @brief A NumpyArray of the same #shape with a 64-bit hash of each
+    /// value, in the platform's unsigned 64-bit integer format.
+    ///
+    /// Integers and booleans are hashed by value, so equal values in
+    /// different integer formats have equal hashes; floating-point numbers
+    /// are hashed by their bits as double-precision, so `0.0` and `-0.0`
+    /// are equal, but `1.0` and `1` are not.
+    const ContentPtr
+      hash64() const;
+
+    /// @brief A NumpyArray of the same #shape with the index at which each
+    /// value would be inserted into `edges` to keep it sorted, in the
+    /// platform's 64-bit integer format (like NumPy's `searchsorted`).
+    ///
+    /// @param edges Bin edges, in non-decreasing order.
+    /// @param right If `false`, each index is the first suitable position
+    /// (number of edges less than the value); if `true`, the last (number of
+    /// edges less than or equal to the value).
+    ///
+    /// Values are compared as double-precision; NaN is placed after all
+    /// edges. Booleans and other non-numeric formats are not allowed.
+    const ContentPtr
+      searchsorted(const std::vector<double>& edges, bool right) const;
+
     /// @brief Returns `true` if the #shape is zero-dimensional; `false` otherwise.
     bool
       isscalar() const override;
@@ -399,6 +453,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     int64_t
       length() const override;
 
@@ -445,6 +502,9 @@ namespace awkward {
     const ContentPtr
       carry(const Index64& carry) const override;
 
+    const ContentPtr
+      carry(const Index32& carry) const override;
+
     int64_t
       numfields() const override;
 
@@ -516,6 +576,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     /// @brief Returns `true` if this array is contiguous; `false` otherwise.
     ///
     /// An array is "contiguous" if
@@ -547,6 +610,18 @@ namespace awkward {
     const NumpyArray
       contiguous() const;
 
+    /// @brief This array if all of its items can be reached in row-major
+    /// order by a single stride; otherwise, a #contiguous copy.
+    ///
+    /// @param itemstride Set to the distance between consecutive items, in
+    /// units of #itemsize (`1` for a contiguous copy; it may be zero or
+    /// negative for broadcasted or reversed views).
+    ///
+    /// Kernels that take a `fromstride` can read the result in place, so
+    /// arrays sliced with a step (such as `x[::2]`) are not copied.
+    const NumpyArray
+      flatstrided(int64_t& itemstride) const;
+
     /// @brief Inhibited general function (see 7 argument `getitem_next`
     /// specific to NumpyArray).
     const ContentPtr
@@ -590,11 +665,27 @@ namespace awkward {
                    const Index64& advanced) const override;
 
   protected:
+    /// @brief Internal function that implements #carry for 32-bit and
+    /// 64-bit `carry` indexes.
+    template <typename C>
+    const ContentPtr
+      carry_generic(const IndexOf<C>& carry) const;
+
     /// @brief Internal function to merge two byte arrays without promoting
     /// the types to int64.
     const ContentPtr
       merge_bytes(const std::shared_ptr<NumpyArray>& other) const;
 
+    /// @brief Internal function that converts all of the items of this array
+    /// (in row-major order) to `format` and writes them into `toptr`,
+    /// starting at item `tooffset`.
+    ///
+    /// See #astype for the supported conversions.
+    void
+      fill_as(const std::string& format,
+              const std::shared_ptr<void>& toptr,
+              int64_t tooffset) const;
+
     /// @brief Internal function that propagates the derivation of a contiguous
     /// version of this array from one axis to the next.
     ///
@@ -604,6 +695,28 @@ namespace awkward {
     const NumpyArray
       contiguous_next(const Index64& bytepos) const;
 
+    /// @brief Internal function that performs #reduce_next directly on the
+    /// strided data, without first making a contiguous copy.
+    ///
+    /// @param reducer The reducer algorithm.
+    /// @param axis The dimension of #shape to reduce; if `0`, all of the
+    /// `parents` must be `0`.
+    /// @param parents An integer array indicating which group each item of
+    /// the first dimension belongs to.
+    /// @param outlength The number of groups.
+    /// @param mask If `true`, the output is wrapped in a ByteMaskedArray.
+    /// @param keepdims If `true`, the reduced dimension is kept as a
+    /// RegularArray of size `1`.
+    ///
+    /// The output has the same structure as reducing #toRegularArray.
+    const ContentPtr
+      reduce_next_strided(const Reducer& reducer,
+                          int64_t axis,
+                          const Index64& parents,
+                          int64_t outlength,
+                          bool mask,
+                          bool keepdims) const;
+
     /// @brief Internal function that propagates a generic #getitem request
     /// through one axis by propagating strides (non-advanced indexing only).
     ///
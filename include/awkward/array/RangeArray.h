@@ -0,0 +1,310 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_RANGEARRAY_H_
+#define AWKWARD_RANGEARRAY_H_
+
+#include <string>
+#include <memory>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/Slice.h"
+#include "awkward/Content.h"
+
+namespace awkward {
+  /// @class RangeArray
+  ///
+  /// @brief Represents an array of 64-bit integers that increase (or
+  /// decrease) by a fixed step, like `numpy.arange`, without storing them.
+  ///
+  /// It has the same type and Form as the NumpyArray of `int64` it
+  /// represents. Ranges of a RangeArray are RangeArrays (as are carries of
+  /// contiguous positions), merging with the RangeArray that continues it
+  /// is a RangeArray, and using it to select elements of another array can
+  /// be a range slice, rather than a carry (see #asslicerange). Other
+  /// operations materialize the values with #toNumpyArray.
+  ///
+  /// {@link Content#localindex Content::localindex} at `axis=0` is a
+  /// RangeArray.
+  ///
+  /// See #RangeArray for the meaning of each parameter.
+  class EXPORT_SYMBOL RangeArray: public Content {
+  public:
+    /// @brief Creates a RangeArray from a full set of parameters.
+    ///
+    /// @param identities Optional Identities for each element of the array
+    /// (may be `nullptr`).
+    /// @param parameters String-to-JSON map that augments the meaning of this
+    /// array.
+    /// @param start The first value.
+    /// @param step The difference between consecutive values.
+    /// @param length Number of elements in the array.
+    RangeArray(const IdentitiesPtr& identities,
+               const util::Parameters& parameters,
+               int64_t start,
+               int64_t step,
+               int64_t length);
+
+    /// @brief Creates a RangeArray of `0, 1, ..., length - 1` with no
+    /// identities or parameters.
+    RangeArray(int64_t length);
+
+    /// @brief The first value.
+    int64_t
+      start() const;
+
+    /// @brief The difference between consecutive values.
+    int64_t
+      step() const;
+
+    /// @brief The value that would follow the last one:
+    /// `start + step*length`.
+    int64_t
+      stop() const;
+
+    /// @brief The array as a NumpyArray of `int64`, which allocates a buffer
+    /// of #length values.
+    const ContentPtr
+      toNumpyArray() const;
+
+    /// @brief Same as #toNumpyArray, for symmetry with the other arrays that
+    /// are materialized on demand.
+    const ContentPtr
+      array() const;
+
+    /// @brief Returns a SliceRange that selects the same elements as this
+    /// RangeArray would as an integer array (a carry), from an array of
+    /// length `target`, or `nullptr` if no SliceRange is equivalent.
+    ///
+    /// The SliceRange selects the same elements only if all values are
+    /// within `0 <= value < target` and #step is not `0`.
+    const SliceItemPtr
+      asslicerange(int64_t target) const;
+
+    /// @brief User-friendly name of this class: `"RangeArray"`.
+    const std::string
+      classname() const override;
+
+    void
+      setidentities() override;
+
+    void
+      setidentities(const IdentitiesPtr& identities) override;
+
+    const TypePtr
+      type(const util::TypeStrs& typestrs) const override;
+
+    const FormPtr
+      form(bool materialize) const override;
+
+    bool
+      has_virtual_form() const override;
+
+    bool
+      has_virtual_length() const override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+    void
+      tojson_part(ToJson& builder, bool include_beginendlist) const override;
+
+    /// @copydoc Content::nbytes_part
+    ///
+    /// A RangeArray has no buffers; only its Identities are counted.
+    void
+      nbytes_part(std::map<size_t, int64_t>& largest) const override;
+
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
+    int64_t
+      length() const override;
+
+    const ContentPtr
+      shallow_copy() const override;
+
+    const ContentPtr
+      deep_copy(bool copyarrays,
+                bool copyindexes,
+                bool copyidentities) const override;
+
+    void
+      check_for_iteration() const override;
+
+    const ContentPtr
+      getitem_nothing() const override;
+
+    const ContentPtr
+      getitem_at(int64_t at) const override;
+
+    const ContentPtr
+      getitem_at_nowrap(int64_t at) const override;
+
+    const ContentPtr
+      getitem_range(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_range_nowrap(int64_t start, int64_t stop) const override;
+
+    const ContentPtr
+      getitem_field(const std::string& key) const override;
+
+    const ContentPtr
+      getitem_fields(const std::vector<std::string>& keys) const override;
+
+    const ContentPtr
+      getitem_next(const SliceItemPtr& head,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      carry(const Index64& carry) const override;
+
+    const std::string
+      purelist_parameter(const std::string& key) const override;
+
+    int64_t
+      numfields() const override;
+
+    int64_t
+      fieldindex(const std::string& key) const override;
+
+    const std::string
+      key(int64_t fieldindex) const override;
+
+    bool
+      haskey(const std::string& key) const override;
+
+    const std::vector<std::string>
+      keys() const override;
+
+    // operations
+    const std::string
+      validityerror(const std::string& path) const override;
+
+    const ContentPtr
+      shallow_simplify() const override;
+
+    const ContentPtr
+      num(int64_t axis, int64_t depth) const override;
+
+    const std::pair<Index64, ContentPtr>
+      offsets_and_flattened(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      materialized() const override;
+
+    bool
+      mergeable(const ContentPtr& other, bool mergebool) const override;
+
+    /// @copydoc Content::merge
+    ///
+    /// If `other` is a RangeArray with the same #step and parameters that
+    /// starts at this array's #stop, the result is a RangeArray; otherwise,
+    /// it is the merge of #toNumpyArray.
+    const ContentPtr
+      merge(const ContentPtr& other) const override;
+
+    const SliceItemPtr
+      asslice() const override;
+
+    const ContentPtr
+      fillna(const ContentPtr& value) const override;
+
+    const ContentPtr
+      rpad(int64_t target, int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      rpad_and_clip(int64_t target,
+                    int64_t axis,
+                    int64_t depth) const override;
+
+    const ContentPtr
+      reduce_next(const Reducer& reducer,
+                  int64_t negaxis,
+                  const Index64& starts,
+                  const Index64& parents,
+                  int64_t outlength,
+                  bool mask,
+                  bool keepdims) const override;
+
+    const ContentPtr
+      localindex(int64_t axis, int64_t depth) const override;
+
+    const ContentPtr
+      combinations(int64_t n,
+                   bool replacement,
+                   const util::RecordLookupPtr& recordlookup,
+                   const util::Parameters& parameters,
+                   int64_t axis,
+                   int64_t depth) const override;
+
+    /// @copydoc Content::packed
+    ///
+    /// Returns #toNumpyArray.
+    const ContentPtr
+      packed() const override;
+
+    const ContentPtr
+      getitem_next(const SliceAt& at,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceRange& range,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceArray64& array,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceField& field,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceFields& fields,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next(const SliceJagged64& jagged,
+                   const Slice& tail,
+                   const Index64& advanced) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceArray64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceMissing64& slicecontent,
+                          const Slice& tail) const override;
+
+    const ContentPtr
+      getitem_next_jagged(const Index64& slicestarts,
+                          const Index64& slicestops,
+                          const SliceJagged64& slicecontent,
+                          const Slice& tail) const override;
+
+  private:
+    /// @brief See #start.
+    const int64_t start_;
+    /// @brief See #step.
+    const int64_t step_;
+    /// @brief See #length.
+    const int64_t length_;
+  };
+
+}
+
+#endif // AWKWARD_RANGEARRAY_H_
@@ -531,6 +531,13 @@ namespace awkward {
       }
     }
 
+    void
+      fingerprint_part(uint64_t& hash) const override {
+      util::fingerprint_combine(hash, (uint64_t)length_);
+      util::fingerprint_combine(hash, util::buffer_fingerprint(
+        ptr_, (int64_t)sizeof(T)*offset_, (int64_t)sizeof(T)*length_));
+    }
+
     const ContentPtr
       shallow_copy() const override {
       return std::make_shared<RawArrayOf<T>>(identities_, parameters_, ptr_,
@@ -951,6 +958,11 @@ namespace awkward {
       }
     }
 
+    const ContentPtr
+      packed() const override {
+      return deep_copy(true, false, false);
+    }
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -93,6 +93,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     int64_t
       length() const override;
 
@@ -221,6 +224,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     /// @brief Returns the field at a given index.
     ///
     /// Equivalent to `contents[fieldindex]`.
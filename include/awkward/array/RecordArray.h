@@ -201,6 +201,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// @copydoc Content::length()
     ///
     /// Note that this is an input parameter.
@@ -247,6 +250,9 @@ namespace awkward {
     const ContentPtr
       carry(const Index64& carry) const override;
 
+    const ContentPtr
+      carry(const Index32& carry) const override;
+
     int64_t
       numfields() const override;
 
@@ -318,6 +324,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     /// @brief Returns the field at a given index (without trimming it to
     /// have the same #length as this RecordArray).
     ///
@@ -349,6 +358,19 @@ namespace awkward {
     const std::shared_ptr<RecordArray>
       astuple() const;
 
+    /// @brief Returns `true` if this RecordArray has at least one field and
+    /// all of its fields are one-dimensional NumpyArrays of the same format,
+    /// without parameters, which can be stored as an InterleavedArray.
+    bool
+      isinterleavable() const;
+
+    /// @brief Copies the fields into an InterleavedArray, which stores all
+    /// fields of a record next to each other.
+    ///
+    /// Raises an error if not #isinterleavable.
+    const ContentPtr
+      toInterleavedArray() const;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -398,6 +420,12 @@ namespace awkward {
                           const Slice& tail) const override;
 
   protected:
+    /// @brief Internal function that implements #carry for 32-bit and
+    /// 64-bit `carry` indexes.
+    template <typename C>
+    const ContentPtr
+      carry_generic(const IndexOf<C>& carry) const;
+
     template <typename S>
     const ContentPtr
       getitem_next_jagged_generic(const Index64& slicestarts,
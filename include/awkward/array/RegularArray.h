@@ -12,6 +12,8 @@
 #include "awkward/Content.h"
 
 namespace awkward {
+  class NumpyArray;
+
   /// @class RegularForm
   ///
   /// @brief Form describing RegularArray.
@@ -184,6 +186,9 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     /// @copydoc Content::length()
     ///
     /// Equal to `floor(len(content) / size)`.
@@ -296,6 +301,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     const ContentPtr
       getitem_next(const SliceAt& at,
                    const Slice& tail,
@@ -335,6 +343,16 @@ namespace awkward {
                           const Slice& tail) const override;
 
   private:
+    /// @brief Returns a multidimensional NumpyArray that views the same
+    /// data, if the #content is a NumpyArray or a RegularArray of one;
+    /// otherwise, returns `nullptr`.
+    ///
+    /// This is the inverse of
+    /// {@link NumpyArray#toRegularArray NumpyArray::toRegularArray}, but
+    /// without copying.
+    const std::shared_ptr<NumpyArray>
+      numpy_view() const;
+
     const ContentPtr content_;
     int64_t size_;
   };
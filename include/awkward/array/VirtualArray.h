@@ -180,6 +180,12 @@ namespace awkward {
     void
       nbytes_part(std::map<size_t, int64_t>& largest) const override;
 
+    /// @copydoc Content::fingerprint_part
+    ///
+    /// Unlike #nbytes_part, this materializes the array.
+    void
+      fingerprint_part(uint64_t& hash) const override;
+
     int64_t
       length() const override;
 
@@ -249,6 +255,9 @@ namespace awkward {
     const std::pair<Index64, ContentPtr>
       offsets_and_flattened(int64_t axis, int64_t depth) const override;
 
+    const ContentPtr
+      materialized() const override;
+
     bool
       mergeable(const ContentPtr& other, bool mergebool) const override;
 
@@ -289,6 +298,9 @@ namespace awkward {
                    int64_t axis,
                    int64_t depth) const override;
 
+    const ContentPtr
+      packed() const override;
+
     const ContentPtr
       getitem(const Slice& where) const override;
 
@@ -0,0 +1,181 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_CHUNKEDARRAYBUILDER_H_
+#define AWKWARD_CHUNKEDARRAYBUILDER_H_
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "awkward/common.h"
+#include "awkward/Content.h"
+#include "awkward/builder/ArrayBuilder.h"
+#include "awkward/partition/PartitionedArray.h"
+
+namespace awkward {
+  /// @class ChunkedArrayBuilder
+  ///
+  /// @brief Append-only array for online ingestion: a list of sealed chunks
+  /// (immutable Content) followed by an open ArrayBuilder, the tail.
+  ///
+  /// Whenever the tail reaches #chunksize complete entries, it is sealed:
+  /// its snapshot becomes the next chunk and the tail is cleared (which
+  /// allocates new buffers, leaving the old ones to the chunk).
+  ///
+  /// One thread may append while other threads take #snapshot; each method
+  /// locks an internal mutex. A snapshot contains all entries that were
+  /// complete when it was taken, as an IrregularlyPartitionedArray with one
+  /// partition per chunk (shared, not copied) and one for the tail.
+  ///
+  /// All partitions have the same type. The tail's type can still grow
+  /// after a seal (integers become reals, a first `None` makes values
+  /// optional, records gain fields), so earlier chunks are then retyped to
+  /// match: wrapped in an option or union, given an all-`None` field, or
+  /// (for numbers) converted.
+  class EXPORT_SYMBOL ChunkedArrayBuilder {
+  public:
+    /// @brief Creates a ChunkedArrayBuilder from a full set of parameters.
+    ///
+    /// @param options Configuration options for the tail ArrayBuilder.
+    /// @param chunksize Number of entries at which the tail is sealed
+    /// into a chunk.
+    ChunkedArrayBuilder(const ArrayBuilderOptions& options,
+                        int64_t chunksize);
+
+    /// @brief Number of entries at which the tail is sealed into a chunk.
+    int64_t
+      chunksize() const;
+
+    /// @brief Returns a string representation of this array (single-line XML
+    /// indicating the length and number of chunks).
+    const std::string
+      tostring() const;
+
+    /// @brief Current number of complete entries, summed over the chunks
+    /// and the tail.
+    int64_t
+      length() const;
+
+    /// @brief Current number of sealed chunks.
+    int64_t
+      numchunks() const;
+
+    /// @brief Seals the tail into a chunk now, regardless of its length.
+    ///
+    /// Raises an error if an entry is only partly filled.
+    void
+      seal();
+
+    /// @brief Turns the complete entries into an IrregularlyPartitionedArray
+    /// without copying any data.
+    ///
+    /// Later appends do not affect the snapshot, just as with
+    /// ArrayBuilder::snapshot.
+    const PartitionedArrayPtr
+      snapshot() const;
+
+    /// @brief Adds a `None` value to the accumulated data.
+    void
+      null();
+
+    /// @brief Adds a boolean value `x` to the accumulated data.
+    void
+      boolean(bool x);
+
+    /// @brief Adds an integer value `x` to the accumulated data.
+    void
+      integer(int64_t x);
+
+    /// @brief Adds a real value `x` to the accumulated data.
+    void
+      real(double x);
+
+    /// @brief Adds an unencoded bytestring `x` to the accumulated data.
+    void
+      bytestring(const std::string& x);
+
+    /// @brief Adds a UTF-8 encoded bytestring `x` to the accumulated data.
+    void
+      string(const std::string& x);
+
+    /// @brief Begins building a nested list.
+    void
+      beginlist();
+
+    /// @brief Ends a nested list.
+    void
+      endlist();
+
+    /// @brief Begins building a tuple with a fixed number of fields.
+    void
+      begintuple(int64_t numfields);
+
+    /// @brief Sets the pointer to a given tuple field index; the next
+    /// command will fill that slot.
+    void
+      index(int64_t index);
+
+    /// @brief Ends a tuple.
+    void
+      endtuple();
+
+    /// @brief Begins building a record without a name.
+    void
+      beginrecord();
+
+    /// @brief Begins building a record with a name.
+    ///
+    /// @param name This name is used to distinguish records of different
+    /// types in heterogeneous data (to build a union of record arrays,
+    /// rather than a record array with union fields and optional values).
+    void
+      beginrecord_check(const std::string& name);
+
+    /// @brief Sets the pointer to a given record field `key`; the next
+    /// command will fill that slot.
+    void
+      field_check(const std::string& key);
+
+    /// @brief Ends a record.
+    void
+      endrecord();
+
+    /// @brief Append an element `at` a given index of an arbitrary `array`
+    /// (Content instance) to the accumulated data, handling negative
+    /// indexing and bounds-checking like Python.
+    void
+      append(const ContentPtr& array, int64_t at);
+
+    /// @brief Append all the elements of an arbitrary `array` (Content
+    /// instance) to the accumulated data, sealing chunks as it goes.
+    void
+      extend(const ContentPtr& array);
+
+  private:
+    /// @brief Seals the tail if it is between entries and has at least
+    /// #chunksize of them; the caller must hold the lock.
+    void
+      maybeseal();
+
+    /// @brief Seals the tail if it is not empty; the caller must hold
+    /// the lock.
+    void
+      seal_nolock();
+
+    /// @brief See #chunksize.
+    const int64_t chunksize_;
+    /// @brief Open builder for entries after the last chunk.
+    ArrayBuilder tail_;
+    /// @brief Number of lists, tuples, and records that have been begun
+    /// but not ended.
+    int64_t depth_;
+    /// @brief Sealed chunks.
+    ContentPtrVec chunks_;
+    /// @brief Logical index where each chunk ends.
+    std::vector<int64_t> stops_;
+    /// @brief Serializes the writer and readers.
+    mutable std::mutex mutex_;
+  };
+}
+
+#endif // AWKWARD_CHUNKEDARRAYBUILDER_H_
@@ -135,6 +135,7 @@ namespace awkward {
     bool begun_;
     int64_t nextindex_;
     int64_t nexttotry_;
+    bool cleared_;
 
     void
       maybeupdate(int64_t i, const BuilderPtr& tmp);
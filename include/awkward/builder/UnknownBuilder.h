@@ -92,6 +92,7 @@ namespace awkward {
   private:
     const ArrayBuilderOptions options_;
     int64_t nullcount_;
+    bool cleared_;
   };
 }
 
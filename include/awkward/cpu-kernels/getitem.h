@@ -147,6 +147,26 @@ extern "C" {
     awkward_carry_arange_64(
       int64_t* toptr,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_carry_isrange_64(
+      bool* toisrange,
+      const int64_t* fromcarry,
+      int64_t lencarry);
+
+  EXPORT_SYMBOL struct Error
+    awkward_rangearray_fill_64(
+      int64_t* toptr,
+      int64_t start,
+      int64_t step,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_rangearray_getitem_carry_64(
+      int64_t* toptr,
+      int64_t start,
+      int64_t step,
+      int64_t length,
+      const int64_t* fromcarry,
+      int64_t lencarry);
 
   EXPORT_SYMBOL struct Error
     awkward_identities32_getitem_carry_64(
@@ -196,6 +216,24 @@ extern "C" {
       int64_t stride,
       int64_t offset,
       const int64_t* pos);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_getitem_next_null_strided_64(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t len,
+      int64_t tostride,
+      int64_t fromstride,
+      int64_t offset,
+      const int64_t* pos);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_getitem_next_null_strided_32(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t len,
+      int64_t tostride,
+      int64_t fromstride,
+      int64_t offset,
+      const int32_t* pos);
   EXPORT_SYMBOL struct Error
     awkward_numpyarray_getitem_next_at_64(
       int64_t* nextcarryptr,
@@ -256,6 +294,30 @@ extern "C" {
       int64_t length,
       int64_t stride);
 
+  EXPORT_SYMBOL struct Error
+    awkward_bitpackedarray_getitem_numtrue(
+      int64_t* numtrue,
+      const uint8_t* frombits,
+      int64_t bitsoffset,
+      int64_t length,
+      bool lsb_order);
+  EXPORT_SYMBOL struct Error
+    awkward_bitpackedarray_getitem_nonzero_64(
+      int64_t* toptr,
+      const uint8_t* frombits,
+      int64_t bitsoffset,
+      int64_t length,
+      bool lsb_order);
+  EXPORT_SYMBOL struct Error
+    awkward_bitpackedarray_getitem_carry_64(
+      uint8_t* tobits,
+      const uint8_t* frombits,
+      int64_t bitsoffset,
+      int64_t length,
+      const int64_t* fromcarry,
+      int64_t lencarry,
+      bool lsb_order);
+
   EXPORT_SYMBOL struct Error
     awkward_listarray32_getitem_next_at_64(
       int64_t* tocarry,
@@ -283,6 +345,15 @@ extern "C" {
       int64_t startsoffset,
       int64_t stopsoffset,
       int64_t at);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_getitem_next_at_32(
+      int32_t* tocarry,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      int64_t lenstarts,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t at);
 
   EXPORT_SYMBOL struct Error
     awkward_listarray32_getitem_next_range_carrylength(
@@ -354,6 +425,18 @@ extern "C" {
       int64_t start,
       int64_t stop,
       int64_t step);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_getitem_next_range_32(
+      int32_t* tooffsets,
+      int32_t* tocarry,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      int64_t lenstarts,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t start,
+      int64_t stop,
+      int64_t step);
 
   EXPORT_SYMBOL struct Error
     awkward_listarray32_getitem_next_range_counts_64(
@@ -426,6 +509,18 @@ extern "C" {
       int64_t lenstarts,
       int64_t lenarray,
       int64_t lencontent);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_getitem_next_array_32(
+      int32_t* tocarry,
+      int64_t* toadvanced,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      const int64_t* fromarray,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lenarray,
+      int64_t lencontent);
 
   EXPORT_SYMBOL struct Error
     awkward_listarray32_getitem_next_array_advanced_64(
@@ -466,6 +561,19 @@ extern "C" {
       int64_t lenstarts,
       int64_t lenarray,
       int64_t lencontent);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_getitem_next_array_advanced_32(
+      int32_t* tocarry,
+      int64_t* toadvanced,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      const int64_t* fromarray,
+      const int64_t* fromadvanced,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lenarray,
+      int64_t lencontent);
 
   EXPORT_SYMBOL struct Error
     awkward_listarray32_getitem_carry_64(
@@ -500,6 +608,39 @@ extern "C" {
       int64_t stopsoffset,
       int64_t lenstarts,
       int64_t lencarry);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_getitem_carry_32(
+      int32_t* tostarts,
+      int32_t* tostops,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      const int32_t* fromcarry,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lencarry);
+  EXPORT_SYMBOL struct Error
+    awkward_listarrayU32_getitem_carry_32(
+      uint32_t* tostarts,
+      uint32_t* tostops,
+      const uint32_t* fromstarts,
+      const uint32_t* fromstops,
+      const int32_t* fromcarry,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lencarry);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray64_getitem_carry_32(
+      int64_t* tostarts,
+      int64_t* tostops,
+      const int64_t* fromstarts,
+      const int64_t* fromstops,
+      const int32_t* fromcarry,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lencarry);
 
   EXPORT_SYMBOL struct Error
     awkward_regulararray_getitem_next_at_64(
@@ -80,6 +80,24 @@ extern "C" {
       const int64_t* inneroffsets,
       int64_t inneroffsetsoffset,
       int64_t inneroffsetslen);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_flatten_offsets_32(
+      int32_t* tooffsets,
+      const int32_t* outeroffsets,
+      int64_t outeroffsetsoffset,
+      int64_t outeroffsetslen,
+      const int64_t* inneroffsets,
+      int64_t inneroffsetsoffset,
+      int64_t inneroffsetslen);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_flatten_offsetsU32(
+      uint32_t* tooffsets,
+      const uint32_t* outeroffsets,
+      int64_t outeroffsetsoffset,
+      int64_t outeroffsetslen,
+      const int64_t* inneroffsets,
+      int64_t inneroffsetsoffset,
+      int64_t inneroffsetslen);
 
   EXPORT_SYMBOL struct Error
     awkward_indexedarray32_flatten_none2empty_64(
@@ -368,6 +386,22 @@ extern "C" {
       int64_t startsoffset,
       int64_t stopsoffset,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_compact_offsets32(
+      int32_t* tooffsets,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listarrayU32_compact_offsetsU32(
+      uint32_t* tooffsets,
+      const uint32_t* fromstarts,
+      const uint32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t length);
 
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray32_compact_offsets64(
@@ -387,6 +421,18 @@ extern "C" {
       const int64_t* fromoffsets,
       int64_t offsetsoffset,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_compact_offsets32(
+      int32_t* tooffsets,
+      const int32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_compact_offsetsU32(
+      uint32_t* tooffsets,
+      const uint32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t length);
 
   EXPORT_SYMBOL struct Error
     awkward_listarray32_broadcast_tooffsets64(
@@ -421,6 +467,28 @@ extern "C" {
       const int64_t* fromstops,
       int64_t stopsoffset,
       int64_t lencontent);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_broadcast_tooffsets32(
+      int32_t* tocarry,
+      const int32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t offsetslength,
+      const int32_t* fromstarts,
+      int64_t startsoffset,
+      const int32_t* fromstops,
+      int64_t stopsoffset,
+      int64_t lencontent);
+  EXPORT_SYMBOL struct Error
+    awkward_listarrayU32_broadcast_tooffsetsU32(
+      int64_t* tocarry,
+      const uint32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t offsetslength,
+      const uint32_t* fromstarts,
+      int64_t startsoffset,
+      const uint32_t* fromstops,
+      int64_t stopsoffset,
+      int64_t lencontent);
 
   EXPORT_SYMBOL struct Error
     awkward_regulararray_broadcast_tooffsets64(
@@ -461,6 +529,7 @@ extern "C" {
       int64_t tooffset,
       const double* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_numpyarray_fill_todouble_fromfloat(
@@ -468,6 +537,7 @@ extern "C" {
       int64_t tooffset,
       const float* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_numpyarray_fill_todouble_from64(
@@ -475,139 +545,1135 @@ extern "C" {
       int64_t tooffset,
       const int64_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_fromU64(
+      double* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_from32(
+      double* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_fromU32(
+      double* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_from16(
+      double* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_fromU16(
+      double* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_from8(
+      double* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_fromU8(
+      double* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_frombool(
+      double* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_todouble_fromhalf(
+      double* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_fromhalf(
+      float* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_fromfloat(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_fromdouble(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_fromU64(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_from64(
+      int64_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_fromU64(
+      int64_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_from32(
+      int64_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_fromU32(
+      int64_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_from16(
+      int64_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_fromU16(
+      int64_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_from8(
+      int64_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_fromU8(
+      int64_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_frombool(
+      int64_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tobool_frombool(
+      bool* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_frombool(
+      float* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_from8(
+      float* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_fromU8(
+      float* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_from16(
+      float* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_fromU16(
+      float* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_from32(
+      float* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_fromU32(
+      float* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_from64(
+      float* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_fromU64(
+      float* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_fromfloat(
+      float* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tofloat_fromdouble(
+      float* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_frombool(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_from8(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_fromU8(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_from16(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_fromU16(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_from32(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_fromU32(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_from64(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_fromU64(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_tohalf_fromhalf(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_fromhalf(
+      int64_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_fromfloat(
+      int64_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to64_fromdouble(
+      int64_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_frombool(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_from8(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_fromU8(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_from16(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_fromU16(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_from32(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_fromU32(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_from64(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_fromhalf(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_fromfloat(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU64_fromdouble(
+      uint64_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_frombool(
+      int32_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_from8(
+      int32_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_fromU8(
+      int32_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_from16(
+      int32_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_fromU16(
+      int32_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_from32(
+      int32_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_fromU32(
+      int32_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_from64(
+      int32_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_fromU64(
+      int32_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_fromhalf(
+      int32_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_fromfloat(
+      int32_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to32_fromdouble(
+      int32_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_frombool(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_from8(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_fromU8(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_from16(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_fromU16(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_from32(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_fromU32(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_from64(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_fromU64(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_fromhalf(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_fromfloat(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU32_fromdouble(
+      uint32_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_frombool(
+      int16_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_from8(
+      int16_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_fromU8(
+      int16_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_from16(
+      int16_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_fromU16(
+      int16_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_from32(
+      int16_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_fromU32(
+      int16_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_from64(
+      int16_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_fromU64(
+      int16_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_fromhalf(
+      int16_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_fromfloat(
+      int16_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to16_fromdouble(
+      int16_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_frombool(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_from8(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_fromU8(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_from16(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_fromU16(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_from32(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_fromU32(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_from64(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_fromU64(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_fromhalf(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_fromfloat(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU16_fromdouble(
+      uint16_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_frombool(
+      int8_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_from8(
+      int8_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_fromU8(
+      int8_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_from16(
+      int8_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_fromU16(
+      int8_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_from32(
+      int8_t* toptr,
+      int64_t tooffset,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_fromU32(
+      int8_t* toptr,
+      int64_t tooffset,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_from64(
+      int8_t* toptr,
+      int64_t tooffset,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_fromU64(
+      int8_t* toptr,
+      int64_t tooffset,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_fromhalf(
+      int8_t* toptr,
+      int64_t tooffset,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_fromfloat(
+      int8_t* toptr,
+      int64_t tooffset,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_to8_fromdouble(
+      int8_t* toptr,
+      int64_t tooffset,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU8_frombool(
+      uint8_t* toptr,
+      int64_t tooffset,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU8_from8(
+      uint8_t* toptr,
+      int64_t tooffset,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU8_fromU8(
+      uint8_t* toptr,
+      int64_t tooffset,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_fill_toU8_from16(
+      uint8_t* toptr,
+      int64_t tooffset,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_fromU64(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_fromU16(
+      uint8_t* toptr,
       int64_t tooffset,
-      const uint64_t* fromptr,
+      const uint16_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_from32(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_from32(
+      uint8_t* toptr,
       int64_t tooffset,
       const int32_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_fromU32(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_fromU32(
+      uint8_t* toptr,
       int64_t tooffset,
       const uint32_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_from16(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_from64(
+      uint8_t* toptr,
       int64_t tooffset,
-      const int16_t* fromptr,
+      const int64_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_fromU16(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_fromU64(
+      uint8_t* toptr,
       int64_t tooffset,
-      const uint16_t* fromptr,
+      const uint64_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_from8(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_fromhalf(
+      uint8_t* toptr,
       int64_t tooffset,
-      const int8_t* fromptr,
+      const uint16_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_fromU8(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_fromfloat(
+      uint8_t* toptr,
       int64_t tooffset,
-      const uint8_t* fromptr,
+      const float* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_todouble_frombool(
-      double* toptr,
+    awkward_numpyarray_fill_toU8_fromdouble(
+      uint8_t* toptr,
       int64_t tooffset,
-      const bool* fromptr,
+      const double* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_toU64_fromU64(
-      uint64_t* toptr,
+    awkward_numpyarray_fill_tobool_from8(
+      bool* toptr,
       int64_t tooffset,
-      const uint64_t* fromptr,
+      const int8_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_from64(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_fromU8(
+      bool* toptr,
       int64_t tooffset,
-      const int64_t* fromptr,
+      const uint8_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_fromU64(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_from16(
+      bool* toptr,
       int64_t tooffset,
-      const uint64_t* fromptr,
+      const int16_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_from32(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_fromU16(
+      bool* toptr,
       int64_t tooffset,
-      const int32_t* fromptr,
+      const uint16_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_fromU32(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_from32(
+      bool* toptr,
       int64_t tooffset,
-      const uint32_t* fromptr,
+      const int32_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_from16(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_fromU32(
+      bool* toptr,
       int64_t tooffset,
-      const int16_t* fromptr,
+      const uint32_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_fromU16(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_from64(
+      bool* toptr,
       int64_t tooffset,
-      const uint16_t* fromptr,
+      const int64_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_from8(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_fromU64(
+      bool* toptr,
       int64_t tooffset,
-      const int8_t* fromptr,
+      const uint64_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_fromU8(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_fromhalf(
+      bool* toptr,
       int64_t tooffset,
-      const uint8_t* fromptr,
+      const uint16_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_to64_frombool(
-      int64_t* toptr,
+    awkward_numpyarray_fill_tobool_fromfloat(
+      bool* toptr,
       int64_t tooffset,
-      const bool* fromptr,
+      const float* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_numpyarray_fill_tobool_frombool(
+    awkward_numpyarray_fill_tobool_fromdouble(
       bool* toptr,
       int64_t tooffset,
-      const bool* fromptr,
+      const double* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_numpyarray_fill_tobyte_frombyte(
@@ -615,6 +1681,7 @@ extern "C" {
       int64_t tooffset,
       const int8_t* fromptr,
       int64_t fromoffset,
+      int64_t fromstride,
       int64_t length);
 
   EXPORT_SYMBOL struct Error
@@ -1051,6 +2118,17 @@ extern "C" {
       int64_t length,
       int64_t startsoffset,
       int64_t stopsoffset);
+  EXPORT_SYMBOL struct Error
+    awkward_ListArray32_rpad_axis1_32(
+      int32_t* toindex,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      int32_t* tostarts,
+      int32_t* tostops,
+      int64_t target,
+      int64_t length,
+      int64_t startsoffset,
+      int64_t stopsoffset);
 
   EXPORT_SYMBOL struct Error
     awkward_ListOffsetArray32_rpad_and_clip_axis1_64(
@@ -1120,6 +2198,13 @@ extern "C" {
       int64_t offsetsoffset,
       int64_t fromlength,
       int64_t target);
+  EXPORT_SYMBOL struct Error
+    awkward_ListOffsetArray32_rpad_axis1_32(
+      int32_t* toindex,
+      const int32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t fromlength,
+      int64_t target);
 
   EXPORT_SYMBOL struct Error
     awkward_listarray32_validity(
@@ -1333,6 +2418,305 @@ extern "C" {
       bool validwhen,
       bool lsb_order);
 
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_to_bitpackedarray(
+      uint8_t* tobits,
+      const int8_t* fromptr,
+      int64_t byteoffset,
+      int64_t length,
+      int64_t stride,
+      bool lsb_order);
+
+  EXPORT_SYMBOL struct Error
+    awkward_buffer_hash64(
+      uint64_t* tohash,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      uint64_t seed);
+  EXPORT_SYMBOL struct Error
+    awkward_buffer_hash64_strided(
+      uint64_t* tohash,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      const int64_t* shape,
+      const int64_t* strides,
+      int64_t ndim,
+      int64_t itemsize,
+      uint64_t seed);
+
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_frombool(
+      uint64_t* tohash,
+      const bool* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_from8(
+      uint64_t* tohash,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_fromU8(
+      uint64_t* tohash,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_from16(
+      uint64_t* tohash,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_fromU16(
+      uint64_t* tohash,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_from32(
+      uint64_t* tohash,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_fromU32(
+      uint64_t* tohash,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_from64(
+      uint64_t* tohash,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_fromU64(
+      uint64_t* tohash,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_fromfloat(
+      uint64_t* tohash,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_hash64_fromdouble(
+      uint64_t* tohash,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t length);
+
+  EXPORT_SYMBOL struct Error
+    awkward_listarray32_hash64(
+      uint64_t* tohash,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      const uint8_t* fromcontent,
+      int64_t contentoffset,
+      int64_t itemsize,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listarrayU32_hash64(
+      uint64_t* tohash,
+      const uint32_t* fromstarts,
+      const uint32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      const uint8_t* fromcontent,
+      int64_t contentoffset,
+      int64_t itemsize,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listarray64_hash64(
+      uint64_t* tohash,
+      const int64_t* fromstarts,
+      const int64_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      const uint8_t* fromcontent,
+      int64_t contentoffset,
+      int64_t itemsize,
+      int64_t length);
+
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_from8(
+      int64_t* toindex,
+      const int8_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_fromU8(
+      int64_t* toindex,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_from16(
+      int64_t* toindex,
+      const int16_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_fromU16(
+      int64_t* toindex,
+      const uint16_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_from32(
+      int64_t* toindex,
+      const int32_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_fromU32(
+      int64_t* toindex,
+      const uint32_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_from64(
+      int64_t* toindex,
+      const int64_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_fromU64(
+      int64_t* toindex,
+      const uint64_t* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_fromfloat(
+      int64_t* toindex,
+      const float* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_searchsorted_fromdouble(
+      int64_t* toindex,
+      const double* fromptr,
+      int64_t fromoffset,
+      int64_t length,
+      const double* edges,
+      int64_t edgesoffset,
+      int64_t numedges,
+      bool right);
+
+  EXPORT_SYMBOL struct Error
+    awkward_binnedlookup_evaluate(
+      double* toptr,
+      const double* fromcoords,
+      int64_t length,
+      int64_t numaxes,
+      const double* edges,
+      const int64_t* edgesoffsets,
+      const double* table,
+      bool interpolate);
+
+  EXPORT_SYMBOL struct Error
+    awkward_interleavedarray_fill_field(
+      uint8_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromoffset,
+      int64_t fromstride,
+      int64_t itemsize,
+      int64_t length);
+
+  EXPORT_SYMBOL struct Error
+    awkward_quantizedarray_dequantize(
+      double* toptr,
+      const double* fromptr,
+      int64_t length,
+      double scale,
+      double offset);
+
+  EXPORT_SYMBOL struct Error
+    awkward_quantizedarray_reduce_sum(
+      double* toptr,
+      const double* fromsum,
+      const int64_t* fromcount,
+      int64_t length,
+      double scale,
+      double offset);
+
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray_rolling_sum_64(
+      double* toptr,
+      const double* fromptr,
+      int64_t fromoffset,
+      const int64_t* offsets,
+      int64_t length,
+      int64_t window,
+      bool mean);
+
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray_rolling_minmax_64(
+      double* toptr,
+      int64_t* scratch,
+      const double* fromptr,
+      int64_t fromoffset,
+      const int64_t* offsets,
+      int64_t length,
+      int64_t window,
+      bool ismax);
+
 }
 
 #endif // AWKWARDCPU_GETITEM_H_
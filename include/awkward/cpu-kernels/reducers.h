@@ -1086,6 +1086,1477 @@ extern "C" {
       int64_t lenparents,
       int64_t outlength);
 
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_count_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      int64_t outerlen,
+      int64_t reducelen,
+      int64_t innerlen);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_bool_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_int64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_uint64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_countnonzero_float64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_bool_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint8_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint16_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint32_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int64_int64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint64_uint64_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float32_float32_strided(
+      float* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_float64_float64_strided(
+      double* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_bool_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int8_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint8_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int16_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint16_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_int32_int32_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_uint32_uint32_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_bool_strided(
+      bool* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int8_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint8_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int16_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint16_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int32_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint32_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_int64_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_uint64_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float32_strided(
+      bool* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_sum_bool_float64_strided(
+      bool* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_bool_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint8_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint16_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint32_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int64_int64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint64_uint64_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float32_float32_strided(
+      float* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_float64_float64_strided(
+      double* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_bool_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int8_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint8_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int16_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint16_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_int32_int32_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_uint32_uint32_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_bool_strided(
+      bool* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int8_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint8_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int16_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint16_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int32_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint32_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_int64_strided(
+      bool* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_uint64_strided(
+      bool* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float32_strided(
+      bool* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_prod_bool_float64_strided(
+      bool* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int8_int8_strided(
+      int8_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int8_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint8_uint8_strided(
+      uint8_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint8_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int16_int16_strided(
+      int16_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int16_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint16_uint16_strided(
+      uint16_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint16_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int32_int32_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int32_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint32_uint32_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint32_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_int64_int64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int64_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_uint64_uint64_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint64_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float32_float32_strided(
+      float* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      float identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_min_float64_float64_strided(
+      double* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      double identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int8_int8_strided(
+      int8_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int8_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint8_uint8_strided(
+      uint8_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint8_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int16_int16_strided(
+      int16_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int16_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint16_uint16_strided(
+      uint16_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint16_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int32_int32_strided(
+      int32_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int32_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint32_uint32_strided(
+      uint32_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint32_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_int64_int64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      int64_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_uint64_uint64_strided(
+      uint64_t* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      uint64_t identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float32_float32_strided(
+      float* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      float identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_max_float64_float64_strided(
+      double* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride,
+      double identity);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_bool_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_int64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_uint64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmin_float64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_bool_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const bool* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint8_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint8_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint16_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint16_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint32_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_int64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const int64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_uint64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const uint64_t* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float32_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const float* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
+  EXPORT_SYMBOL struct Error
+    awkward_reduce_argmax_float64_strided(
+      int64_t* toptr,
+      int64_t tostride,
+      const double* fromptr,
+      int64_t fromptroffset,
+      int64_t outerlen,
+      int64_t outerstride,
+      int64_t reducelen,
+      int64_t reducestride,
+      int64_t innerlen,
+      int64_t innerstride);
+
   EXPORT_SYMBOL struct Error
     awkward_content_reduce_zeroparents_64(
       int64_t* toparents,
@@ -1097,48 +2568,114 @@ extern "C" {
       const int64_t* offsets,
       int64_t offsetsoffset,
       int64_t length);
-
   EXPORT_SYMBOL struct Error
-    awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
-      int64_t* maxcount,
-      int64_t* offsetscopy,
-      const int64_t* offsets,
+    awkward_listoffsetarray32_reduce_global_startstop_64(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const int32_t* offsets,
       int64_t offsetsoffset,
       int64_t length);
   EXPORT_SYMBOL struct Error
-    awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
-      int64_t* nextcarry,
-      int64_t* nextparents,
-      int64_t nextlen,
-      int64_t* maxnextparents,
-      int64_t* distincts,
-      int64_t distinctslen,
-      int64_t* offsetscopy,
+    awkward_listoffsetarrayU32_reduce_global_startstop_64(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
+
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray_reduce_nonlocal_outoffsets_64(
+      int64_t* outoffsets,
       const int64_t* offsets,
       int64_t offsetsoffset,
       int64_t length,
       const int64_t* parents,
       int64_t parentsoffset,
-      int64_t maxcount);
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_nonlocal_outoffsets_64(
+      int64_t* outoffsets,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t outlength);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_nonlocal_outoffsets_64(
+      int64_t* outoffsets,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t outlength);
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
       int64_t* nextstarts,
-      const int64_t* nextparents,
-      int64_t nextlen);
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_nonlocal_nextstarts_64(
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset);
   EXPORT_SYMBOL struct Error
-    awkward_listoffsetarray_reduce_nonlocal_findgaps_64(
-      int64_t* gaps,
+    awkward_listoffsetarrayU32_reduce_nonlocal_nextstarts_64(
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
       const int64_t* parents,
-      int64_t parentsoffset,
-      int64_t lenparents);
+      int64_t parentsoffset);
   EXPORT_SYMBOL struct Error
-    awkward_listoffsetarray_reduce_nonlocal_outstartsstops_64(
-      int64_t* outstarts,
-      int64_t* outstops,
-      const int64_t* distincts,
-      int64_t lendistincts,
-      const int64_t* gaps,
-      int64_t outlength);
+    awkward_listoffsetarray_reduce_nonlocal_nextcarry_64(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_nonlocal_nextcarry_32(
+      int32_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_nonlocal_nextcarry_64(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset);
 
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_local_nextparents_64(
@@ -1146,6 +2683,18 @@ extern "C" {
       const int64_t* offsets,
       int64_t offsetsoffset,
       int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarray32_reduce_local_nextparents_64(
+      int64_t* nextparents,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
+  EXPORT_SYMBOL struct Error
+    awkward_listoffsetarrayU32_reduce_local_nextparents_64(
+      int64_t* nextparents,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length);
   EXPORT_SYMBOL struct Error
     awkward_listoffsetarray_reduce_local_outoffsets_64(
       int64_t* outoffsets,
@@ -1201,6 +2750,12 @@ extern "C" {
       int64_t lenparents,
       int64_t outlength);
 
+  EXPORT_SYMBOL struct Error
+    awkward_numpyarray_reduce_mask_strided_bytemaskedarray(
+      int8_t* toptr,
+      int64_t length,
+      int64_t reducelen);
+
   EXPORT_SYMBOL struct Error
     awkward_bytemaskedarray_reduce_next_64(
       int64_t* nextcarry,
@@ -0,0 +1,152 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#ifndef AWKWARD_PARTITIONINDEX_H_
+#define AWKWARD_PARTITIONINDEX_H_
+
+#include <unordered_map>
+#include <utility>
+
+#include "awkward/Content.h"
+
+namespace awkward {
+  /// @class BloomFilter
+  ///
+  /// @brief Set of 64-bit hashes that answers "definitely not present" or
+  /// "possibly present," using a fixed number of bits.
+  ///
+  /// Each hash sets #numhashes bits, chosen by double hashing, so the false
+  /// positive rate depends only on the number of bits per added hash.
+  class EXPORT_SYMBOL BloomFilter {
+  public:
+    /// @brief Creates an empty BloomFilter.
+    ///
+    /// @param numbits Number of bits in the filter (at least `1`).
+    /// @param numhashes Number of bits set by each hash (at least `1`).
+    BloomFilter(int64_t numbits, int64_t numhashes);
+
+    /// @brief Creates an empty BloomFilter sized to hold `count` hashes
+    /// with a given false positive rate.
+    static BloomFilter
+      forcount(int64_t count, double falsepositive);
+
+    /// @brief Number of bits in the filter.
+    int64_t
+      numbits() const;
+
+    /// @brief Number of bits set by each hash.
+    int64_t
+      numhashes() const;
+
+    /// @brief Adds one hash.
+    void
+      add(uint64_t hash);
+
+    /// @brief Returns `false` if `hash` was definitely not added; `true`
+    /// if it might have been.
+    bool
+      mightcontain(uint64_t hash) const;
+
+  private:
+    /// @brief See #numbits.
+    int64_t numbits_;
+    /// @brief See #numhashes.
+    int64_t numhashes_;
+    /// @brief The bits, packed into 64-bit words.
+    std::vector<uint64_t> bits_;
+  };
+
+  /// @class PartitionIndex
+  ///
+  /// @brief Secondary index over one or more integer key columns of a
+  /// partitioned array, for point lookups.
+  ///
+  /// Each partition gets a BloomFilter of its keys, so that a lookup only
+  /// needs to visit partitions that might contain the key. Optionally, a
+  /// global hash index maps each key's hash to its position in the full
+  /// array, which is split into a partitionid and an index with the same
+  /// semantics as {@link PartitionedArray#partitionid_index_at
+  /// PartitionedArray::partitionid_index_at}.
+  ///
+  /// Keys are hashed with {@link NumpyArray#hash64 NumpyArray::hash64}, so
+  /// integers match by value, regardless of their type. Since only hashes
+  /// are stored, positions from #find must be checked against the data.
+  class EXPORT_SYMBOL PartitionIndex {
+  public:
+    /// @brief Creates an empty PartitionIndex.
+    ///
+    /// @param numkeys Number of key columns.
+    /// @param falsepositive False positive rate of each BloomFilter.
+    /// @param hashindex If `true`, also build the global hash index.
+    PartitionIndex(int64_t numkeys, double falsepositive, bool hashindex);
+
+    /// @brief Number of key columns.
+    int64_t
+      numkeys() const;
+
+    /// @brief False positive rate of each BloomFilter.
+    double
+      falsepositive() const;
+
+    /// @brief If `true`, #find can be used.
+    bool
+      hashindex() const;
+
+    /// @brief Number of partitions that have been appended.
+    int64_t
+      numpartitions() const;
+
+    /// @brief Total number of keys that have been appended.
+    int64_t
+      length() const;
+
+    /// @brief Logical index where each partition ends.
+    const std::vector<int64_t>
+      stops() const;
+
+    /// @brief Indexes the next partition.
+    ///
+    /// @param keys One-dimensional NumpyArrays of integers, one for each
+    /// key column, all with the same length.
+    void
+      append(const ContentPtrVec& keys);
+
+    /// @brief The partitionids of partitions that might contain `key`, in
+    /// increasing order.
+    const std::vector<int64_t>
+      candidates(const std::vector<int64_t>& key) const;
+
+    /// @brief The (partitionid, index) of every position whose key has the
+    /// same hash as `key`, in increasing order; requires #hashindex.
+    const std::vector<std::pair<int64_t, int64_t>>
+      find(const std::vector<int64_t>& key) const;
+
+    /// @brief Gets the partitionid and index for a given logical position,
+    /// like {@link IrregularlyPartitionedArray#partitionid_index_at
+    /// IrregularlyPartitionedArray::partitionid_index_at}, but with a binary
+    /// search.
+    void
+      partitionid_index_at(int64_t at,
+                           int64_t& partitionid,
+                           int64_t& index) const;
+
+  private:
+    /// @brief Hash of one key, consistent with the hashes in #append.
+    uint64_t
+      keyhash(const std::vector<int64_t>& key) const;
+
+    /// @brief See #numkeys.
+    const int64_t numkeys_;
+    /// @brief See #falsepositive.
+    const double falsepositive_;
+    /// @brief See #hashindex.
+    const bool hashindex_;
+    /// @brief See #stops.
+    std::vector<int64_t> stops_;
+    /// @brief One BloomFilter per partition.
+    std::vector<BloomFilter> blooms_;
+    /// @brief Logical positions of each key hash, if #hashindex.
+    std::unordered_multimap<uint64_t, int64_t> positions_;
+  };
+}
+
+#endif // AWKWARD_PARTITIONINDEX_H_
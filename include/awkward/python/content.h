@@ -7,8 +7,10 @@
 #include <pybind11/stl.h>
 
 #include "awkward/builder/ArrayBuilder.h"
+#include "awkward/builder/ChunkedArrayBuilder.h"
 #include "awkward/Iterator.h"
 #include "awkward/Content.h"
+#include "awkward/BinnedLookup.h"
 #include "awkward/array/EmptyArray.h"
 #include "awkward/array/IndexedArray.h"
 #include "awkward/array/ByteMaskedArray.h"
@@ -23,6 +25,11 @@
 #include "awkward/array/RegularArray.h"
 #include "awkward/array/UnionArray.h"
 #include "awkward/array/VirtualArray.h"
+#include "awkward/array/ConstantArray.h"
+#include "awkward/array/RangeArray.h"
+#include "awkward/array/InterleavedArray.h"
+#include "awkward/array/BitPackedArray.h"
+#include "awkward/array/QuantizedArray.h"
 
 namespace py = pybind11;
 namespace ak = awkward;
@@ -62,6 +69,11 @@ ak::Slice
 py::class_<ak::ArrayBuilder>
   make_ArrayBuilder(const py::handle& m, const std::string& name);
 
+/// @brief Makes a ChunkedArrayBuilder class in Python that mirrors the one
+/// in C++.
+py::class_<ak::ChunkedArrayBuilder, std::shared_ptr<ak::ChunkedArrayBuilder>>
+  make_ChunkedArrayBuilder(const py::handle& m, const std::string& name);
+
 /// @brief Makes an Iterator class in Python that mirrors the one in C++.
 py::class_<ak::Iterator, std::shared_ptr<ak::Iterator>>
   make_Iterator(const py::handle& m, const std::string& name);
@@ -95,6 +107,19 @@ private:
 py::class_<PersistentSharedPtr>
   make_PersistentSharedPtr(const py::handle& m, const std::string& name);
 
+/// @brief Makes a QuantileSketch class in Python that mirrors the one in
+/// C++.
+py::class_<ak::QuantileSketch, std::shared_ptr<ak::QuantileSketch>>
+  make_QuantileSketch(const py::handle& m, const std::string& name);
+
+/// @brief Makes a HyperLogLog class in Python that mirrors the one in C++.
+py::class_<ak::HyperLogLog, std::shared_ptr<ak::HyperLogLog>>
+  make_HyperLogLog(const py::handle& m, const std::string& name);
+
+/// @brief Makes a BinnedLookup class in Python that mirrors the one in C++.
+py::class_<ak::BinnedLookup, std::shared_ptr<ak::BinnedLookup>>
+  make_BinnedLookup(const py::handle& m, const std::string& name);
+
 /// @brief Makes an abstract Content class in Python that mirrors the one
 /// in C++.
 py::class_<ak::Content, std::shared_ptr<ak::Content>>
@@ -180,4 +205,30 @@ py::class_<ak::UnionArrayOf<T, I>,
 py::class_<ak::VirtualArray, std::shared_ptr<ak::VirtualArray>, ak::Content>
   make_VirtualArray(const py::handle& m, const std::string& name);
 
+/// @brief Makes a ConstantArray in Python that mirrors the one in C++.
+py::class_<ak::ConstantArray, std::shared_ptr<ak::ConstantArray>, ak::Content>
+  make_ConstantArray(const py::handle& m, const std::string& name);
+
+/// @brief Makes a RangeArray in Python that mirrors the one in C++.
+py::class_<ak::RangeArray, std::shared_ptr<ak::RangeArray>, ak::Content>
+  make_RangeArray(const py::handle& m, const std::string& name);
+
+/// @brief Makes an InterleavedArray in Python that mirrors the one in C++.
+py::class_<ak::InterleavedArray,
+           std::shared_ptr<ak::InterleavedArray>,
+           ak::Content>
+  make_InterleavedArray(const py::handle& m, const std::string& name);
+
+/// @brief Makes a BitPackedArray in Python that mirrors the one in C++.
+py::class_<ak::BitPackedArray,
+           std::shared_ptr<ak::BitPackedArray>,
+           ak::Content>
+  make_BitPackedArray(const py::handle& m, const std::string& name);
+
+/// @brief Makes a QuantizedArray in Python that mirrors the one in C++.
+py::class_<ak::QuantizedArray,
+           std::shared_ptr<ak::QuantizedArray>,
+           ak::Content>
+  make_QuantizedArray(const py::handle& m, const std::string& name);
+
 #endif // AWKWARDPY_CONTENT_H_
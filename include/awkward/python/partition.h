@@ -9,6 +9,7 @@
 
 #include "awkward/partition/PartitionedArray.h"
 #include "awkward/partition/IrregularlyPartitionedArray.h"
+#include "awkward/partition/PartitionIndex.h"
 
 namespace py = pybind11;
 namespace ak = awkward;
@@ -25,4 +26,8 @@ py::class_<ak::IrregularlyPartitionedArray,
            ak::PartitionedArray>
   make_IrregularlyPartitionedArray(const py::handle& m, const std::string& name);
 
+/// @brief Makes a PartitionIndex in Python that mirrors the one in C++.
+py::class_<ak::PartitionIndex, std::shared_ptr<ak::PartitionIndex>>
+  make_PartitionIndex(const py::handle& m, const std::string& name);
+
 #endif // AWKWARDPY_PARTITION_H_
@@ -97,4 +97,17 @@ private:
 py::class_<PyArrayCache, std::shared_ptr<PyArrayCache>>
 make_PyArrayCache(const py::handle& m, const std::string& name);
 
+////////// MemoryCache
+
+py::class_<ak::MemoryCache, std::shared_ptr<ak::MemoryCache>>
+make_MemoryCache(const py::handle& m, const std::string& name);
+
+////////// memocache
+
+void
+make_setmemocache(py::module& m, const std::string& name);
+
+void
+make_memocache(py::module& m, const std::string& name);
+
 #endif // AWKWARDPY_VIRTUAL_H_
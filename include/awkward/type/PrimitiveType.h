@@ -30,6 +30,7 @@ namespace awkward {
       uint64,
       float32,
       float64,
+      float16,
       numtypes
     };
 
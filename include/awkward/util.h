@@ -7,6 +7,8 @@
 #include <vector>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 
 #include "awkward/common.h"
 
@@ -100,7 +102,46 @@ namespace awkward {
     IndexOf<T>
       make_stops(const IndexOf<T>& offsets);
 
-    using RecordLookup    = std::vector<std::string>;
+    /// @class RecordLookup
+    ///
+    /// @brief The names of a record's fields, in order, with a hash index
+    /// from name to field index that is built on the first lookup.
+    ///
+    /// Everything that shares a RecordLookupPtr (all the RecordArray,
+    /// RecordForm, and RecordType nodes derived from one another) shares the
+    /// index, so it is built once, not once per node. Records with thousands
+    /// of fields are common, so lookup by name must not be a linear search.
+    ///
+    /// Because it is shared, lookups from different threads are serialized
+    /// by a mutex; adding names is not thread-safe.
+    class EXPORT_SYMBOL RecordLookup: public std::vector<std::string> {
+    public:
+      using std::vector<std::string>::vector;
+
+      /// @brief Copies the names, but not the index.
+      RecordLookup(const RecordLookup& other);
+
+      /// @brief Copies the names, but not the index.
+      RecordLookup&
+        operator=(const RecordLookup& other);
+
+      /// @brief The field index of `key` (the first, if it is repeated) or
+      /// `-1` if `key` is not one of the names.
+      ///
+      /// If names have been added since the last lookup, the index is
+      /// rebuilt.
+      int64_t
+        position(const std::string& key) const;
+
+    private:
+      /// @brief Guards #index_ and #indexed_.
+      mutable std::mutex mutex_;
+      /// @brief See #position.
+      mutable std::unordered_map<std::string, int64_t> index_;
+      /// @brief Number of names in #index_.
+      mutable size_t indexed_ = 0;
+    };
+
     using RecordLookupPtr = std::shared_ptr<RecordLookup>;
 
     /// @brief Initializes a RecordLookup by assigning each element with
@@ -136,7 +177,101 @@ namespace awkward {
     const std::vector<std::string>
       keys(const RecordLookupPtr& recordlookup, int64_t numfields);
 
-    using Parameters = std::map<std::string, std::string>;
+    /// @class Parameters
+    ///
+    /// @brief String-to-JSON map that augments the meaning of a Content,
+    /// Form, or Type node.
+    ///
+    /// Keys are simple strings, but values are JSON-encoded strings.
+    ///
+    /// The map is reference-counted and copy-on-write: copying a Parameters
+    /// (as every new node does) copies a pointer, and the map is only
+    /// duplicated if a shared copy is modified. Nodes store #intern'ed maps,
+    /// so equal maps are also shared, and comparing them can stop at the
+    /// pointer.
+    class EXPORT_SYMBOL Parameters {
+    public:
+      using Map = std::map<std::string, std::string>;
+      using const_iterator = Map::const_iterator;
+      using value_type = Map::value_type;
+
+      /// @brief Creates an empty Parameters; this does not allocate.
+      Parameters();
+
+      /// @brief Creates a Parameters from the key-value pairs of a map.
+      Parameters(const Map& map);
+
+      /// @brief Iterator to the first key-value pair, in key order.
+      const_iterator
+        begin() const;
+
+      /// @brief Iterator past the last key-value pair.
+      const_iterator
+        end() const;
+
+      /// @brief Iterator to the pair with `key` or #end if there is none.
+      const_iterator
+        find(const std::string& key) const;
+
+      /// @brief Number of pairs with `key` (`0` or `1`).
+      size_t
+        count(const std::string& key) const;
+
+      /// @brief Number of key-value pairs.
+      size_t
+        size() const;
+
+      /// @brief Returns `true` if there are no key-value pairs.
+      bool
+        empty() const;
+
+      /// @brief Value associated with `key`, inserting an empty string if
+      /// there is none.
+      ///
+      /// This makes a private copy of the map if it is shared.
+      std::string&
+        operator[](const std::string& key);
+
+      /// @brief Removes the pair with `key`, if any, and returns the number
+      /// of pairs removed.
+      ///
+      /// This makes a private copy of the map if it is shared.
+      size_t
+        erase(const std::string& key);
+
+      /// @brief Returns `true` if `other` has exactly the same keys and
+      /// (string-equal) values.
+      bool
+        operator==(const Parameters& other) const;
+
+      /// @brief Returns `true` if `other` has exactly the same keys and
+      /// (string-equal) values.
+      bool
+        operator!=(const Parameters& other) const;
+
+      /// @brief Returns `true` if this and `other` share one map, which
+      /// implies #operator== without comparing any strings.
+      bool
+        same(const Parameters& other) const;
+
+      /// @brief A Parameters with the same key-value pairs that shares its
+      /// map with every other interned Parameters that is equal to it.
+      ///
+      /// This is cheap (a pointer copy) if the map is already interned.
+      const Parameters
+        intern() const;
+
+    private:
+      /// @brief Makes #map_ a private, unshared copy before a modification.
+      Map&
+        detach();
+
+      /// @brief The map or `nullptr` if it is empty.
+      std::shared_ptr<Map> map_;
+      /// @brief If `true`, #map_ belongs to the intern pool and must never
+      /// be modified in place.
+      bool interned_;
+    };
 
     /// @brief Returns `true` if the value associated with a `key` in
     /// `parameters` is equal to the specified `value`.
@@ -181,6 +316,35 @@ namespace awkward {
       gettypestr(const Parameters& parameters,
                  const TypeStrs& typestrs);
 
+    /// @brief Hash of `bytelength` bytes of a buffer, starting at
+    /// `byteoffset`, for Content#fingerprint.
+    ///
+    /// Buffers are assumed to be immutable, so the hash of each range is
+    /// remembered for as long as the buffer is alive. A buffer is recognized
+    /// by its reference count, not its address, so a new buffer that happens
+    /// to reuse the address of a deleted one is hashed again.
+    uint64_t
+      buffer_fingerprint(const std::shared_ptr<void>& ptr,
+                         int64_t byteoffset,
+                         int64_t bytelength);
+
+    /// @brief Hash of the items of a strided array, in row-major order,
+    /// for Content#fingerprint.
+    ///
+    /// It is equal to the #buffer_fingerprint of a contiguous copy of the
+    /// array, but the items are read in place. The hash is remembered the
+    /// same way, keyed by the `shape` and `strides` as well.
+    uint64_t
+      buffer_fingerprint(const std::shared_ptr<void>& ptr,
+                         int64_t byteoffset,
+                         int64_t itemsize,
+                         const std::vector<ssize_t>& shape,
+                         const std::vector<ssize_t>& strides);
+
+    /// @brief Mixes `value` into a running fingerprint `hash`.
+    void
+      fingerprint_combine(uint64_t& hash, uint64_t value);
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template <typename T>
@@ -332,12 +496,40 @@ namespace awkward {
         int64_t fromindexoffset,
         int64_t length);
 
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename C>
+    ERROR
+      awkward_numpyarray_getitem_next_null_strided(
+        uint8_t* toptr,
+        const uint8_t* fromptr,
+        int64_t len,
+        int64_t tostride,
+        int64_t fromstride,
+        int64_t offset,
+        const C* pos);
+
+    /// @brief The integer type of the carries that a list node with `T`
+    /// offsets (or starts and stops) passes to its content.
+    ///
+    /// Positions in the content of 32-bit signed offsets always fit in 32
+    /// bits, so their carries are Index32, with half the memory traffic of
+    /// an Index64. Unsigned 32-bit positions may not fit.
+    template <typename T>
+    struct carry_of {
+      using type = int64_t;
+    };
+    template <>
+    struct carry_of<int32_t> {
+      using type = int32_t;
+    };
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template <typename T>
     ERROR
-      awkward_listarray_getitem_next_at_64(
-        int64_t* tocarry,
+      awkward_listarray_getitem_next_at(
+        typename carry_of<T>::type* tocarry,
         const T* fromstarts,
         const T* fromstops,
         int64_t lenstarts,
@@ -364,9 +556,9 @@ namespace awkward {
     /// to make it easier and more type-safe to call.
     template <typename T>
     ERROR
-      awkward_listarray_getitem_next_range_64(
+      awkward_listarray_getitem_next_range(
         T* tooffsets,
-        int64_t* tocarry,
+        typename carry_of<T>::type* tocarry,
         const T* fromstarts,
         const T* fromstops,
         int64_t lenstarts,
@@ -399,8 +591,8 @@ namespace awkward {
     /// to make it easier and more type-safe to call.
     template <typename T>
     ERROR
-      awkward_listarray_getitem_next_array_64(
-        int64_t* tocarry,
+      awkward_listarray_getitem_next_array(
+        typename carry_of<T>::type* tocarry,
         int64_t* toadvanced,
         const T* fromstarts,
         const T* fromstops,
@@ -415,8 +607,8 @@ namespace awkward {
     /// to make it easier and more type-safe to call.
     template <typename T>
     ERROR
-      awkward_listarray_getitem_next_array_advanced_64(
-        int64_t* tocarry,
+      awkward_listarray_getitem_next_array_advanced(
+        typename carry_of<T>::type* tocarry,
         int64_t* toadvanced,
         const T* fromstarts,
         const T* fromstops,
@@ -430,14 +622,14 @@ namespace awkward {
 
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
-    template <typename T>
+    template <typename T, typename C>
     ERROR
-      awkward_listarray_getitem_carry_64(
+      awkward_listarray_getitem_carry(
         T* tostarts,
         T* tostops,
         const T* fromstarts,
         const T* fromstops,
-        const int64_t* fromcarry,
+        const C* fromcarry,
         int64_t startsoffset,
         int64_t stopsoffset,
         int64_t lenstarts,
@@ -468,6 +660,19 @@ namespace awkward {
         int64_t inneroffsetsoffset,
         int64_t inneroffsetslen);
 
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_flatten_offsets(
+        T* tooffsets,
+        const T* outeroffsets,
+        int64_t outeroffsetsoffset,
+        int64_t outeroffsetslen,
+        const int64_t* inneroffsets,
+        int64_t inneroffsetsoffset,
+        int64_t inneroffsetslen);
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template <typename T>
@@ -676,6 +881,33 @@ namespace awkward {
         int64_t stopsoffset,
         int64_t length);
 
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listarray_compact_offsets(
+        T* tooffsets,
+        const T* fromstarts,
+        const T* fromstops,
+        int64_t startsoffset,
+        int64_t stopsoffset,
+        int64_t length);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listarray_hash64(
+        uint64_t* tohash,
+        const T* fromstarts,
+        const T* fromstops,
+        int64_t startsoffset,
+        int64_t stopsoffset,
+        const uint8_t* fromcontent,
+        int64_t contentoffset,
+        int64_t itemsize,
+        int64_t length);
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template <typename T>
@@ -686,6 +918,16 @@ namespace awkward {
         int64_t offsetsoffset,
         int64_t length);
 
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_compact_offsets(
+        T* tooffsets,
+        const T* fromoffsets,
+        int64_t offsetsoffset,
+        int64_t length);
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template <typename T>
@@ -701,6 +943,21 @@ namespace awkward {
         int64_t stopsoffset,
         int64_t lencontent);
 
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listarray_broadcast_tooffsets(
+        typename carry_of<T>::type* tocarry,
+        const T* fromoffsets,
+        int64_t offsetsoffset,
+        int64_t offsetslength,
+        const T* fromstarts,
+        int64_t startsoffset,
+        const T* fromstops,
+        int64_t stopsoffset,
+        int64_t lencontent);
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template <typename T>
@@ -857,6 +1114,70 @@ namespace awkward {
         int64_t parentsoffset,
         int64_t length);
 
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_global_startstop_64(
+        int64_t* globalstart,
+        int64_t* globalstop,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_nonlocal_outoffsets_64(
+        int64_t* outoffsets,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length,
+        const int64_t* parents,
+        int64_t parentsoffset,
+        int64_t outlength);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
+        int64_t* nextstarts,
+        int64_t nextoutlength,
+        const int64_t* outoffsets,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length,
+        const int64_t* parents,
+        int64_t parentsoffset);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_nonlocal_nextcarry(
+        typename carry_of<T>::type* nextcarry,
+        int64_t* nextparents,
+        int64_t* nextstarts,
+        int64_t nextoutlength,
+        const int64_t* outoffsets,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length,
+        const int64_t* parents,
+        int64_t parentsoffset);
+
+    /// @brief Wraps several cpu-kernels from the C interface with a template
+    /// to make it easier and more type-safe to call.
+    template <typename T>
+    ERROR
+      awkward_listoffsetarray_reduce_local_nextparents_64(
+        int64_t* nextparents,
+        const T* offsets,
+        int64_t offsetsoffset,
+        int64_t length);
+
     /// @brief Wraps several cpu-kernels from the C interface with a template
     /// to make it easier and more type-safe to call.
     template <typename T>
@@ -3,6 +3,10 @@
 #ifndef AWKWARD_ARRAYCACHE_H_
 #define AWKWARD_ARRAYCACHE_H_
 
+#include <list>
+#include <mutex>
+#include <unordered_map>
+
 #include "awkward/Content.h"
 
 namespace awkward {
@@ -41,6 +45,73 @@ namespace awkward {
 
   using ArrayCachePtr = std::shared_ptr<ArrayCache>;
 
+  /// @class MemoryCache
+  ///
+  /// @brief Pure C++ ArrayCache that keeps arrays in memory up to a budget
+  /// of bytes, dropping the least recently used arrays first.
+  ///
+  /// The size of each array is its Content#nbytes, so arrays that share
+  /// buffers are counted once for each array. An array larger than the
+  /// whole budget is not kept at all. All methods are thread-safe.
+  class EXPORT_SYMBOL MemoryCache: public ArrayCache {
+  public:
+    /// @brief Creates an empty MemoryCache.
+    ///
+    /// @param max_bytes The most bytes to keep; must be non-negative.
+    MemoryCache(int64_t max_bytes);
+
+    /// @brief The most bytes to keep.
+    int64_t
+      max_bytes() const;
+
+    /// @brief The number of bytes currently kept.
+    int64_t
+      current_bytes() const;
+
+    /// @brief The number of arrays currently kept.
+    int64_t
+      length() const;
+
+    /// @brief Drops all arrays.
+    void
+      clear();
+
+    ContentPtr
+      get(const std::string& key) const override;
+
+    void
+      set(const std::string& key, const ContentPtr& value) override;
+
+    const std::string
+      tostring_part(const std::string& indent,
+                    const std::string& pre,
+                    const std::string& post) const override;
+
+  private:
+    struct Entry {
+      std::string key;
+      ContentPtr value;
+      int64_t nbytes;
+    };
+    using EntryList = std::list<Entry>;
+
+    /// @brief Drops the least recently used arrays until #current_bytes
+    /// is at most `max_bytes`; the caller must hold the lock.
+    void
+      shrink(int64_t max_bytes);
+
+    /// @brief See #max_bytes.
+    const int64_t max_bytes_;
+    /// @brief See #current_bytes.
+    int64_t current_bytes_;
+    /// @brief Entries from most to least recently used.
+    mutable EntryList order_;
+    /// @brief Position of each key in #order_.
+    std::unordered_map<std::string, EntryList::iterator> entries_;
+    /// @brief Guards all of the above.
+    mutable std::mutex mutex_;
+  };
+
   // Note: if you're creating a pure C++ cache (and it's not ridiculously
   // large), define it in this file and implement it in
   // src/libawkward/virtual/ArrayCache.cpp.
@@ -208,6 +208,12 @@ def tolookup(layout, positions, sharedptrs, arrays):
             layout, positions, sharedptrs, arrays
         )
 
+    elif isinstance(
+        layout, (awkward1.layout.ConstantArray, awkward1.layout.RangeArray)
+    ):
+        # no Numba type of its own: Numba sees the materialized array
+        return tolookup(layout.toNumpyArray(), positions, sharedptrs, arrays)
+
     else:
         raise AssertionError(
             "unrecognized Content or Form type: {0}".format(type(layout))
@@ -133,6 +133,16 @@ def typeof_VirtualArray(obj, c):
     return VirtualArrayType(obj.form.form, numba.none, obj.parameters)
 
 
+@numba.extending.typeof_impl.register(awkward1.layout.ConstantArray)
+def typeof_ConstantArray(obj, c):
+    return numba.typeof(obj.toNumpyArray())
+
+
+@numba.extending.typeof_impl.register(awkward1.layout.RangeArray)
+def typeof_RangeArray(obj, c):
+    return numba.typeof(obj.toNumpyArray())
+
+
 class ContentType(numba.types.Type):
     @classmethod
     def tolookup_identities(cls, layout, positions, sharedptrs, arrays):
@@ -102,6 +102,30 @@ def array_ufunc(ufunc, method, inputs, kwargs):
 
         return None
 
+    skips = awkward1.partition.zonemap_skips(ufunc, inputs)
+    if skips is not None:
+        array, skips = skips
+        outparts = []
+        for partition, skip in zip(array.partitions, skips):
+            if skip:
+                # zone map says no value can pass: don't read the partition
+                outparts.append(
+                    awkward1.layout.NumpyArray(
+                        numpy.zeros(len(partition), dtype=numpy.bool_)
+                    )
+                )
+            else:
+                nextinputs = [partition if x is array else x for x in inputs]
+                out = awkward1._util.broadcast_and_apply(
+                    nextinputs, getfunction, behavior
+                )
+                assert isinstance(out, tuple) and len(out) == 1
+                outparts.append(out[0])
+        return awkward1._util.wrap(
+            awkward1.partition.IrregularlyPartitionedArray(outparts, array.stops),
+            behavior,
+        )
+
     out = awkward1._util.broadcast_and_apply(inputs, getfunction, behavior)
     assert isinstance(out, tuple) and len(out) == 1
     return awkward1._util.wrap(out[0], behavior)
@@ -27,7 +27,14 @@ if py27:
 else:
     unicode = None
 
-virtualtypes = (awkward1.layout.VirtualArray,)
+virtualtypes = (
+    awkward1.layout.VirtualArray,
+    awkward1.layout.ConstantArray,
+    awkward1.layout.RangeArray,
+    awkward1.layout.InterleavedArray,
+    awkward1.layout.BitPackedArray,
+    awkward1.layout.QuantizedArray,
+)
 
 unknowntypes = (awkward1.layout.EmptyArray,)
 
@@ -1096,7 +1103,7 @@ def recursively_apply(layout, getfunction, args=(), depth=1, keep_parameters=Tru
             layout.parameters if keep_parameters else None,
         )
 
-    elif isinstance(layout, awkward1.layout.VirtualArray):
+    elif isinstance(layout, virtualtypes):
         return recursively_apply(
             layout.array, getfunction, args, depth, keep_parameters
         )
@@ -13,7 +13,11 @@ from awkward1._ext import Identities64
 
 from awkward1._ext import Iterator
 from awkward1._ext import ArrayBuilder
+from awkward1._ext import ChunkedArrayBuilder
 from awkward1._ext import _PersistentSharedPtr
+from awkward1._ext import QuantileSketch
+from awkward1._ext import HyperLogLog
+from awkward1._ext import BinnedLookup
 
 from awkward1._ext import Content
 
@@ -52,5 +56,14 @@ from awkward1._ext import VirtualArray
 from awkward1._ext import ArrayGenerator
 from awkward1._ext import SliceGenerator
 from awkward1._ext import ArrayCache
+from awkward1._ext import MemoryCache
+from awkward1._ext import setmemocache
+from awkward1._ext import memocache
+
+from awkward1._ext import ConstantArray
+from awkward1._ext import RangeArray
+from awkward1._ext import InterleavedArray
+from awkward1._ext import BitPackedArray
+from awkward1._ext import QuantizedArray
 
 from awkward1._ext import _slice_tostring
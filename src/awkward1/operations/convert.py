@@ -1075,6 +1075,20 @@ def to_awkward0(array, keeplayout=False):
         elif isinstance(layout, awkward1.layout.VirtualArray):
             raise NotImplementedError("FIXME")
 
+        elif isinstance(
+            layout,
+            (
+                awkward1.layout.ConstantArray,
+                awkward1.layout.RangeArray,
+                awkward1.layout.BitPackedArray,
+                awkward1.layout.QuantizedArray,
+            ),
+        ):
+            return recurse(layout.toNumpyArray())
+
+        elif isinstance(layout, awkward1.layout.InterleavedArray):
+            return recurse(layout.toRecordArray())
+
         else:
             raise AssertionError(
                 "missing converter for {0}".format(type(layout).__name__)
@@ -1197,6 +1211,18 @@ def regularize_numpyarray(array, allow_empty=True, highlevel=True):
             # FIXME: we must transform the Form (replacing inner_shape with
             # RegularForms) and wrap the ArrayGenerator with regularize_numpy
             return lambda: layout
+        elif isinstance(
+            layout,
+            (
+                awkward1.layout.ConstantArray,
+                awkward1.layout.RangeArray,
+                awkward1.layout.BitPackedArray,
+                awkward1.layout.QuantizedArray,
+            ),
+        ):
+            return lambda: regularize_numpyarray(
+                layout.toNumpyArray(), allow_empty=allow_empty, highlevel=False
+            )
         else:
             return None
 
@@ -1558,6 +1584,20 @@ def to_arrow(array):
         elif isinstance(layout, (awkward1.layout.UnmaskedArray)):
             return recurse(layout.content)
 
+        elif isinstance(
+            layout,
+            (
+                awkward1.layout.ConstantArray,
+                awkward1.layout.RangeArray,
+                awkward1.layout.BitPackedArray,
+                awkward1.layout.QuantizedArray,
+            ),
+        ):
+            return recurse(layout.toNumpyArray(), mask)
+
+        elif isinstance(layout, awkward1.layout.InterleavedArray):
+            return recurse(layout.toRecordArray(), mask)
+
         else:
             raise TypeError("unrecognized array type: {0}".format(repr(layout)))
 
@@ -190,6 +190,7 @@ type.dtype2primitive = {
     numpy.uint16: "uint16",
     numpy.uint32: "uint32",
     numpy.uint64: "uint64",
+    numpy.float16: "float16",
     numpy.float32: "float32",
     numpy.float64: "float64",
 }
@@ -740,6 +740,153 @@ def argmax(array, axis=None, keepdims=False, mask_identity=True):
         )
 
 
+def quantile(array, q, axis=None, keepdims=False, mask_identity=True, k=200):
+    """
+    Args:
+        array: Data from which to estimate quantiles.
+        q (float): Fraction of the distribution, from `0` to `1` (e.g. `0.5`
+            for the median).
+        axis (None or int): If None, combine all values from the array into
+            a single scalar result; if an int, group by that axis: `0` is the
+            outermost, `1` is the first level of nested lists, etc., and
+            negative `axis` counts from the innermost: `-1` is the innermost,
+            `-2` is the next level up, etc.
+        keepdims (bool): If False, this reducer descreases the number of
+            dimensions by 1; if True, the reduced values are wrapped in a new
+            length-1 dimension so that the result of this operation may be
+            broadcasted with the original array.
+        mask_identity (bool): If True, reducing over empty lists results in
+            None (an option type); otherwise, reducing over empty lists
+            results in `nan`.
+        k (int): Accuracy of the sketches: the rank of each result is within
+            about `2/k` of the requested `q` (as a fraction of the number of
+            values in the group).
+
+    Returns an approximate `q` quantile of each group of elements from
+    `array` as a floating-point number, without sorting the groups. Each
+    group is summarized by a mergeable sketch (#ak.layout.QuantileSketch)
+    of about `3*k` values, so groups with fewer than `k` values get the exact
+    quantile, in the sense of NumPy's
+    [quantile](https://docs.scipy.org/doc/numpy/reference/generated/numpy.quantile.html)
+    with `interpolation="lower"` (no interpolation between values).
+
+    With `axis=None`, each partition of a partitioned array is summarized
+    separately and the sketches are merged.
+
+    See #ak.sum for a more complete description of nested list and missing
+    value (None) handling in reducers.
+    """
+    layout = awkward1.operations.convert.to_layout(
+        array, allow_record=False, allow_other=False
+    )
+    if axis is None:
+        sketch = awkward1.layout.QuantileSketch(k)
+        partitions = (
+            layout.partitions
+            if isinstance(layout, awkward1.partition.PartitionedArray)
+            else [layout]
+        )
+        for partition in partitions:
+            partial = awkward1.layout.QuantileSketch(k)
+            for tmp in awkward1._util.completely_flatten(partition):
+                partial.update(tmp.reshape(-1))
+            sketch.merge(partial)
+        if sketch.count == 0:
+            return None
+        return sketch.quantile(q)
+    else:
+        behavior = awkward1._util.behaviorof(array)
+        return awkward1._util.wrap(
+            layout.quantile(q, axis=axis, mask=mask_identity, keepdims=keepdims, k=k),
+            behavior,
+        )
+
+
+def count_distinct(array, axis=None, keepdims=False, mask_identity=False, precision=12):
+    """
+    Args:
+        array: Data in which to count distinct values.
+        axis (None or int): If None, combine all values from the array into
+            a single scalar result; if an int, group by that axis: `0` is the
+            outermost, `1` is the first level of nested lists, etc., and
+            negative `axis` counts from the innermost: `-1` is the innermost,
+            `-2` is the next level up, etc.
+        keepdims (bool): If False, this reducer descreases the number of
+            dimensions by 1; if True, the reduced values are wrapped in a new
+            length-1 dimension so that the result of this operation may be
+            broadcasted with the original array.
+        mask_identity (bool): If True, reducing over empty lists results in
+            None (an option type); otherwise, reducing over empty lists
+            results in the operation's identity of 0.
+        precision (int): Each group is summarized by a HyperLogLog with
+            `2**precision` registers, from `4` to `18`; the standard error
+            is about `1.04/sqrt(2**precision)`.
+
+    Returns an estimate of the number of distinct values in each group of
+    elements from `array`, without sorting. Strings (and bytestrings) are
+    treated as single values. Groups with fewer than about
+    `2**precision / 16` distinct values are counted exactly, up to 64-bit
+    hash collisions.
+
+    Integers are compared by value, regardless of their type, but
+    floating-point numbers are distinct from integers (`1.0` is not `1`).
+
+    With `axis=None`, each partition of a partitioned array is summarized
+    separately and the sketches are merged.
+
+    See #ak.sum for a more complete description of nested list and missing
+    value (None) handling in reducers.
+    """
+    layout = awkward1.operations.convert.to_layout(
+        array, allow_record=False, allow_other=False
+    )
+
+    def getfunction(layout, depth):
+        if isinstance(
+            layout,
+            (
+                awkward1.layout.ListArray32,
+                awkward1.layout.ListArrayU32,
+                awkward1.layout.ListArray64,
+                awkward1.layout.ListOffsetArray32,
+                awkward1.layout.ListOffsetArrayU32,
+                awkward1.layout.ListOffsetArray64,
+            ),
+        ) and layout.parameter("__array__") in ("string", "bytestring"):
+            return lambda: layout.hash64()
+        else:
+            return None
+
+    layout = awkward1._util.recursively_apply(
+        layout, getfunction, keep_parameters=False
+    )
+
+    if axis is None:
+        sketch = awkward1.layout.HyperLogLog(precision)
+        partitions = (
+            layout.partitions
+            if isinstance(layout, awkward1.partition.PartitionedArray)
+            else [layout]
+        )
+        for partition in partitions:
+            partial = awkward1.layout.HyperLogLog(precision)
+            for tmp in awkward1._util.completely_flatten(partition):
+                if len(tmp) > 0:
+                    partial.update(
+                        numpy.asarray(awkward1.layout.NumpyArray(tmp).hash64())
+                    )
+            sketch.merge(partial)
+        return int(round(sketch.estimate()))
+    else:
+        behavior = awkward1._util.behaviorof(array)
+        return awkward1._util.wrap(
+            layout.count_distinct(
+                axis=axis, mask=mask_identity, keepdims=keepdims, precision=precision
+            ),
+            behavior,
+        )
+
+
 # The following are not strictly reducers, but are defined in terms of
 # reducers and ufuncs.
 
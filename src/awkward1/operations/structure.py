@@ -368,6 +368,169 @@ def unzip(array):
         return tuple(array[n] for n in keys)
 
 
+def interleaved(array, highlevel=True):
+    """
+    Args:
+        array: Data containing records or tuples.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+
+    Returns an array with the same values in which every record or tuple
+    whose fields are all numbers of the same type is stored as an
+    #ak.layout.InterleavedArray: all fields of one record are next to each
+    other in memory, rather than in a separate array for each field.
+
+    This helps computations that read several fields of each record at
+    once, such as the mass of a Lorentz vector from `px`, `py`, `pz`, and
+    `E`, which then read one stream of data, rather than four. Selecting a
+    field is a strided view, so it does not copy anything.
+
+    To interleave only some fields, #ak.zip them into a record of their
+    own first. For example,
+
+        >>> p4 = ak.interleaved(ak.zip({"px": px, "py": py, "pz": pz, "E": E}))
+
+    Records with fields of different types or with nested fields are left
+    as they are.
+    """
+
+    def getfunction(layout, depth):
+        if (
+            isinstance(layout, awkward1.layout.RecordArray)
+            and layout.isinterleavable
+        ):
+            return lambda: layout.toInterleavedArray()
+        elif isinstance(layout, awkward1.layout.InterleavedArray):
+            return lambda: layout
+        else:
+            return None
+
+    out = awkward1._util.recursively_apply(
+        awkward1.operations.convert.to_layout(array), getfunction
+    )
+    if highlevel:
+        return awkward1._util.wrap(out, awkward1._util.behaviorof(array))
+    else:
+        return out
+
+
+def bitpacked(array, lsb_order=True, highlevel=True):
+    """
+    Args:
+        array: Data containing booleans.
+        lsb_order (bool): If True, the bits in each byte are in
+            Least Significant Bit (LSB) order, as in Arrow; otherwise, they
+            are in Most Significant Bit (MSB) order, as in `numpy.packbits`.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+
+    Returns an array with the same values in which every array of booleans
+    is stored as an #ak.layout.BitPackedArray: one bit per value, rather
+    than one byte.
+
+    This is intended for masks that are kept for a while, such as the
+    result of a selection on all events,
+
+        >>> passing = ak.bitpacked(events.muons.pt > 20)
+
+    which then takes an eighth of the memory. Selecting with it,
+
+        >>> events.muons[passing]
+
+    counts and finds the true values directly from the bits; most other
+    operations unpack them first.
+    """
+
+    def getfunction(layout, depth):
+        if (
+            isinstance(layout, awkward1.layout.NumpyArray)
+            and layout.format == "?"
+            and layout.ndim == 1
+        ):
+            return lambda: layout.toBitPackedArray(lsb_order)
+        elif isinstance(layout, awkward1.layout.BitPackedArray):
+            if layout.lsb_order == lsb_order:
+                return lambda: layout
+            else:
+                return lambda: layout.toNumpyArray().toBitPackedArray(lsb_order)
+        else:
+            return None
+
+    out = awkward1._util.recursively_apply(
+        awkward1.operations.convert.to_layout(array), getfunction
+    )
+    if highlevel:
+        return awkward1._util.wrap(out, awkward1._util.behaviorof(array))
+    else:
+        return out
+
+
+def quantized(array, scale, offset=0.0, dtype=numpy.int16, highlevel=True):
+    """
+    Args:
+        array: Data containing floating point numbers.
+        scale (float): Distance between neighboring representable values.
+        offset (float): Value represented by an integer zero.
+        dtype (integer dtype): Type of the stored integers.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+
+    Returns an array in which every array of floating point numbers is
+    rounded to the nearest `scale * integer + offset` and stored as an
+    #ak.layout.QuantizedArray of `dtype` integers.
+
+    This is a lossy conversion, intended for quantities whose precision is
+    known to be limited, such as
+
+        >>> ak.quantized(events.muons.pt, 0.01, dtype=np.uint16)
+
+    which takes a quarter of the memory. `sum`, `count`, and (with a
+    positive `scale`) `argmin` and `argmax` are computed from the integers;
+    most other operations convert them back to floating point first.
+
+    If any value is NaN or does not fit in `dtype` after rounding, this
+    function raises a ValueError.
+    """
+    dtype = numpy.dtype(dtype)
+    if not issubclass(dtype.type, numpy.integer):
+        raise ValueError("dtype must be an integer type, not {0}".format(dtype))
+    if not scale != 0:
+        raise ValueError("scale must be nonzero")
+    info = numpy.iinfo(dtype)
+
+    def getfunction(layout, depth):
+        if (
+            isinstance(layout, awkward1.layout.NumpyArray)
+            and layout.format in ("d", "f", "e")
+            and layout.ndim == 1
+        ):
+            rounded = numpy.round((numpy.asarray(layout) - offset) / scale)
+            if len(rounded) != 0 and not (
+                info.min <= numpy.min(rounded) and numpy.max(rounded) <= info.max
+            ):
+                raise ValueError(
+                    "values are NaN or out of range for {0} with scale {1} "
+                    "and offset {2}".format(dtype, scale, offset)
+                )
+            return lambda: awkward1.layout.QuantizedArray(
+                rounded.astype(dtype),
+                scale,
+                offset,
+                layout.identities,
+                layout.parameters,
+            )
+        else:
+            return None
+
+    out = awkward1._util.recursively_apply(
+        awkward1.operations.convert.to_layout(array), getfunction
+    )
+    if highlevel:
+        return awkward1._util.wrap(out, awkward1._util.behaviorof(array))
+    else:
+        return out
+
+
 def with_name(array, name, highlevel=True):
     """
     Args:
@@ -474,11 +637,7 @@ def with_field(base, what, where=None, highlevel=True):
             base, what = inputs
             if isinstance(base, awkward1.layout.RecordArray):
                 if not isinstance(what, awkward1.layout.Content):
-                    what = awkward1.layout.NumpyArray(
-                        numpy.lib.stride_tricks.as_strided(
-                            [what], shape=(len(base),), strides=(0,)
-                        )
-                    )
+                    what = awkward1.layout.ConstantArray(what, len(base))
                 return lambda: (base.setitem_field(where, what),)
             else:
                 return None
@@ -2091,6 +2250,326 @@ def argcombinations(
             return out
 
 
+@awkward1._connect._numpy.implements(numpy.searchsorted)
+def searchsorted(a, v, side="left", sorter=None, highlevel=True):
+    """
+    Args:
+        a: One-dimensional bin edges, in increasing order (unless `sorter`
+            is given).
+        v: Values to search for, which may be any Awkward Array of numbers,
+            including nested lists and missing values.
+        side ("left" or "right"): If "left", each result is the first
+            suitable position (number of edges less than the value); if
+            "right", the last (number of edges less than or equal to the
+            value).
+        sorter (None or array of int): Indices that sort `a` into increasing
+            order.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+
+    Implements NumPy's
+    [searchsorted](https://docs.scipy.org/doc/numpy/reference/generated/numpy.searchsorted.html)
+    function for values `v` in an Awkward Array, preserving their structure:
+    each number is replaced by the int64 index at which it would be
+    inserted into `a` to keep it sorted. For example,
+
+        >>> ak.searchsorted([0, 10, 20], ak.Array([[5, 15], [], [25]]))
+        <Array [[1, 2], [], [3]] type='3 * var * int64'>
+
+    The search is done in compiled code without flattening `v`, which makes
+    it the first step of applying a binned correction to jagged data.
+    Values are compared as double-precision numbers and NaN is placed after
+    all edges.
+
+    See also #ak.digitize.
+    """
+    edges = numpy.asarray(a, dtype=numpy.float64)
+    if edges.ndim != 1:
+        raise ValueError("searchsorted edges must be one-dimensional")
+    if sorter is not None:
+        edges = edges[numpy.asarray(sorter)]
+    if side not in ("left", "right"):
+        raise ValueError("side must be 'left' or 'right', not {0}".format(repr(side)))
+    right = side == "right"
+
+    def getfunction(layout, depth):
+        if isinstance(layout, awkward1.layout.NumpyArray):
+            return lambda: layout.searchsorted(edges, right)
+        elif isinstance(layout, awkward1.layout.EmptyArray):
+            return lambda: awkward1.layout.NumpyArray(numpy.empty(0, numpy.int64))
+        else:
+            return None
+
+    layout = awkward1.operations.convert.to_layout(
+        v, allow_record=False, allow_other=False
+    )
+    out = awkward1._util.recursively_apply(layout, getfunction, keep_parameters=False)
+    if highlevel:
+        return awkward1._util.wrap(out, behavior=awkward1._util.behaviorof(v))
+    else:
+        return out
+
+
+@awkward1._connect._numpy.implements(numpy.digitize)
+def digitize(x, bins, right=False, highlevel=True):
+    """
+    Args:
+        x: Values to bin, which may be any Awkward Array of numbers,
+            including nested lists and missing values.
+        bins: One-dimensional bin edges, either increasing or decreasing.
+        right (bool): If False, each bin includes its left edge; if True,
+            its right edge.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+
+    Implements NumPy's
+    [digitize](https://docs.scipy.org/doc/numpy/reference/generated/numpy.digitize.html)
+    function for values `x` in an Awkward Array, preserving their structure:
+    values below the first edge are in bin `0`, values in the first bin are
+    in bin `1`, and values beyond the last edge are in bin `len(bins)`.
+
+        >>> ak.digitize(ak.Array([[5, 15], [], [25, -5]]), [0, 10, 20])
+        <Array [[1, 2], [], [3, 0]] type='3 * var * int64'>
+
+    See also #ak.searchsorted.
+    """
+    edges = numpy.asarray(bins, dtype=numpy.float64)
+    if edges.ndim != 1:
+        raise ValueError("digitize bins must be one-dimensional")
+    side = "left" if right else "right"
+
+    if len(edges) > 1 and edges[0] > edges[-1]:
+        flipped = edges[::-1]
+
+        def getfunction(layout, depth):
+            if isinstance(layout, awkward1.layout.NumpyArray):
+                return lambda: awkward1.layout.NumpyArray(
+                    len(edges)
+                    - numpy.asarray(layout.searchsorted(flipped, side == "right"))
+                )
+            elif isinstance(layout, awkward1.layout.EmptyArray):
+                return lambda: awkward1.layout.NumpyArray(
+                    numpy.empty(0, numpy.int64)
+                )
+            else:
+                return None
+
+        layout = awkward1.operations.convert.to_layout(
+            x, allow_record=False, allow_other=False
+        )
+        out = awkward1._util.recursively_apply(
+            layout, getfunction, keep_parameters=False
+        )
+        if highlevel:
+            return awkward1._util.wrap(out, behavior=awkward1._util.behaviorof(x))
+        else:
+            return out
+
+    else:
+        return searchsorted(edges, x, side=side, highlevel=highlevel)
+
+
+def binned_lookup(table, edges, inputs, interpolate=False, highlevel=True):
+    """
+    Args:
+        table: Dense N-dimensional array of values, such as scale factors,
+            or an #ak.layout.BinnedLookup that was already built from one.
+        edges (None or list of arrays): Bin edges for each of the N axes of
+            `table`, each strictly increasing and one longer than the
+            number of bins on its axis; must be None if `table` is an
+            #ak.layout.BinnedLookup.
+        inputs (list of arrays): N arrays of coordinates, one per axis, with
+            the same structure (or broadcastable to it).
+        interpolate (bool): If False, use the value of the bin containing
+            each set of coordinates; if True, interpolate linearly between
+            bin centers on each axis.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+
+    Returns the values of `table` looked up at the coordinates given by
+    `inputs`, with the same structure as the `inputs`. For example, with
+    a table of scale factors binned in pT and eta,
+
+        >>> sf = ak.binned_lookup(table, [pt_edges, eta_edges],
+        ...                       [jets.pt, jets.eta])
+
+    gives one scale factor per jet, in the same nested lists as `jets`,
+    without flattening and unflattening the inputs.
+
+    Coordinates beyond the first or last edge of an axis are clamped to
+    the first or last bin (or held at the first or last bin center when
+    interpolating), and NaN coordinates give NaN.
+
+    To evaluate the same table many times, build an #ak.layout.BinnedLookup
+    once and pass it as `table`.
+    """
+    if isinstance(table, awkward1.layout.BinnedLookup):
+        if edges is not None:
+            raise ValueError("edges must be None if table is a BinnedLookup")
+        lookup = table
+    else:
+        lookup = awkward1.layout.BinnedLookup(
+            numpy.asarray(table, dtype=numpy.float64),
+            [numpy.asarray(x, dtype=numpy.float64) for x in edges],
+        )
+    if len(inputs) != lookup.numaxes:
+        raise ValueError(
+            "binned_lookup table has {0} axes, but {1} inputs were "
+            "given".format(lookup.numaxes, len(inputs))
+        )
+
+    behavior = awkward1._util.behaviorof(*inputs)
+    layouts = [
+        awkward1.operations.convert.to_layout(x, allow_record=False, allow_other=True)
+        for x in inputs
+    ]
+
+    def getfunction(inputs, depth):
+        if all(
+            isinstance(x, awkward1.layout.NumpyArray)
+            or not isinstance(
+                x, (awkward1.layout.Content, awkward1.partition.PartitionedArray)
+            )
+            for x in inputs
+        ):
+            shape = None
+            for x in inputs:
+                if isinstance(x, awkward1.layout.NumpyArray):
+                    shape = numpy.asarray(x).shape
+            nextinputs = [
+                x
+                if isinstance(x, awkward1.layout.NumpyArray)
+                else awkward1.layout.NumpyArray(
+                    numpy.full(shape, x, dtype=numpy.float64)
+                )
+                for x in inputs
+            ]
+            return lambda: (lookup.evaluate(nextinputs, interpolate),)
+        else:
+            return None
+
+    out = awkward1._util.broadcast_and_apply(layouts, getfunction, behavior)
+    assert isinstance(out, tuple) and len(out) == 1
+    if highlevel:
+        return awkward1._util.wrap(out[0], behavior)
+    else:
+        return out[0]
+
+
+def rolling(array, window, reducer="sum", partial=True, highlevel=True):
+    """
+    Args:
+        array: Array of lists of numbers, possibly nested in further lists
+            or records.
+        window (int): Number of items in a full window; must be positive.
+        reducer (str): One of `"sum"`, `"mean"`, `"min"`, or `"max"`.
+        partial (bool): If True, the first `window - 1` items of each list
+            reduce the fewer items that are available; if False, they are
+            None.
+        highlevel (bool): If True, return an #ak.Array; otherwise, return
+            a low-level #ak.layout.Content subclass.
+
+    Returns a sliding-window (moving, or rolling) reduction within each of
+    the innermost lists: item `j` of a list is the `reducer` of the
+    `window` items of the same list ending at `j`. Windows never cross
+    from one list into the next, and the output has the same lists as
+    the input, with float64 values.
+
+        >>> ak.rolling(ak.Array([[1, 2, 3, 4], [], [5, 6]]), 2)
+        <Array [[1, 3, 5, 7], [], [5, 11]] type='3 * var * float64'>
+        >>> ak.rolling(ak.Array([[1, 2, 3, 4], [], [5, 6]]), 2,
+        ...            reducer="max", partial=False)
+        <Array [[None, 2, 3, 4], [], [None, 6]] type='3 * var * ?float64'>
+
+    The cost is linear in the number of items, regardless of `window`.
+    A NaN makes the sums and means of the windows containing it NaN, but
+    is skipped by `"min"` and `"max"`.
+
+    Missing values are not allowed within the lists; see #ak.fill_none.
+    """
+    if not isinstance(window, (numbers.Integral, numpy.integer)) or window < 1:
+        raise ValueError(
+            "rolling window must be a positive integer, not {0}".format(
+                repr(window)
+            )
+        )
+    if reducer not in ("sum", "mean", "min", "max"):
+        raise ValueError(
+            "rolling reducer must be 'sum', 'mean', 'min', or 'max', "
+            "not {0}".format(repr(reducer))
+        )
+
+    def roll(layout):
+        if isinstance(layout.content, awkward1.layout.EmptyArray):
+            layout = awkward1.layout.ListOffsetArray64(
+                layout.compact_offsets64(True),
+                awkward1.layout.NumpyArray(numpy.empty(0, numpy.float64)),
+            )
+        elif not isinstance(
+            layout,
+            (
+                awkward1.layout.ListOffsetArray32,
+                awkward1.layout.ListOffsetArrayU32,
+                awkward1.layout.ListOffsetArray64,
+            ),
+        ):
+            layout = layout.broadcast_tooffsets64(layout.compact_offsets64(True))
+
+        out = layout.rolling(reducer, window)
+        if not partial:
+            offsets = numpy.asarray(out.offsets)
+            parents = numpy.repeat(
+                numpy.arange(len(offsets) - 1), offsets[1:] - offsets[:-1]
+            )
+            localindex = numpy.arange(offsets[-1]) - offsets[parents]
+            out = awkward1.layout.ListOffsetArray64(
+                out.offsets,
+                awkward1.layout.ByteMaskedArray(
+                    awkward1.layout.Index8(localindex >= window - 1),
+                    out.content,
+                    valid_when=True,
+                ),
+            )
+        return out
+
+    def getfunction(layout, depth):
+        if layout.parameter("__array__") in ("string", "bytestring"):
+            raise ValueError("rolling requires lists of numbers, not strings")
+        elif isinstance(layout, awkward1._util.listtypes) and (
+            isinstance(layout.content, awkward1.layout.EmptyArray)
+            or (
+                isinstance(layout.content, awkward1.layout.NumpyArray)
+                and layout.content.ndim == 1
+            )
+        ):
+            if isinstance(layout, awkward1.layout.RegularArray):
+                return lambda: roll(layout).toRegularArray()
+            else:
+                return lambda: roll(layout)
+        elif isinstance(layout, awkward1.layout.NumpyArray) and layout.ndim > 1:
+            return lambda: awkward1._util.recursively_apply(
+                layout.toRegularArray(), getfunction, keep_parameters=False
+            )
+        elif isinstance(
+            layout, (awkward1.layout.NumpyArray, awkward1.layout.EmptyArray)
+        ):
+            raise ValueError(
+                "rolling requires lists of numbers (without missing values "
+                "within the lists)"
+            )
+        else:
+            return None
+
+    layout = awkward1.operations.convert.to_layout(
+        array, allow_record=False, allow_other=False
+    )
+    out = awkward1._util.recursively_apply(layout, getfunction, keep_parameters=False)
+    if highlevel:
+        return awkward1._util.wrap(out, behavior=awkward1._util.behaviorof(array))
+    else:
+        return out
+
+
 def partitions(array):
     """
     Args:
@@ -2115,7 +2594,7 @@ def partitions(array):
         return None
 
 
-def partitioned(generate, numpartitions, highlevel=True, behavior=None):
+def partitioned(generate, numpartitions, highlevel=True, behavior=None, zonemaps=False):
     """
     Args:
         generate (int -> array): A function that generates an array partition
@@ -2126,6 +2605,11 @@ def partitioned(generate, numpartitions, highlevel=True, behavior=None):
             subclass.
         behavior (bool): Custom #ak.behavior for the output array, if
             high-level.
+        zonemaps (bool, dict, or JSON): If True, compute the minimum,
+            maximum, and number of missing values of each numeric field in
+            each partition as it is generated; if a dict or its JSON string
+            (such as the `zonemaps` of a previously partitioned array), use
+            these precomputed values.
 
     Returns a partitioned array, produced by calling a function for each
     partition.
@@ -2136,10 +2620,40 @@ def partitioned(generate, numpartitions, highlevel=True, behavior=None):
 
     Arrays can only be partitioned in the first dimension; it is intended
     for performing calculations in memory-sized chunks.
+
+    Zone maps let comparisons of a one-dimensional field with a number,
+    such as `array.run == 123456`, skip partitions whose range of values
+    can't satisfy the comparison, and slicing with the result skips them
+    as well. Without precomputed zone maps, they are computed on the first
+    comparison and reused by later ones.
+
+    Zone maps are JSON-compatible: a dict from field path (field names
+    joined by `"."`, such as `"y.z"`, with `"."` and backslash in names
+    escaped by a backslash, and `""` for a non-record array) to a list of
+    `{"min", "max", "nulls"}` per partition. They can therefore be saved
+    with the partitions' Form, and an array of #ak.virtual partitions made
+    from both skips partitions without reading them:
+
+        >>> form = array.layout.partition(0).form.tojson()
+        >>> zonemaps = json.dumps(array.layout.zonemaps)
+        >>> lengths = ak.partitions(array)
+
+    and later
+
+        >>> def generate(i):
+        ...     return ak.virtual(read, args=(i,), form=form, length=lengths[i])
+        ...
+        >>> array = ak.partitioned(generate, len(lengths), zonemaps=zonemaps)
     """
+    if isinstance(zonemaps, str) or (
+        awkward1._util.py27 and isinstance(zonemaps, awkward1._util.unicode)
+    ):
+        zonemaps = json.loads(zonemaps)
+
     total_length = 0
     partitions = []
     stops = []
+    computed = []
     for partitionid in range(numpartitions):
         layout = awkward1.operations.convert.to_layout(
             generate(partitionid), allow_record=False, allow_other=False
@@ -2147,8 +2661,20 @@ def partitioned(generate, numpartitions, highlevel=True, behavior=None):
         total_length += len(layout)
         partitions.append(layout)
         stops.append(total_length)
-
-    out = awkward1.partition.IrregularlyPartitionedArray(partitions, stops)
+        if zonemaps is True:
+            computed.append(awkward1.partition.zonemaps_of(layout))
+
+    if zonemaps is True:
+        paths = set()
+        for x in computed:
+            paths.update(x)
+        zonemaps = dict((path, [x.get(path) for x in computed]) for path in paths)
+    elif zonemaps is False:
+        zonemaps = None
+
+    out = awkward1.partition.IrregularlyPartitionedArray(
+        partitions, stops, zonemaps=zonemaps
+    )
     if highlevel:
         return awkward1._util.wrap(out, behavior=behavior)
     else:
@@ -2289,6 +2815,7 @@ def virtual(
     if form in (
         "float64",
         "float32",
+        "float16",
         "int64",
         "uint64",
         "int32",
@@ -95,6 +95,143 @@ def apply(function, array):
     return IrregularlyPartitionedArray([function(x) for x in array.partitions])
 
 
+def zonemap_of(layout):
+    # min/max of all numbers at any depth (ignoring NaN) and the number of
+    # missing values; None if the values are not numbers
+    if isinstance(layout, awkward1.layout.NumpyArray):
+        if layout.parameter("__array__") in ("char", "byte"):
+            return None
+        array = numpy.asarray(layout).reshape(-1)
+        if array.dtype.kind not in ("b", "i", "u", "f"):
+            return None
+        if array.dtype.kind == "f":
+            array = array[~numpy.isnan(array)]
+        if len(array) == 0:
+            return {"min": None, "max": None, "nulls": 0}
+        return {"min": array.min().item(), "max": array.max().item(), "nulls": 0}
+
+    elif isinstance(layout, awkward1._util.virtualtypes):
+        return zonemap_of(layout.array)
+
+    elif isinstance(layout, awkward1._util.unknowntypes):
+        return {"min": None, "max": None, "nulls": 0}
+
+    elif isinstance(layout, awkward1._util.indexedtypes):
+        return zonemap_of(layout.project())
+
+    elif isinstance(layout, awkward1._util.optiontypes):
+        out = zonemap_of(layout.project())
+        if out is not None:
+            out["nulls"] += int(numpy.count_nonzero(numpy.asarray(layout.bytemask())))
+        return out
+
+    elif isinstance(layout, awkward1._util.listtypes):
+        if layout.parameter("__array__") in ("string", "bytestring"):
+            return None
+        return zonemap_of(layout.flatten(axis=1))
+
+    else:
+        return None
+
+
+def zonemap_key(path):
+    # field path (tuple of str) -> JSON-compatible key: "y.z", with dots and
+    # backslashes in field names escaped by a backslash; "" is the array
+    return ".".join(x.replace("\\", "\\\\").replace(".", "\\.") for x in path)
+
+
+def zonemap_path(key):
+    # inverse of zonemap_key
+    if key == "":
+        return ()
+    out = []
+    current = []
+    escaped = False
+    for char in key:
+        if escaped:
+            current.append(char)
+            escaped = False
+        elif char == "\\":
+            escaped = True
+        elif char == ".":
+            out.append("".join(current))
+            current = []
+        else:
+            current.append(char)
+    out.append("".join(current))
+    return tuple(out)
+
+
+def zonemaps_of(layout, path=()):
+    return dict((zonemap_key(k), v) for k, v in _zonemaps_of(layout, path).items())
+
+
+def _zonemaps_of(layout, path):
+    if layout.numfields > 0:
+        out = {}
+        for key in layout.keys():
+            out.update(_zonemaps_of(layout[key], path + (key,)))
+        return out
+    else:
+        zonemap = zonemap_of(layout)
+        if zonemap is None:
+            return {}
+        else:
+            return {path: zonemap}
+
+
+# for each comparison, whether it is False for every value in [min, max]
+_zonemap_excludes = {
+    numpy.equal: lambda low, high, value: value < low or high < value,
+    numpy.less: lambda low, high, value: low >= value,
+    numpy.less_equal: lambda low, high, value: low > value,
+    numpy.greater: lambda low, high, value: high <= value,
+    numpy.greater_equal: lambda low, high, value: high < value,
+}
+
+_zonemap_flipped = {
+    numpy.equal: numpy.equal,
+    numpy.less: numpy.greater,
+    numpy.less_equal: numpy.greater_equal,
+    numpy.greater: numpy.less,
+    numpy.greater_equal: numpy.less_equal,
+}
+
+
+def zonemap_skips(ufunc, inputs):
+    if len(inputs) != 2 or ufunc not in _zonemap_excludes:
+        return None
+    array, value = inputs
+    if not isinstance(array, PartitionedArray):
+        value, array = inputs
+        ufunc = _zonemap_flipped[ufunc]
+    if (
+        not isinstance(array, PartitionedArray)
+        or isinstance(value, (bool, numpy.bool_))
+        or not isinstance(value, (numbers.Real, numpy.number))
+        or array.purelist_depth != 1
+        or array.parameter("__array__") is not None
+    ):
+        return None
+
+    excludes = _zonemap_excludes[ufunc]
+    skips = []
+    for zonemap in array.zonemap():
+        skips.append(
+            zonemap is not None
+            and zonemap["nulls"] == 0
+            and (
+                zonemap["min"] is None
+                or excludes(zonemap["min"], zonemap["max"], value)
+            )
+        )
+
+    if any(skips):
+        return array, skips
+    else:
+        return None
+
+
 class PartitionedArray(object):
     @classmethod
     def from_ext(cls, obj):
@@ -139,6 +276,35 @@ class PartitionedArray(object):
     def stop(self, partitionid):
         return self._ext.stop(partitionid)
 
+    def _zonemap_root(self):
+        # shared by all field projections of the same array, keyed by path
+        if getattr(self, "_zonemaps", None) is None:
+            self._zonemaps = {}
+            self._zonemappath = ()
+        return self._zonemaps, self._zonemappath
+
+    def _share_zonemaps(self, parent, key):
+        zonemaps, path = parent._zonemap_root()
+        self._zonemaps = zonemaps
+        self._zonemappath = path + (key,)
+
+    @property
+    def zonemaps(self):
+        zonemaps, path = self._zonemap_root()
+        return dict(
+            (zonemap_key(k[len(path) :]), v)
+            for k, v in zonemaps.items()
+            if k[: len(path)] == path
+        )
+
+    def zonemap(self, compute=True):
+        zonemaps, path = self._zonemap_root()
+        out = zonemaps.get(path)
+        if out is None and compute:
+            out = [zonemap_of(x) for x in self.partitions]
+            zonemaps[path] = out
+        return out
+
     def partitionid_index_at(self, at):
         return self._ext.partitionid_index_at(at)
 
@@ -280,6 +446,33 @@ class PartitionedArray(object):
     def argmax(self, axis, mask, keepdims):
         return self.reduce("argmax", axis, mask, keepdims)
 
+    def quantile(self, q, axis, mask, keepdims, k=200):
+        branch, depth = first(self).branch_depth
+        negaxis = -axis
+        if not branch and negaxis <= 0:
+            negaxis += depth
+        if not branch and negaxis == depth:
+            return self.toContent().quantile(q, axis, mask, keepdims, k)
+        else:
+            return self.replace_partitions(
+                [x.quantile(q, axis, mask, keepdims, k) for x in self.partitions]
+            )
+
+    def count_distinct(self, axis, mask, keepdims, precision=12):
+        branch, depth = first(self).branch_depth
+        negaxis = -axis
+        if not branch and negaxis <= 0:
+            negaxis += depth
+        if not branch and negaxis == depth:
+            return self.toContent().count_distinct(axis, mask, keepdims, precision)
+        else:
+            return self.replace_partitions(
+                [
+                    x.count_distinct(axis, mask, keepdims, precision)
+                    for x in self.partitions
+                ]
+            )
+
     def localindex(self, axis):
         if first(self).axis_wrap_if_negative(axis) == 0:
             start = 0
@@ -365,7 +558,9 @@ class PartitionedArray(object):
         elif isinstance(where, str) or (
             awkward1._util.py27 and isinstance(where, awkward1._util.unicode)
         ):
-            return self.replace_partitions([x[where] for x in self.partitions])
+            out = self.replace_partitions([x[where] for x in self.partitions])
+            out._share_zonemaps(self, where)
+            return out
 
         elif isinstance(where, tuple) and len(where) == 0:
             return self
@@ -489,8 +684,18 @@ class PartitionedArray(object):
                     headparts = layout.partitions
                     outparts = []
                     for i in range(len(inparts)):
+                        if isinstance(headparts[i], awkward1.layout.NumpyArray):
+                            mask = numpy.asarray(headparts[i])
+                            if (
+                                mask.dtype == numpy.dtype(numpy.bool_)
+                                and mask.ndim == 1
+                                and not mask.any()
+                            ):
+                                # nothing selected: don't touch this partition
+                                outparts.append(inparts[i][(slice(0, 0),) + tail])
+                                continue
                         outparts.append(inparts[i][(headparts[i],) + tail])
-                    return IrregularlyPartitionedArray(outparts, stops)
+                    return IrregularlyPartitionedArray(outparts)
 
 
 class IrregularlyPartitionedArray(PartitionedArray):
@@ -503,11 +708,22 @@ class IrregularlyPartitionedArray(PartitionedArray):
             start = stop
         return IrregularlyPartitionedArray(partitions, stops)
 
-    def __init__(self, partitions, stops=None):
+    def __init__(self, partitions, stops=None, zonemaps=None):
         if stops is None:
             self._ext = awkward1._ext.IrregularlyPartitionedArray(partitions)
         else:
             self._ext = awkward1._ext.IrregularlyPartitionedArray(partitions, stops)
+        if zonemaps is not None:
+            for path, zonemap in zonemaps.items():
+                if len(zonemap) != len(partitions):
+                    raise ValueError(
+                        "IrregularlyPartitionedArray zonemaps must have the same "
+                        "length as its partitions"
+                    )
+            self._zonemaps = dict(
+                (zonemap_path(k), list(v)) for k, v in zonemaps.items()
+            )
+            self._zonemappath = ()
 
     @property
     def stops(self):
@@ -529,3 +745,84 @@ class IrregularlyPartitionedArray(PartitionedArray):
 
     def replace_partitions(self, partitions):
         return IrregularlyPartitionedArray(partitions, self.stops)
+
+
+class PartitionIndex(object):
+    def __init__(self, array, fields, falsepositive=0.01, hashindex=False):
+        import awkward1.operations.convert
+
+        layout = awkward1.operations.convert.to_layout(
+            array, allow_record=False, allow_other=False
+        )
+        if not isinstance(layout, PartitionedArray):
+            layout = single(layout)
+        if isinstance(fields, str) or (
+            awkward1._util.py27 and isinstance(fields, awkward1._util.unicode)
+        ):
+            fields = [fields]
+
+        self._array = layout
+        self._fields = list(fields)
+        self._ext = awkward1._ext.PartitionIndex(
+            len(self._fields), falsepositive, hashindex
+        )
+        for partition in layout.partitions:
+            self._ext.append([self._column(partition, x) for x in self._fields])
+
+    @staticmethod
+    def _column(partition, field):
+        import awkward1.operations.convert
+
+        return awkward1.layout.NumpyArray(
+            awkward1.operations.convert.to_numpy(partition[field], allow_missing=False)
+        )
+
+    def _key(self, key):
+        if not isinstance(key, (tuple, list)):
+            key = (key,)
+        if len(key) != len(self._fields):
+            raise ValueError(
+                "key {0} does not match the {1} indexed fields".format(
+                    repr(key), len(self._fields)
+                )
+            )
+        return key
+
+    def __repr__(self):
+        return repr(self._ext)
+
+    @property
+    def fields(self):
+        return self._fields
+
+    @property
+    def hashindex(self):
+        return self._ext.hashindex
+
+    def candidates(self, key):
+        # uint64 keys are hashed by their bits, like int64
+        key = [x - 2 ** 64 if x >= 2 ** 63 else x for x in self._key(key)]
+        return self._ext.candidates(key)
+
+    def find(self, key):
+        key = self._key(key)
+        if self._ext.hashindex:
+            # hashes can collide, so check every match against the data
+            out = []
+            signed = [x - 2 ** 64 if x >= 2 ** 63 else x for x in key]
+            for partitionid, index in self._ext.find(signed):
+                partition = self._array.partition(partitionid)
+                if all(partition[n][index] == x for n, x in zip(self._fields, key)):
+                    out.append((partitionid, index))
+            return out
+
+        else:
+            out = []
+            for partitionid in self.candidates(key):
+                partition = self._array.partition(partitionid)
+                mask = numpy.ones(len(partition), dtype=numpy.bool_)
+                for field, x in zip(self._fields, key):
+                    mask &= numpy.asarray(self._column(partition, field)) == x
+                for index in numpy.nonzero(mask)[0]:
+                    out.append((partitionid, int(index)))
+            return out
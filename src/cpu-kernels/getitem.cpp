@@ -364,6 +364,47 @@ ERROR awkward_carry_arange_64(
     length);
 }
 
+ERROR awkward_carry_isrange_64(
+  bool* toisrange,
+  const int64_t* fromcarry,
+  int64_t lencarry) {
+  *toisrange = true;
+  for (int64_t i = 1;  i < lencarry;  i++) {
+    if (fromcarry[i] != fromcarry[0] + i) {
+      *toisrange = false;
+      return success();
+    }
+  }
+  return success();
+}
+
+ERROR awkward_rangearray_fill_64(
+  int64_t* toptr,
+  int64_t start,
+  int64_t step,
+  int64_t length) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toptr[i] = start + i*step;
+  }
+  return success();
+}
+
+ERROR awkward_rangearray_getitem_carry_64(
+  int64_t* toptr,
+  int64_t start,
+  int64_t step,
+  int64_t length,
+  const int64_t* fromcarry,
+  int64_t lencarry) {
+  for (int64_t i = 0;  i < lencarry;  i++) {
+    if (fromcarry[i] >= length) {
+      return failure("index out of range", i, fromcarry[i]);
+    }
+    toptr[i] = start + fromcarry[i]*step;
+  }
+  return success();
+}
+
 template <typename ID, typename T>
 ERROR awkward_identities_getitem_carry(
   ID* newidentitiesptr,
@@ -528,6 +569,56 @@ ERROR awkward_numpyarray_getitem_next_null_64(
     offset,
     pos);
 }
+template <typename T>
+ERROR awkward_numpyarray_getitem_next_null_strided(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t len,
+  int64_t tostride,
+  int64_t fromstride,
+  int64_t offset,
+  const T* pos) {
+  for (int64_t i = 0;  i < len;  i++) {
+    std::memcpy(&toptr[i*tostride],
+                &fromptr[offset + pos[i]*fromstride],
+                (size_t)tostride);
+  }
+  return success();
+}
+ERROR awkward_numpyarray_getitem_next_null_strided_64(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t len,
+  int64_t tostride,
+  int64_t fromstride,
+  int64_t offset,
+  const int64_t* pos) {
+  return awkward_numpyarray_getitem_next_null_strided(
+    toptr,
+    fromptr,
+    len,
+    tostride,
+    fromstride,
+    offset,
+    pos);
+}
+ERROR awkward_numpyarray_getitem_next_null_strided_32(
+  uint8_t* toptr,
+  const uint8_t* fromptr,
+  int64_t len,
+  int64_t tostride,
+  int64_t fromstride,
+  int64_t offset,
+  const int32_t* pos) {
+  return awkward_numpyarray_getitem_next_null_strided(
+    toptr,
+    fromptr,
+    len,
+    tostride,
+    fromstride,
+    offset,
+    pos);
+}
 
 template <typename T>
 ERROR awkward_numpyarray_getitem_next_at(
@@ -738,6 +829,142 @@ ERROR awkward_numpyarray_getitem_boolean_nonzero_64(
     stride);
 }
 
+// bits of a partial last byte that belong to the array
+inline uint8_t awkward_bitpackedarray_lastmask(int64_t length,
+                                              bool lsb_order) {
+  int64_t rem = length % 8;
+  if (rem == 0) {
+    return (uint8_t)255;
+  }
+  else if (lsb_order) {
+    return (uint8_t)((1 << rem) - 1);
+  }
+  else {
+    return (uint8_t)(255 << (8 - rem));
+  }
+}
+
+inline int64_t awkward_bitpackedarray_popcount64(uint64_t word) {
+#if defined __GNUC__ || defined __clang__
+  return (int64_t)__builtin_popcountll(word);
+#else
+  word = word - ((word >> 1) & 0x5555555555555555ULL);
+  word = (word & 0x3333333333333333ULL) +
+         ((word >> 2) & 0x3333333333333333ULL);
+  word = (word + (word >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+  return (int64_t)((word * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// position of the lowest set bit of a nonzero byte
+inline int64_t awkward_bitpackedarray_lowestbit(uint8_t byte) {
+#if defined __GNUC__ || defined __clang__
+  return (int64_t)__builtin_ctz((unsigned int)byte);
+#else
+  int64_t out = 0;
+  while ((byte & 1) == 0) {
+    byte >>= 1;
+    out++;
+  }
+  return out;
+#endif
+}
+
+inline uint8_t awkward_bitpackedarray_reverse(uint8_t byte) {
+  byte = (uint8_t)(((byte & 0xf0) >> 4) | ((byte & 0x0f) << 4));
+  byte = (uint8_t)(((byte & 0xcc) >> 2) | ((byte & 0x33) << 2));
+  return (uint8_t)(((byte & 0xaa) >> 1) | ((byte & 0x55) << 1));
+}
+
+ERROR awkward_bitpackedarray_getitem_numtrue(
+  int64_t* numtrue,
+  const uint8_t* frombits,
+  int64_t bitsoffset,
+  int64_t length,
+  bool lsb_order) {
+  const uint8_t* bits = frombits + bitsoffset;
+  int64_t fullbytes = length / 8;
+  int64_t out = 0;
+  int64_t i = 0;
+  // bit order does not matter for counting: eight bytes at a time
+  for (;  i + 8 <= fullbytes;  i += 8) {
+    uint64_t word;
+    std::memcpy(&word, bits + i, 8);
+    out += awkward_bitpackedarray_popcount64(word);
+  }
+  for (;  i < fullbytes;  i++) {
+    out += awkward_bitpackedarray_popcount64((uint64_t)bits[i]);
+  }
+  if (length % 8 != 0) {
+    out += awkward_bitpackedarray_popcount64(
+      (uint64_t)(bits[fullbytes] &
+                 awkward_bitpackedarray_lastmask(length, lsb_order)));
+  }
+  *numtrue = out;
+  return success();
+}
+
+ERROR awkward_bitpackedarray_getitem_nonzero_64(
+  int64_t* toptr,
+  const uint8_t* frombits,
+  int64_t bitsoffset,
+  int64_t length,
+  bool lsb_order) {
+  const uint8_t* bits = frombits + bitsoffset;
+  int64_t numbytes = (length + 7) / 8;
+  int64_t k = 0;
+  int64_t i = 0;
+  while (i < numbytes) {
+    // skip eight bytes of false at a time
+    if (i + 8 < numbytes) {
+      uint64_t word;
+      std::memcpy(&word, bits + i, 8);
+      if (word == 0) {
+        i += 8;
+        continue;
+      }
+    }
+    uint8_t byte = bits[i];
+    if (i == numbytes - 1) {
+      byte &= awkward_bitpackedarray_lastmask(length, lsb_order);
+    }
+    if (!lsb_order) {
+      byte = awkward_bitpackedarray_reverse(byte);
+    }
+    while (byte != 0) {
+      toptr[k] = i*8 + awkward_bitpackedarray_lowestbit(byte);
+      k++;
+      byte &= (uint8_t)(byte - 1);
+    }
+    i++;
+  }
+  return success();
+}
+
+ERROR awkward_bitpackedarray_getitem_carry_64(
+  uint8_t* tobits,
+  const uint8_t* frombits,
+  int64_t bitsoffset,
+  int64_t length,
+  const int64_t* fromcarry,
+  int64_t lencarry,
+  bool lsb_order) {
+  for (int64_t i = 0;  i < (lencarry + 7) / 8;  i++) {
+    tobits[i] = 0;
+  }
+  for (int64_t i = 0;  i < lencarry;  i++) {
+    int64_t at = fromcarry[i];
+    if (at < 0  ||  at >= length) {
+      return failure("index out of range", i, at);
+    }
+    uint8_t byte = frombits[bitsoffset + at / 8];
+    int64_t frombit = (lsb_order ? at % 8 : 7 - at % 8);
+    int64_t tobit = (lsb_order ? i % 8 : 7 - i % 8);
+    tobits[i / 8] |= (uint8_t)(((byte >> frombit) & 1) << tobit);
+  }
+  return success();
+}
+
 template <typename C, typename T>
 ERROR awkward_listarray_getitem_next_at(
   T* tocarry,
@@ -756,7 +983,7 @@ ERROR awkward_listarray_getitem_next_at(
     if (!(0 <= regular_at  &&  regular_at < length)) {
       return failure("index out of range", i, at);
     }
-    tocarry[i] = fromstarts[startsoffset + i] + regular_at;
+    tocarry[i] = (T)(fromstarts[startsoffset + i] + regular_at);
   }
   return success();
 }
@@ -811,6 +1038,23 @@ ERROR awkward_listarray64_getitem_next_at_64(
     stopsoffset,
     at);
 }
+ERROR awkward_listarray32_getitem_next_at_32(
+  int32_t* tocarry,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t at) {
+  return awkward_listarray_getitem_next_at<int32_t, int32_t>(
+    tocarry,
+    fromstarts,
+    fromstops,
+    lenstarts,
+    startsoffset,
+    stopsoffset,
+    at);
+}
 
 template <typename C>
 ERROR awkward_listarray_getitem_next_range_carrylength(
@@ -932,7 +1176,7 @@ ERROR awkward_listarray_getitem_next_range(
                                     start != kSliceNone, stop != kSliceNone,
                                     length);
       for (int64_t j = regular_start;  j < regular_stop;  j += step) {
-        tocarry[k] = fromstarts[startsoffset + i] + j;
+        tocarry[k] = (T)(fromstarts[startsoffset + i] + j);
         k++;
       }
       tooffsets[i + 1] = (C)k;
@@ -948,7 +1192,7 @@ ERROR awkward_listarray_getitem_next_range(
                                     start != kSliceNone, stop != kSliceNone,
                                     length);
       for (int64_t j = regular_start;  j > regular_stop;  j += step) {
-        tocarry[k] = fromstarts[startsoffset + i] + j;
+        tocarry[k] = (T)(fromstarts[startsoffset + i] + j);
         k++;
       }
       tooffsets[i + 1] = (C)k;
@@ -1025,6 +1269,29 @@ ERROR awkward_listarray64_getitem_next_range_64(
     stop,
     step);
 }
+ERROR awkward_listarray32_getitem_next_range_32(
+  int32_t* tooffsets,
+  int32_t* tocarry,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t start,
+  int64_t stop,
+  int64_t step) {
+  return awkward_listarray_getitem_next_range<int32_t, int32_t>(
+    tooffsets,
+    tocarry,
+    fromstarts,
+    fromstops,
+    lenstarts,
+    startsoffset,
+    stopsoffset,
+    start,
+    stop,
+    step);
+}
 
 template <typename C, typename T>
 ERROR awkward_listarray_getitem_next_range_counts(
@@ -1116,9 +1383,9 @@ ERROR awkward_listarray64_getitem_next_range_spreadadvanced_64(
     lenstarts);
 }
 
-template <typename C, typename T>
+template <typename C, typename T, typename K = T>
 ERROR awkward_listarray_getitem_next_array(
-  T* tocarry,
+  K* tocarry,
   T* toadvanced,
   const C* fromstarts,
   const C* fromstops,
@@ -1145,7 +1412,8 @@ ERROR awkward_listarray_getitem_next_array(
       if (!(0 <= regular_at  &&  regular_at < length)) {
         return failure("index out of range", i, fromarray[j]);
       }
-      tocarry[i*lenarray + j] = fromstarts[startsoffset + i] + regular_at;
+      tocarry[i*lenarray + j] =
+        (K)(fromstarts[startsoffset + i] + regular_at);
       toadvanced[i*lenarray + j] = j;
     }
   }
@@ -1220,10 +1488,33 @@ ERROR awkward_listarray64_getitem_next_array_64(
     lenarray,
     lencontent);
 }
+ERROR awkward_listarray32_getitem_next_array_32(
+  int32_t* tocarry,
+  int64_t* toadvanced,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  const int64_t* fromarray,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t lenstarts,
+  int64_t lenarray,
+  int64_t lencontent) {
+  return awkward_listarray_getitem_next_array<int32_t, int64_t, int32_t>(
+    tocarry,
+    toadvanced,
+    fromstarts,
+    fromstops,
+    fromarray,
+    startsoffset,
+    stopsoffset,
+    lenstarts,
+    lenarray,
+    lencontent);
+}
 
-template <typename C, typename T>
+template <typename C, typename T, typename K = T>
 ERROR awkward_listarray_getitem_next_array_advanced(
-  T* tocarry,
+  K* tocarry,
   T* toadvanced,
   const C* fromstarts,
   const C* fromstops,
@@ -1250,7 +1541,7 @@ ERROR awkward_listarray_getitem_next_array_advanced(
     if (!(0 <= regular_at  &&  regular_at < length)) {
       return failure("index out of range", i, fromarray[fromadvanced[i]]);
     }
-    tocarry[i] = fromstarts[startsoffset + i] + regular_at;
+    tocarry[i] = (K)(fromstarts[startsoffset + i] + regular_at);
     toadvanced[i] = i;
   }
   return success();
@@ -1330,6 +1621,33 @@ ERROR awkward_listarray64_getitem_next_array_advanced_64(
     lenarray,
     lencontent);
 }
+ERROR awkward_listarray32_getitem_next_array_advanced_32(
+  int32_t* tocarry,
+  int64_t* toadvanced,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  const int64_t* fromarray,
+  const int64_t* fromadvanced,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t lenstarts,
+  int64_t lenarray,
+  int64_t lencontent) {
+  return awkward_listarray_getitem_next_array_advanced<int32_t,
+                                                       int64_t,
+                                                       int32_t>(
+    tocarry,
+    toadvanced,
+    fromstarts,
+    fromstops,
+    fromarray,
+    fromadvanced,
+    startsoffset,
+    stopsoffset,
+    lenstarts,
+    lenarray,
+    lencontent);
+}
 
 template <typename C, typename T>
 ERROR awkward_listarray_getitem_carry(
@@ -1414,6 +1732,69 @@ ERROR awkward_listarray64_getitem_carry_64(
     lenstarts,
     lencarry);
 }
+ERROR awkward_listarray32_getitem_carry_32(
+  int32_t* tostarts,
+  int32_t* tostops,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  const int32_t* fromcarry,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t lenstarts,
+  int64_t lencarry) {
+  return awkward_listarray_getitem_carry<int32_t, int32_t>(
+    tostarts,
+    tostops,
+    fromstarts,
+    fromstops,
+    fromcarry,
+    startsoffset,
+    stopsoffset,
+    lenstarts,
+    lencarry);
+}
+ERROR awkward_listarrayU32_getitem_carry_32(
+  uint32_t* tostarts,
+  uint32_t* tostops,
+  const uint32_t* fromstarts,
+  const uint32_t* fromstops,
+  const int32_t* fromcarry,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t lenstarts,
+  int64_t lencarry) {
+  return awkward_listarray_getitem_carry<uint32_t, int32_t>(
+    tostarts,
+    tostops,
+    fromstarts,
+    fromstops,
+    fromcarry,
+    startsoffset,
+    stopsoffset,
+    lenstarts,
+    lencarry);
+}
+ERROR awkward_listarray64_getitem_carry_32(
+  int64_t* tostarts,
+  int64_t* tostops,
+  const int64_t* fromstarts,
+  const int64_t* fromstops,
+  const int32_t* fromcarry,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t lenstarts,
+  int64_t lencarry) {
+  return awkward_listarray_getitem_carry<int64_t, int32_t>(
+    tostarts,
+    tostops,
+    fromstarts,
+    fromstops,
+    fromcarry,
+    startsoffset,
+    stopsoffset,
+    lenstarts,
+    lencarry);
+}
 
 template <typename T>
 ERROR awkward_regulararray_getitem_next_at(
@@ -1,6 +1,13 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <cmath>
 #include <cstring>
+#include <limits>
+#if (defined __GNUC__  ||  defined __clang__)  &&  \
+    (defined __x86_64__  ||  defined __i386__)
+  #define AWKWARD_F16C_DISPATCH
+  #include <immintrin.h>
+#endif
 
 #include "awkward/cpu-kernels/operations.h"
 
@@ -85,9 +92,9 @@ ERROR awkward_regulararray_num_64(
     length);
 }
 
-template <typename T, typename C>
+template <typename T, typename C, typename O = T>
 ERROR awkward_listoffsetarray_flatten_offsets(
-  T* tooffsets,
+  O* tooffsets,
   const C* outeroffsets,
   int64_t outeroffsetsoffset,
   int64_t outeroffsetslen,
@@ -95,8 +102,8 @@ ERROR awkward_listoffsetarray_flatten_offsets(
   int64_t inneroffsetsoffset,
   int64_t inneroffsetslen) {
   for (int64_t i = 0;  i < outeroffsetslen;  i++) {
-    tooffsets[i] =
-      inneroffsets[inneroffsetsoffset + outeroffsets[outeroffsetsoffset + i]];
+    tooffsets[i] = (O)inneroffsets[inneroffsetsoffset +
+                                   outeroffsets[outeroffsetsoffset + i]];
   }
   return success();
 }
@@ -151,6 +158,40 @@ ERROR awkward_listoffsetarray64_flatten_offsets_64(
     inneroffsetsoffset,
     inneroffsetslen);
 }
+ERROR awkward_listoffsetarray32_flatten_offsets_32(
+  int32_t* tooffsets,
+  const int32_t* outeroffsets,
+  int64_t outeroffsetsoffset,
+  int64_t outeroffsetslen,
+  const int64_t* inneroffsets,
+  int64_t inneroffsetsoffset,
+  int64_t inneroffsetslen) {
+  return awkward_listoffsetarray_flatten_offsets<int64_t, int32_t, int32_t>(
+    tooffsets,
+    outeroffsets,
+    outeroffsetsoffset,
+    outeroffsetslen,
+    inneroffsets,
+    inneroffsetsoffset,
+    inneroffsetslen);
+}
+ERROR awkward_listoffsetarrayU32_flatten_offsetsU32(
+  uint32_t* tooffsets,
+  const uint32_t* outeroffsets,
+  int64_t outeroffsetsoffset,
+  int64_t outeroffsetslen,
+  const int64_t* inneroffsets,
+  int64_t inneroffsetsoffset,
+  int64_t inneroffsetslen) {
+  return awkward_listoffsetarray_flatten_offsets<int64_t, uint32_t, uint32_t>(
+    tooffsets,
+    outeroffsets,
+    outeroffsetsoffset,
+    outeroffsetslen,
+    inneroffsets,
+    inneroffsetsoffset,
+    inneroffsetslen);
+}
 
 template <typename T, typename C>
 ERROR awkward_indexedarray_flatten_none2empty(
@@ -837,6 +878,8 @@ ERROR awkward_listarray_compact_offsets(
   int64_t startsoffset,
   int64_t stopsoffset,
   int64_t length) {
+  // overlapping lists can add up to more than fits in 32-bit offsets
+  int64_t total = 0;
   tooffsets[0] = 0;
   for (int64_t i = 0;  i < length;  i++) {
     C start = fromstarts[startsoffset + i];
@@ -844,7 +887,13 @@ ERROR awkward_listarray_compact_offsets(
     if (stop < start) {
       return failure("stops[i] < starts[i]", i, kSliceNone);
     }
-    tooffsets[i + 1] = tooffsets[i] + (stop - start);
+    total += (int64_t)(stop - start);
+    if ((int64_t)((T)total) != total) {
+      return failure("total length of lists does not fit in the offsets",
+                     i,
+                     kSliceNone);
+    }
+    tooffsets[i + 1] = (T)total;
   }
   return success();
 }
@@ -893,6 +942,36 @@ ERROR awkward_listarray64_compact_offsets64(
     stopsoffset,
     length);
 }
+ERROR awkward_listarray32_compact_offsets32(
+  int32_t* tooffsets,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t length) {
+  return awkward_listarray_compact_offsets<int32_t, int32_t>(
+    tooffsets,
+    fromstarts,
+    fromstops,
+    startsoffset,
+    stopsoffset,
+    length);
+}
+ERROR awkward_listarrayU32_compact_offsetsU32(
+  uint32_t* tooffsets,
+  const uint32_t* fromstarts,
+  const uint32_t* fromstops,
+  int64_t startsoffset,
+  int64_t stopsoffset,
+  int64_t length) {
+  return awkward_listarray_compact_offsets<uint32_t, uint32_t>(
+    tooffsets,
+    fromstarts,
+    fromstops,
+    startsoffset,
+    stopsoffset,
+    length);
+}
 
 template <typename C, typename T>
 ERROR awkward_listoffsetarray_compact_offsets(
@@ -940,11 +1019,33 @@ ERROR awkward_listoffsetarray64_compact_offsets64(
     offsetsoffset,
     length);
 }
+ERROR awkward_listoffsetarray32_compact_offsets32(
+  int32_t* tooffsets,
+  const int32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_compact_offsets<int32_t, int32_t>(
+    tooffsets,
+    fromoffsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarrayU32_compact_offsetsU32(
+  uint32_t* tooffsets,
+  const uint32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_compact_offsets<uint32_t, uint32_t>(
+    tooffsets,
+    fromoffsets,
+    offsetsoffset,
+    length);
+}
 
-template <typename C, typename T>
+template <typename C, typename T, typename O = T>
 ERROR awkward_listarray_broadcast_tooffsets(
   T* tocarry,
-  const T* fromoffsets,
+  const O* fromoffsets,
   int64_t offsetsoffset,
   int64_t offsetslength,
   const C* fromstarts,
@@ -1038,6 +1139,48 @@ ERROR awkward_listarray64_broadcast_tooffsets64(
     stopsoffset,
     lencontent);
 }
+ERROR awkward_listarray32_broadcast_tooffsets32(
+  int32_t* tocarry,
+  const int32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t offsetslength,
+  const int32_t* fromstarts,
+  int64_t startsoffset,
+  const int32_t* fromstops,
+  int64_t stopsoffset,
+  int64_t lencontent) {
+  return awkward_listarray_broadcast_tooffsets<int32_t, int32_t>(
+    tocarry,
+    fromoffsets,
+    offsetsoffset,
+    offsetslength,
+    fromstarts,
+    startsoffset,
+    fromstops,
+    stopsoffset,
+    lencontent);
+}
+ERROR awkward_listarrayU32_broadcast_tooffsetsU32(
+  int64_t* tocarry,
+  const uint32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t offsetslength,
+  const uint32_t* fromstarts,
+  int64_t startsoffset,
+  const uint32_t* fromstops,
+  int64_t stopsoffset,
+  int64_t lencontent) {
+  return awkward_listarray_broadcast_tooffsets<uint32_t, int64_t, uint32_t>(
+    tocarry,
+    fromoffsets,
+    offsetsoffset,
+    offsetslength,
+    fromstarts,
+    startsoffset,
+    fromstops,
+    stopsoffset,
+    lencontent);
+}
 
 template <typename T>
 ERROR awkward_regulararray_broadcast_tooffsets(
@@ -1173,9 +1316,20 @@ ERROR awkward_numpyarray_fill(
   int64_t tooffset,
   const FROM* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[tooffset + i] = (TO)fromptr[fromoffset + i];
+  if (fromstride == 1) {
+    // unit stride is the common case; keep it simple enough to vectorize
+    TO* to = toptr + tooffset;
+    const FROM* from = fromptr + fromoffset;
+    for (int64_t i = 0;  i < length;  i++) {
+      to[i] = (TO)from[i];
+    }
+  }
+  else {
+    for (int64_t i = 0;  i < length;  i++) {
+      toptr[tooffset + i] = (TO)fromptr[fromoffset + i*fromstride];
+    }
   }
   return success();
 }
@@ -1185,9 +1339,19 @@ ERROR awkward_numpyarray_fill_frombool(
   int64_t tooffset,
   const bool* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toptr[tooffset + i] = (TO)(fromptr[fromoffset + i] != 0);
+  if (fromstride == 1) {
+    TO* to = toptr + tooffset;
+    const bool* from = fromptr + fromoffset;
+    for (int64_t i = 0;  i < length;  i++) {
+      to[i] = (TO)(from[i] != 0);
+    }
+  }
+  else {
+    for (int64_t i = 0;  i < length;  i++) {
+      toptr[tooffset + i] = (TO)(fromptr[fromoffset + i*fromstride] != 0);
+    }
   }
   return success();
 }
@@ -1196,12 +1360,14 @@ ERROR awkward_numpyarray_fill_todouble_fromdouble(
   int64_t tooffset,
   const double* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<double, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_fromfloat(
@@ -1209,12 +1375,14 @@ ERROR awkward_numpyarray_fill_todouble_fromfloat(
   int64_t tooffset,
   const float* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<float, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_from64(
@@ -1222,12 +1390,14 @@ ERROR awkward_numpyarray_fill_todouble_from64(
   int64_t tooffset,
   const int64_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int64_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_fromU64(
@@ -1235,12 +1405,14 @@ ERROR awkward_numpyarray_fill_todouble_fromU64(
   int64_t tooffset,
   const uint64_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint64_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_from32(
@@ -1248,12 +1420,14 @@ ERROR awkward_numpyarray_fill_todouble_from32(
   int64_t tooffset,
   const int32_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int32_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_fromU32(
@@ -1261,12 +1435,14 @@ ERROR awkward_numpyarray_fill_todouble_fromU32(
   int64_t tooffset,
   const uint32_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint32_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_from16(
@@ -1274,12 +1450,14 @@ ERROR awkward_numpyarray_fill_todouble_from16(
   int64_t tooffset,
   const int16_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int16_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_fromU16(
@@ -1287,12 +1465,14 @@ ERROR awkward_numpyarray_fill_todouble_fromU16(
   int64_t tooffset,
   const uint16_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint16_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_from8(
@@ -1300,12 +1480,14 @@ ERROR awkward_numpyarray_fill_todouble_from8(
   int64_t tooffset,
   const int8_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int8_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_fromU8(
@@ -1313,12 +1495,14 @@ ERROR awkward_numpyarray_fill_todouble_fromU8(
   int64_t tooffset,
   const uint8_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint8_t, double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_todouble_frombool(
@@ -1326,12 +1510,281 @@ ERROR awkward_numpyarray_fill_todouble_frombool(
   int64_t tooffset,
   const bool* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill_frombool<double>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
+    length);
+}
+
+// IEEE 754 half precision (NumPy's float16, format "e") is stored as
+// uint16_t. On x86 with GCC or Clang, the F16C instructions convert eight
+// values at a time; they are compiled for the functions marked
+// AWKWARD_F16C_TARGET only, and used only if the CPU has them (checked at
+// run time), so no -mf16c flag is needed. Otherwise, bit by bit.
+inline float awkward_half_to_float(uint16_t half) {
+  uint32_t sign = ((uint32_t)half & 0x8000) << 16;
+  uint32_t exponent = ((uint32_t)half >> 10) & 0x1f;
+  uint32_t mantissa = (uint32_t)half & 0x3ff;
+  uint32_t bits;
+  if (exponent == 0x1f) {
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  }
+  else if (exponent != 0) {
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  }
+  else {
+    // zero or subnormal: mantissa * 2**-24
+    float value = (float)mantissa * 5.9604644775390625e-8f;
+    std::memcpy(&bits, &value, 4);
+    bits |= sign;
+  }
+  float out;
+  std::memcpy(&out, &bits, 4);
+  return out;
+}
+
+// rounds to nearest, ties to even
+inline uint16_t awkward_float_to_half(float value) {
+  const uint32_t infinity = (uint32_t)255 << 23;
+  const uint32_t toolarge = (uint32_t)(127 + 16) << 23;
+  const uint32_t denormmagic = (uint32_t)((127 - 15) + (23 - 10) + 1) << 23;
+  uint32_t bits;
+  std::memcpy(&bits, &value, 4);
+  uint32_t sign = bits & 0x80000000;
+  bits ^= sign;
+  uint16_t out;
+  if (bits >= toolarge) {
+    out = (bits > infinity ? 0x7e00 : 0x7c00);
+  }
+  else if (bits < ((uint32_t)113 << 23)) {
+    // result is subnormal or zero: let float addition do the rounding
+    float shifted;
+    float magic;
+    std::memcpy(&shifted, &bits, 4);
+    std::memcpy(&magic, &denormmagic, 4);
+    shifted += magic;
+    std::memcpy(&bits, &shifted, 4);
+    out = (uint16_t)(bits - denormmagic);
+  }
+  else {
+    uint32_t odd = (bits >> 13) & 1;
+    bits += ((uint32_t)(15 - 127) << 23) + 0xfff;
+    bits += odd;
+    out = (uint16_t)(bits >> 13);
+  }
+  return (uint16_t)(out | (sign >> 16));
+}
+
+// rounds to nearest, ties to even, directly from the double's bits:
+// rounding to float first would round twice
+inline uint16_t awkward_double_to_half(double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, 8);
+  uint16_t sign = (uint16_t)((bits >> 48) & 0x8000);
+  bits &= 0x7fffffffffffffffULL;
+  if (bits >= 0x7ff0000000000000ULL) {
+    return (uint16_t)(sign | (bits > 0x7ff0000000000000ULL ? 0x7e00 : 0x7c00));
+  }
+  int64_t exponent = (int64_t)(bits >> 52) - 1023 + 15;
+  if (exponent >= 0x1f) {
+    return (uint16_t)(sign | 0x7c00);
+  }
+  uint64_t mantissa = (bits & 0x000fffffffffffffULL) | (1ULL << 52);
+  // the result is the mantissa shifted right (by more than 10 bits for
+  // subnormal halves), plus the exponent for normal halves
+  int64_t shift = 42;
+  uint64_t top = 0;
+  if (exponent <= 0) {
+    shift = 42 + 1 - exponent;
+    if (shift >= 64) {
+      return sign;
+    }
+  }
+  else {
+    top = (uint64_t)(exponent - 1) << 10;
+  }
+  uint64_t out = mantissa >> shift;
+  uint64_t rest = mantissa & ((1ULL << shift) - 1);
+  uint64_t halfway = 1ULL << (shift - 1);
+  if (rest > halfway  ||  (rest == halfway  &&  (out & 1) != 0)) {
+    out++;
+  }
+  // a carry out of the mantissa increments the exponent, possibly to
+  // infinity, which is the right answer
+  return (uint16_t)(sign | (top + out));
+}
+
+inline uint16_t awkward_to_half(float value) {
+  return awkward_float_to_half(value);
+}
+inline uint16_t awkward_to_half(double value) {
+  return awkward_double_to_half(value);
+}
+// integers and booleans are exact as doubles, up to far beyond the largest
+// finite half
+template <typename FROM>
+inline uint16_t awkward_to_half(FROM value) {
+  return awkward_double_to_half((double)value);
+}
+
+#if defined AWKWARD_F16C_DISPATCH
+  #define AWKWARD_F16C_TARGET __attribute__((target("f16c,avx")))
+
+inline bool awkward_has_f16c() {
+  static const bool out = __builtin_cpu_supports("avx")  &&
+                          __builtin_cpu_supports("f16c");
+  return out;
+}
+
+// converts the largest multiple of 8 values and returns how many
+template <typename TO>
+AWKWARD_F16C_TARGET int64_t awkward_fromhalf_f16c(
+  TO* to,
+  const uint16_t* from,
+  int64_t length) {
+  int64_t i = 0;
+  float widened[8];
+  for (;  i + 8 <= length;  i += 8) {
+    __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                                     from + i));
+    _mm256_storeu_ps(widened, _mm256_cvtph_ps(half));
+    for (int64_t j = 0;  j < 8;  j++) {
+      to[i + j] = (TO)widened[j];
+    }
+  }
+  return i;
+}
+
+// only floats: doubles would be rounded twice (to float, then to half)
+AWKWARD_F16C_TARGET int64_t awkward_tohalf_f16c(
+  uint16_t* to,
+  const float* from,
+  int64_t length) {
+  int64_t i = 0;
+  for (;  i + 8 <= length;  i += 8) {
+    __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(from + i),
+                                   _MM_FROUND_TO_NEAREST_INT);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(to + i), half);
+  }
+  return i;
+}
+template <typename FROM>
+int64_t awkward_tohalf_f16c(
+  uint16_t* to,
+  const FROM* from,
+  int64_t length) {
+  return 0;
+}
+#endif
+
+template <typename TO>
+ERROR awkward_numpyarray_fill_fromhalf(
+  TO* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  int64_t i = 0;
+#if defined AWKWARD_F16C_DISPATCH
+  if (fromstride == 1  &&  awkward_has_f16c()) {
+    i = awkward_fromhalf_f16c<TO>(toptr + tooffset,
+                                  fromptr + fromoffset,
+                                  length);
+  }
+#endif
+  for (;  i < length;  i++) {
+    toptr[tooffset + i] =
+      (TO)awkward_half_to_float(fromptr[fromoffset + i*fromstride]);
+  }
+  return success();
+}
+ERROR awkward_numpyarray_fill_todouble_fromhalf(
+  double* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<double>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tofloat_fromhalf(
+  float* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+
+template <typename FROM>
+ERROR awkward_numpyarray_fill_tohalf(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const FROM* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  int64_t i = 0;
+#if defined AWKWARD_F16C_DISPATCH
+  if (fromstride == 1  &&  awkward_has_f16c()) {
+    i = awkward_tohalf_f16c(toptr + tooffset,
+                            fromptr + fromoffset,
+                            length);
+  }
+#endif
+  for (;  i < length;  i++) {
+    toptr[tooffset + i] =
+      awkward_to_half(fromptr[fromoffset + i*fromstride]);
+  }
+  return success();
+}
+ERROR awkward_numpyarray_fill_tohalf_fromfloat(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_tohalf<float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tohalf_fromdouble(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_tohalf<double>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_toU64_fromU64(
@@ -1339,12 +1792,14 @@ ERROR awkward_numpyarray_fill_toU64_fromU64(
   int64_t tooffset,
   const uint64_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint64_t, uint64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_from64(
@@ -1352,12 +1807,14 @@ ERROR awkward_numpyarray_fill_to64_from64(
   int64_t tooffset,
   const int64_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int64_t, int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_fromU64(
@@ -1365,26 +1822,44 @@ ERROR awkward_numpyarray_fill_to64_fromU64(
   int64_t tooffset,
   const uint64_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
+  // check all values at once (a vectorizable reduction) before copying,
+  // and only look for the offending index if there is one
+  uint64_t highbits = 0;
   for (int64_t i = 0;  i < length;  i++) {
-    if (fromptr[fromoffset + i] > kMaxInt64) {
-      return failure("uint64 value too large for int64 output", i, kSliceNone);
+    highbits |= fromptr[fromoffset + i*fromstride];
+  }
+  if (highbits > kMaxInt64) {
+    for (int64_t i = 0;  i < length;  i++) {
+      if (fromptr[fromoffset + i*fromstride] > kMaxInt64) {
+        return failure("uint64 value too large for int64 output",
+                       i,
+                       kSliceNone);
+      }
     }
-    toptr[tooffset + i] = fromptr[fromoffset + i];
   }
-  return success();
+  return awkward_numpyarray_fill<uint64_t, int64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
 ERROR awkward_numpyarray_fill_to64_from32(
   int64_t* toptr,
   int64_t tooffset,
   const int32_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int32_t, int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_fromU32(
@@ -1392,12 +1867,14 @@ ERROR awkward_numpyarray_fill_to64_fromU32(
   int64_t tooffset,
   const uint32_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint32_t, int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_from16(
@@ -1405,12 +1882,14 @@ ERROR awkward_numpyarray_fill_to64_from16(
   int64_t tooffset,
   const int16_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int16_t, int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_fromU16(
@@ -1418,12 +1897,14 @@ ERROR awkward_numpyarray_fill_to64_fromU16(
   int64_t tooffset,
   const uint16_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint16_t, int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_from8(
@@ -1431,12 +1912,14 @@ ERROR awkward_numpyarray_fill_to64_from8(
   int64_t tooffset,
   const int8_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<int8_t, int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_fromU8(
@@ -1444,12 +1927,14 @@ ERROR awkward_numpyarray_fill_to64_fromU8(
   int64_t tooffset,
   const uint8_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill<uint8_t, int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_to64_frombool(
@@ -1457,12 +1942,14 @@ ERROR awkward_numpyarray_fill_to64_frombool(
   int64_t tooffset,
   const bool* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill_frombool<int64_t>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
 ERROR awkward_numpyarray_fill_tobool_frombool(
@@ -1470,402 +1957,2290 @@ ERROR awkward_numpyarray_fill_tobool_frombool(
   int64_t tooffset,
   const bool* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   return awkward_numpyarray_fill_frombool<bool>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
-ERROR awkward_numpyarray_fill_tobyte_frombyte(
-  int8_t* toptr,
+ERROR awkward_numpyarray_fill_tofloat_frombool(
+  float* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tofloat_from8(
+  float* toptr,
   int64_t tooffset,
   const int8_t* fromptr,
   int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_numpyarray_fill<int8_t, int8_t>(
+  return awkward_numpyarray_fill<int8_t, float>(
     toptr,
     tooffset,
     fromptr,
     fromoffset,
+    fromstride,
     length);
 }
-
-template <typename FROM, typename TO>
-ERROR awkward_listarray_fill(
-  TO* tostarts,
-  int64_t tostartsoffset,
-  TO* tostops,
-  int64_t tostopsoffset,
-  const FROM* fromstarts,
-  int64_t fromstartsoffset,
-  const FROM* fromstops,
-  int64_t fromstopsoffset,
-  int64_t length,
-  int64_t base) {
-  for (int64_t i = 0;  i < length;  i++) {
-    tostarts[tostartsoffset + i] =
-      (TO)(fromstarts[fromstartsoffset + i] + base);
-    tostops[tostopsoffset + i] =
-      (TO)(fromstops[fromstopsoffset + i] + base);
-  }
-  return success();
+ERROR awkward_numpyarray_fill_tofloat_fromU8(
+  float* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_listarray_fill_to64_from32(
-  int64_t* tostarts,
-  int64_t tostartsoffset,
-  int64_t* tostops,
-  int64_t tostopsoffset,
-  const int32_t* fromstarts,
-  int64_t fromstartsoffset,
-  const int32_t* fromstops,
-  int64_t fromstopsoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_listarray_fill<int32_t, int64_t>(
-    tostarts,
-    tostartsoffset,
-    tostops,
-    tostopsoffset,
-    fromstarts,
-    fromstartsoffset,
-    fromstops,
-    fromstopsoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tofloat_from16(
+  float* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_listarray_fill_to64_fromU32(
-  int64_t* tostarts,
-  int64_t tostartsoffset,
-  int64_t* tostops,
-  int64_t tostopsoffset,
-  const uint32_t* fromstarts,
-  int64_t fromstartsoffset,
-  const uint32_t* fromstops,
-  int64_t fromstopsoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_listarray_fill<uint32_t, int64_t>(
-    tostarts,
-    tostartsoffset,
-    tostops,
-    tostopsoffset,
-    fromstarts,
-    fromstartsoffset,
-    fromstops,
-    fromstopsoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tofloat_fromU16(
+  float* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_listarray_fill_to64_from64(
-  int64_t* tostarts,
-  int64_t tostartsoffset,
-  int64_t* tostops,
-  int64_t tostopsoffset,
-  const int64_t* fromstarts,
-  int64_t fromstartsoffset,
-  const int64_t* fromstops,
-  int64_t fromstopsoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_listarray_fill<int64_t, int64_t>(
-    tostarts,
-    tostartsoffset,
-    tostops,
-    tostopsoffset,
-    fromstarts,
-    fromstartsoffset,
-    fromstops,
-    fromstopsoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tofloat_from32(
+  float* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-
-template <typename FROM, typename TO>
-ERROR awkward_indexedarray_fill(
-  TO* toindex,
-  int64_t toindexoffset,
-  const FROM* fromindex,
-  int64_t fromindexoffset,
-  int64_t length,
-  int64_t base) {
-  for (int64_t i = 0;  i < length;  i++) {
-    FROM from = fromindex[fromindexoffset + i];
-    toindex[toindexoffset + i] = from < 0 ? -1 : (TO)(from + base);
-  }
-  return success();
+ERROR awkward_numpyarray_fill_tofloat_fromU32(
+  float* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_indexedarray_fill_to64_from32(
-  int64_t* toindex,
-  int64_t toindexoffset,
-  const int32_t* fromindex,
-  int64_t fromindexoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_indexedarray_fill<int32_t, int64_t>(
-    toindex,
-    toindexoffset,
-    fromindex,
-    fromindexoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tofloat_from64(
+  float* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_indexedarray_fill_to64_fromU32(
-  int64_t* toindex,
-  int64_t toindexoffset,
-  const uint32_t* fromindex,
-  int64_t fromindexoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_indexedarray_fill<uint32_t, int64_t>(
-    toindex,
-    toindexoffset,
-    fromindex,
-    fromindexoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tofloat_fromU64(
+  float* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_indexedarray_fill_to64_from64(
-  int64_t* toindex,
-  int64_t toindexoffset,
-  const int64_t* fromindex,
-  int64_t fromindexoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_indexedarray_fill<int64_t, int64_t>(
-    toindex,
-    toindexoffset,
-    fromindex,
-    fromindexoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tofloat_fromfloat(
+  float* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-
-template <typename TO>
-ERROR awkward_indexedarray_fill_count(
-  TO* toindex,
-  int64_t toindexoffset,
-  int64_t length,
-  int64_t base) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toindex[toindexoffset + i] = i + base;
-  }
-  return success();
+ERROR awkward_numpyarray_fill_tofloat_fromdouble(
+  float* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, float>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_indexedarray_fill_to64_count(
-  int64_t* toindex,
-  int64_t toindexoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_indexedarray_fill_count(
-    toindex,
-    toindexoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tohalf_frombool(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_tohalf<bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-
-template <typename FROM, typename TO>
-ERROR awkward_unionarray_filltags(
-  TO* totags,
-  int64_t totagsoffset,
-  const FROM* fromtags,
-  int64_t fromtagsoffset,
-  int64_t length,
-  int64_t base) {
-  for (int64_t i = 0;  i < length;  i++) {
-    totags[totagsoffset + i] = (TO)(fromtags[fromtagsoffset + i] + base);
-  }
-  return success();
-}
-ERROR awkward_unionarray_filltags_to8_from8(
-  int8_t* totags,
-  int64_t totagsoffset,
-  const int8_t* fromtags,
-  int64_t fromtagsoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_filltags<int8_t, int8_t>(
-    totags,
-    totagsoffset,
-    fromtags,
-    fromtagsoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tohalf_from8(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_tohalf<int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-
-template <typename FROM, typename TO>
-ERROR awkward_unionarray_fillindex(
-  TO* toindex,
-  int64_t toindexoffset,
-  const FROM* fromindex,
-  int64_t fromindexoffset,
+ERROR awkward_numpyarray_fill_tohalf_fromU8(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toindex[toindexoffset + i] = (TO)fromindex[fromindexoffset + i];
-  }
-  return success();
+  return awkward_numpyarray_fill_tohalf<uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_unionarray_fillindex_to64_from32(
-  int64_t* toindex,
-  int64_t toindexoffset,
-  const int32_t* fromindex,
-  int64_t fromindexoffset,
+ERROR awkward_numpyarray_fill_tohalf_from16(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_unionarray_fillindex<int32_t, int64_t>(
-    toindex,
-    toindexoffset,
-    fromindex,
-    fromindexoffset,
+  return awkward_numpyarray_fill_tohalf<int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-ERROR awkward_unionarray_fillindex_to64_fromU32(
-  int64_t* toindex,
-  int64_t toindexoffset,
-  const uint32_t* fromindex,
-  int64_t fromindexoffset,
+ERROR awkward_numpyarray_fill_tohalf_fromU16(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_unionarray_fillindex<uint32_t, int64_t>(
-    toindex,
-    toindexoffset,
-    fromindex,
-    fromindexoffset,
+  return awkward_numpyarray_fill_tohalf<uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-ERROR awkward_unionarray_fillindex_to64_from64(
-  int64_t* toindex,
-  int64_t toindexoffset,
-  const int64_t* fromindex,
-  int64_t fromindexoffset,
+ERROR awkward_numpyarray_fill_tohalf_from32(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_unionarray_fillindex<int64_t, int64_t>(
-    toindex,
-    toindexoffset,
-    fromindex,
-    fromindexoffset,
+  return awkward_numpyarray_fill_tohalf<int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-
-template <typename TO>
-ERROR awkward_unionarray_filltags_const(
-  TO* totags,
-  int64_t totagsoffset,
-  int64_t length,
-  int64_t base) {
-  for (int64_t i = 0;  i < length;  i++) {
-    totags[totagsoffset + i] = (TO)base;
-  }
-  return success();
+ERROR awkward_numpyarray_fill_tohalf_fromU32(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_tohalf<uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_unionarray_filltags_to8_const(
-  int8_t* totags,
-  int64_t totagsoffset,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_filltags_const<int8_t>(
-    totags,
-    totagsoffset,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_tohalf_from64(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_tohalf<int64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-
-template <typename TO>
-ERROR awkward_unionarray_fillindex_count(
-  TO* toindex,
-  int64_t toindexoffset,
+ERROR awkward_numpyarray_fill_tohalf_fromU64(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    toindex[toindexoffset + i] = (TO)i;
-  }
-  return success();
+  return awkward_numpyarray_fill_tohalf<uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_unionarray_fillindex_to64_count(
-  int64_t* toindex,
-  int64_t toindexoffset,
+ERROR awkward_numpyarray_fill_tohalf_fromhalf(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_unionarray_fillindex_count<int64_t>(
-    toindex,
-    toindexoffset,
+  return awkward_numpyarray_fill<uint16_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-
-template <typename OUTERTAGS,
-          typename OUTERINDEX,
-          typename INNERTAGS,
-          typename INNERINDEX,
-          typename TOTAGS,
-          typename TOINDEX>
-ERROR awkward_unionarray_simplify(
-  TOTAGS* totags,
-  TOINDEX* toindex,
-  const OUTERTAGS* outertags,
-  int64_t outertagsoffset,
-  const OUTERINDEX* outerindex,
-  int64_t outerindexoffset,
-  const INNERTAGS* innertags,
-  int64_t innertagsoffset,
-  const INNERINDEX* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
-  int64_t length,
-  int64_t base) {
-  for (int64_t i = 0;  i < length;  i++) {
-    if (outertags[outertagsoffset + i] == outerwhich) {
-      OUTERINDEX j = outerindex[outerindexoffset + i];
-      if (innertags[innertagsoffset + j] == innerwhich) {
-        totags[i] = (TOTAGS)towhich;
-        toindex[i] = (TOINDEX)(innerindex[innerindexoffset + j] + base);
-      }
-    }
-  }
-  return success();
+ERROR awkward_numpyarray_fill_to64_fromhalf(
+  int64_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<int64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_unionarray8_32_simplify8_32_to8_64(
-  int8_t* totags,
-  int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const int32_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const int32_t* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     int32_t,
-                                     int8_t,
-                                     int32_t,
-                                     int8_t,
-                                     int64_t>(
-    totags,
-    toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
-    towhich,
-    innerwhich,
-    outerwhich,
-    length,
-    base);
+ERROR awkward_numpyarray_fill_to64_fromfloat(
+  int64_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, int64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to64_fromdouble(
+  int64_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, int64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_frombool(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_from8(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_fromU8(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_from16(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_fromU16(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_from32(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_fromU32(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_from64(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_fromhalf(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_fromfloat(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU64_fromdouble(
+  uint64_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, uint64_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_frombool(
+  int32_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_from8(
+  int32_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_fromU8(
+  int32_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_from16(
+  int32_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_fromU16(
+  int32_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_from32(
+  int32_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_fromU32(
+  int32_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_from64(
+  int32_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_fromU64(
+  int32_t* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_fromhalf(
+  int32_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_fromfloat(
+  int32_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to32_fromdouble(
+  int32_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, int32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_frombool(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_from8(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_fromU8(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_from16(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_fromU16(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_from32(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_fromU32(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_from64(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_fromU64(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_fromhalf(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_fromfloat(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU32_fromdouble(
+  uint32_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, uint32_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_frombool(
+  int16_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_from8(
+  int16_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_fromU8(
+  int16_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_from16(
+  int16_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_fromU16(
+  int16_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_from32(
+  int16_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_fromU32(
+  int16_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_from64(
+  int16_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_fromU64(
+  int16_t* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_fromhalf(
+  int16_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_fromfloat(
+  int16_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to16_fromdouble(
+  int16_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, int16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_frombool(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_from8(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_fromU8(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_from16(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_fromU16(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_from32(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_fromU32(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_from64(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_fromU64(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_fromhalf(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_fromfloat(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU16_fromdouble(
+  uint16_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, uint16_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_frombool(
+  int8_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_from8(
+  int8_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_fromU8(
+  int8_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_from16(
+  int8_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_fromU16(
+  int8_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_from32(
+  int8_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_fromU32(
+  int8_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_from64(
+  int8_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_fromU64(
+  int8_t* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_fromhalf(
+  int8_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_fromfloat(
+  int8_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_to8_fromdouble(
+  int8_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_frombool(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_frombool<uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_from8(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_fromU8(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_from16(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_fromU16(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_from32(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_fromU32(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_from64(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_fromU64(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_fromhalf(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_fromfloat(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_toU8_fromdouble(
+  uint8_t* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, uint8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_from8(
+  bool* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_fromU8(
+  bool* toptr,
+  int64_t tooffset,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint8_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_from16(
+  bool* toptr,
+  int64_t tooffset,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int16_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_fromU16(
+  bool* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint16_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_from32(
+  bool* toptr,
+  int64_t tooffset,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int32_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_fromU32(
+  bool* toptr,
+  int64_t tooffset,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint32_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_from64(
+  bool* toptr,
+  int64_t tooffset,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int64_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_fromU64(
+  bool* toptr,
+  int64_t tooffset,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<uint64_t, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_fromhalf(
+  bool* toptr,
+  int64_t tooffset,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill_fromhalf<bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_fromfloat(
+  bool* toptr,
+  int64_t tooffset,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<float, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobool_fromdouble(
+  bool* toptr,
+  int64_t tooffset,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<double, bool>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+ERROR awkward_numpyarray_fill_tobyte_frombyte(
+  int8_t* toptr,
+  int64_t tooffset,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t length) {
+  return awkward_numpyarray_fill<int8_t, int8_t>(
+    toptr,
+    tooffset,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
+}
+
+template <typename FROM, typename TO>
+ERROR awkward_listarray_fill(
+  TO* tostarts,
+  int64_t tostartsoffset,
+  TO* tostops,
+  int64_t tostopsoffset,
+  const FROM* fromstarts,
+  int64_t fromstartsoffset,
+  const FROM* fromstops,
+  int64_t fromstopsoffset,
+  int64_t length,
+  int64_t base) {
+  for (int64_t i = 0;  i < length;  i++) {
+    tostarts[tostartsoffset + i] =
+      (TO)(fromstarts[fromstartsoffset + i] + base);
+    tostops[tostopsoffset + i] =
+      (TO)(fromstops[fromstopsoffset + i] + base);
+  }
+  return success();
+}
+ERROR awkward_listarray_fill_to64_from32(
+  int64_t* tostarts,
+  int64_t tostartsoffset,
+  int64_t* tostops,
+  int64_t tostopsoffset,
+  const int32_t* fromstarts,
+  int64_t fromstartsoffset,
+  const int32_t* fromstops,
+  int64_t fromstopsoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_listarray_fill<int32_t, int64_t>(
+    tostarts,
+    tostartsoffset,
+    tostops,
+    tostopsoffset,
+    fromstarts,
+    fromstartsoffset,
+    fromstops,
+    fromstopsoffset,
+    length,
+    base);
+}
+ERROR awkward_listarray_fill_to64_fromU32(
+  int64_t* tostarts,
+  int64_t tostartsoffset,
+  int64_t* tostops,
+  int64_t tostopsoffset,
+  const uint32_t* fromstarts,
+  int64_t fromstartsoffset,
+  const uint32_t* fromstops,
+  int64_t fromstopsoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_listarray_fill<uint32_t, int64_t>(
+    tostarts,
+    tostartsoffset,
+    tostops,
+    tostopsoffset,
+    fromstarts,
+    fromstartsoffset,
+    fromstops,
+    fromstopsoffset,
+    length,
+    base);
+}
+ERROR awkward_listarray_fill_to64_from64(
+  int64_t* tostarts,
+  int64_t tostartsoffset,
+  int64_t* tostops,
+  int64_t tostopsoffset,
+  const int64_t* fromstarts,
+  int64_t fromstartsoffset,
+  const int64_t* fromstops,
+  int64_t fromstopsoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_listarray_fill<int64_t, int64_t>(
+    tostarts,
+    tostartsoffset,
+    tostops,
+    tostopsoffset,
+    fromstarts,
+    fromstartsoffset,
+    fromstops,
+    fromstopsoffset,
+    length,
+    base);
+}
+
+template <typename FROM, typename TO>
+ERROR awkward_indexedarray_fill(
+  TO* toindex,
+  int64_t toindexoffset,
+  const FROM* fromindex,
+  int64_t fromindexoffset,
+  int64_t length,
+  int64_t base) {
+  for (int64_t i = 0;  i < length;  i++) {
+    FROM from = fromindex[fromindexoffset + i];
+    toindex[toindexoffset + i] = from < 0 ? -1 : (TO)(from + base);
+  }
+  return success();
+}
+ERROR awkward_indexedarray_fill_to64_from32(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  const int32_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_indexedarray_fill<int32_t, int64_t>(
+    toindex,
+    toindexoffset,
+    fromindex,
+    fromindexoffset,
+    length,
+    base);
+}
+ERROR awkward_indexedarray_fill_to64_fromU32(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  const uint32_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_indexedarray_fill<uint32_t, int64_t>(
+    toindex,
+    toindexoffset,
+    fromindex,
+    fromindexoffset,
+    length,
+    base);
+}
+ERROR awkward_indexedarray_fill_to64_from64(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  const int64_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_indexedarray_fill<int64_t, int64_t>(
+    toindex,
+    toindexoffset,
+    fromindex,
+    fromindexoffset,
+    length,
+    base);
+}
+
+template <typename TO>
+ERROR awkward_indexedarray_fill_count(
+  TO* toindex,
+  int64_t toindexoffset,
+  int64_t length,
+  int64_t base) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toindex[toindexoffset + i] = i + base;
+  }
+  return success();
+}
+ERROR awkward_indexedarray_fill_to64_count(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_indexedarray_fill_count(
+    toindex,
+    toindexoffset,
+    length,
+    base);
+}
+
+template <typename FROM, typename TO>
+ERROR awkward_unionarray_filltags(
+  TO* totags,
+  int64_t totagsoffset,
+  const FROM* fromtags,
+  int64_t fromtagsoffset,
+  int64_t length,
+  int64_t base) {
+  for (int64_t i = 0;  i < length;  i++) {
+    totags[totagsoffset + i] = (TO)(fromtags[fromtagsoffset + i] + base);
+  }
+  return success();
+}
+ERROR awkward_unionarray_filltags_to8_from8(
+  int8_t* totags,
+  int64_t totagsoffset,
+  const int8_t* fromtags,
+  int64_t fromtagsoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_filltags<int8_t, int8_t>(
+    totags,
+    totagsoffset,
+    fromtags,
+    fromtagsoffset,
+    length,
+    base);
+}
+
+template <typename FROM, typename TO>
+ERROR awkward_unionarray_fillindex(
+  TO* toindex,
+  int64_t toindexoffset,
+  const FROM* fromindex,
+  int64_t fromindexoffset,
+  int64_t length) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toindex[toindexoffset + i] = (TO)fromindex[fromindexoffset + i];
+  }
+  return success();
+}
+ERROR awkward_unionarray_fillindex_to64_from32(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  const int32_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t length) {
+  return awkward_unionarray_fillindex<int32_t, int64_t>(
+    toindex,
+    toindexoffset,
+    fromindex,
+    fromindexoffset,
+    length);
+}
+ERROR awkward_unionarray_fillindex_to64_fromU32(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  const uint32_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t length) {
+  return awkward_unionarray_fillindex<uint32_t, int64_t>(
+    toindex,
+    toindexoffset,
+    fromindex,
+    fromindexoffset,
+    length);
+}
+ERROR awkward_unionarray_fillindex_to64_from64(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  const int64_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t length) {
+  return awkward_unionarray_fillindex<int64_t, int64_t>(
+    toindex,
+    toindexoffset,
+    fromindex,
+    fromindexoffset,
+    length);
+}
+
+template <typename TO>
+ERROR awkward_unionarray_filltags_const(
+  TO* totags,
+  int64_t totagsoffset,
+  int64_t length,
+  int64_t base) {
+  for (int64_t i = 0;  i < length;  i++) {
+    totags[totagsoffset + i] = (TO)base;
+  }
+  return success();
+}
+ERROR awkward_unionarray_filltags_to8_const(
+  int8_t* totags,
+  int64_t totagsoffset,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_filltags_const<int8_t>(
+    totags,
+    totagsoffset,
+    length,
+    base);
+}
+
+template <typename TO>
+ERROR awkward_unionarray_fillindex_count(
+  TO* toindex,
+  int64_t toindexoffset,
+  int64_t length) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toindex[toindexoffset + i] = (TO)i;
+  }
+  return success();
+}
+ERROR awkward_unionarray_fillindex_to64_count(
+  int64_t* toindex,
+  int64_t toindexoffset,
+  int64_t length) {
+  return awkward_unionarray_fillindex_count<int64_t>(
+    toindex,
+    toindexoffset,
+    length);
+}
+
+template <typename OUTERTAGS,
+          typename OUTERINDEX,
+          typename INNERTAGS,
+          typename INNERINDEX,
+          typename TOTAGS,
+          typename TOINDEX>
+ERROR awkward_unionarray_simplify(
+  TOTAGS* totags,
+  TOINDEX* toindex,
+  const OUTERTAGS* outertags,
+  int64_t outertagsoffset,
+  const OUTERINDEX* outerindex,
+  int64_t outerindexoffset,
+  const INNERTAGS* innertags,
+  int64_t innertagsoffset,
+  const INNERINDEX* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  for (int64_t i = 0;  i < length;  i++) {
+    if (outertags[outertagsoffset + i] == outerwhich) {
+      OUTERINDEX j = outerindex[outerindexoffset + i];
+      if (innertags[innertagsoffset + j] == innerwhich) {
+        totags[i] = (TOTAGS)towhich;
+        toindex[i] = (TOINDEX)(innerindex[innerindexoffset + j] + base);
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_unionarray8_32_simplify8_32_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const int32_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const int32_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     int32_t,
+                                     int8_t,
+                                     int32_t,
+                                     int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
 }
 ERROR awkward_unionarray8_32_simplify8_U32_to8_64(
   int8_t* totags,
   int64_t* toindex,
   const int8_t* outertags,
   int64_t outertagsoffset,
-  const int32_t* outerindex,
+  const int32_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const uint32_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     int32_t,
+                                     int8_t,
+                                     uint32_t,
+                                     int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_32_simplify8_64_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const int32_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const int64_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     int32_t,
+                                     int8_t,
+                                     int64_t,
+                                     int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_U32_simplify8_32_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const uint32_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const int32_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     uint32_t,
+                                     int8_t,
+                                     int32_t,
+                                     int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_U32_simplify8_U32_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const uint32_t* outerindex,
   int64_t outerindexoffset,
   const int8_t* innertags,
   int64_t innertagsoffset,
@@ -1877,8 +4252,122 @@ ERROR awkward_unionarray8_32_simplify8_U32_to8_64(
   int64_t length,
   int64_t base) {
   return awkward_unionarray_simplify<int8_t,
+                                     uint32_t,
+                                     int8_t,
+                                     uint32_t,
+                                     int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_U32_simplify8_64_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const uint32_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const int64_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     uint32_t,
+                                     int8_t,
+                                     int64_t,
+                                     int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_64_simplify8_32_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const int64_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const int32_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     int64_t,
+                                     int8_t,
                                      int32_t,
                                      int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_64_simplify8_U32_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const int64_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const uint32_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     int64_t,
+                                     int8_t,
                                      uint32_t,
                                      int8_t,
                                      int64_t>(
@@ -1893,1777 +4382,2537 @@ ERROR awkward_unionarray8_32_simplify8_U32_to8_64(
     innerindex,
     innerindexoffset,
     towhich,
-    innerwhich,
-    outerwhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_64_simplify8_64_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* outertags,
+  int64_t outertagsoffset,
+  const int64_t* outerindex,
+  int64_t outerindexoffset,
+  const int8_t* innertags,
+  int64_t innertagsoffset,
+  const int64_t* innerindex,
+  int64_t innerindexoffset,
+  int64_t towhich,
+  int64_t innerwhich,
+  int64_t outerwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify<int8_t,
+                                     int64_t,
+                                     int8_t,
+                                     int64_t,
+                                     int8_t,
+                                     int64_t>(
+    totags,
+    toindex,
+    outertags,
+    outertagsoffset,
+    outerindex,
+    outerindexoffset,
+    innertags,
+    innertagsoffset,
+    innerindex,
+    innerindexoffset,
+    towhich,
+    innerwhich,
+    outerwhich,
+    length,
+    base);
+}
+
+template <typename FROMTAGS,
+          typename FROMINDEX,
+          typename TOTAGS,
+          typename TOINDEX>
+ERROR awkward_unionarray_simplify_one(
+  TOTAGS* totags,
+  TOINDEX* toindex,
+  const FROMTAGS* fromtags,
+  int64_t fromtagsoffset,
+  const FROMINDEX* fromindex,
+  int64_t fromindexoffset,
+  int64_t towhich,
+  int64_t fromwhich,
+  int64_t length,
+  int64_t base) {
+  for (int64_t i = 0;  i < length;  i++) {
+    if (fromtags[fromtagsoffset + i] == fromwhich) {
+      totags[i] = (TOTAGS)towhich;
+      toindex[i] = (TOINDEX)(fromindex[fromindexoffset + i] + base);
+    }
+  }
+  return success();
+}
+ERROR awkward_unionarray8_32_simplify_one_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* fromtags,
+  int64_t fromtagsoffset,
+  const int32_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t towhich,
+  int64_t fromwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify_one<int8_t, int32_t, int8_t, int64_t>(
+    totags,
+    toindex,
+    fromtags,
+    fromtagsoffset,
+    fromindex,
+    fromindexoffset,
+    towhich,
+    fromwhich,
+    length,
+    base);
+}
+ERROR awkward_unionarray8_U32_simplify_one_to8_64(
+  int8_t* totags,
+  int64_t* toindex,
+  const int8_t* fromtags,
+  int64_t fromtagsoffset,
+  const uint32_t* fromindex,
+  int64_t fromindexoffset,
+  int64_t towhich,
+  int64_t fromwhich,
+  int64_t length,
+  int64_t base) {
+  return awkward_unionarray_simplify_one<int8_t, uint32_t, int8_t, int64_t>(
+    totags,
+    toindex,
+    fromtags,
+    fromtagsoffset,
+    fromindex,
+    fromindexoffset,
+    towhich,
+    fromwhich,
     length,
     base);
 }
-ERROR awkward_unionarray8_32_simplify8_64_to8_64(
+ERROR awkward_unionarray8_64_simplify_one_to8_64(
   int8_t* totags,
   int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const int32_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const int64_t* innerindex,
-  int64_t innerindexoffset,
+  const int8_t* fromtags,
+  int64_t fromtagsoffset,
+  const int64_t* fromindex,
+  int64_t fromindexoffset,
   int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
+  int64_t fromwhich,
   int64_t length,
   int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     int32_t,
-                                     int8_t,
-                                     int64_t,
-                                     int8_t,
-                                     int64_t>(
+  return awkward_unionarray_simplify_one<int8_t, int64_t, int8_t, int64_t>(
     totags,
     toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
+    fromtags,
+    fromtagsoffset,
+    fromindex,
+    fromindexoffset,
     towhich,
-    innerwhich,
-    outerwhich,
+    fromwhich,
+    length,
+    base);
+}
+
+template <typename C>
+ERROR awkward_listarray_validity(
+  const C* starts,
+  int64_t startsoffset,
+  const C* stops,
+  int64_t stopsoffset,
+  int64_t length,
+  int64_t lencontent) {
+  for (int64_t i = 0;  i < length;  i++) {
+    C start = starts[startsoffset + i];
+    C stop = stops[stopsoffset + i];
+    if (start != stop) {
+      if (start > stop) {
+        return failure("start[i] > stop[i]", i, kSliceNone);
+      }
+      if (start < 0) {
+        return failure("start[i] < 0", i, kSliceNone);
+      }
+      if (stop > lencontent) {
+        return failure("stop[i] > len(content)", i, kSliceNone);
+      }
+    }
+  }
+  return success();
+}
+
+ERROR awkward_listarray32_validity(
+  const int32_t* starts,
+  int64_t startsoffset,
+  const int32_t* stops,
+  int64_t stopsoffset,
+  int64_t length,
+  int64_t lencontent) {
+  return awkward_listarray_validity<int32_t>(
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
+    length,
+    lencontent);
+}
+ERROR awkward_listarrayU32_validity(
+  const uint32_t* starts,
+  int64_t startsoffset,
+  const uint32_t* stops,
+  int64_t stopsoffset,
+  int64_t length,
+  int64_t lencontent) {
+  return awkward_listarray_validity<uint32_t>(
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
+    length,
+    lencontent);
+}
+ERROR awkward_listarray64_validity(
+  const int64_t* starts,
+  int64_t startsoffset,
+  const int64_t* stops,
+  int64_t stopsoffset,
+  int64_t length,
+  int64_t lencontent) {
+  return awkward_listarray_validity<int64_t>(
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
+    length,
+    lencontent);
+}
+
+template <typename C, bool ISOPTION>
+ERROR awkward_indexedarray_validity(
+  const C* index,
+  int64_t indexoffset,
+  int64_t length,
+  int64_t lencontent) {
+  for (int64_t i = 0;  i < length;  i++) {
+    C idx = index[indexoffset + i];
+    if (!ISOPTION) {
+      if (idx < 0) {
+        return failure("index[i] < 0", i, kSliceNone);
+      }
+    }
+    if (idx >= lencontent) {
+      return failure("index[i] >= len(content)", i, kSliceNone);
+    }
+  }
+  return success();
+}
+ERROR awkward_indexedarray32_validity(
+  const int32_t* index,
+  int64_t indexoffset,
+  int64_t length,
+  int64_t lencontent,
+  bool isoption) {
+  if (isoption) {
+    return awkward_indexedarray_validity<int32_t, true>(
+    index,
+    indexoffset,
+    length,
+    lencontent);
+  }
+  else {
+    return awkward_indexedarray_validity<int32_t, false>(
+    index,
+    indexoffset,
+    length,
+    lencontent);
+  }
+}
+ERROR awkward_indexedarrayU32_validity(
+  const uint32_t* index,
+  int64_t indexoffset,
+  int64_t length,
+  int64_t lencontent,
+  bool isoption) {
+  if (isoption) {
+    return awkward_indexedarray_validity<uint32_t, true>(
+    index,
+    indexoffset,
+    length,
+    lencontent);
+  }
+  else {
+    return awkward_indexedarray_validity<uint32_t, false>(
+    index,
+    indexoffset,
+    length,
+    lencontent);
+  }
+}
+ERROR awkward_indexedarray64_validity(
+  const int64_t* index,
+  int64_t indexoffset,
+  int64_t length,
+  int64_t lencontent,
+  bool isoption) {
+  if (isoption) {
+    return awkward_indexedarray_validity<int64_t, true>(
+    index,
+    indexoffset,
+    length,
+    lencontent);
+  }
+  else {
+    return awkward_indexedarray_validity<int64_t, false>(
+    index,
+    indexoffset,
+    length,
+    lencontent);
+  }
+}
+
+template <typename T, typename I>
+ERROR awkward_unionarray_validity(
+  const T* tags,
+  int64_t tagsoffset,
+  const I* index,
+  int64_t indexoffset,
+  int64_t length,
+  int64_t numcontents,
+  const int64_t* lencontents) {
+  for (int64_t i = 0;  i < length;  i++) {
+    T tag = tags[tagsoffset + i];
+    I idx = index[indexoffset + i];
+    if (tag < 0) {
+      return failure("tags[i] < 0", i, kSliceNone);
+    }
+    if (idx < 0) {
+      return failure("index[i] < 0", i, kSliceNone);
+    }
+    if (tag >= numcontents) {
+      return failure("tags[i] >= len(contents)", i, kSliceNone);
+    }
+    int64_t lencontent = lencontents[tag];
+    if (idx >= lencontent) {
+      return failure("index[i] >= len(content[tags[i]])", i, kSliceNone);
+    }
+  }
+  return success();
+}
+ERROR awkward_unionarray8_32_validity(
+  const int8_t* tags,
+  int64_t tagsoffset,
+  const int32_t* index,
+  int64_t indexoffset,
+  int64_t length,
+  int64_t numcontents,
+  const int64_t* lencontents) {
+  return awkward_unionarray_validity<int8_t, int32_t>(
+    tags,
+    tagsoffset,
+    index,
+    indexoffset,
+    length,
+    numcontents,
+    lencontents);
+}
+ERROR awkward_unionarray8_U32_validity(
+  const int8_t* tags,
+  int64_t tagsoffset,
+  const uint32_t* index,
+  int64_t indexoffset,
+  int64_t length,
+  int64_t numcontents,
+  const int64_t* lencontents) {
+  return awkward_unionarray_validity<int8_t, uint32_t>(
+    tags,
+    tagsoffset,
+    index,
+    indexoffset,
     length,
-    base);
+    numcontents,
+    lencontents);
 }
-ERROR awkward_unionarray8_U32_simplify8_32_to8_64(
-  int8_t* totags,
-  int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const uint32_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const int32_t* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
+ERROR awkward_unionarray8_64_validity(
+  const int8_t* tags,
+  int64_t tagsoffset,
+  const int64_t* index,
+  int64_t indexoffset,
   int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     uint32_t,
-                                     int8_t,
-                                     int32_t,
-                                     int8_t,
-                                     int64_t>(
-    totags,
-    toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
-    towhich,
-    innerwhich,
-    outerwhich,
+  int64_t numcontents,
+  const int64_t* lencontents) {
+  return awkward_unionarray_validity<int8_t, int64_t>(
+    tags,
+    tagsoffset,
+    index,
+    indexoffset,
     length,
-    base);
+    numcontents,
+    lencontents);
 }
-ERROR awkward_unionarray8_U32_simplify8_U32_to8_64(
-  int8_t* totags,
+
+template <typename T, typename C>
+ERROR awkward_UnionArray_fillna(
+  T* toindex,
+  const C* fromindex,
+  int64_t offset,
+  int64_t length) {
+  for (int64_t i = 0; i < length; i++)
+  {
+    toindex[i] = fromindex[offset + i] >= 0 ? fromindex[offset + i] : 0;
+  }
+  return success();
+}
+ERROR awkward_UnionArray_fillna_from32_to64(
   int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const uint32_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const uint32_t* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     uint32_t,
-                                     int8_t,
-                                     uint32_t,
-                                     int8_t,
-                                     int64_t>(
-    totags,
+  const int32_t* fromindex,
+  int64_t offset,
+  int64_t length) {
+  return awkward_UnionArray_fillna<int64_t, int32_t>(
     toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
-    towhich,
-    innerwhich,
-    outerwhich,
-    length,
-    base);
+    fromindex,
+    offset,
+    length);
 }
-ERROR awkward_unionarray8_U32_simplify8_64_to8_64(
-  int8_t* totags,
+ERROR awkward_UnionArray_fillna_fromU32_to64(
   int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const uint32_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const int64_t* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     uint32_t,
-                                     int8_t,
-                                     int64_t,
-                                     int8_t,
-                                     int64_t>(
-    totags,
+  const uint32_t* fromindex,
+  int64_t offset,
+  int64_t length) {
+  return awkward_UnionArray_fillna<int64_t, uint32_t>(
     toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
-    towhich,
-    innerwhich,
-    outerwhich,
-    length,
-    base);
+    fromindex,
+    offset,
+    length);
 }
-ERROR awkward_unionarray8_64_simplify8_32_to8_64(
-  int8_t* totags,
+ERROR awkward_UnionArray_fillna_from64_to64(
   int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const int64_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const int32_t* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     int64_t,
-                                     int8_t,
-                                     int32_t,
-                                     int8_t,
-                                     int64_t>(
-    totags,
+  const int64_t* fromindex,
+  int64_t offset,
+  int64_t length) {
+  return awkward_UnionArray_fillna<int64_t, int64_t>(
     toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
-    towhich,
-    innerwhich,
-    outerwhich,
-    length,
-    base);
+    fromindex,
+    offset,
+    length);
 }
-ERROR awkward_unionarray8_64_simplify8_U32_to8_64(
-  int8_t* totags,
+
+template <typename T>
+ERROR awkward_IndexedOptionArray_rpad_and_clip_mask_axis1(
+  T* toindex,
+  const int8_t* frommask,
+  int64_t length) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < length; i++) {
+    if(frommask[i]) {
+      toindex[i] = -1;
+    }
+    else {
+      toindex[i] = count++;
+    }
+  }
+  return success();
+}
+ERROR awkward_IndexedOptionArray_rpad_and_clip_mask_axis1_64(
   int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const int64_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const uint32_t* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     int64_t,
-                                     int8_t,
-                                     uint32_t,
-                                     int8_t,
-                                     int64_t>(
-    totags,
+  const int8_t* frommask,
+  int64_t length) {
+  return awkward_IndexedOptionArray_rpad_and_clip_mask_axis1<int64_t>(
+    toindex,
+    frommask,
+    length);
+}
+
+template <typename T>
+ERROR awkward_index_rpad_and_clip_axis0(
+  T* toindex,
+  int64_t target,
+  int64_t length) {
+  int64_t shorter = (target < length ? target : length);
+  for (int64_t i = 0; i < shorter; i++) {
+    toindex[i] = i;
+  }
+  for (int64_t i = shorter; i < target; i++) {
+    toindex[i] = -1;
+  }
+  return success();
+}
+ERROR awkward_index_rpad_and_clip_axis0_64(
+  int64_t* toindex,
+  int64_t target,
+  int64_t length) {
+  return awkward_index_rpad_and_clip_axis0<int64_t>(
     toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
-    towhich,
-    innerwhich,
-    outerwhich,
-    length,
-    base);
+    target,
+    length);
 }
-ERROR awkward_unionarray8_64_simplify8_64_to8_64(
-  int8_t* totags,
+
+template <typename T>
+ERROR awkward_index_rpad_and_clip_axis1(
+  T* tostarts,
+  T* tostops,
+  int64_t target,
+  int64_t length) {
+  int64_t offset = 0;
+  for (int64_t i = 0; i < length; i++) {
+    tostarts[i] = offset;
+    offset = offset + target;
+    tostops[i] = offset;
+   }
+  return success();
+}
+ERROR awkward_index_rpad_and_clip_axis1_64(
+  int64_t* tostarts,
+  int64_t* tostops,
+  int64_t target,
+  int64_t length) {
+  return awkward_index_rpad_and_clip_axis1<int64_t>(
+    tostarts,
+    tostops,
+    target,
+    length);
+}
+
+template <typename T>
+ERROR awkward_RegularArray_rpad_and_clip_axis1(
+  T* toindex,
+  int64_t target,
+  int64_t size,
+  int64_t length) {
+  int64_t shorter = (target < size ? target : size);
+  for (int64_t i = 0;  i < length;  i++) {
+    for (int64_t j = 0;  j < shorter;  j++) {
+      toindex[i*target + j] = i*size + j;
+    }
+    for (int64_t j = shorter;  j < target;  j++) {
+      toindex[i*target + j] = -1;
+    }
+  }
+  return success();
+}
+ERROR awkward_RegularArray_rpad_and_clip_axis1_64(
   int64_t* toindex,
-  const int8_t* outertags,
-  int64_t outertagsoffset,
-  const int64_t* outerindex,
-  int64_t outerindexoffset,
-  const int8_t* innertags,
-  int64_t innertagsoffset,
-  const int64_t* innerindex,
-  int64_t innerindexoffset,
-  int64_t towhich,
-  int64_t innerwhich,
-  int64_t outerwhich,
-  int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify<int8_t,
-                                     int64_t,
-                                     int8_t,
-                                     int64_t,
-                                     int8_t,
-                                     int64_t>(
-    totags,
+  int64_t target,
+  int64_t size,
+  int64_t length) {
+  return awkward_RegularArray_rpad_and_clip_axis1<int64_t>(
     toindex,
-    outertags,
-    outertagsoffset,
-    outerindex,
-    outerindexoffset,
-    innertags,
-    innertagsoffset,
-    innerindex,
-    innerindexoffset,
-    towhich,
-    innerwhich,
-    outerwhich,
-    length,
-    base);
+    target,
+    size,
+    length);
 }
 
-template <typename FROMTAGS,
-          typename FROMINDEX,
-          typename TOTAGS,
-          typename TOINDEX>
-ERROR awkward_unionarray_simplify_one(
-  TOTAGS* totags,
-  TOINDEX* toindex,
-  const FROMTAGS* fromtags,
-  int64_t fromtagsoffset,
-  const FROMINDEX* fromindex,
-  int64_t fromindexoffset,
-  int64_t towhich,
-  int64_t fromwhich,
+template <typename C>
+ERROR awkward_ListArray_min_range(
+  int64_t* tomin,
+  const C* fromstarts,
+  const C* fromstops,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  int64_t shorter = fromstops[stopsoffset + 0] - fromstarts[startsoffset + 0];
+  for (int64_t i = 1;  i < lenstarts;  i++) {
+    int64_t range = fromstops[startsoffset + i] - fromstarts[stopsoffset + i];
+    shorter = (shorter < range) ? shorter : range;
+  }
+  *tomin = shorter;
+  return success();
+}
+ERROR awkward_ListArray32_min_range(
+  int64_t* tomin,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_min_range<int32_t>(
+    tomin,
+    fromstarts,
+    fromstops,
+    lenstarts,
+    startsoffset,
+    stopsoffset);
+}
+ERROR awkward_ListArrayU32_min_range(
+  int64_t* tomin,
+  const uint32_t* fromstarts,
+  const uint32_t* fromstops,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_min_range<uint32_t>(
+    tomin,
+    fromstarts,
+    fromstops,
+    lenstarts,
+    startsoffset,
+    stopsoffset);
+}
+ERROR awkward_ListArray64_min_range(
+  int64_t* tomin,
+  const int64_t* fromstarts,
+  const int64_t* fromstops,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_min_range<int64_t>(
+    tomin,
+    fromstarts,
+    fromstops,
+    lenstarts,
+    startsoffset,
+    stopsoffset);
+}
+
+template <typename C>
+ERROR awkward_ListArray_rpad_and_clip_length_axis1(
+  int64_t* tolength,
+  const C* fromstarts,
+  const C* fromstops,
+  int64_t target,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  int64_t length = 0;
+  for (int64_t i = 0;  i < lenstarts;  i++) {
+    int64_t range = fromstops[startsoffset + i] - fromstarts[stopsoffset + i];
+    length += (target > range) ? target : range;
+  }
+  *tolength = length;
+  return success();
+}
+ERROR awkward_ListArray32_rpad_and_clip_length_axis1(
+  int64_t* tomin,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  int64_t target,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_rpad_and_clip_length_axis1<int32_t>(
+    tomin,
+    fromstarts,
+    fromstops,
+    target,
+    lenstarts,
+    startsoffset,
+    stopsoffset);
+}
+ERROR awkward_ListArrayU32_rpad_and_clip_length_axis1(
+  int64_t* tomin,
+  const uint32_t* fromstarts,
+  const uint32_t* fromstops,
+  int64_t target,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_rpad_and_clip_length_axis1<uint32_t>(
+    tomin,
+    fromstarts,
+    fromstops,
+    target,
+    lenstarts,
+    startsoffset,
+    stopsoffset);
+}
+ERROR awkward_ListArray64_rpad_and_clip_length_axis1(
+  int64_t* tomin,
+  const int64_t* fromstarts,
+  const int64_t* fromstops,
+  int64_t target,
+  int64_t lenstarts,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_rpad_and_clip_length_axis1<int64_t>(
+    tomin,
+    fromstarts,
+    fromstops,
+    target,
+    lenstarts,
+    startsoffset,
+    stopsoffset);
+}
+
+template <typename T, typename C>
+ERROR awkward_ListArray_rpad_axis1(
+  T* toindex,
+  const C* fromstarts,
+  const C* fromstops,
+  C* tostarts,
+  C* tostops,
+  int64_t target,
   int64_t length,
-  int64_t base) {
-  for (int64_t i = 0;  i < length;  i++) {
-    if (fromtags[fromtagsoffset + i] == fromwhich) {
-      totags[i] = (TOTAGS)towhich;
-      toindex[i] = (TOINDEX)(fromindex[fromindexoffset + i] + base);
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  int64_t offset = 0;
+  for (int64_t i = 0; i < length; i++) {
+    tostarts[i] = offset;
+    int64_t range = fromstops[startsoffset + i] - fromstarts[stopsoffset + i];
+    for (int64_t j = 0; j < range; j++) {
+     toindex[offset + j] = fromstarts[startsoffset + i] + j;
     }
-  }
+    for (int64_t j = range; j < target; j++) {
+     toindex[offset + j] = -1;
+    }
+    offset = (target > range) ? tostarts[i] + target : tostarts[i] + range;
+    tostops[i] = offset;
+   }
   return success();
 }
-ERROR awkward_unionarray8_32_simplify_one_to8_64(
-  int8_t* totags,
+ERROR awkward_ListArray32_rpad_axis1_64(
   int64_t* toindex,
-  const int8_t* fromtags,
-  int64_t fromtagsoffset,
-  const int32_t* fromindex,
-  int64_t fromindexoffset,
-  int64_t towhich,
-  int64_t fromwhich,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  int32_t* tostarts,
+  int32_t* tostops,
+  int64_t target,
   int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify_one<int8_t, int32_t, int8_t, int64_t>(
-    totags,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_rpad_axis1<int64_t, int32_t>(
     toindex,
-    fromtags,
-    fromtagsoffset,
-    fromindex,
-    fromindexoffset,
-    towhich,
-    fromwhich,
+    fromstarts,
+    fromstops,
+    tostarts,
+    tostops,
+    target,
     length,
-    base);
+    startsoffset,
+    stopsoffset);
 }
-ERROR awkward_unionarray8_U32_simplify_one_to8_64(
-  int8_t* totags,
+ERROR awkward_ListArrayU32_rpad_axis1_64(
   int64_t* toindex,
-  const int8_t* fromtags,
-  int64_t fromtagsoffset,
-  const uint32_t* fromindex,
-  int64_t fromindexoffset,
-  int64_t towhich,
-  int64_t fromwhich,
+  const uint32_t* fromstarts,
+  const uint32_t* fromstops,
+  uint32_t* tostarts,
+  uint32_t* tostops,
+  int64_t target,
   int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify_one<int8_t, uint32_t, int8_t, int64_t>(
-    totags,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_rpad_axis1<int64_t, uint32_t>(
     toindex,
-    fromtags,
-    fromtagsoffset,
-    fromindex,
-    fromindexoffset,
-    towhich,
-    fromwhich,
+    fromstarts,
+    fromstops,
+    tostarts,
+    tostops,
+    target,
     length,
-    base);
+    startsoffset,
+    stopsoffset);
 }
-ERROR awkward_unionarray8_64_simplify_one_to8_64(
-  int8_t* totags,
+ERROR awkward_ListArray64_rpad_axis1_64(
   int64_t* toindex,
-  const int8_t* fromtags,
-  int64_t fromtagsoffset,
-  const int64_t* fromindex,
-  int64_t fromindexoffset,
-  int64_t towhich,
-  int64_t fromwhich,
+  const int64_t* fromstarts,
+  const int64_t* fromstops,
+  int64_t* tostarts,
+  int64_t* tostops,
+  int64_t target,
   int64_t length,
-  int64_t base) {
-  return awkward_unionarray_simplify_one<int8_t, int64_t, int8_t, int64_t>(
-    totags,
+  int64_t startsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_rpad_axis1<int64_t, int64_t>(
     toindex,
-    fromtags,
-    fromtagsoffset,
-    fromindex,
-    fromindexoffset,
-    towhich,
-    fromwhich,
+    fromstarts,
+    fromstops,
+    tostarts,
+    tostops,
+    target,
     length,
-    base);
-}
-
-template <typename C>
-ERROR awkward_listarray_validity(
-  const C* starts,
-  int64_t startsoffset,
-  const C* stops,
-  int64_t stopsoffset,
-  int64_t length,
-  int64_t lencontent) {
-  for (int64_t i = 0;  i < length;  i++) {
-    C start = starts[startsoffset + i];
-    C stop = stops[stopsoffset + i];
-    if (start != stop) {
-      if (start > stop) {
-        return failure("start[i] > stop[i]", i, kSliceNone);
-      }
-      if (start < 0) {
-        return failure("start[i] < 0", i, kSliceNone);
-      }
-      if (stop > lencontent) {
-        return failure("stop[i] > len(content)", i, kSliceNone);
-      }
-    }
-  }
-  return success();
-}
-
-ERROR awkward_listarray32_validity(
-  const int32_t* starts,
-  int64_t startsoffset,
-  const int32_t* stops,
-  int64_t stopsoffset,
-  int64_t length,
-  int64_t lencontent) {
-  return awkward_listarray_validity<int32_t>(
-    starts,
     startsoffset,
-    stops,
-    stopsoffset,
-    length,
-    lencontent);
+    stopsoffset);
 }
-ERROR awkward_listarrayU32_validity(
-  const uint32_t* starts,
-  int64_t startsoffset,
-  const uint32_t* stops,
-  int64_t stopsoffset,
+ERROR awkward_ListArray32_rpad_axis1_32(
+  int32_t* toindex,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
+  int32_t* tostarts,
+  int32_t* tostops,
+  int64_t target,
   int64_t length,
-  int64_t lencontent) {
-  return awkward_listarray_validity<uint32_t>(
-    starts,
-    startsoffset,
-    stops,
-    stopsoffset,
-    length,
-    lencontent);
-}
-ERROR awkward_listarray64_validity(
-  const int64_t* starts,
   int64_t startsoffset,
-  const int64_t* stops,
-  int64_t stopsoffset,
-  int64_t length,
-  int64_t lencontent) {
-  return awkward_listarray_validity<int64_t>(
-    starts,
-    startsoffset,
-    stops,
-    stopsoffset,
+  int64_t stopsoffset) {
+  return awkward_ListArray_rpad_axis1<int32_t, int32_t>(
+    toindex,
+    fromstarts,
+    fromstops,
+    tostarts,
+    tostops,
+    target,
     length,
-    lencontent);
+    startsoffset,
+    stopsoffset);
 }
 
-template <typename C, bool ISOPTION>
-ERROR awkward_indexedarray_validity(
-  const C* index,
-  int64_t indexoffset,
+template <typename T, typename C>
+ERROR awkward_ListOffsetArray_rpad_and_clip_axis1(
+  T* toindex,
+  const C* fromoffsets,
+  int64_t offsetsoffset,
   int64_t length,
-  int64_t lencontent) {
-  for (int64_t i = 0;  i < length;  i++) {
-    C idx = index[indexoffset + i];
-    if (!ISOPTION) {
-      if (idx < 0) {
-        return failure("index[i] < 0", i, kSliceNone);
-      }
+  int64_t target) {
+  for (int64_t i = 0; i < length; i++) {
+    int64_t range = (T)(fromoffsets[offsetsoffset + i + 1] -
+                        fromoffsets[offsetsoffset + i]);
+    int64_t shorter = (target < range) ? target : range;
+    for (int64_t j = 0; j < shorter; j++) {
+      toindex[i*target + j] = (T)fromoffsets[offsetsoffset + i] + j;
     }
-    if (idx >= lencontent) {
-      return failure("index[i] >= len(content)", i, kSliceNone);
+    for (int64_t j = shorter; j < target; j++) {
+      toindex[i*target + j] = -1;
     }
   }
   return success();
 }
-ERROR awkward_indexedarray32_validity(
-  const int32_t* index,
-  int64_t indexoffset,
+ERROR awkward_ListOffsetArray32_rpad_and_clip_axis1_64(
+  int64_t* toindex,
+  const int32_t* fromoffsets,
+  int64_t offsetsoffset,
   int64_t length,
-  int64_t lencontent,
-  bool isoption) {
-  if (isoption) {
-    return awkward_indexedarray_validity<int32_t, true>(
-    index,
-    indexoffset,
-    length,
-    lencontent);
-  }
-  else {
-    return awkward_indexedarray_validity<int32_t, false>(
-    index,
-    indexoffset,
+  int64_t target) {
+  return awkward_ListOffsetArray_rpad_and_clip_axis1<int64_t, int32_t>(
+    toindex,
+    fromoffsets,
+    offsetsoffset,
     length,
-    lencontent);
-  }
+    target);
 }
-ERROR awkward_indexedarrayU32_validity(
-  const uint32_t* index,
-  int64_t indexoffset,
+ERROR awkward_ListOffsetArrayU32_rpad_and_clip_axis1_64(
+  int64_t* toindex,
+  const uint32_t* fromoffsets,
+  int64_t offsetsoffset,
   int64_t length,
-  int64_t lencontent,
-  bool isoption) {
-  if (isoption) {
-    return awkward_indexedarray_validity<uint32_t, true>(
-    index,
-    indexoffset,
-    length,
-    lencontent);
-  }
-  else {
-    return awkward_indexedarray_validity<uint32_t, false>(
-    index,
-    indexoffset,
+  int64_t target) {
+  return awkward_ListOffsetArray_rpad_and_clip_axis1<int64_t, uint32_t>(
+    toindex,
+    fromoffsets,
+    offsetsoffset,
     length,
-    lencontent);
-  }
+    target);
 }
-ERROR awkward_indexedarray64_validity(
-  const int64_t* index,
-  int64_t indexoffset,
+ERROR awkward_ListOffsetArray64_rpad_and_clip_axis1_64(
+  int64_t* toindex,
+  const int64_t* fromoffsets,
+  int64_t offsetsoffset,
   int64_t length,
-  int64_t lencontent,
-  bool isoption) {
-  if (isoption) {
-    return awkward_indexedarray_validity<int64_t, true>(
-    index,
-    indexoffset,
-    length,
-    lencontent);
-  }
-  else {
-    return awkward_indexedarray_validity<int64_t, false>(
-    index,
-    indexoffset,
+  int64_t target) {
+  return awkward_ListOffsetArray_rpad_and_clip_axis1<int64_t, int64_t>(
+    toindex,
+    fromoffsets,
+    offsetsoffset,
     length,
-    lencontent);
+    target);
+}
+
+template <typename C>
+ERROR awkward_ListOffsetArray_rpad_length_axis1(
+  C* tooffsets,
+  const C* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target,
+  int64_t* tolength) {
+  int64_t length = 0;
+  tooffsets[0] = 0;
+  for (int64_t i = 0; i < fromlength; i++) {
+    int64_t range =
+      fromoffsets[offsetsoffset + i + 1] - fromoffsets[offsetsoffset + i];
+    int64_t longer = (target < range) ? range : target;
+    length = length + longer;
+    tooffsets[i + 1] = tooffsets[i] + longer;
   }
+  *tolength = length;
+
+  return success();
+}
+ERROR awkward_ListOffsetArray32_rpad_length_axis1(
+  int32_t* tooffsets,
+  const int32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target,
+  int64_t* tolength) {
+  return awkward_ListOffsetArray_rpad_length_axis1<int32_t>(
+    tooffsets,
+    fromoffsets,
+    offsetsoffset,
+    fromlength,
+    target,
+    tolength);
+}
+ERROR awkward_ListOffsetArrayU32_rpad_length_axis1(
+  uint32_t* tooffsets,
+  const uint32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target,
+  int64_t* tolength) {
+  return awkward_ListOffsetArray_rpad_length_axis1<uint32_t>(
+    tooffsets,
+    fromoffsets,
+    offsetsoffset,
+    fromlength,
+    target,
+    tolength);
+}
+ERROR awkward_ListOffsetArray64_rpad_length_axis1(
+  int64_t* tooffsets,
+  const int64_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target,
+  int64_t* tolength) {
+  return awkward_ListOffsetArray_rpad_length_axis1<int64_t>(
+    tooffsets,
+    fromoffsets,
+    offsetsoffset,
+    fromlength,
+    target,
+    tolength);
 }
 
-template <typename T, typename I>
-ERROR awkward_unionarray_validity(
-  const T* tags,
-  int64_t tagsoffset,
-  const I* index,
-  int64_t indexoffset,
-  int64_t length,
-  int64_t numcontents,
-  const int64_t* lencontents) {
-  for (int64_t i = 0;  i < length;  i++) {
-    T tag = tags[tagsoffset + i];
-    I idx = index[indexoffset + i];
-    if (tag < 0) {
-      return failure("tags[i] < 0", i, kSliceNone);
-    }
-    if (idx < 0) {
-      return failure("index[i] < 0", i, kSliceNone);
-    }
-    if (tag >= numcontents) {
-      return failure("tags[i] >= len(contents)", i, kSliceNone);
+template <typename T, typename C>
+ERROR awkward_ListOffsetArray_rpad_axis1(
+  T* toindex,
+  const C* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target) {
+  int64_t count = 0;
+  for (int64_t i = 0; i < fromlength; i++) {
+    int64_t range =
+      (T)(fromoffsets[offsetsoffset + i + 1] - fromoffsets[offsetsoffset + i]);
+    for (int64_t j = 0; j < range; j++) {
+      toindex[count++] = (T)fromoffsets[offsetsoffset + i] + j;
     }
-    int64_t lencontent = lencontents[tag];
-    if (idx >= lencontent) {
-      return failure("index[i] >= len(content[tags[i]])", i, kSliceNone);
+    for (int64_t j = range; j < target; j++) {
+      toindex[count++] = -1;
     }
   }
   return success();
 }
-ERROR awkward_unionarray8_32_validity(
-  const int8_t* tags,
-  int64_t tagsoffset,
-  const int32_t* index,
-  int64_t indexoffset,
-  int64_t length,
-  int64_t numcontents,
-  const int64_t* lencontents) {
-  return awkward_unionarray_validity<int8_t, int32_t>(
-    tags,
-    tagsoffset,
-    index,
-    indexoffset,
-    length,
-    numcontents,
-    lencontents);
+ERROR awkward_ListOffsetArray32_rpad_axis1_64(
+  int64_t* toindex,
+  const int32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target) {
+  return awkward_ListOffsetArray_rpad_axis1<int64_t, int32_t>(
+    toindex,
+    fromoffsets,
+    offsetsoffset,
+    fromlength,
+    target);
 }
-ERROR awkward_unionarray8_U32_validity(
-  const int8_t* tags,
-  int64_t tagsoffset,
-  const uint32_t* index,
-  int64_t indexoffset,
-  int64_t length,
-  int64_t numcontents,
-  const int64_t* lencontents) {
-  return awkward_unionarray_validity<int8_t, uint32_t>(
-    tags,
-    tagsoffset,
-    index,
-    indexoffset,
-    length,
-    numcontents,
-    lencontents);
+ERROR awkward_ListOffsetArrayU32_rpad_axis1_64(
+  int64_t* toindex,
+  const uint32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target) {
+  return awkward_ListOffsetArray_rpad_axis1<int64_t, uint32_t>(
+    toindex,
+    fromoffsets,
+    offsetsoffset,
+    fromlength,
+    target);
+}
+ERROR awkward_ListOffsetArray64_rpad_axis1_64(
+  int64_t* toindex,
+  const int64_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target) {
+  return awkward_ListOffsetArray_rpad_axis1<int64_t, int64_t>(
+    toindex,
+    fromoffsets,
+    offsetsoffset,
+    fromlength,
+    target);
+}
+ERROR awkward_ListOffsetArray32_rpad_axis1_32(
+  int32_t* toindex,
+  const int32_t* fromoffsets,
+  int64_t offsetsoffset,
+  int64_t fromlength,
+  int64_t target) {
+  return awkward_ListOffsetArray_rpad_axis1<int32_t, int32_t>(
+    toindex,
+    fromoffsets,
+    offsetsoffset,
+    fromlength,
+    target);
+}
+
+template <typename T>
+ERROR awkward_localindex(
+  T* toindex,
+  int64_t length) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toindex[i] = i;
+  }
+  return success();
 }
-ERROR awkward_unionarray8_64_validity(
-  const int8_t* tags,
-  int64_t tagsoffset,
-  const int64_t* index,
-  int64_t indexoffset,
-  int64_t length,
-  int64_t numcontents,
-  const int64_t* lencontents) {
-  return awkward_unionarray_validity<int8_t, int64_t>(
-    tags,
-    tagsoffset,
-    index,
-    indexoffset,
-    length,
-    numcontents,
-    lencontents);
+ERROR awkward_localindex_64(
+  int64_t* toindex,
+  int64_t length) {
+  return awkward_localindex<int64_t>(
+    toindex,
+    length);
 }
 
-template <typename T, typename C>
-ERROR awkward_UnionArray_fillna(
+template <typename C, typename T>
+ERROR awkward_listarray_localindex(
   T* toindex,
-  const C* fromindex,
-  int64_t offset,
+  const C* offsets,
+  int64_t offsetsoffset,
   int64_t length) {
-  for (int64_t i = 0; i < length; i++)
-  {
-    toindex[i] = fromindex[offset + i] >= 0 ? fromindex[offset + i] : 0;
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t start = (int64_t)offsets[offsetsoffset + i];
+    int64_t stop = (int64_t)offsets[offsetsoffset + i + 1];
+    for (int64_t j = start;  j < stop;  j++) {
+      toindex[j] = j - start;
+    }
   }
   return success();
 }
-ERROR awkward_UnionArray_fillna_from32_to64(
+ERROR awkward_listarray32_localindex_64(
   int64_t* toindex,
-  const int32_t* fromindex,
-  int64_t offset,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
   int64_t length) {
-  return awkward_UnionArray_fillna<int64_t, int32_t>(
+  return awkward_listarray_localindex<int32_t, int64_t>(
     toindex,
-    fromindex,
-    offset,
+    offsets,
+    offsetsoffset,
     length);
 }
-ERROR awkward_UnionArray_fillna_fromU32_to64(
+ERROR awkward_listarrayU32_localindex_64(
   int64_t* toindex,
-  const uint32_t* fromindex,
-  int64_t offset,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
   int64_t length) {
-  return awkward_UnionArray_fillna<int64_t, uint32_t>(
+  return awkward_listarray_localindex<uint32_t, int64_t>(
     toindex,
-    fromindex,
-    offset,
+    offsets,
+    offsetsoffset,
     length);
 }
-ERROR awkward_UnionArray_fillna_from64_to64(
+ERROR awkward_listarray64_localindex_64(
   int64_t* toindex,
-  const int64_t* fromindex,
-  int64_t offset,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
   int64_t length) {
-  return awkward_UnionArray_fillna<int64_t, int64_t>(
+  return awkward_listarray_localindex<int64_t, int64_t>(
     toindex,
-    fromindex,
-    offset,
+    offsets,
+    offsetsoffset,
     length);
 }
 
 template <typename T>
-ERROR awkward_IndexedOptionArray_rpad_and_clip_mask_axis1(
+ERROR awkward_regulararray_localindex(
   T* toindex,
-  const int8_t* frommask,
+  int64_t size,
   int64_t length) {
-  int64_t count = 0;
-  for (int64_t i = 0; i < length; i++) {
-    if(frommask[i]) {
-      toindex[i] = -1;
+  for (int64_t i = 0;  i < length;  i++) {
+    for (int64_t j = 0;  j < size;  j++) {
+      toindex[i*size + j] = j;
+    }
+  }
+  return success();
+}
+ERROR awkward_regulararray_localindex_64(
+  int64_t* toindex,
+  int64_t size,
+  int64_t length) {
+  return awkward_regulararray_localindex<int64_t>(
+    toindex,
+    size,
+    length);
+}
+
+template <typename T>
+ERROR awkward_combinations(
+  T* toindex,
+  int64_t n,
+  bool replacement,
+  int64_t singlelen) {
+  return failure("FIXME: awkward_combinations", 0, kSliceNone);
+}
+ERROR awkward_combinations_64(
+  int64_t* toindex,
+  int64_t n,
+  bool replacement,
+  int64_t singlelen) {
+  return awkward_combinations<int64_t>(
+    toindex,
+    n,
+    replacement,
+    singlelen);
+}
+
+template <typename C, typename T>
+ERROR awkward_listarray_combinations_length(
+  int64_t* totallen,
+  T* tooffsets,
+  int64_t n,
+  bool replacement,
+  const C* starts,
+  int64_t startsoffset,
+  const C* stops,
+  int64_t stopsoffset,
+  int64_t length) {
+  *totallen = 0;
+  tooffsets[0] = 0;
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t size = (int64_t)(stops[stopsoffset + i] -
+                             starts[startsoffset + i]);
+    if (replacement) {
+      size += (n - 1);
+    }
+    int64_t thisn = n;
+    int64_t combinationslen;
+    if (thisn > size) {
+      combinationslen = 0;
+    }
+    else if (thisn == size) {
+      combinationslen = 1;
     }
     else {
-      toindex[i] = count++;
+      if (thisn * 2 > size) {
+        thisn = size - thisn;
+      }
+      combinationslen = size;
+      for (int64_t j = 2;  j <= thisn;  j++) {
+        combinationslen *= (size - j + 1);
+        combinationslen /= j;
+      }
+    }
+    *totallen = *totallen + combinationslen;
+    tooffsets[i + 1] = tooffsets[i] + combinationslen;
+  }
+  return success();
+}
+ERROR awkward_listarray32_combinations_length_64(
+  int64_t* totallen,
+  int64_t* tooffsets,
+  int64_t n,
+  bool replacement,
+  const int32_t* starts,
+  int64_t startsoffset,
+  const int32_t* stops,
+  int64_t stopsoffset,
+  int64_t length) {
+  return awkward_listarray_combinations_length<int32_t, int64_t>(
+    totallen,
+    tooffsets,
+    n,
+    replacement,
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
+    length);
+}
+ERROR awkward_listarrayU32_combinations_length_64(
+  int64_t* totallen,
+  int64_t* tooffsets,
+  int64_t n,
+  bool replacement,
+  const uint32_t* starts,
+  int64_t startsoffset,
+  const uint32_t* stops,
+  int64_t stopsoffset,
+  int64_t length) {
+  return awkward_listarray_combinations_length<uint32_t, int64_t>(
+    totallen,
+    tooffsets,
+    n,
+    replacement,
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
+    length);
+}
+ERROR awkward_listarray64_combinations_length_64(
+  int64_t* totallen,
+  int64_t* tooffsets,
+  int64_t n,
+  bool replacement,
+  const int64_t* starts,
+  int64_t startsoffset,
+  const int64_t* stops,
+  int64_t stopsoffset,
+  int64_t length) {
+  return awkward_listarray_combinations_length<int64_t, int64_t>(
+    totallen,
+    tooffsets,
+    n,
+    replacement,
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
+    length);
+}
+
+template <typename T>
+void awkward_listarray_combinations_step(
+  T** tocarry,
+  int64_t* toindex,
+  int64_t* fromindex,
+  int64_t j,
+  int64_t stop,
+  int64_t n,
+  bool replacement) {
+  while (fromindex[j] < stop) {
+    if (replacement) {
+      for (int64_t k = j + 1;  k < n;  k++) {
+        fromindex[k] = fromindex[j];
+      }
+    }
+    else {
+      for (int64_t k = j + 1;  k < n;  k++) {
+        fromindex[k] = fromindex[j] + (k - j);
+      }
+    }
+    if (j + 1 == n) {
+      for (int64_t k = 0;  k < n;  k++) {
+        tocarry[k][toindex[k]] = fromindex[k];
+        toindex[k]++;
+      }
+    }
+    else {
+      awkward_listarray_combinations_step<T>(tocarry,
+                                             toindex,
+                                             fromindex,
+                                             j + 1,
+                                             stop,
+                                             n,
+                                             replacement);
     }
+    fromindex[j]++;
   }
-  return success();
-}
-ERROR awkward_IndexedOptionArray_rpad_and_clip_mask_axis1_64(
-  int64_t* toindex,
-  const int8_t* frommask,
-  int64_t length) {
-  return awkward_IndexedOptionArray_rpad_and_clip_mask_axis1<int64_t>(
-    toindex,
-    frommask,
-    length);
 }
 
-template <typename T>
-ERROR awkward_index_rpad_and_clip_axis0(
-  T* toindex,
-  int64_t target,
+template <typename C, typename T>
+ERROR awkward_listarray_combinations(
+  T** tocarry,
+  int64_t n,
+  bool replacement,
+  const C* starts,
+  int64_t startsoffset,
+  const C* stops,
+  int64_t stopsoffset,
   int64_t length) {
-  int64_t shorter = (target < length ? target : length);
-  for (int64_t i = 0; i < shorter; i++) {
-    toindex[i] = i;
+  // delete these before any return!
+  int64_t* toindex = new int64_t[n];
+  int64_t* fromindex = new int64_t[n];
+  for (int64_t j = 0;  j < n;  j++) {
+    toindex[j] = 0;
   }
-  for (int64_t i = shorter; i < target; i++) {
-    toindex[i] = -1;
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t start = (int64_t)starts[startsoffset + i];
+    int64_t stop = (int64_t)stops[stopsoffset + i];
+    fromindex[0] = start;
+    awkward_listarray_combinations_step<T>(tocarry,
+                                           toindex,
+                                           fromindex,
+                                           0,
+                                           stop,
+                                           n,
+                                           replacement);
   }
+  delete [] toindex;
+  delete [] fromindex;
   return success();
 }
-ERROR awkward_index_rpad_and_clip_axis0_64(
-  int64_t* toindex,
-  int64_t target,
+ERROR awkward_listarray32_combinations_64(
+  int64_t** tocarry,
+  int64_t n,
+  bool replacement,
+  const int32_t* starts,
+  int64_t startsoffset,
+  const int32_t* stops,
+  int64_t stopsoffset,
   int64_t length) {
-  return awkward_index_rpad_and_clip_axis0<int64_t>(
-    toindex,
-    target,
+  return awkward_listarray_combinations<int32_t, int64_t>(
+    tocarry,
+    n,
+    replacement,
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
     length);
 }
-
-template <typename T>
-ERROR awkward_index_rpad_and_clip_axis1(
-  T* tostarts,
-  T* tostops,
-  int64_t target,
+ERROR awkward_listarrayU32_combinations_64(
+  int64_t** tocarry,
+  int64_t n,
+  bool replacement,
+  const uint32_t* starts,
+  int64_t startsoffset,
+  const uint32_t* stops,
+  int64_t stopsoffset,
   int64_t length) {
-  int64_t offset = 0;
-  for (int64_t i = 0; i < length; i++) {
-    tostarts[i] = offset;
-    offset = offset + target;
-    tostops[i] = offset;
-   }
-  return success();
+  return awkward_listarray_combinations<uint32_t, int64_t>(
+    tocarry,
+    n,
+    replacement,
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
+    length);
 }
-ERROR awkward_index_rpad_and_clip_axis1_64(
-  int64_t* tostarts,
-  int64_t* tostops,
-  int64_t target,
+ERROR awkward_listarray64_combinations_64(
+  int64_t** tocarry,
+  int64_t n,
+  bool replacement,
+  const int64_t* starts,
+  int64_t startsoffset,
+  const int64_t* stops,
+  int64_t stopsoffset,
   int64_t length) {
-  return awkward_index_rpad_and_clip_axis1<int64_t>(
-    tostarts,
-    tostops,
-    target,
+  return awkward_listarray_combinations<int64_t, int64_t>(
+    tocarry,
+    n,
+    replacement,
+    starts,
+    startsoffset,
+    stops,
+    stopsoffset,
     length);
 }
 
-template <typename T>
-ERROR awkward_RegularArray_rpad_and_clip_axis1(
-  T* toindex,
-  int64_t target,
+template <typename C, typename T>
+ERROR awkward_regulararray_combinations(
+  T** tocarry,
+  int64_t n,
+  bool replacement,
   int64_t size,
   int64_t length) {
-  int64_t shorter = (target < size ? target : size);
+  // delete these before any return!
+  int64_t* toindex = new int64_t[n];
+  int64_t* fromindex = new int64_t[n];
+  for (int64_t j = 0;  j < n;  j++) {
+    toindex[j] = 0;
+  }
   for (int64_t i = 0;  i < length;  i++) {
-    for (int64_t j = 0;  j < shorter;  j++) {
-      toindex[i*target + j] = i*size + j;
-    }
-    for (int64_t j = shorter;  j < target;  j++) {
-      toindex[i*target + j] = -1;
-    }
+    int64_t start = size*i;
+    int64_t stop = start + size;
+    fromindex[0] = start;
+    awkward_listarray_combinations_step<T>(tocarry,
+                                           toindex,
+                                           fromindex,
+                                           0,
+                                           stop,
+                                           n,
+                                           replacement);
   }
+  delete [] toindex;
+  delete [] fromindex;
   return success();
 }
-ERROR awkward_RegularArray_rpad_and_clip_axis1_64(
-  int64_t* toindex,
-  int64_t target,
+ERROR awkward_regulararray_combinations_64(
+  int64_t** tocarry,
+  int64_t n,
+  bool replacement,
   int64_t size,
   int64_t length) {
-  return awkward_RegularArray_rpad_and_clip_axis1<int64_t>(
-    toindex,
-    target,
+  return awkward_regulararray_combinations<int32_t, int64_t>(
+    tocarry,
+    n,
+    replacement,
     size,
     length);
 }
 
-template <typename C>
-ERROR awkward_ListArray_min_range(
-  int64_t* tomin,
-  const C* fromstarts,
-  const C* fromstops,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  int64_t shorter = fromstops[stopsoffset + 0] - fromstarts[startsoffset + 0];
-  for (int64_t i = 1;  i < lenstarts;  i++) {
-    int64_t range = fromstops[startsoffset + i] - fromstarts[stopsoffset + i];
-    shorter = (shorter < range) ? shorter : range;
-  }
-  *tomin = shorter;
-  return success();
-}
-ERROR awkward_ListArray32_min_range(
-  int64_t* tomin,
-  const int32_t* fromstarts,
-  const int32_t* fromstops,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_min_range<int32_t>(
-    tomin,
-    fromstarts,
-    fromstops,
-    lenstarts,
-    startsoffset,
-    stopsoffset);
-}
-ERROR awkward_ListArrayU32_min_range(
-  int64_t* tomin,
-  const uint32_t* fromstarts,
-  const uint32_t* fromstops,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_min_range<uint32_t>(
-    tomin,
-    fromstarts,
-    fromstops,
-    lenstarts,
-    startsoffset,
-    stopsoffset);
-}
-ERROR awkward_ListArray64_min_range(
-  int64_t* tomin,
-  const int64_t* fromstarts,
-  const int64_t* fromstops,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_min_range<int64_t>(
-    tomin,
-    fromstarts,
-    fromstops,
-    lenstarts,
-    startsoffset,
-    stopsoffset);
-}
-
-template <typename C>
-ERROR awkward_ListArray_rpad_and_clip_length_axis1(
-  int64_t* tolength,
-  const C* fromstarts,
-  const C* fromstops,
-  int64_t target,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  int64_t length = 0;
-  for (int64_t i = 0;  i < lenstarts;  i++) {
-    int64_t range = fromstops[startsoffset + i] - fromstarts[stopsoffset + i];
-    length += (target > range) ? target : range;
+template <typename M>
+ERROR awkward_bytemaskedarray_overlay_mask(
+  M* tomask,
+  const M* theirmask,
+  int64_t theirmaskoffset,
+  const M* mymask,
+  int64_t mymaskoffset,
+  int64_t length,
+  bool validwhen) {
+  for (int64_t i = 0;  i < length;  i++) {
+    bool theirs = theirmask[theirmaskoffset + i];
+    bool mine = ((mymask[mymaskoffset + i] != 0) != validwhen);
+    tomask[i] = ((theirs | mine) ? 1 : 0);
   }
-  *tolength = length;
   return success();
 }
-ERROR awkward_ListArray32_rpad_and_clip_length_axis1(
-  int64_t* tomin,
-  const int32_t* fromstarts,
-  const int32_t* fromstops,
-  int64_t target,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_rpad_and_clip_length_axis1<int32_t>(
-    tomin,
-    fromstarts,
-    fromstops,
-    target,
-    lenstarts,
-    startsoffset,
-    stopsoffset);
-}
-ERROR awkward_ListArrayU32_rpad_and_clip_length_axis1(
-  int64_t* tomin,
-  const uint32_t* fromstarts,
-  const uint32_t* fromstops,
-  int64_t target,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_rpad_and_clip_length_axis1<uint32_t>(
-    tomin,
-    fromstarts,
-    fromstops,
-    target,
-    lenstarts,
-    startsoffset,
-    stopsoffset);
+ERROR awkward_bytemaskedarray_overlay_mask8(
+  int8_t* tomask,
+  const int8_t* theirmask,
+  int64_t theirmaskoffset,
+  const int8_t* mymask,
+  int64_t mymaskoffset,
+  int64_t length,
+  bool validwhen) {
+  return awkward_bytemaskedarray_overlay_mask<int8_t>(
+    tomask,
+    theirmask,
+    theirmaskoffset,
+    mymask,
+    mymaskoffset,
+    length,
+    validwhen);
 }
-ERROR awkward_ListArray64_rpad_and_clip_length_axis1(
-  int64_t* tomin,
-  const int64_t* fromstarts,
-  const int64_t* fromstops,
-  int64_t target,
-  int64_t lenstarts,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_rpad_and_clip_length_axis1<int64_t>(
-    tomin,
-    fromstarts,
-    fromstops,
-    target,
-    lenstarts,
-    startsoffset,
-    stopsoffset);
+
+ERROR awkward_bitmaskedarray_to_bytemaskedarray(
+  int8_t* tobytemask,
+  const uint8_t* frombitmask,
+  int64_t bitmaskoffset,
+  int64_t bitmasklength,
+  bool validwhen,
+  bool lsb_order) {
+  if (lsb_order) {
+    for (int64_t i = 0;  i < bitmasklength;  i++) {
+      uint8_t byte = frombitmask[bitmaskoffset + i];
+      tobytemask[i*8 + 0] = ((byte & ((uint8_t)1)) != validwhen);
+      byte >>= 1;
+      tobytemask[i*8 + 1] = ((byte & ((uint8_t)1)) != validwhen);
+      byte >>= 1;
+      tobytemask[i*8 + 2] = ((byte & ((uint8_t)1)) != validwhen);
+      byte >>= 1;
+      tobytemask[i*8 + 3] = ((byte & ((uint8_t)1)) != validwhen);
+      byte >>= 1;
+      tobytemask[i*8 + 4] = ((byte & ((uint8_t)1)) != validwhen);
+      byte >>= 1;
+      tobytemask[i*8 + 5] = ((byte & ((uint8_t)1)) != validwhen);
+      byte >>= 1;
+      tobytemask[i*8 + 6] = ((byte & ((uint8_t)1)) != validwhen);
+      byte >>= 1;
+      tobytemask[i*8 + 7] = ((byte & ((uint8_t)1)) != validwhen);
+    }
+  }
+  else {
+    for (int64_t i = 0;  i < bitmasklength;  i++) {
+      uint8_t byte = frombitmask[bitmaskoffset + i];
+      tobytemask[i*8 + 0] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+      byte <<= 1;
+      tobytemask[i*8 + 1] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+      byte <<= 1;
+      tobytemask[i*8 + 2] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+      byte <<= 1;
+      tobytemask[i*8 + 3] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+      byte <<= 1;
+      tobytemask[i*8 + 4] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+      byte <<= 1;
+      tobytemask[i*8 + 5] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+      byte <<= 1;
+      tobytemask[i*8 + 6] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+      byte <<= 1;
+      tobytemask[i*8 + 7] = (((byte & ((uint8_t)128)) != 0) != validwhen);
+    }
+  }
+  return success();
 }
 
-template <typename T, typename C>
-ERROR awkward_ListArray_rpad_axis1(
+template <typename T>
+ERROR awkward_bitmaskedarray_to_indexedoptionarray(
   T* toindex,
-  const C* fromstarts,
-  const C* fromstops,
-  C* tostarts,
-  C* tostops,
-  int64_t target,
-  int64_t length,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  int64_t offset = 0;
-  for (int64_t i = 0; i < length; i++) {
-    tostarts[i] = offset;
-    int64_t range = fromstops[startsoffset + i] - fromstarts[stopsoffset + i];
-    for (int64_t j = 0; j < range; j++) {
-     toindex[offset + j] = fromstarts[startsoffset + i] + j;
+  const uint8_t* frombitmask,
+  int64_t bitmaskoffset,
+  int64_t bitmasklength,
+  bool validwhen,
+  bool lsb_order) {
+  if (lsb_order) {
+    for (int64_t i = 0;  i < bitmasklength;  i++) {
+      uint8_t byte = frombitmask[bitmaskoffset + i];
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 0] = i*8 + 0;
+      }
+      else {
+        toindex[i*8 + 0] = -1;
+      }
+      byte >>= 1;
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 1] = i*8 + 1;
+      }
+      else {
+        toindex[i*8 + 1] = -1;
+      }
+      byte >>= 1;
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 2] = i*8 + 2;
+      }
+      else {
+        toindex[i*8 + 2] = -1;
+      }
+      byte >>= 1;
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 3] = i*8 + 3;
+      }
+      else {
+        toindex[i*8 + 3] = -1;
+      }
+      byte >>= 1;
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 4] = i*8 + 4;
+      }
+      else {
+        toindex[i*8 + 4] = -1;
+      }
+      byte >>= 1;
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 5] = i*8 + 5;
+      }
+      else {
+        toindex[i*8 + 5] = -1;
+      }
+      byte >>= 1;
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 6] = i*8 + 6;
+      }
+      else {
+        toindex[i*8 + 6] = -1;
+      }
+      byte >>= 1;
+      if ((byte & ((uint8_t)1)) == validwhen) {
+        toindex[i*8 + 7] = i*8 + 7;
+      }
+      else {
+        toindex[i*8 + 7] = -1;
+      }
     }
-    for (int64_t j = range; j < target; j++) {
-     toindex[offset + j] = -1;
+  }
+  else {
+    for (int64_t i = 0;  i < bitmasklength;  i++) {
+      uint8_t byte = frombitmask[bitmaskoffset + i];
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 0] = i*8 + 0;
+      }
+      else {
+        toindex[i*8 + 0] = -1;
+      }
+      byte <<= 1;
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 1] = i*8 + 1;
+      }
+      else {
+        toindex[i*8 + 1] = -1;
+      }
+      byte <<= 1;
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 2] = i*8 + 2;
+      }
+      else {
+        toindex[i*8 + 2] = -1;
+      }
+      byte <<= 1;
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 3] = i*8 + 3;
+      }
+      else {
+        toindex[i*8 + 3] = -1;
+      }
+      byte <<= 1;
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 4] = i*8 + 4;
+      }
+      else {
+        toindex[i*8 + 4] = -1;
+      }
+      byte <<= 1;
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 5] = i*8 + 5;
+      }
+      else {
+        toindex[i*8 + 5] = -1;
+      }
+      byte <<= 1;
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 6] = i*8 + 6;
+      }
+      else {
+        toindex[i*8 + 6] = -1;
+      }
+      byte <<= 1;
+      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
+        toindex[i*8 + 7] = i*8 + 7;
+      }
+      else {
+        toindex[i*8 + 7] = -1;
+      }
     }
-    offset = (target > range) ? tostarts[i] + target : tostarts[i] + range;
-    tostops[i] = offset;
-   }
+  }
   return success();
 }
-ERROR awkward_ListArray32_rpad_axis1_64(
-  int64_t* toindex,
-  const int32_t* fromstarts,
-  const int32_t* fromstops,
-  int32_t* tostarts,
-  int32_t* tostops,
-  int64_t target,
-  int64_t length,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_rpad_axis1<int64_t, int32_t>(
-    toindex,
-    fromstarts,
-    fromstops,
-    tostarts,
-    tostops,
-    target,
-    length,
-    startsoffset,
-    stopsoffset);
-}
-ERROR awkward_ListArrayU32_rpad_axis1_64(
-  int64_t* toindex,
-  const uint32_t* fromstarts,
-  const uint32_t* fromstops,
-  uint32_t* tostarts,
-  uint32_t* tostops,
-  int64_t target,
-  int64_t length,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_rpad_axis1<int64_t, uint32_t>(
-    toindex,
-    fromstarts,
-    fromstops,
-    tostarts,
-    tostops,
-    target,
-    length,
-    startsoffset,
-    stopsoffset);
-}
-ERROR awkward_ListArray64_rpad_axis1_64(
+ERROR awkward_bitmaskedarray_to_indexedoptionarray_64(
   int64_t* toindex,
-  const int64_t* fromstarts,
-  const int64_t* fromstops,
-  int64_t* tostarts,
-  int64_t* tostops,
-  int64_t target,
-  int64_t length,
-  int64_t startsoffset,
-  int64_t stopsoffset) {
-  return awkward_ListArray_rpad_axis1<int64_t, int64_t>(
+  const uint8_t* frombitmask,
+  int64_t bitmaskoffset,
+  int64_t bitmasklength,
+  bool validwhen,
+  bool lsb_order) {
+  return awkward_bitmaskedarray_to_indexedoptionarray<int64_t>(
     toindex,
-    fromstarts,
-    fromstops,
-    tostarts,
-    tostops,
-    target,
-    length,
-    startsoffset,
-    stopsoffset);
+    frombitmask,
+    bitmaskoffset,
+    bitmasklength,
+    validwhen,
+    lsb_order);
 }
 
-template <typename T, typename C>
-ERROR awkward_ListOffsetArray_rpad_and_clip_axis1(
-  T* toindex,
-  const C* fromoffsets,
-  int64_t offsetsoffset,
+ERROR awkward_numpyarray_to_bitpackedarray(
+  uint8_t* tobits,
+  const int8_t* fromptr,
+  int64_t byteoffset,
   int64_t length,
-  int64_t target) {
-  for (int64_t i = 0; i < length; i++) {
-    int64_t range = (T)(fromoffsets[offsetsoffset + i + 1] -
-                        fromoffsets[offsetsoffset + i]);
-    int64_t shorter = (target < range) ? target : range;
-    for (int64_t j = 0; j < shorter; j++) {
-      toindex[i*target + j] = (T)fromoffsets[offsetsoffset + i] + j;
-    }
-    for (int64_t j = shorter; j < target; j++) {
-      toindex[i*target + j] = -1;
+  int64_t stride,
+  bool lsb_order) {
+  for (int64_t i = 0;  i < (length + 7) / 8;  i++) {
+    uint8_t byte = 0;
+    for (int64_t j = 0;  j < 8  &&  i*8 + j < length;  j++) {
+      if (fromptr[byteoffset + (i*8 + j)*stride] != 0) {
+        byte |= (uint8_t)(lsb_order ? 1 << j : 128 >> j);
+      }
     }
+    tobits[i] = byte;
   }
   return success();
 }
-ERROR awkward_ListOffsetArray32_rpad_and_clip_axis1_64(
-  int64_t* toindex,
-  const int32_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t length,
-  int64_t target) {
-  return awkward_ListOffsetArray_rpad_and_clip_axis1<int64_t, int32_t>(
-    toindex,
-    fromoffsets,
-    offsetsoffset,
-    length,
-    target);
-}
-ERROR awkward_ListOffsetArrayU32_rpad_and_clip_axis1_64(
-  int64_t* toindex,
-  const uint32_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t length,
-  int64_t target) {
-  return awkward_ListOffsetArray_rpad_and_clip_axis1<int64_t, uint32_t>(
-    toindex,
-    fromoffsets,
-    offsetsoffset,
-    length,
-    target);
-}
-ERROR awkward_ListOffsetArray64_rpad_and_clip_axis1_64(
-  int64_t* toindex,
-  const int64_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t length,
-  int64_t target) {
-  return awkward_ListOffsetArray_rpad_and_clip_axis1<int64_t, int64_t>(
-    toindex,
-    fromoffsets,
-    offsetsoffset,
-    length,
-    target);
-}
 
-template <typename C>
-ERROR awkward_ListOffsetArray_rpad_length_axis1(
-  C* tooffsets,
-  const C* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target,
-  int64_t* tolength) {
-  int64_t length = 0;
-  tooffsets[0] = 0;
-  for (int64_t i = 0; i < fromlength; i++) {
-    int64_t range =
-      fromoffsets[offsetsoffset + i + 1] - fromoffsets[offsetsoffset + i];
-    int64_t longer = (target < range) ? range : target;
-    length = length + longer;
-    tooffsets[i + 1] = tooffsets[i] + longer;
-  }
-  *tolength = length;
+// Non-cryptographic 64-bit hash in the style of xxHash64: four independent
+// lanes consume 32 bytes per iteration, so the multiplications pipeline.
+const uint64_t kHashPrime1 = 11400714785074694791ULL;
+const uint64_t kHashPrime2 = 14029467366897019727ULL;
+const uint64_t kHashPrime3 = 1609587929392839161ULL;
+const uint64_t kHashPrime4 = 9650029242287828579ULL;
+const uint64_t kHashPrime5 = 2870177450012600261ULL;
 
-  return success();
-}
-ERROR awkward_ListOffsetArray32_rpad_length_axis1(
-  int32_t* tooffsets,
-  const int32_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target,
-  int64_t* tolength) {
-  return awkward_ListOffsetArray_rpad_length_axis1<int32_t>(
-    tooffsets,
-    fromoffsets,
-    offsetsoffset,
-    fromlength,
-    target,
-    tolength);
-}
-ERROR awkward_ListOffsetArrayU32_rpad_length_axis1(
-  uint32_t* tooffsets,
-  const uint32_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target,
-  int64_t* tolength) {
-  return awkward_ListOffsetArray_rpad_length_axis1<uint32_t>(
-    tooffsets,
-    fromoffsets,
-    offsetsoffset,
-    fromlength,
-    target,
-    tolength);
-}
-ERROR awkward_ListOffsetArray64_rpad_length_axis1(
-  int64_t* tooffsets,
-  const int64_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target,
-  int64_t* tolength) {
-  return awkward_ListOffsetArray_rpad_length_axis1<int64_t>(
-    tooffsets,
-    fromoffsets,
-    offsetsoffset,
-    fromlength,
-    target,
-    tolength);
-}
+inline uint64_t awkward_hash_rotl(uint64_t x, int r) {
+  return (x << r) | (x >> (64 - r));
+}
+inline uint64_t awkward_hash_round(uint64_t acc, uint64_t word) {
+  return awkward_hash_rotl(acc + word*kHashPrime2, 31)*kHashPrime1;
+}
+// Reads the bytes of a contiguous buffer, in order.
+class awkward_hash_contiguous_reader {
+public:
+  awkward_hash_contiguous_reader(const uint8_t* data): data_(data) { }
+  inline void read(uint8_t* dst, int64_t length) {
+    std::memcpy(dst, data_, (size_t)length);
+    data_ += length;
+  }
+private:
+  const uint8_t* data_;
+};
 
-template <typename T, typename C>
-ERROR awkward_ListOffsetArray_rpad_axis1(
-  T* toindex,
-  const C* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target) {
-  int64_t count = 0;
-  for (int64_t i = 0; i < fromlength; i++) {
-    int64_t range =
-      (T)(fromoffsets[offsetsoffset + i + 1] - fromoffsets[offsetsoffset + i]);
-    for (int64_t j = 0; j < range; j++) {
-      toindex[count++] = (T)fromoffsets[offsetsoffset + i] + j;
+// Reads the bytes of a strided array in row-major order, as though it had
+// been made contiguous first, without copying it.
+class awkward_hash_strided_reader {
+public:
+  awkward_hash_strided_reader(const uint8_t* data,
+                              const int64_t* shape,
+                              const int64_t* strides,
+                              int64_t ndim,
+                              int64_t itemsize)
+      : data_(data), shape_(shape), strides_(strides), ndim_(ndim)
+      , itemsize_(itemsize), item_(0), within_(0), itemptr_(data) { }
+  inline void read(uint8_t* dst, int64_t length) {
+    while (length > 0) {
+      int64_t take = itemsize_ - within_;
+      if (take > length) {
+        take = length;
+      }
+      std::memcpy(dst, &itemptr_[within_], (size_t)take);
+      dst += take;
+      length -= take;
+      within_ += take;
+      if (within_ == itemsize_) {
+        within_ = 0;
+        item_++;
+        next_item();
+      }
     }
-    for (int64_t j = range; j < target; j++) {
-      toindex[count++] = -1;
+  }
+private:
+  inline void next_item() {
+    if (ndim_ > 0  &&  item_ % shape_[ndim_ - 1] != 0) {
+      itemptr_ += strides_[ndim_ - 1];
+    }
+    else {
+      itemptr_ = data_;
+      int64_t rest = item_;
+      for (int64_t d = ndim_ - 1;  d >= 0;  d--) {
+        itemptr_ += (rest % shape_[d])*strides_[d];
+        rest /= shape_[d];
+      }
     }
   }
-  return success();
-}
-ERROR awkward_ListOffsetArray32_rpad_axis1_64(
-  int64_t* toindex,
-  const int32_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target) {
-  return awkward_ListOffsetArray_rpad_axis1<int64_t, int32_t>(
-    toindex,
-    fromoffsets,
-    offsetsoffset,
-    fromlength,
-    target);
-}
-ERROR awkward_ListOffsetArrayU32_rpad_axis1_64(
-  int64_t* toindex,
-  const uint32_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target) {
-  return awkward_ListOffsetArray_rpad_axis1<int64_t, uint32_t>(
-    toindex,
-    fromoffsets,
-    offsetsoffset,
-    fromlength,
-    target);
+  const uint8_t* data_;
+  const int64_t* shape_;
+  const int64_t* strides_;
+  int64_t ndim_;
+  int64_t itemsize_;
+  int64_t item_;
+  int64_t within_;
+  const uint8_t* itemptr_;
+};
+
+template <typename READER>
+uint64_t awkward_buffer_hash64_read(
+  READER& reader,
+  int64_t length,
+  uint64_t seed) {
+  int64_t i = 0;
+  uint64_t word;
+  uint64_t out;
+  if (length >= 32) {
+    uint64_t v0 = seed + kHashPrime1 + kHashPrime2;
+    uint64_t v1 = seed + kHashPrime2;
+    uint64_t v2 = seed;
+    uint64_t v3 = seed - kHashPrime1;
+    uint64_t words[4];
+    for (;  i + 32 <= length;  i += 32) {
+      reader.read(reinterpret_cast<uint8_t*>(words), 32);
+      v0 = awkward_hash_round(v0, words[0]);
+      v1 = awkward_hash_round(v1, words[1]);
+      v2 = awkward_hash_round(v2, words[2]);
+      v3 = awkward_hash_round(v3, words[3]);
+    }
+    out = awkward_hash_rotl(v0, 1) + awkward_hash_rotl(v1, 7) +
+          awkward_hash_rotl(v2, 12) + awkward_hash_rotl(v3, 18);
+    out = (out ^ awkward_hash_round(0, v0))*kHashPrime1 + kHashPrime4;
+    out = (out ^ awkward_hash_round(0, v1))*kHashPrime1 + kHashPrime4;
+    out = (out ^ awkward_hash_round(0, v2))*kHashPrime1 + kHashPrime4;
+    out = (out ^ awkward_hash_round(0, v3))*kHashPrime1 + kHashPrime4;
+  }
+  else {
+    out = seed + kHashPrime5;
+  }
+  out += (uint64_t)length;
+  for (;  i + 8 <= length;  i += 8) {
+    reader.read(reinterpret_cast<uint8_t*>(&word), 8);
+    out ^= awkward_hash_round(0, word);
+    out = awkward_hash_rotl(out, 27)*kHashPrime1 + kHashPrime4;
+  }
+  uint8_t byte;
+  for (;  i < length;  i++) {
+    reader.read(&byte, 1);
+    out ^= byte*kHashPrime5;
+    out = awkward_hash_rotl(out, 11)*kHashPrime1;
+  }
+  out ^= out >> 33;
+  out *= kHashPrime2;
+  out ^= out >> 29;
+  out *= kHashPrime3;
+  out ^= out >> 32;
+  return out;
+}
+ERROR awkward_buffer_hash64(
+  uint64_t* tohash,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  uint64_t seed) {
+  awkward_hash_contiguous_reader reader(&fromptr[fromoffset]);
+  *tohash = awkward_buffer_hash64_read(reader, length, seed);
+  return success();
 }
-ERROR awkward_ListOffsetArray64_rpad_axis1_64(
-  int64_t* toindex,
-  const int64_t* fromoffsets,
-  int64_t offsetsoffset,
-  int64_t fromlength,
-  int64_t target) {
-  return awkward_ListOffsetArray_rpad_axis1<int64_t, int64_t>(
-    toindex,
-    fromoffsets,
-    offsetsoffset,
-    fromlength,
-    target);
+ERROR awkward_buffer_hash64_strided(
+  uint64_t* tohash,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  const int64_t* shape,
+  const int64_t* strides,
+  int64_t ndim,
+  int64_t itemsize,
+  uint64_t seed) {
+  int64_t length = itemsize;
+  for (int64_t d = 0;  d < ndim;  d++) {
+    if (shape[d] < 0) {
+      return failure("shape must be non-negative", d, shape[d]);
+    }
+    length *= shape[d];
+  }
+  awkward_hash_strided_reader reader(&fromptr[fromoffset],
+                                     shape,
+                                     strides,
+                                     ndim,
+                                     itemsize);
+  *tohash = awkward_buffer_hash64_read(reader, length, seed);
+  return success();
 }
 
+// Mixes one value (widened to 64 bits) with the splitmix64 finalizer, so
+// that every input bit affects every output bit. Integers hash by value,
+// regardless of width; floating-point numbers hash by their bits as double,
+// with -0.0 folded into 0.0.
+inline uint64_t awkward_hash_mix(uint64_t z) {
+  z = (z ^ (z >> 30))*0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27))*0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
 template <typename T>
-ERROR awkward_localindex(
-  T* toindex,
+inline uint64_t awkward_hash_word(T x) {
+  return (uint64_t)(int64_t)x;
+}
+template <>
+inline uint64_t awkward_hash_word(uint64_t x) {
+  return x;
+}
+template <>
+inline uint64_t awkward_hash_word(double x) {
+  uint64_t out;
+  x = (x == 0.0 ? 0.0 : x);
+  std::memcpy(&out, &x, 8);
+  return out;
+}
+template <>
+inline uint64_t awkward_hash_word(float x) {
+  return awkward_hash_word<double>((double)x);
+}
+template <typename T>
+ERROR awkward_numpyarray_hash64(
+  uint64_t* tohash,
+  const T* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
   for (int64_t i = 0;  i < length;  i++) {
-    toindex[i] = i;
+    tohash[i] = awkward_hash_mix(
+      awkward_hash_word<T>(fromptr[fromoffset + i*fromstride]));
   }
   return success();
 }
-ERROR awkward_localindex_64(
-  int64_t* toindex,
+ERROR awkward_numpyarray_hash64_frombool(
+  uint64_t* tohash,
+  const bool* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_localindex<int64_t>(
-    toindex,
+  return awkward_numpyarray_hash64<bool>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-
-template <typename C, typename T>
-ERROR awkward_listarray_localindex(
-  T* toindex,
-  const C* offsets,
-  int64_t offsetsoffset,
+ERROR awkward_numpyarray_hash64_from8(
+  uint64_t* tohash,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    int64_t start = (int64_t)offsets[offsetsoffset + i];
-    int64_t stop = (int64_t)offsets[offsetsoffset + i + 1];
-    for (int64_t j = start;  j < stop;  j++) {
-      toindex[j] = j - start;
-    }
-  }
-  return success();
+  return awkward_numpyarray_hash64<int8_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_listarray32_localindex_64(
-  int64_t* toindex,
-  const int32_t* offsets,
-  int64_t offsetsoffset,
+ERROR awkward_numpyarray_hash64_fromU8(
+  uint64_t* tohash,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_listarray_localindex<int32_t, int64_t>(
-    toindex,
-    offsets,
-    offsetsoffset,
+  return awkward_numpyarray_hash64<uint8_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-ERROR awkward_listarrayU32_localindex_64(
-  int64_t* toindex,
-  const uint32_t* offsets,
-  int64_t offsetsoffset,
+ERROR awkward_numpyarray_hash64_from16(
+  uint64_t* tohash,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_listarray_localindex<uint32_t, int64_t>(
-    toindex,
-    offsets,
-    offsetsoffset,
+  return awkward_numpyarray_hash64<int16_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-ERROR awkward_listarray64_localindex_64(
-  int64_t* toindex,
-  const int64_t* offsets,
-  int64_t offsetsoffset,
+ERROR awkward_numpyarray_hash64_fromU16(
+  uint64_t* tohash,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_listarray_localindex<int64_t, int64_t>(
-    toindex,
-    offsets,
-    offsetsoffset,
+  return awkward_numpyarray_hash64<uint16_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-
-template <typename T>
-ERROR awkward_regulararray_localindex(
-  T* toindex,
-  int64_t size,
+ERROR awkward_numpyarray_hash64_from32(
+  uint64_t* tohash,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  for (int64_t i = 0;  i < length;  i++) {
-    for (int64_t j = 0;  j < size;  j++) {
-      toindex[i*size + j] = j;
-    }
-  }
-  return success();
+  return awkward_numpyarray_hash64<int32_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_regulararray_localindex_64(
-  int64_t* toindex,
-  int64_t size,
+ERROR awkward_numpyarray_hash64_fromU32(
+  uint64_t* tohash,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_regulararray_localindex<int64_t>(
-    toindex,
-    size,
+  return awkward_numpyarray_hash64<uint32_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-
-template <typename T>
-ERROR awkward_combinations(
-  T* toindex,
-  int64_t n,
-  bool replacement,
-  int64_t singlelen) {
-  return failure("FIXME: awkward_combinations", 0, kSliceNone);
-}
-ERROR awkward_combinations_64(
-  int64_t* toindex,
-  int64_t n,
-  bool replacement,
-  int64_t singlelen) {
-  return awkward_combinations<int64_t>(
-    toindex,
-    n,
-    replacement,
-    singlelen);
-}
-
-template <typename C, typename T>
-ERROR awkward_listarray_combinations_length(
-  int64_t* totallen,
-  T* tooffsets,
-  int64_t n,
-  bool replacement,
-  const C* starts,
-  int64_t startsoffset,
-  const C* stops,
-  int64_t stopsoffset,
+ERROR awkward_numpyarray_hash64_from64(
+  uint64_t* tohash,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  *totallen = 0;
-  tooffsets[0] = 0;
-  for (int64_t i = 0;  i < length;  i++) {
-    int64_t size = (int64_t)(stops[stopsoffset + i] -
-                             starts[startsoffset + i]);
-    if (replacement) {
-      size += (n - 1);
-    }
-    int64_t thisn = n;
-    int64_t combinationslen;
-    if (thisn > size) {
-      combinationslen = 0;
-    }
-    else if (thisn == size) {
-      combinationslen = 1;
-    }
-    else {
-      if (thisn * 2 > size) {
-        thisn = size - thisn;
-      }
-      combinationslen = size;
-      for (int64_t j = 2;  j <= thisn;  j++) {
-        combinationslen *= (size - j + 1);
-        combinationslen /= j;
-      }
-    }
-    *totallen = *totallen + combinationslen;
-    tooffsets[i + 1] = tooffsets[i] + combinationslen;
-  }
-  return success();
+  return awkward_numpyarray_hash64<int64_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
+    length);
 }
-ERROR awkward_listarray32_combinations_length_64(
-  int64_t* totallen,
-  int64_t* tooffsets,
-  int64_t n,
-  bool replacement,
-  const int32_t* starts,
-  int64_t startsoffset,
-  const int32_t* stops,
-  int64_t stopsoffset,
+ERROR awkward_numpyarray_hash64_fromU64(
+  uint64_t* tohash,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_listarray_combinations_length<int32_t, int64_t>(
-    totallen,
-    tooffsets,
-    n,
-    replacement,
-    starts,
-    startsoffset,
-    stops,
-    stopsoffset,
+  return awkward_numpyarray_hash64<uint64_t>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-ERROR awkward_listarrayU32_combinations_length_64(
-  int64_t* totallen,
-  int64_t* tooffsets,
-  int64_t n,
-  bool replacement,
-  const uint32_t* starts,
-  int64_t startsoffset,
-  const uint32_t* stops,
-  int64_t stopsoffset,
+ERROR awkward_numpyarray_hash64_fromfloat(
+  uint64_t* tohash,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_listarray_combinations_length<uint32_t, int64_t>(
-    totallen,
-    tooffsets,
-    n,
-    replacement,
-    starts,
-    startsoffset,
-    stops,
-    stopsoffset,
+  return awkward_numpyarray_hash64<float>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
-ERROR awkward_listarray64_combinations_length_64(
-  int64_t* totallen,
-  int64_t* tooffsets,
-  int64_t n,
-  bool replacement,
-  const int64_t* starts,
-  int64_t startsoffset,
-  const int64_t* stops,
-  int64_t stopsoffset,
+ERROR awkward_numpyarray_hash64_fromdouble(
+  uint64_t* tohash,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
   int64_t length) {
-  return awkward_listarray_combinations_length<int64_t, int64_t>(
-    totallen,
-    tooffsets,
-    n,
-    replacement,
-    starts,
-    startsoffset,
-    stops,
-    stopsoffset,
+  return awkward_numpyarray_hash64<double>(
+    tohash,
+    fromptr,
+    fromoffset,
+    fromstride,
     length);
 }
 
-template <typename T>
-void awkward_listarray_combinations_step(
-  T** tocarry,
-  int64_t* toindex,
-  int64_t* fromindex,
-  int64_t j,
-  int64_t stop,
-  int64_t n,
-  bool replacement) {
-  while (fromindex[j] < stop) {
-    if (replacement) {
-      for (int64_t k = j + 1;  k < n;  k++) {
-        fromindex[k] = fromindex[j];
-      }
-    }
-    else {
-      for (int64_t k = j + 1;  k < n;  k++) {
-        fromindex[k] = fromindex[j] + (k - j);
-      }
-    }
-    if (j + 1 == n) {
-      for (int64_t k = 0;  k < n;  k++) {
-        tocarry[k][toindex[k]] = fromindex[k];
-        toindex[k]++;
-      }
-    }
-    else {
-      awkward_listarray_combinations_step<T>(tocarry,
-                                             toindex,
-                                             fromindex,
-                                             j + 1,
-                                             stop,
-                                             n,
-                                             replacement);
-    }
-    fromindex[j]++;
-  }
-}
-
-template <typename C, typename T>
-ERROR awkward_listarray_combinations(
-  T** tocarry,
-  int64_t n,
-  bool replacement,
-  const C* starts,
+template <typename C>
+ERROR awkward_listarray_hash64(
+  uint64_t* tohash,
+  const C* fromstarts,
+  const C* fromstops,
   int64_t startsoffset,
-  const C* stops,
   int64_t stopsoffset,
+  const uint8_t* fromcontent,
+  int64_t contentoffset,
+  int64_t itemsize,
   int64_t length) {
-  // delete these before any return!
-  int64_t* toindex = new int64_t[n];
-  int64_t* fromindex = new int64_t[n];
-  for (int64_t j = 0;  j < n;  j++) {
-    toindex[j] = 0;
-  }
   for (int64_t i = 0;  i < length;  i++) {
-    int64_t start = (int64_t)starts[startsoffset + i];
-    int64_t stop = (int64_t)stops[stopsoffset + i];
-    fromindex[0] = start;
-    awkward_listarray_combinations_step<T>(tocarry,
-                                           toindex,
-                                           fromindex,
-                                           0,
-                                           stop,
-                                           n,
-                                           replacement);
+    int64_t start = (int64_t)fromstarts[startsoffset + i];
+    int64_t stop = (int64_t)fromstops[stopsoffset + i];
+    if (stop < start) {
+      return failure("stops[i] < starts[i]", i, kSliceNone);
+    }
+    awkward_buffer_hash64(
+      &tohash[i],
+      fromcontent,
+      contentoffset + start*itemsize,
+      (stop - start)*itemsize,
+      0);
   }
-  delete [] toindex;
-  delete [] fromindex;
   return success();
 }
-ERROR awkward_listarray32_combinations_64(
-  int64_t** tocarry,
-  int64_t n,
-  bool replacement,
-  const int32_t* starts,
+ERROR awkward_listarray32_hash64(
+  uint64_t* tohash,
+  const int32_t* fromstarts,
+  const int32_t* fromstops,
   int64_t startsoffset,
-  const int32_t* stops,
   int64_t stopsoffset,
+  const uint8_t* fromcontent,
+  int64_t contentoffset,
+  int64_t itemsize,
   int64_t length) {
-  return awkward_listarray_combinations<int32_t, int64_t>(
-    tocarry,
-    n,
-    replacement,
-    starts,
+  return awkward_listarray_hash64<int32_t>(
+    tohash,
+    fromstarts,
+    fromstops,
     startsoffset,
-    stops,
     stopsoffset,
+    fromcontent,
+    contentoffset,
+    itemsize,
     length);
 }
-ERROR awkward_listarrayU32_combinations_64(
-  int64_t** tocarry,
-  int64_t n,
-  bool replacement,
-  const uint32_t* starts,
+ERROR awkward_listarrayU32_hash64(
+  uint64_t* tohash,
+  const uint32_t* fromstarts,
+  const uint32_t* fromstops,
   int64_t startsoffset,
-  const uint32_t* stops,
   int64_t stopsoffset,
+  const uint8_t* fromcontent,
+  int64_t contentoffset,
+  int64_t itemsize,
   int64_t length) {
-  return awkward_listarray_combinations<uint32_t, int64_t>(
-    tocarry,
-    n,
-    replacement,
-    starts,
+  return awkward_listarray_hash64<uint32_t>(
+    tohash,
+    fromstarts,
+    fromstops,
     startsoffset,
-    stops,
     stopsoffset,
+    fromcontent,
+    contentoffset,
+    itemsize,
     length);
 }
-ERROR awkward_listarray64_combinations_64(
-  int64_t** tocarry,
-  int64_t n,
-  bool replacement,
-  const int64_t* starts,
+ERROR awkward_listarray64_hash64(
+  uint64_t* tohash,
+  const int64_t* fromstarts,
+  const int64_t* fromstops,
   int64_t startsoffset,
-  const int64_t* stops,
   int64_t stopsoffset,
+  const uint8_t* fromcontent,
+  int64_t contentoffset,
+  int64_t itemsize,
   int64_t length) {
-  return awkward_listarray_combinations<int64_t, int64_t>(
-    tocarry,
-    n,
-    replacement,
-    starts,
+  return awkward_listarray_hash64<int64_t>(
+    tohash,
+    fromstarts,
+    fromstops,
     startsoffset,
-    stops,
     stopsoffset,
+    fromcontent,
+    contentoffset,
+    itemsize,
     length);
 }
+template <typename T>
+ERROR awkward_numpyarray_searchsorted(
+  int64_t* toindex,
+  const T* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  const double* first = edges + edgesoffset;
+  for (int64_t i = 0;  i < length;  i++) {
+    double value = (double)fromptr[fromoffset + i];
+    if (numedges == 0) {
+      toindex[i] = 0;
+      continue;
+    }
+    // branchless binary search; the negated comparisons put NaN last
+    const double* base = first;
+    int64_t n = numedges;
+    if (right) {
+      while (n > 1) {
+        int64_t half = n / 2;
+        base = !(value < base[half]) ? base + half : base;
+        n -= half;
+      }
+      toindex[i] = (base - first) + (int64_t)!(value < *base);
+    }
+    else {
+      while (n > 1) {
+        int64_t half = n / 2;
+        base = !(value <= base[half]) ? base + half : base;
+        n -= half;
+      }
+      toindex[i] = (base - first) + (int64_t)!(value <= *base);
+    }
+  }
+  return success();
+}
+ERROR awkward_numpyarray_searchsorted_from8(
+  int64_t* toindex,
+  const int8_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<int8_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_fromU8(
+  int64_t* toindex,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<uint8_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_from16(
+  int64_t* toindex,
+  const int16_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<int16_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_fromU16(
+  int64_t* toindex,
+  const uint16_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<uint16_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_from32(
+  int64_t* toindex,
+  const int32_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<int32_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_fromU32(
+  int64_t* toindex,
+  const uint32_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<uint32_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_from64(
+  int64_t* toindex,
+  const int64_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<int64_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_fromU64(
+  int64_t* toindex,
+  const uint64_t* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<uint64_t>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_fromfloat(
+  int64_t* toindex,
+  const float* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<float>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
+ERROR awkward_numpyarray_searchsorted_fromdouble(
+  int64_t* toindex,
+  const double* fromptr,
+  int64_t fromoffset,
+  int64_t length,
+  const double* edges,
+  int64_t edgesoffset,
+  int64_t numedges,
+  bool right) {
+  return awkward_numpyarray_searchsorted<double>(
+    toindex,
+    fromptr,
+    fromoffset,
+    length,
+    edges,
+    edgesoffset,
+    numedges,
+    right);
+}
 
-template <typename C, typename T>
-ERROR awkward_regulararray_combinations(
-  T** tocarry,
-  int64_t n,
-  bool replacement,
-  int64_t size,
-  int64_t length) {
-  // delete these before any return!
-  int64_t* toindex = new int64_t[n];
-  int64_t* fromindex = new int64_t[n];
-  for (int64_t j = 0;  j < n;  j++) {
-    toindex[j] = 0;
+// number of edges less than or equal to value (branchless)
+inline int64_t awkward_binnedlookup_upper(
+  const double* first,
+  int64_t numedges,
+  double value) {
+  const double* base = first;
+  int64_t n = numedges;
+  while (n > 1) {
+    int64_t half = n / 2;
+    base = !(value < base[half]) ? base + half : base;
+    n -= half;
+  }
+  return (base - first) + (int64_t)!(value < *base);
+}
+ERROR awkward_binnedlookup_evaluate(
+  double* toptr,
+  const double* fromcoords,
+  int64_t length,
+  int64_t numaxes,
+  const double* edges,
+  const int64_t* edgesoffsets,
+  const double* table,
+  bool interpolate) {
+  if (numaxes < 1  ||  numaxes > 8) {
+    return failure("binned lookup must have from 1 to 8 axes",
+                   kSliceNone, kSliceNone);
   }
+  int64_t numbins[8];
+  int64_t strides[8];
+  int64_t stride = 1;
+  for (int64_t k = numaxes - 1;  k >= 0;  k--) {
+    numbins[k] = edgesoffsets[k + 1] - edgesoffsets[k] - 1;
+    strides[k] = stride;
+    stride *= numbins[k];
+  }
+  int64_t low[8];
+  double frac[8];
   for (int64_t i = 0;  i < length;  i++) {
-    int64_t start = size*i;
-    int64_t stop = start + size;
-    fromindex[0] = start;
-    awkward_listarray_combinations_step<T>(tocarry,
-                                           toindex,
-                                           fromindex,
-                                           0,
-                                           stop,
-                                           n,
-                                           replacement);
+    bool isnan = false;
+    int64_t at = 0;
+    for (int64_t k = 0;  k < numaxes;  k++) {
+      const double* axis = edges + edgesoffsets[k];
+      double value = fromcoords[k*length + i];
+      isnan |= (value != value);
+      int64_t bin = awkward_binnedlookup_upper(
+        axis, numbins[k] + 1, value) - 1;
+      bin = (bin < 0 ? 0 : (bin >= numbins[k] ? numbins[k] - 1 : bin));
+      if (!interpolate) {
+        at += bin*strides[k];
+      }
+      else {
+        // lower of the two bin centers that surround the value
+        double center = 0.5*(axis[bin] + axis[bin + 1]);
+        int64_t j = (value < center ? bin - 1 : bin);
+        if (j < 0) {
+          low[k] = 0;
+          frac[k] = 0.0;
+        }
+        else if (j >= numbins[k] - 1) {
+          low[k] = (numbins[k] > 1 ? numbins[k] - 2 : 0);
+          frac[k] = (numbins[k] > 1 ? 1.0 : 0.0);
+        }
+        else {
+          double c0 = 0.5*(axis[j] + axis[j + 1]);
+          double c1 = 0.5*(axis[j + 1] + axis[j + 2]);
+          low[k] = j;
+          frac[k] = (value - c0) / (c1 - c0);
+        }
+      }
+    }
+    if (isnan) {
+      toptr[i] = std::numeric_limits<double>::quiet_NaN();
+    }
+    else if (!interpolate) {
+      toptr[i] = table[at];
+    }
+    else {
+      double sum = 0.0;
+      for (int64_t corner = 0;  corner < ((int64_t)1 << numaxes);  corner++) {
+        double weight = 1.0;
+        int64_t cornerat = 0;
+        for (int64_t k = 0;  k < numaxes;  k++) {
+          bool upper = ((corner >> k) & 1) != 0;
+          weight *= (upper ? frac[k] : 1.0 - frac[k]);
+          cornerat += (low[k] + (upper ? 1 : 0))*strides[k];
+        }
+        if (weight != 0.0) {
+          sum += weight*table[cornerat];
+        }
+      }
+      toptr[i] = sum;
+    }
   }
-  delete [] toindex;
-  delete [] fromindex;
   return success();
 }
-ERROR awkward_regulararray_combinations_64(
-  int64_t** tocarry,
-  int64_t n,
-  bool replacement,
-  int64_t size,
+
+ERROR awkward_interleavedarray_fill_field(
+  uint8_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromoffset,
+  int64_t fromstride,
+  int64_t itemsize,
   int64_t length) {
-  return awkward_regulararray_combinations<int32_t, int64_t>(
-    tocarry,
-    n,
-    replacement,
-    size,
-    length);
+  for (int64_t i = 0;  i < length;  i++) {
+    std::memcpy(&toptr[i*tostride],
+                &fromptr[fromoffset + i*fromstride],
+                (size_t)itemsize);
+  }
+  return success();
 }
 
-template <typename M>
-ERROR awkward_bytemaskedarray_overlay_mask(
-  M* tomask,
-  const M* theirmask,
-  int64_t theirmaskoffset,
-  const M* mymask,
-  int64_t mymaskoffset,
+ERROR awkward_quantizedarray_dequantize(
+  double* toptr,
+  const double* fromptr,
   int64_t length,
-  bool validwhen) {
+  double scale,
+  double offset) {
   for (int64_t i = 0;  i < length;  i++) {
-    bool theirs = theirmask[theirmaskoffset + i];
-    bool mine = ((mymask[mymaskoffset + i] != 0) != validwhen);
-    tomask[i] = ((theirs | mine) ? 1 : 0);
+    toptr[i] = fromptr[i]*scale + offset;
   }
   return success();
 }
-ERROR awkward_bytemaskedarray_overlay_mask8(
-  int8_t* tomask,
-  const int8_t* theirmask,
-  int64_t theirmaskoffset,
-  const int8_t* mymask,
-  int64_t mymaskoffset,
+
+ERROR awkward_quantizedarray_reduce_sum(
+  double* toptr,
+  const double* fromsum,
+  const int64_t* fromcount,
   int64_t length,
-  bool validwhen) {
-  return awkward_bytemaskedarray_overlay_mask<int8_t>(
-    tomask,
-    theirmask,
-    theirmaskoffset,
-    mymask,
-    mymaskoffset,
-    length,
-    validwhen);
+  double scale,
+  double offset) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toptr[i] = fromsum[i]*scale + (double)fromcount[i]*offset;
+  }
+  return success();
 }
 
-ERROR awkward_bitmaskedarray_to_bytemaskedarray(
-  int8_t* tobytemask,
-  const uint8_t* frombitmask,
-  int64_t bitmaskoffset,
-  int64_t bitmasklength,
-  bool validwhen,
-  bool lsb_order) {
-  if (lsb_order) {
-    for (int64_t i = 0;  i < bitmasklength;  i++) {
-      uint8_t byte = frombitmask[bitmaskoffset + i];
-      tobytemask[i*8 + 0] = ((byte & ((uint8_t)1)) != validwhen);
-      byte >>= 1;
-      tobytemask[i*8 + 1] = ((byte & ((uint8_t)1)) != validwhen);
-      byte >>= 1;
-      tobytemask[i*8 + 2] = ((byte & ((uint8_t)1)) != validwhen);
-      byte >>= 1;
-      tobytemask[i*8 + 3] = ((byte & ((uint8_t)1)) != validwhen);
-      byte >>= 1;
-      tobytemask[i*8 + 4] = ((byte & ((uint8_t)1)) != validwhen);
-      byte >>= 1;
-      tobytemask[i*8 + 5] = ((byte & ((uint8_t)1)) != validwhen);
-      byte >>= 1;
-      tobytemask[i*8 + 6] = ((byte & ((uint8_t)1)) != validwhen);
-      byte >>= 1;
-      tobytemask[i*8 + 7] = ((byte & ((uint8_t)1)) != validwhen);
-    }
+// Neumaier's compensated summation: x is added to sum and the rounding
+// error is accumulated in comp
+inline void awkward_rolling_sum_add(double& sum, double& comp, double x) {
+  double t = sum + x;
+  if (std::fabs(sum) >= std::fabs(x)) {
+    comp += (sum - t) + x;
   }
   else {
-    for (int64_t i = 0;  i < bitmasklength;  i++) {
-      uint8_t byte = frombitmask[bitmaskoffset + i];
-      tobytemask[i*8 + 0] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-      byte <<= 1;
-      tobytemask[i*8 + 1] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-      byte <<= 1;
-      tobytemask[i*8 + 2] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-      byte <<= 1;
-      tobytemask[i*8 + 3] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-      byte <<= 1;
-      tobytemask[i*8 + 4] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-      byte <<= 1;
-      tobytemask[i*8 + 5] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-      byte <<= 1;
-      tobytemask[i*8 + 6] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-      byte <<= 1;
-      tobytemask[i*8 + 7] = (((byte & ((uint8_t)128)) != 0) != validwhen);
-    }
+    comp += (x - t) + sum;
   }
-  return success();
+  sum = t;
 }
 
-template <typename T>
-ERROR awkward_bitmaskedarray_to_indexedoptionarray(
-  T* toindex,
-  const uint8_t* frombitmask,
-  int64_t bitmaskoffset,
-  int64_t bitmasklength,
-  bool validwhen,
-  bool lsb_order) {
-  if (lsb_order) {
-    for (int64_t i = 0;  i < bitmasklength;  i++) {
-      uint8_t byte = frombitmask[bitmaskoffset + i];
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 0] = i*8 + 0;
-      }
-      else {
-        toindex[i*8 + 0] = -1;
-      }
-      byte >>= 1;
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 1] = i*8 + 1;
-      }
-      else {
-        toindex[i*8 + 1] = -1;
-      }
-      byte >>= 1;
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 2] = i*8 + 2;
-      }
-      else {
-        toindex[i*8 + 2] = -1;
-      }
-      byte >>= 1;
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 3] = i*8 + 3;
-      }
-      else {
-        toindex[i*8 + 3] = -1;
-      }
-      byte >>= 1;
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 4] = i*8 + 4;
-      }
-      else {
-        toindex[i*8 + 4] = -1;
-      }
-      byte >>= 1;
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 5] = i*8 + 5;
-      }
-      else {
-        toindex[i*8 + 5] = -1;
-      }
-      byte >>= 1;
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 6] = i*8 + 6;
-      }
-      else {
-        toindex[i*8 + 6] = -1;
-      }
-      byte >>= 1;
-      if ((byte & ((uint8_t)1)) == validwhen) {
-        toindex[i*8 + 7] = i*8 + 7;
-      }
-      else {
-        toindex[i*8 + 7] = -1;
-      }
+inline void awkward_rolling_sum_count(int64_t& numnan,
+                                      int64_t& numposinf,
+                                      int64_t& numneginf,
+                                      double& sum,
+                                      double& comp,
+                                      double x,
+                                      int64_t sign) {
+  // non-finite values are counted, rather than added, so that the sum
+  // recovers when they leave the window
+  if (x != x) {
+    numnan += sign;
+  }
+  else if (std::isinf(x)) {
+    if (x > 0) {
+      numposinf += sign;
+    }
+    else {
+      numneginf += sign;
     }
   }
   else {
-    for (int64_t i = 0;  i < bitmasklength;  i++) {
-      uint8_t byte = frombitmask[bitmaskoffset + i];
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 0] = i*8 + 0;
-      }
-      else {
-        toindex[i*8 + 0] = -1;
-      }
-      byte <<= 1;
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 1] = i*8 + 1;
-      }
-      else {
-        toindex[i*8 + 1] = -1;
-      }
-      byte <<= 1;
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 2] = i*8 + 2;
-      }
-      else {
-        toindex[i*8 + 2] = -1;
+    awkward_rolling_sum_add(sum, comp, sign > 0 ? x : -x);
+  }
+}
+
+ERROR awkward_listoffsetarray_rolling_sum_64(
+  double* toptr,
+  const double* fromptr,
+  int64_t fromoffset,
+  const int64_t* offsets,
+  int64_t length,
+  int64_t window,
+  bool mean) {
+  if (window < 1) {
+    return failure("window must be at least 1", kSliceNone, kSliceNone);
+  }
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t start = offsets[i];
+    int64_t stop = offsets[i + 1];
+    double sum = 0.0;
+    double comp = 0.0;
+    int64_t numnan = 0;
+    int64_t numposinf = 0;
+    int64_t numneginf = 0;
+    for (int64_t j = start;  j < stop;  j++) {
+      awkward_rolling_sum_count(numnan, numposinf, numneginf, sum, comp,
+                                fromptr[fromoffset + j], 1);
+      if (j - start >= window) {
+        awkward_rolling_sum_count(numnan, numposinf, numneginf, sum, comp,
+                                  fromptr[fromoffset + j - window], -1);
       }
-      byte <<= 1;
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 3] = i*8 + 3;
+      double out;
+      if (numnan != 0  ||  (numposinf != 0  &&  numneginf != 0)) {
+        out = std::numeric_limits<double>::quiet_NaN();
       }
-      else {
-        toindex[i*8 + 3] = -1;
+      else if (numposinf != 0) {
+        out = std::numeric_limits<double>::infinity();
       }
-      byte <<= 1;
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 4] = i*8 + 4;
+      else if (numneginf != 0) {
+        out = -std::numeric_limits<double>::infinity();
       }
       else {
-        toindex[i*8 + 4] = -1;
-      }
-      byte <<= 1;
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 5] = i*8 + 5;
+        out = sum + comp;
       }
-      else {
-        toindex[i*8 + 5] = -1;
+      if (mean) {
+        int64_t count = (j - start + 1 < window ? j - start + 1 : window);
+        out /= (double)count;
       }
-      byte <<= 1;
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 6] = i*8 + 6;
+      toptr[j] = out;
+    }
+  }
+  return success();
+}
+
+ERROR awkward_listoffsetarray_rolling_minmax_64(
+  double* toptr,
+  int64_t* scratch,
+  const double* fromptr,
+  int64_t fromoffset,
+  const int64_t* offsets,
+  int64_t length,
+  int64_t window,
+  bool ismax) {
+  if (window < 1) {
+    return failure("window must be at least 1", kSliceNone, kSliceNone);
+  }
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t start = offsets[i];
+    int64_t stop = offsets[i + 1];
+    // monotonic deque of indexes in scratch[head:tail]; each list pushes
+    // at most stop - start of them, so scratch[start:stop] is enough
+    int64_t head = start;
+    int64_t tail = start;
+    for (int64_t j = start;  j < stop;  j++) {
+      double x = fromptr[fromoffset + j];
+      if (x == x) {
+        while (tail > head  &&
+               (ismax ? fromptr[fromoffset + scratch[tail - 1]] <= x
+                      : fromptr[fromoffset + scratch[tail - 1]] >= x)) {
+          tail--;
+        }
+        scratch[tail] = j;
+        tail++;
       }
-      else {
-        toindex[i*8 + 6] = -1;
+      while (tail > head  &&  scratch[head] <= j - window) {
+        head++;
       }
-      byte <<= 1;
-      if (((byte & ((uint8_t)128)) != 0) == validwhen) {
-        toindex[i*8 + 7] = i*8 + 7;
+      if (tail > head) {
+        toptr[j] = fromptr[fromoffset + scratch[head]];
       }
       else {
-        toindex[i*8 + 7] = -1;
+        toptr[j] = std::numeric_limits<double>::quiet_NaN();
       }
     }
   }
   return success();
 }
-ERROR awkward_bitmaskedarray_to_indexedoptionarray_64(
-  int64_t* toindex,
-  const uint8_t* frombitmask,
-  int64_t bitmaskoffset,
-  int64_t bitmasklength,
-  bool validwhen,
-  bool lsb_order) {
-  return awkward_bitmaskedarray_to_indexedoptionarray<int64_t>(
-    toindex,
-    frombitmask,
-    bitmaskoffset,
-    bitmasklength,
-    validwhen,
-    lsb_order);
-}
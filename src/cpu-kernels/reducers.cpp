@@ -2225,6 +2225,3156 @@ ERROR awkward_reduce_argmax_float64_64(
     outlength);
 }
 
+// Segments of a fixed size from 2 to 16 are reduced by a kernel that knows
+// the size at compile time, so that the loop over each segment is unrolled
+// and the loop over segments can be vectorized. Returns false for other
+// sizes, which take the general strided loop.
+template <typename KERNEL, typename... ARGS>
+bool awkward_reduce_fixed(int64_t size, ARGS... args) {
+  switch (size) {
+    case 2:
+      KERNEL::template apply<2>(args...);
+      return true;
+    case 3:
+      KERNEL::template apply<3>(args...);
+      return true;
+    case 4:
+      KERNEL::template apply<4>(args...);
+      return true;
+    case 5:
+      KERNEL::template apply<5>(args...);
+      return true;
+    case 6:
+      KERNEL::template apply<6>(args...);
+      return true;
+    case 7:
+      KERNEL::template apply<7>(args...);
+      return true;
+    case 8:
+      KERNEL::template apply<8>(args...);
+      return true;
+    case 9:
+      KERNEL::template apply<9>(args...);
+      return true;
+    case 10:
+      KERNEL::template apply<10>(args...);
+      return true;
+    case 11:
+      KERNEL::template apply<11>(args...);
+      return true;
+    case 12:
+      KERNEL::template apply<12>(args...);
+      return true;
+    case 13:
+      KERNEL::template apply<13>(args...);
+      return true;
+    case 14:
+      KERNEL::template apply<14>(args...);
+      return true;
+    case 15:
+      KERNEL::template apply<15>(args...);
+      return true;
+    case 16:
+      KERNEL::template apply<16>(args...);
+      return true;
+    default:
+      return false;
+  }
+}
+
+ERROR awkward_reduce_count_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  int64_t outerlen,
+  int64_t reducelen,
+  int64_t innerlen) {
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      toptr[i*tostride + k] = reducelen;
+    }
+  }
+  return success();
+}
+
+template <typename IN>
+struct awkward_reduce_countnonzero_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    int64_t* toptr,
+    const IN* fromptr,
+    int64_t outerlen) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      int64_t x = 0;
+      for (int64_t j = 0;  j < SIZE;  j++) {
+        x += (row[j] != 0);
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename IN>
+ERROR awkward_reduce_countnonzero_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_countnonzero_fixed<IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    int64_t* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = 0;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        out[k] += (row[k*innerstride] != 0);
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_reduce_countnonzero_bool_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_int8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_uint8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_int16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_uint16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_int32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_uint32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_int64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_uint64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_float32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_countnonzero_float64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_countnonzero_strided<double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+
+template <typename OUT, typename IN>
+struct awkward_reduce_sum_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    OUT* toptr,
+    const IN* fromptr,
+    int64_t outerlen) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      OUT x = 0;
+      for (int64_t j = 0;  j < SIZE;  j++) {
+        x += (OUT)row[j];
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_sum_strided(
+  OUT* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_sum_fixed<OUT, IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    OUT* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = 0;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        out[k] += (OUT)row[k*innerstride];
+      }
+    }
+  }
+  return success();
+}
+
+template <typename IN>
+struct awkward_reduce_sum_bool_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    bool* toptr,
+    const IN* fromptr,
+    int64_t outerlen) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      bool x = (bool)0;
+      for (int64_t j = 0;  j < SIZE;  j++) {
+        x |= (row[j] != 0);
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename IN>
+ERROR awkward_reduce_sum_bool_strided(
+  bool* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_sum_bool_fixed<IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    bool* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = (bool)0;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        out[k] |= (row[k*innerstride] != 0);
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_reduce_sum_int64_bool_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int64_t, bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int64_int8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int64_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_uint64_uint8_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<uint64_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int64_int16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int64_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_uint64_uint16_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<uint64_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int64_int32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int64_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_uint64_uint32_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<uint64_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int64_int64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int64_t, int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_uint64_uint64_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<uint64_t, uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_float32_float32_strided(
+  float* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<float, float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_float64_float64_strided(
+  double* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<double, double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int32_bool_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int32_t, bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int32_int8_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int32_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_uint32_uint8_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<uint32_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int32_int16_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int32_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_uint32_uint16_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<uint32_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_int32_int32_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<int32_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_uint32_uint32_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_strided<uint32_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_bool_strided(
+  bool* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_int8_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_uint8_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_int16_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_uint16_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_int32_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_uint32_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_int64_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_uint64_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_float32_strided(
+  bool* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_sum_bool_float64_strided(
+  bool* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_sum_bool_strided<double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+
+template <typename OUT, typename IN>
+struct awkward_reduce_prod_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    OUT* toptr,
+    const IN* fromptr,
+    int64_t outerlen) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      OUT x = 1;
+      for (int64_t j = 0;  j < SIZE;  j++) {
+        x *= (OUT)row[j];
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_prod_strided(
+  OUT* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_prod_fixed<OUT, IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    OUT* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = 1;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        out[k] *= (OUT)row[k*innerstride];
+      }
+    }
+  }
+  return success();
+}
+
+template <typename IN>
+struct awkward_reduce_prod_bool_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    bool* toptr,
+    const IN* fromptr,
+    int64_t outerlen) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      bool x = (bool)1;
+      for (int64_t j = 0;  j < SIZE;  j++) {
+        x &= (row[j] != 0);
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename IN>
+ERROR awkward_reduce_prod_bool_strided(
+  bool* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_prod_bool_fixed<IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    bool* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = (bool)1;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        out[k] &= (row[k*innerstride] != 0);
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_reduce_prod_int64_bool_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int64_t, bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int64_int8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int64_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_uint64_uint8_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<uint64_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int64_int16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int64_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_uint64_uint16_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<uint64_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int64_int32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int64_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_uint64_uint32_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<uint64_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int64_int64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int64_t, int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_uint64_uint64_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<uint64_t, uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_float32_float32_strided(
+  float* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<float, float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_float64_float64_strided(
+  double* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<double, double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int32_bool_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int32_t, bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int32_int8_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int32_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_uint32_uint8_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<uint32_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int32_int16_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int32_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_uint32_uint16_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<uint32_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_int32_int32_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<int32_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_uint32_uint32_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_strided<uint32_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_bool_strided(
+  bool* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_int8_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_uint8_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_int16_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_uint16_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_int32_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_uint32_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_int64_strided(
+  bool* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_uint64_strided(
+  bool* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_float32_strided(
+  bool* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_prod_bool_float64_strided(
+  bool* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_prod_bool_strided<double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+
+template <typename OUT, typename IN>
+struct awkward_reduce_min_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    OUT* toptr,
+    const IN* fromptr,
+    int64_t outerlen,
+    OUT identity) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      OUT x = identity;
+      for (int64_t j = 0;  j < SIZE;  j++) {
+        x = (row[j] < x ? row[j] : x);
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_min_strided(
+  OUT* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  OUT identity) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_min_fixed<OUT, IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen, identity)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    OUT* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = identity;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        IN x = row[k*innerstride];
+        out[k] = (x < out[k] ? x : out[k]);
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_reduce_min_int8_int8_strided(
+  int8_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int8_t identity) {
+  return awkward_reduce_min_strided<int8_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_uint8_uint8_strided(
+  uint8_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint8_t identity) {
+  return awkward_reduce_min_strided<uint8_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_int16_int16_strided(
+  int16_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int16_t identity) {
+  return awkward_reduce_min_strided<int16_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_uint16_uint16_strided(
+  uint16_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint16_t identity) {
+  return awkward_reduce_min_strided<uint16_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_int32_int32_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int32_t identity) {
+  return awkward_reduce_min_strided<int32_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_uint32_uint32_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint32_t identity) {
+  return awkward_reduce_min_strided<uint32_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_int64_int64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int64_t identity) {
+  return awkward_reduce_min_strided<int64_t, int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_uint64_uint64_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint64_t identity) {
+  return awkward_reduce_min_strided<uint64_t, uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_float32_float32_strided(
+  float* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  float identity) {
+  return awkward_reduce_min_strided<float, float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_min_float64_float64_strided(
+  double* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  double identity) {
+  return awkward_reduce_min_strided<double, double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+
+template <typename OUT, typename IN>
+struct awkward_reduce_max_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    OUT* toptr,
+    const IN* fromptr,
+    int64_t outerlen,
+    OUT identity) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      OUT x = identity;
+      for (int64_t j = 0;  j < SIZE;  j++) {
+        x = (row[j] > x ? row[j] : x);
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_max_strided(
+  OUT* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  OUT identity) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_max_fixed<OUT, IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen, identity)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    OUT* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = identity;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        IN x = row[k*innerstride];
+        out[k] = (x > out[k] ? x : out[k]);
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_reduce_max_int8_int8_strided(
+  int8_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int8_t identity) {
+  return awkward_reduce_max_strided<int8_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_uint8_uint8_strided(
+  uint8_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint8_t identity) {
+  return awkward_reduce_max_strided<uint8_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_int16_int16_strided(
+  int16_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int16_t identity) {
+  return awkward_reduce_max_strided<int16_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_uint16_uint16_strided(
+  uint16_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint16_t identity) {
+  return awkward_reduce_max_strided<uint16_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_int32_int32_strided(
+  int32_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int32_t identity) {
+  return awkward_reduce_max_strided<int32_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_uint32_uint32_strided(
+  uint32_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint32_t identity) {
+  return awkward_reduce_max_strided<uint32_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_int64_int64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  int64_t identity) {
+  return awkward_reduce_max_strided<int64_t, int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_uint64_uint64_strided(
+  uint64_t* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  uint64_t identity) {
+  return awkward_reduce_max_strided<uint64_t, uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_float32_float32_strided(
+  float* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  float identity) {
+  return awkward_reduce_max_strided<float, float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+ERROR awkward_reduce_max_float64_float64_strided(
+  double* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride,
+  double identity) {
+  return awkward_reduce_max_strided<double, double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride,
+    identity);
+}
+
+template <typename OUT, typename IN>
+struct awkward_reduce_argmin_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    OUT* toptr,
+    const IN* fromptr,
+    int64_t outerlen) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      OUT x = 0;
+      for (int64_t j = 1;  j < SIZE;  j++) {
+        if (row[j] < row[x]) {
+          x = j;
+        }
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_argmin_strided(
+  OUT* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_argmin_fixed<OUT, IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    OUT* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = -1;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        IN x = row[k*innerstride];
+        if (out[k] == -1  ||
+            x < in[out[k]*reducestride + k*innerstride]) {
+          out[k] = j;
+        }
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_reduce_argmin_bool_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_int8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_uint8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_int16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_uint16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_int32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_uint32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_int64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_uint64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_float32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmin_float64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmin_strided<int64_t, double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+
+template <typename OUT, typename IN>
+struct awkward_reduce_argmax_fixed {
+  template <int64_t SIZE>
+  static void apply(
+    OUT* toptr,
+    const IN* fromptr,
+    int64_t outerlen) {
+    for (int64_t i = 0;  i < outerlen;  i++) {
+      const IN* row = fromptr + i*SIZE;
+      OUT x = 0;
+      for (int64_t j = 1;  j < SIZE;  j++) {
+        if (row[j] > row[x]) {
+          x = j;
+        }
+      }
+      toptr[i] = x;
+    }
+  }
+};
+
+template <typename OUT, typename IN>
+ERROR awkward_reduce_argmax_strided(
+  OUT* toptr,
+  int64_t tostride,
+  const IN* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  if (innerlen == 1  &&  reducestride == 1  &&  outerstride == reducelen  &&
+      tostride == 1  &&
+      awkward_reduce_fixed<awkward_reduce_argmax_fixed<OUT, IN>>(
+        reducelen, toptr, fromptr + fromptroffset, outerlen)) {
+    return success();
+  }
+  for (int64_t i = 0;  i < outerlen;  i++) {
+    OUT* out = toptr + i*tostride;
+    const IN* in = fromptr + fromptroffset + i*outerstride;
+    for (int64_t k = 0;  k < innerlen;  k++) {
+      out[k] = -1;
+    }
+    for (int64_t j = 0;  j < reducelen;  j++) {
+      const IN* row = in + j*reducestride;
+      for (int64_t k = 0;  k < innerlen;  k++) {
+        IN x = row[k*innerstride];
+        if (out[k] == -1  ||
+            x > in[out[k]*reducestride + k*innerstride]) {
+          out[k] = j;
+        }
+      }
+    }
+  }
+  return success();
+}
+ERROR awkward_reduce_argmax_bool_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const bool* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, bool>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_int8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, int8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_uint8_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint8_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, uint8_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_int16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, int16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_uint16_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint16_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, uint16_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_int32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, int32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_uint32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint32_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, uint32_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_int64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const int64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, int64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_uint64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const uint64_t* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, uint64_t>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_float32_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const float* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, float>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+ERROR awkward_reduce_argmax_float64_strided(
+  int64_t* toptr,
+  int64_t tostride,
+  const double* fromptr,
+  int64_t fromptroffset,
+  int64_t outerlen,
+  int64_t outerstride,
+  int64_t reducelen,
+  int64_t reducestride,
+  int64_t innerlen,
+  int64_t innerstride) {
+  return awkward_reduce_argmax_strided<int64_t, double>(
+    toptr,
+    tostride,
+    fromptr,
+    fromptroffset,
+    outerlen,
+    outerstride,
+    reducelen,
+    reducestride,
+    innerlen,
+    innerstride);
+}
+
 ERROR awkward_content_reduce_zeroparents_64(
   int64_t* toparents,
   int64_t length) {
@@ -2234,152 +5384,335 @@ ERROR awkward_content_reduce_zeroparents_64(
   return success();
 }
 
-ERROR awkward_listoffsetarray_reduce_global_startstop_64(
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_global_startstop(
   int64_t* globalstart,
   int64_t* globalstop,
-  const int64_t* offsets,
+  const C* offsets,
   int64_t offsetsoffset,
   int64_t length) {
   *globalstart = offsets[offsetsoffset + 0];
   *globalstop = offsets[offsetsoffset + length];
   return success();
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
-  int64_t* maxcount,
-  int64_t* offsetscopy,
+ERROR awkward_listoffsetarray_reduce_global_startstop_64(
+  int64_t* globalstart,
+  int64_t* globalstop,
   const int64_t* offsets,
   int64_t offsetsoffset,
   int64_t length) {
-  *maxcount = 0;
-  offsetscopy[0] = offsets[offsetsoffset + 0];
+  return awkward_listoffsetarray_reduce_global_startstop<int64_t>(
+    globalstart,
+    globalstop,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarray32_reduce_global_startstop_64(
+  int64_t* globalstart,
+  int64_t* globalstop,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_global_startstop<int32_t>(
+    globalstart,
+    globalstop,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarrayU32_reduce_global_startstop_64(
+  int64_t* globalstart,
+  int64_t* globalstop,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_global_startstop<uint32_t>(
+    globalstart,
+    globalstop,
+    offsets,
+    offsetsoffset,
+    length);
+}
+
+// The nonlocal reduction combines item r of every list with the same
+// parent. Output list p (one per parent) has as many items as the longest
+// of its lists, so the output items number at most len(content) and each
+// step below is a histogram, a scan, or a scatter over the content.
+
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_nonlocal_outoffsets(
+  int64_t* outoffsets,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t outlength) {
+  for (int64_t p = 0;  p <= outlength;  p++) {
+    outoffsets[p] = 0;
+  }
   for (int64_t i = 0;  i < length;  i++) {
     int64_t count = (offsets[offsetsoffset + i + 1] -
                      offsets[offsetsoffset + i]);
-    if (*maxcount < count) {
-      *maxcount = count;
+    int64_t parent = parents[parentsoffset + i];
+    if (outoffsets[parent + 1] < count) {
+      outoffsets[parent + 1] = count;
     }
-    offsetscopy[i + 1] = offsets[offsetsoffset + i + 1];
+  }
+  for (int64_t p = 0;  p < outlength;  p++) {
+    outoffsets[p + 1] += outoffsets[p];
   }
   return success();
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
-  int64_t* nextcarry,
-  int64_t* nextparents,
-  int64_t nextlen,
-  int64_t* maxnextparents,
-  int64_t* distincts,
-  int64_t distinctslen,
-  int64_t* offsetscopy,
+ERROR awkward_listoffsetarray_reduce_nonlocal_outoffsets_64(
+  int64_t* outoffsets,
   const int64_t* offsets,
   int64_t offsetsoffset,
   int64_t length,
   const int64_t* parents,
   int64_t parentsoffset,
-  int64_t maxcount) {
-  *maxnextparents = 0;
-  for (int64_t i = 0;  i < distinctslen;  i++) {
-    distincts[i] = -1;
-  }
-
-  int64_t k = 0;
-  while (k < nextlen) {
-    int64_t j = 0;
-    for (int64_t i = 0;  i < length;  i++) {
-      if (offsetscopy[i] < offsets[offsetsoffset + i + 1]) {
-        int64_t count = (offsets[offsetsoffset + i + 1] -
-                         offsets[offsetsoffset + i]);
-        int64_t diff = offsetscopy[i] - offsets[offsetsoffset + i];
-        int64_t parent = parents[parentsoffset + i];
-
-        nextcarry[k] = offsetscopy[i];
-        nextparents[k] = parent*maxcount + diff;
-
-        if (*maxnextparents < nextparents[k]) {
-          *maxnextparents = nextparents[k];
-        }
-
-        if (distincts[nextparents[k]] == -1) {
-          distincts[nextparents[k]] = j;
-          j++;
-        }
+  int64_t outlength) {
+  return awkward_listoffsetarray_reduce_nonlocal_outoffsets<int64_t>(
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset,
+    outlength);
+}
+ERROR awkward_listoffsetarray32_reduce_nonlocal_outoffsets_64(
+  int64_t* outoffsets,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t outlength) {
+  return awkward_listoffsetarray_reduce_nonlocal_outoffsets<int32_t>(
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset,
+    outlength);
+}
+ERROR awkward_listoffsetarrayU32_reduce_nonlocal_outoffsets_64(
+  int64_t* outoffsets,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset,
+  int64_t outlength) {
+  return awkward_listoffsetarray_reduce_nonlocal_outoffsets<uint32_t>(
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset,
+    outlength);
+}
 
-        k++;
-        offsetscopy[i]++;
-      }
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_nonlocal_nextstarts(
+  int64_t* nextstarts,
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset) {
+  for (int64_t k = 0;  k < nextoutlength;  k++) {
+    nextstarts[k] = 0;
+  }
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t count = (offsets[offsetsoffset + i + 1] -
+                     offsets[offsetsoffset + i]);
+    int64_t outstart = outoffsets[parents[parentsoffset + i]];
+    for (int64_t r = 0;  r < count;  r++) {
+      nextstarts[outstart + r]++;
     }
   }
+  int64_t start = 0;
+  for (int64_t k = 0;  k < nextoutlength;  k++) {
+    int64_t count = nextstarts[k];
+    nextstarts[k] = start;
+    start += count;
+  }
   return success();
 }
-
 ERROR awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
   int64_t* nextstarts,
-  const int64_t* nextparents,
-  int64_t nextlen) {
-  int64_t lastnextparent = -1;
-  for (int64_t k = 0;  k < nextlen;  k++) {
-    if (nextparents[k] != lastnextparent) {
-      nextstarts[nextparents[k]] = k;
-    }
-    lastnextparent = nextparents[k];
-  }
-  return success();
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset) {
+  return awkward_listoffsetarray_reduce_nonlocal_nextstarts<int64_t>(
+    nextstarts,
+    nextoutlength,
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset);
 }
-
-ERROR awkward_listoffsetarray_reduce_nonlocal_findgaps_64(
-  int64_t* gaps,
+ERROR awkward_listoffsetarray32_reduce_nonlocal_nextstarts_64(
+  int64_t* nextstarts,
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
   const int64_t* parents,
-  int64_t parentsoffset,
-  int64_t lenparents) {
-  int64_t k = 0;
-  int64_t last = -1;
-  for (int64_t i = 0;  i < lenparents;  i++) {
-    int64_t parent = parents[parentsoffset + i];
-    if (last < parent) {
-      gaps[k] = parent - last;
-      k++;
-      last = parent;
-    }
-  }
-  return success();
+  int64_t parentsoffset) {
+  return awkward_listoffsetarray_reduce_nonlocal_nextstarts<int32_t>(
+    nextstarts,
+    nextoutlength,
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset);
+}
+ERROR awkward_listoffsetarrayU32_reduce_nonlocal_nextstarts_64(
+  int64_t* nextstarts,
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset) {
+  return awkward_listoffsetarray_reduce_nonlocal_nextstarts<uint32_t>(
+    nextstarts,
+    nextoutlength,
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset);
 }
 
-ERROR awkward_listoffsetarray_reduce_nonlocal_outstartsstops_64(
-  int64_t* outstarts,
-  int64_t* outstops,
-  const int64_t* distincts,
-  int64_t lendistincts,
-  const int64_t* gaps,
-  int64_t outlength) {
-  int64_t j = 0;
-  int64_t k = 0;
-  int64_t maxdistinct = -1;
-  for (int64_t i = 0;  i < lendistincts;  i++) {
-    if (maxdistinct < distincts[i]) {
-      maxdistinct = distincts[i];
-      for (int64_t gappy = 0;  gappy < gaps[j];  gappy++) {
-        outstarts[k] = i;
-        outstops[k] = i;
-        k++;
-      }
-      j++;
-    }
-    if (distincts[i] != -1) {
-      outstops[k - 1] = i + 1;
+template <typename C, typename T>
+ERROR awkward_listoffsetarray_reduce_nonlocal_nextcarry(
+  T* nextcarry,
+  int64_t* nextparents,
+  int64_t* nextstarts,
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
+  const C* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset) {
+  // stable scatter, so that items with the same nextparent are contiguous
+  // and in list order; nextstarts is used as the write cursor
+  for (int64_t i = 0;  i < length;  i++) {
+    int64_t start = offsets[offsetsoffset + i];
+    int64_t count = offsets[offsetsoffset + i + 1] - start;
+    int64_t outstart = outoffsets[parents[parentsoffset + i]];
+    for (int64_t r = 0;  r < count;  r++) {
+      int64_t k = nextstarts[outstart + r];
+      nextcarry[k] = (T)(start + r);
+      nextparents[k] = outstart + r;
+      nextstarts[outstart + r] = k + 1;
     }
   }
-  for (;  k < outlength;  k++) {
-    outstarts[k] = lendistincts + 1;
-    outstops[k] = lendistincts + 1;
+  // each cursor has moved to the next one's start; shift them back
+  for (int64_t k = nextoutlength - 1;  k > 0;  k--) {
+    nextstarts[k] = nextstarts[k - 1];
+  }
+  if (nextoutlength > 0) {
+    nextstarts[0] = 0;
   }
   return success();
 }
-
-ERROR awkward_listoffsetarray_reduce_local_nextparents_64(
+ERROR awkward_listoffsetarray_reduce_nonlocal_nextcarry_64(
+  int64_t* nextcarry,
   int64_t* nextparents,
+  int64_t* nextstarts,
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
   const int64_t* offsets,
   int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset) {
+  return awkward_listoffsetarray_reduce_nonlocal_nextcarry<int64_t, int64_t>(
+    nextcarry,
+    nextparents,
+    nextstarts,
+    nextoutlength,
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset);
+}
+ERROR awkward_listoffsetarray32_reduce_nonlocal_nextcarry_32(
+  int32_t* nextcarry,
+  int64_t* nextparents,
+  int64_t* nextstarts,
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset) {
+  return awkward_listoffsetarray_reduce_nonlocal_nextcarry<int32_t, int32_t>(
+    nextcarry,
+    nextparents,
+    nextstarts,
+    nextoutlength,
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset);
+}
+ERROR awkward_listoffsetarrayU32_reduce_nonlocal_nextcarry_64(
+  int64_t* nextcarry,
+  int64_t* nextparents,
+  int64_t* nextstarts,
+  int64_t nextoutlength,
+  const int64_t* outoffsets,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length,
+  const int64_t* parents,
+  int64_t parentsoffset) {
+  return awkward_listoffsetarray_reduce_nonlocal_nextcarry<uint32_t, int64_t>(
+    nextcarry,
+    nextparents,
+    nextstarts,
+    nextoutlength,
+    outoffsets,
+    offsets,
+    offsetsoffset,
+    length,
+    parents,
+    parentsoffset);
+}
+
+template <typename C>
+ERROR awkward_listoffsetarray_reduce_local_nextparents(
+  int64_t* nextparents,
+  const C* offsets,
+  int64_t offsetsoffset,
   int64_t length) {
   int64_t initialoffset = offsets[offsetsoffset];
   for (int64_t i = 0;  i < length;  i++) {
@@ -2391,6 +5724,39 @@ ERROR awkward_listoffsetarray_reduce_local_nextparents_64(
   }
   return success();
 }
+ERROR awkward_listoffsetarray_reduce_local_nextparents_64(
+  int64_t* nextparents,
+  const int64_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_nextparents<int64_t>(
+    nextparents,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarray32_reduce_local_nextparents_64(
+  int64_t* nextparents,
+  const int32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_nextparents<int32_t>(
+    nextparents,
+    offsets,
+    offsetsoffset,
+    length);
+}
+ERROR awkward_listoffsetarrayU32_reduce_local_nextparents_64(
+  int64_t* nextparents,
+  const uint32_t* offsets,
+  int64_t offsetsoffset,
+  int64_t length) {
+  return awkward_listoffsetarray_reduce_local_nextparents<uint32_t>(
+    nextparents,
+    offsets,
+    offsetsoffset,
+    length);
+}
 
 ERROR awkward_listoffsetarray_reduce_local_outoffsets_64(
   int64_t* outoffsets,
@@ -2524,6 +5890,16 @@ ERROR awkward_numpyarray_reduce_mask_bytemaskedarray(
   return success();
 }
 
+ERROR awkward_numpyarray_reduce_mask_strided_bytemaskedarray(
+  int8_t* toptr,
+  int64_t length,
+  int64_t reducelen) {
+  for (int64_t i = 0;  i < length;  i++) {
+    toptr[i] = (reducelen == 0);
+  }
+  return success();
+}
+
 ERROR awkward_bytemaskedarray_reduce_next_64(
   int64_t* nextcarry,
   int64_t* nextparents,
@@ -0,0 +1,134 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/array/NumpyArray.h"
+
+#include "awkward/BinnedLookup.h"
+
+namespace awkward {
+  BinnedLookup::BinnedLookup(const std::vector<std::vector<double>>& edges,
+                             const std::vector<double>& table)
+      : edges_(edges)
+      , table_(table) {
+    if (edges.empty()  ||  (int64_t)edges.size() > maxaxes) {
+      throw std::invalid_argument(
+        std::string("BinnedLookup must have from 1 to ")
+        + std::to_string(maxaxes) + std::string(" axes"));
+    }
+    int64_t size = 1;
+    edgesoffsets_.push_back(0);
+    for (auto axis : edges) {
+      if (axis.size() < 2) {
+        throw std::invalid_argument(
+          "BinnedLookup edges must have at least two values on each axis");
+      }
+      for (size_t i = 1;  i < axis.size();  i++) {
+        if (!(axis[i - 1] < axis[i])) {
+          throw std::invalid_argument(
+            "BinnedLookup edges must be strictly increasing on each axis");
+        }
+      }
+      size *= (int64_t)axis.size() - 1;
+      flatedges_.insert(flatedges_.end(), axis.begin(), axis.end());
+      edgesoffsets_.push_back((int64_t)flatedges_.size());
+    }
+    if ((int64_t)table.size() != size) {
+      throw std::invalid_argument(
+        std::string("BinnedLookup table has ") + std::to_string(table.size())
+        + std::string(" values, but the edges define ")
+        + std::to_string(size) + std::string(" bins"));
+    }
+  }
+
+  int64_t
+  BinnedLookup::numaxes() const {
+    return (int64_t)edges_.size();
+  }
+
+  const std::vector<std::vector<double>>
+  BinnedLookup::edges() const {
+    return edges_;
+  }
+
+  const std::vector<int64_t>
+  BinnedLookup::shape() const {
+    std::vector<int64_t> out;
+    for (auto axis : edges_) {
+      out.push_back((int64_t)axis.size() - 1);
+    }
+    return out;
+  }
+
+  const std::vector<double>
+  BinnedLookup::table() const {
+    return table_;
+  }
+
+  const ContentPtr
+  BinnedLookup::evaluate(const ContentPtrVec& inputs,
+                         bool interpolate) const {
+    if ((int64_t)inputs.size() != numaxes()) {
+      throw std::invalid_argument(
+        std::string("BinnedLookup has ") + std::to_string(numaxes())
+        + std::string(" axes, but ") + std::to_string(inputs.size())
+        + std::string(" inputs were given"));
+    }
+    std::vector<ssize_t> shape;
+    int64_t length = 0;
+    std::vector<double> coords;
+    for (size_t k = 0;  k < inputs.size();  k++) {
+      NumpyArray* raw = dynamic_cast<NumpyArray*>(inputs[k].get());
+      if (raw == nullptr) {
+        throw std::invalid_argument(
+          "BinnedLookup inputs must be NumpyArrays");
+      }
+      if (k == 0) {
+        shape = raw->shape();
+        length = 1;
+        for (auto x : shape) {
+          length *= (int64_t)x;
+        }
+        coords.resize((size_t)(length*numaxes()));
+      }
+      else if (raw->shape() != shape) {
+        throw std::invalid_argument(
+          "BinnedLookup inputs must all have the same shape");
+      }
+      ContentPtr asdouble = raw->astype("d");
+      NumpyArray contig =
+        dynamic_cast<NumpyArray*>(asdouble.get())->contiguous();
+      const double* ptr = reinterpret_cast<const double*>(contig.byteptr());
+      std::copy(ptr, ptr + length, coords.begin() + (ssize_t)k*length);
+    }
+
+    std::vector<ssize_t> strides(shape.size(), 8);
+    ssize_t stride = 8;
+    for (int64_t i = ((int64_t)shape.size()) - 1;  i >= 0;  i--) {
+      strides[(size_t)i] = stride;
+      stride *= shape[(size_t)i];
+    }
+    std::shared_ptr<double> ptr(new double[(size_t)length],
+                                util::array_deleter<double>());
+    struct Error err = awkward_binnedlookup_evaluate(
+      ptr.get(),
+      coords.data(),
+      length,
+      numaxes(),
+      flatedges_.data(),
+      edgesoffsets_.data(),
+      table_.data(),
+      interpolate);
+    util::handle_error(err, "BinnedLookup", nullptr);
+    return std::make_shared<NumpyArray>(Identities::none(),
+                                        util::Parameters(),
+                                        ptr,
+                                        shape,
+                                        strides,
+                                        0,
+                                        8,
+                                        "d");
+  }
+}
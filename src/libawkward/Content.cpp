@@ -1,5 +1,7 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <iomanip>
+#include <mutex>
 #include <sstream>
 
 #include "rapidjson/document.h"
@@ -7,6 +9,7 @@
 #include "rapidjson/writer.h"
 #include "rapidjson/prettywriter.h"
 
+#include "awkward/cpu-kernels/getitem.h"
 #include "awkward/cpu-kernels/operations.h"
 #include "awkward/cpu-kernels/reducers.h"
 #include "awkward/array/RegularArray.h"
@@ -21,7 +24,9 @@
 #include "awkward/array/BitMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
 #include "awkward/array/VirtualArray.h"
+#include "awkward/array/RangeArray.h"
 #include "awkward/type/ArrayType.h"
+#include "awkward/virtual/ArrayCache.h"
 
 #include "awkward/Content.h"
 
@@ -43,6 +48,9 @@ namespace awkward {
       if (std::string("float32") == json.GetString()) {
         return std::make_shared<NumpyForm>(false, p, s, 4, "f");
       }
+      if (std::string("float16") == json.GetString()) {
+        return std::make_shared<NumpyForm>(false, p, s, 2, "e");
+      }
       if (std::string("int64") == json.GetString()) {
 #if defined _MSC_VER || defined __i386__
         return std::make_shared<NumpyForm>(false, p, s, 8, "q");
@@ -490,7 +498,7 @@ namespace awkward {
 
   Form::Form(bool has_identities, const util::Parameters& parameters)
       : has_identities_(has_identities)
-      , parameters_(parameters) { }
+      , parameters_(parameters.intern()) { }
 
   const std::string
   Form::tostring() const {
@@ -562,7 +570,7 @@ namespace awkward {
   Content::Content(const IdentitiesPtr& identities,
                    const util::Parameters& parameters)
       : identities_(identities)
-      , parameters_(parameters) { }
+      , parameters_(parameters.intern()) { }
 
   bool
   Content::isscalar() const {
@@ -626,6 +634,56 @@ namespace awkward {
     return out;
   }
 
+  uint64_t
+  Content::fingerprint() const {
+    std::string formjson = form(true).get()->tojson(false, false);
+    uint64_t out;
+    struct Error err = awkward_buffer_hash64(
+      &out,
+      reinterpret_cast<const uint8_t*>(formjson.data()),
+      0,
+      (int64_t)formjson.length(),
+      0);
+    util::handle_error(err, classname(), identities_.get());
+    fingerprint_part(out);
+    return out;
+  }
+
+  static std::mutex memocache_mutex;
+  static std::shared_ptr<ArrayCache> memocache_(nullptr);
+
+  void
+  Content::setmemocache(const std::shared_ptr<ArrayCache>& cache) {
+    std::lock_guard<std::mutex> lock(memocache_mutex);
+    memocache_ = cache;
+  }
+
+  const std::shared_ptr<ArrayCache>
+  Content::memocache() {
+    std::lock_guard<std::mutex> lock(memocache_mutex);
+    return memocache_;
+  }
+
+  const ContentPtr
+  Content::memoized(const std::string& operation,
+                    const std::function<const ContentPtr()>& compute) const {
+    std::shared_ptr<ArrayCache> cache = memocache();
+    if (cache.get() == nullptr  ||  identities_.get() != nullptr) {
+      return compute();
+    }
+    std::stringstream key;
+    key << operation << ":" << std::hex << std::setw(16)
+        << std::setfill('0') << fingerprint();
+    ContentPtr out = cache.get()->get(key.str());
+    if (out.get() == nullptr) {
+      out = compute();
+      cache.get()->set(key.str(), out);
+    }
+    // callers may setparameter or setidentities on the result, which must
+    // not change the cached node
+    return out.get()->shallow_copy();
+  }
+
   const std::string
   Content::purelist_parameter(const std::string& key) const {
     return form(false).get()->purelist_parameter(key);
@@ -689,23 +747,32 @@ namespace awkward {
       }
     }
 
-    Index64 starts(1);
-    starts.setitem_at_nowrap(0, 0);
-
-    Index64 parents(length());
-    struct Error err = awkward_content_reduce_zeroparents_64(
-      parents.ptr().get(),
-      length());
-    util::handle_error(err, classname(), identities_.get());
-
-    ContentPtr next = reduce_next(reducer,
-                                  negaxis,
-                                  starts,
-                                  parents,
-                                  1,
-                                  mask,
-                                  keepdims);
-    return next.get()->getitem_at_nowrap(0);
+    std::string options = reducer.options();
+    std::string operation = std::string("reduce(") + reducer.name()
+      + (options.empty() ? std::string("") : std::string("(") + options
+                                             + std::string(")"))
+      + std::string(", ") + std::to_string(negaxis)
+      + std::string(mask ? ", mask" : "")
+      + std::string(keepdims ? ", keepdims)" : ")");
+    return memoized(operation, [&]() -> const ContentPtr {
+      Index64 starts(1);
+      starts.setitem_at_nowrap(0, 0);
+
+      Index64 parents(length());
+      struct Error err = awkward_content_reduce_zeroparents_64(
+        parents.ptr().get(),
+        length());
+      util::handle_error(err, classname(), identities_.get());
+
+      ContentPtr next = reduce_next(reducer,
+                                    negaxis,
+                                    starts,
+                                    parents,
+                                    1,
+                                    mask,
+                                    keepdims);
+      return next.get()->getitem_at_nowrap(0);
+    });
   }
 
   const util::Parameters
@@ -715,7 +782,7 @@ namespace awkward {
 
   void
   Content::setparameters(const util::Parameters& parameters) {
-    parameters_ = parameters;
+    parameters_ = parameters.intern();
   }
 
   const std::string
@@ -735,6 +802,7 @@ namespace awkward {
     else {
       parameters_[key] = value;
     }
+    parameters_ = parameters_.intern();
   }
 
   bool
@@ -763,6 +831,11 @@ namespace awkward {
     return util::parameter_asstring(parameters_, key);
   }
 
+  const ContentPtr
+  Content::materialized() const {
+    return shallow_copy();
+  }
+
   const ContentPtr
   Content::merge_as_union(const ContentPtr& other) const {
     int64_t mylength = length();
@@ -822,14 +895,32 @@ namespace awkward {
     return next.get()->simplify_optiontype();
   }
 
+  const ContentPtr
+  Content::carry(const Index32& carry) const {
+    return this->carry(carry.to64());
+  }
+
+  const ContentPtr
+  Content::carry_or_range(const Index64& carry) const {
+    int64_t lencarry = carry.length();
+    if (lencarry != 0) {
+      bool isrange;
+      struct Error err = awkward_carry_isrange_64(
+        &isrange,
+        carry.ptr().get() + carry.offset(),
+        lencarry);
+      util::handle_error(err, classname(), identities_.get());
+      int64_t start = carry.getitem_at_nowrap(0);
+      if (isrange  &&  start >= 0  &&  start + lencarry <= length()) {
+        return getitem_range_nowrap(start, start + lencarry);
+      }
+    }
+    return this->carry(carry);
+  }
+
   const ContentPtr
   Content::localindex_axis0() const {
-    Index64 localindex(length());
-    struct Error err = awkward_localindex_64(
-      localindex.ptr().get(),
-      length());
-    util::handle_error(err, classname(), identities_.get());
-    return std::make_shared<NumpyArray>(localindex);
+    return std::make_shared<RangeArray>(length());
   }
 
   const ContentPtr
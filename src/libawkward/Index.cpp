@@ -233,6 +233,13 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  void
+  IndexOf<T>::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, util::buffer_fingerprint(
+      ptr_, (int64_t)sizeof(T)*offset_, (int64_t)sizeof(T)*length_));
+  }
+
   template <typename T>
   const std::shared_ptr<Index>
   IndexOf<T>::shallow_copy() const {
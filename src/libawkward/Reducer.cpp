@@ -1,12 +1,118 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <sstream>
+#include <stdexcept>
+#include <utility>
 
+#include "awkward/cpu-kernels/operations.h"
 #include "awkward/cpu-kernels/reducers.h"
 
 #include "awkward/Reducer.h"
 
 namespace awkward {
+  // Dimensions before 'axis' are outer, dimensions after it are inner; the
+  // kernel handles the last of each, and this loops over the rest. Adjacent
+  // dimensions that are contiguous with each other are merged first, so that
+  // the kernel sees the longest possible runs.
+  template <typename OUT, typename IN, typename... EXTRA>
+  struct Error
+  reduce_strided(struct Error (*kernel)(OUT*,
+                                        int64_t,
+                                        const IN*,
+                                        int64_t,
+                                        int64_t,
+                                        int64_t,
+                                        int64_t,
+                                        int64_t,
+                                        int64_t,
+                                        int64_t,
+                                        EXTRA...),
+                 OUT* toptr,
+                 const IN* data,
+                 int64_t offset,
+                 const std::vector<ssize_t>& shape,
+                 const std::vector<ssize_t>& strides,
+                 int64_t axis,
+                 EXTRA... extra) {
+    std::vector<int64_t> outershape;
+    std::vector<int64_t> outerstrides;
+    std::vector<int64_t> innershape;
+    std::vector<int64_t> innerstrides;
+    for (int64_t i = 0;  i < (int64_t)shape.size();  i++) {
+      if (i == axis  ||  shape[(size_t)i] == 1) {
+        continue;
+      }
+      std::vector<int64_t>& dims = (i < axis ? outershape : innershape);
+      std::vector<int64_t>& steps = (i < axis ? outerstrides : innerstrides);
+      if (!dims.empty()  &&
+          steps.back() == (int64_t)shape[(size_t)i]*strides[(size_t)i]) {
+        dims.back() *= (int64_t)shape[(size_t)i];
+        steps.back() = (int64_t)strides[(size_t)i];
+      }
+      else {
+        dims.push_back((int64_t)shape[(size_t)i]);
+        steps.push_back((int64_t)strides[(size_t)i]);
+      }
+    }
+
+    int64_t reducelen = (int64_t)shape[(size_t)axis];
+    int64_t reducestride = (int64_t)strides[(size_t)axis];
+    int64_t outerlen = (outershape.empty() ? 1 : outershape.back());
+    int64_t outerstride = (outerstrides.empty() ? 0 : outerstrides.back());
+    int64_t innerlen = (innershape.empty() ? 1 : innershape.back());
+    int64_t innerstride = (innerstrides.empty() ? 0 : innerstrides.back());
+
+    int64_t numouter = 1;
+    for (int64_t d = 0;  d < (int64_t)outershape.size() - 1;  d++) {
+      numouter *= outershape[(size_t)d];
+    }
+    int64_t numinner = 1;
+    for (int64_t d = 0;  d < (int64_t)innershape.size() - 1;  d++) {
+      numinner *= innershape[(size_t)d];
+    }
+    int64_t innertotal = numinner*innerlen;
+
+    for (int64_t i = 0;  i < numouter;  i++) {
+      int64_t outeroffset = offset;
+      int64_t rest = i;
+      for (int64_t d = (int64_t)outershape.size() - 2;  d >= 0;  d--) {
+        outeroffset += (rest % outershape[(size_t)d])*outerstrides[(size_t)d];
+        rest /= outershape[(size_t)d];
+      }
+      for (int64_t j = 0;  j < numinner;  j++) {
+        int64_t fromoffset = outeroffset;
+        rest = j;
+        for (int64_t d = (int64_t)innershape.size() - 2;  d >= 0;  d--) {
+          fromoffset += (rest % innershape[(size_t)d])*innerstrides[(size_t)d];
+          rest /= innershape[(size_t)d];
+        }
+        struct Error err = kernel(toptr + i*outerlen*innertotal + j*innerlen,
+                                  innertotal,
+                                  data,
+                                  fromoffset,
+                                  outerlen,
+                                  outerstride,
+                                  reducelen,
+                                  reducestride,
+                                  innerlen,
+                                  innerstride,
+                                  extra...);
+        if (err.str != nullptr) {
+          return err;
+        }
+      }
+    }
+    return success();
+  }
+
+  const std::string
+  Reducer::options() const {
+    return "";
+  }
+
   const std::string
   Reducer::return_type(const std::string& given_type) const {
     return given_type;
@@ -248,6 +354,177 @@ namespace awkward {
                       outlength);
   }
 
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_bool(const bool* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    // This is the only reducer that completely ignores the data.
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    int64_t reducelen = shape[(size_t)axis];
+    struct Error err = awkward_reduce_count_strided(
+      ptr.get(),
+      outlength,
+      1,
+      reducelen,
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_int8(const int8_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_uint8(const uint8_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_int16(const int16_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_uint16(const uint16_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_int32(const int32_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_uint32(const uint32_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_int64(const int64_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_uint64(const uint64_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_float32(const float* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
+  const std::shared_ptr<void>
+  ReducerCount::apply_strided_float64(const double* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    return apply_strided_bool(reinterpret_cast<const bool*>(data),
+                              offset,
+                              shape,
+                              strides,
+                              axis,
+                              outlength);
+  }
+
   ////////// count nonzero
 
   const std::string
@@ -499,6 +776,239 @@ namespace awkward {
     return ptr;
   }
 
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_bool(const bool* data,
+                                          int64_t offset,
+                                          const std::vector<ssize_t>& shape,
+                                          const std::vector<ssize_t>& strides,
+                                          int64_t axis,
+                                          int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_int8(const int8_t* data,
+                                          int64_t offset,
+                                          const std::vector<ssize_t>& shape,
+                                          const std::vector<ssize_t>& strides,
+                                          int64_t axis,
+                                          int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_uint8(const uint8_t* data,
+                                           int64_t offset,
+                                           const std::vector<ssize_t>& shape,
+                                           const std::vector<ssize_t>& strides,
+                                           int64_t axis,
+                                           int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_int16(const int16_t* data,
+                                           int64_t offset,
+                                           const std::vector<ssize_t>& shape,
+                                           const std::vector<ssize_t>& strides,
+                                           int64_t axis,
+                                           int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_uint16(const uint16_t* data,
+                                            int64_t offset,
+                                            const std::vector<ssize_t>& shape,
+                                            const std::vector<ssize_t>& strides,
+                                            int64_t axis,
+                                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_int32(const int32_t* data,
+                                           int64_t offset,
+                                           const std::vector<ssize_t>& shape,
+                                           const std::vector<ssize_t>& strides,
+                                           int64_t axis,
+                                           int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_uint32(const uint32_t* data,
+                                            int64_t offset,
+                                            const std::vector<ssize_t>& shape,
+                                            const std::vector<ssize_t>& strides,
+                                            int64_t axis,
+                                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_int64(const int64_t* data,
+                                           int64_t offset,
+                                           const std::vector<ssize_t>& shape,
+                                           const std::vector<ssize_t>& strides,
+                                           int64_t axis,
+                                           int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_int64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_uint64(const uint64_t* data,
+                                            int64_t offset,
+                                            const std::vector<ssize_t>& shape,
+                                            const std::vector<ssize_t>& strides,
+                                            int64_t axis,
+                                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_uint64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_float32(
+    const float* data,
+    int64_t offset,
+    const std::vector<ssize_t>& shape,
+    const std::vector<ssize_t>& strides,
+    int64_t axis,
+    int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_float32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountNonzero::apply_strided_float64(
+    const double* data,
+    int64_t offset,
+    const std::vector<ssize_t>& shape,
+    const std::vector<ssize_t>& strides,
+    int64_t axis,
+    int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_countnonzero_float64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
   ////////// sum (addition)
 
   const std::string
@@ -899,42 +1409,364 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// prod (multiplication)
-
-  const std::string
-  ReducerProd::name() const {
-    return "prod";
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_bool(const bool* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int32_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int64_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
   }
 
-  const std::string
-  ReducerProd::preferred_type() const {
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_int8(const int8_t* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    return "q";
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int32_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
 #else
-    return "l";
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int64_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
 #endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
   }
 
-  ssize_t
-  ReducerProd::preferred_typesize() const {
-    return 8;
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_uint8(const uint8_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_uint32_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_uint64_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
   }
 
-  const std::string
-  ReducerProd::return_type(const std::string& given_type) const {
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_int16(const int16_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
 #if defined _MSC_VER || defined __i386__
-    // if the array is 64-bit, even Windows and 32-bit platforms return 64-bit
-    if (given_type.compare("q") == 0) {
-      return "q";
-    }
-    if (given_type.compare("Q") == 0) {
-      return "Q";
-    }
-#endif
-    if (given_type.compare("?") == 0  ||
-        given_type.compare("b") == 0  ||
-        given_type.compare("h") == 0  ||
-        given_type.compare("i") == 0  ||
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int32_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int64_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_uint16(const uint16_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_uint32_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_uint64_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_int32(const int32_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int32_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int64_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_uint32(const uint32_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_uint32_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_uint64_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_int64(const int64_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_int64_int64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_uint64(const uint64_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_uint64_uint64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_float32(const float* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<float> ptr(new float[(size_t)outlength],
+                               util::array_deleter<float>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_float32_float32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerSum::apply_strided_float64(const double* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_float64_float64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// prod (multiplication)
+
+  const std::string
+  ReducerProd::name() const {
+    return "prod";
+  }
+
+  const std::string
+  ReducerProd::preferred_type() const {
+#if defined _MSC_VER || defined __i386__
+    return "q";
+#else
+    return "l";
+#endif
+  }
+
+  ssize_t
+  ReducerProd::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::string
+  ReducerProd::return_type(const std::string& given_type) const {
+#if defined _MSC_VER || defined __i386__
+    // if the array is 64-bit, even Windows and 32-bit platforms return 64-bit
+    if (given_type.compare("q") == 0) {
+      return "q";
+    }
+    if (given_type.compare("Q") == 0) {
+      return "Q";
+    }
+#endif
+    if (given_type.compare("?") == 0  ||
+        given_type.compare("b") == 0  ||
+        given_type.compare("h") == 0  ||
+        given_type.compare("i") == 0  ||
         given_type.compare("l") == 0  ||
         given_type.compare("q") == 0) {
       // for _MSC_VER or __i386__, "l" means 32-bit
@@ -1303,289 +2135,364 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// any (logical or)
-
-  const std::string
-  ReducerAny::name() const {
-    return "any";
-  }
-
-  const std::string
-  ReducerAny::preferred_type() const {
-    return "?";
-  }
-
-  ssize_t
-  ReducerAny::preferred_typesize() const {
-    return 1;
-  }
-
-  const std::string
-  ReducerAny::return_type(const std::string& given_type) const {
-    return "?";
-  }
-
-  ssize_t
-  ReducerAny::return_typesize(const std::string& given_type) const {
-    return 1;
-  }
-
   const std::shared_ptr<void>
-  ReducerAny::apply_bool(const bool* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_bool_64(
+  ReducerProd::apply_strided_bool(const bool* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int32_bool_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
-    util::handle_error(err, util::quote(name(), true), nullptr);
-    return ptr;
-  }
-
-  const std::shared_ptr<void>
-  ReducerAny::apply_int8(const int8_t* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int8_64(
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int64_bool_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint8(const uint8_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint8_64(
+  ReducerProd::apply_strided_int8(const int8_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int32_int8_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int64_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int16(const int16_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int16_64(
+  ReducerProd::apply_strided_uint8(const uint8_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_uint32_uint8_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_uint64_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint16(const uint16_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint16_64(
+  ReducerProd::apply_strided_int16(const int16_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int32_int16_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int64_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int32(const int32_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int32_64(
+  ReducerProd::apply_strided_uint16(const uint16_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_uint32_uint16_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_uint64_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint32(const uint32_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint32_64(
+  ReducerProd::apply_strided_int32(const int32_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int32_int32_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int64_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_int64(const int64_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_int64_64(
+  ReducerProd::apply_strided_uint32(const uint32_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+#if defined _MSC_VER || defined __i386__
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_uint32_uint32_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
+#else
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_uint64_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+#endif
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_uint64(const uint64_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_uint64_64(
+  ReducerProd::apply_strided_int64(const int64_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_int64_int64_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_float32(const float* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_float32_64(
+  ReducerProd::apply_strided_uint64(const uint64_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_uint64_uint64_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerAny::apply_float64(const double* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
-                              util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_float64_64(
+  ReducerProd::apply_strided_float32(const float* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<float> ptr(new float[(size_t)outlength],
+                               util::array_deleter<float>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_float32_float32_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
-  ////////// all (logical and)
+  const std::shared_ptr<void>
+  ReducerProd::apply_strided_float64(const double* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_float64_float64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// any (logical or)
 
   const std::string
-  ReducerAll::name() const {
-    return "all";
+  ReducerAny::name() const {
+    return "any";
   }
 
   const std::string
-  ReducerAll::preferred_type() const {
+  ReducerAny::preferred_type() const {
     return "?";
   }
 
   ssize_t
-  ReducerAll::preferred_typesize() const {
+  ReducerAny::preferred_typesize() const {
     return 1;
   }
 
   const std::string
-  ReducerAll::return_type(const std::string& given_type) const {
+  ReducerAny::return_type(const std::string& given_type) const {
     return "?";
   }
 
   ssize_t
-  ReducerAll::return_typesize(const std::string& given_type) const {
+  ReducerAny::return_typesize(const std::string& given_type) const {
     return 1;
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_bool(const bool* data,
+  ReducerAny::apply_bool(const bool* data,
                          int64_t offset,
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_bool_64(
+    struct Error err = awkward_reduce_sum_bool_bool_64(
       ptr.get(),
       data,
       offset,
@@ -1598,14 +2505,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int8(const int8_t* data,
+  ReducerAny::apply_int8(const int8_t* data,
                          int64_t offset,
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int8_64(
+    struct Error err = awkward_reduce_sum_bool_int8_64(
       ptr.get(),
       data,
       offset,
@@ -1618,14 +2525,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint8(const uint8_t* data,
+  ReducerAny::apply_uint8(const uint8_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint8_64(
+    struct Error err = awkward_reduce_sum_bool_uint8_64(
       ptr.get(),
       data,
       offset,
@@ -1638,14 +2545,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int16(const int16_t* data,
+  ReducerAny::apply_int16(const int16_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int16_64(
+    struct Error err = awkward_reduce_sum_bool_int16_64(
       ptr.get(),
       data,
       offset,
@@ -1658,14 +2565,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint16(const uint16_t* data,
+  ReducerAny::apply_uint16(const uint16_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint16_64(
+    struct Error err = awkward_reduce_sum_bool_uint16_64(
       ptr.get(),
       data,
       offset,
@@ -1678,14 +2585,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int32(const int32_t* data,
+  ReducerAny::apply_int32(const int32_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int32_64(
+    struct Error err = awkward_reduce_sum_bool_int32_64(
       ptr.get(),
       data,
       offset,
@@ -1698,14 +2605,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint32(const uint32_t* data,
+  ReducerAny::apply_uint32(const uint32_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint32_64(
+    struct Error err = awkward_reduce_sum_bool_uint32_64(
       ptr.get(),
       data,
       offset,
@@ -1718,14 +2625,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_int64(const int64_t* data,
+  ReducerAny::apply_int64(const int64_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_int64_64(
+    struct Error err = awkward_reduce_sum_bool_int64_64(
       ptr.get(),
       data,
       offset,
@@ -1738,14 +2645,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_uint64(const uint64_t* data,
+  ReducerAny::apply_uint64(const uint64_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_uint64_64(
+    struct Error err = awkward_reduce_sum_bool_uint64_64(
       ptr.get(),
       data,
       offset,
@@ -1758,14 +2665,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_float32(const float* data,
+  ReducerAny::apply_float32(const float* data,
                             int64_t offset,
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_float32_64(
+    struct Error err = awkward_reduce_sum_bool_float32_64(
       ptr.get(),
       data,
       offset,
@@ -1778,14 +2685,14 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerAll::apply_float64(const double* data,
+  ReducerAny::apply_float64(const double* data,
                             int64_t offset,
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_float64_64(
+    struct Error err = awkward_reduce_sum_bool_float64_64(
       ptr.get(),
       data,
       offset,
@@ -1797,279 +2704,273 @@ namespace awkward {
     return ptr;
   }
 
-  ////////// min (minimum, in which infinity is the identity)
-
-  const std::string
-  ReducerMin::name() const {
-    return "min";
-  }
-
-  const std::string
-  ReducerMin::preferred_type() const {
-    return "d";
-  }
-
-  ssize_t
-  ReducerMin::preferred_typesize() const {
-    return 8;
-  }
-
   const std::shared_ptr<void>
-  ReducerMin::apply_bool(const bool* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
+  ReducerAny::apply_strided_bool(const bool* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_prod_bool_bool_64(
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_bool_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int8(const int8_t* data,
-                         int64_t offset,
-                         const Index64& starts,
-                         const Index64& parents,
-                         int64_t outlength) const {
-    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
-                                util::array_deleter<int8_t>());
-    struct Error err = awkward_reduce_min_int8_int8_64(
+  ReducerAny::apply_strided_int8(const int8_t* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_int8_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<int8_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint8(const uint8_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
-                                 util::array_deleter<uint8_t>());
-    struct Error err = awkward_reduce_min_uint8_uint8_64(
+  ReducerAny::apply_strided_uint8(const uint8_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_uint8_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<uint8_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int16(const int16_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
-                                 util::array_deleter<int16_t>());
-    struct Error err = awkward_reduce_min_int16_int16_64(
+  ReducerAny::apply_strided_int16(const int16_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_int16_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<int16_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint16(const uint16_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
-                                  util::array_deleter<uint16_t>());
-    struct Error err = awkward_reduce_min_uint16_uint16_64(
+  ReducerAny::apply_strided_uint16(const uint16_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_uint16_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<uint16_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int32(const int32_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
-    struct Error err = awkward_reduce_min_int32_int32_64(
+  ReducerAny::apply_strided_int32(const int32_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_int32_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<int32_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint32(const uint32_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
-    struct Error err = awkward_reduce_min_uint32_uint32_64(
+  ReducerAny::apply_strided_uint32(const uint32_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_uint32_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<uint32_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_int64(const int64_t* data,
-                          int64_t offset,
-                          const Index64& starts,
-                          const Index64& parents,
-                          int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_min_int64_int64_64(
+  ReducerAny::apply_strided_int64(const int64_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_int64_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<int64_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_uint64(const uint64_t* data,
-                           int64_t offset,
-                           const Index64& starts,
-                           const Index64& parents,
-                           int64_t outlength) const {
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
-    struct Error err = awkward_reduce_min_uint64_uint64_64(
+  ReducerAny::apply_strided_uint64(const uint64_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_uint64_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<uint64_t>::max());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_float32(const float* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<float> ptr(new float[(size_t)outlength],
-                               util::array_deleter<float>());
-    struct Error err = awkward_reduce_min_float32_float32_64(
+  ReducerAny::apply_strided_float32(const float* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_float32_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<float>::infinity());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMin::apply_float64(const double* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<double> ptr(new double[(size_t)outlength],
-                                util::array_deleter<double>());
-    struct Error err = awkward_reduce_min_float64_float64_64(
+  ReducerAny::apply_strided_float64(const double* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_float64_strided,
       ptr.get(),
       data,
       offset,
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength,
-      std::numeric_limits<double>::infinity());
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
-  ////////// max (maximum, in which -infinity is the identity)
+  ////////// all (logical and)
 
   const std::string
-  ReducerMax::name() const {
-    return "max";
+  ReducerAll::name() const {
+    return "all";
   }
 
   const std::string
-  ReducerMax::preferred_type() const {
-    return "d";
+  ReducerAll::preferred_type() const {
+    return "?";
   }
 
   ssize_t
-  ReducerMax::preferred_typesize() const {
-    return 8;
+  ReducerAll::preferred_typesize() const {
+    return 1;
+  }
+
+  const std::string
+  ReducerAll::return_type(const std::string& given_type) const {
+    return "?";
+  }
+
+  ssize_t
+  ReducerAll::return_typesize(const std::string& given_type) const {
+    return 1;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_bool(const bool* data,
+  ReducerAll::apply_bool(const bool* data,
                          int64_t offset,
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
     std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
                               util::array_deleter<bool>());
-    struct Error err = awkward_reduce_sum_bool_bool_64(
+    struct Error err = awkward_reduce_prod_bool_bool_64(
       ptr.get(),
       data,
       offset,
@@ -2082,541 +2983,465 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int8(const int8_t* data,
+  ReducerAll::apply_int8(const int8_t* data,
                          int64_t offset,
                          const Index64& starts,
                          const Index64& parents,
                          int64_t outlength) const {
-    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
-                                util::array_deleter<int8_t>());
-    struct Error err = awkward_reduce_max_int8_int8_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_int8_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<int8_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint8(const uint8_t* data,
+  ReducerAll::apply_uint8(const uint8_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
-                                 util::array_deleter<uint8_t>());
-    struct Error err = awkward_reduce_max_uint8_uint8_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_uint8_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<uint8_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int16(const int16_t* data,
+  ReducerAll::apply_int16(const int16_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
-                                 util::array_deleter<int16_t>());
-    struct Error err = awkward_reduce_max_int16_int16_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_int16_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<int16_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint16(const uint16_t* data,
+  ReducerAll::apply_uint16(const uint16_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
-                                  util::array_deleter<uint16_t>());
-    struct Error err = awkward_reduce_max_uint16_uint16_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_uint16_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<uint16_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int32(const int32_t* data,
+  ReducerAll::apply_int32(const int32_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
-                                 util::array_deleter<int32_t>());
-    struct Error err = awkward_reduce_max_int32_int32_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_int32_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<int32_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint32(const uint32_t* data,
+  ReducerAll::apply_uint32(const uint32_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
-                                  util::array_deleter<uint32_t>());
-    struct Error err = awkward_reduce_max_uint32_uint32_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_uint32_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<uint32_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_int64(const int64_t* data,
+  ReducerAll::apply_int64(const int64_t* data,
                           int64_t offset,
                           const Index64& starts,
                           const Index64& parents,
                           int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_max_int64_int64_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_int64_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<int64_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_uint64(const uint64_t* data,
+  ReducerAll::apply_uint64(const uint64_t* data,
                            int64_t offset,
                            const Index64& starts,
                            const Index64& parents,
                            int64_t outlength) const {
-    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
-                                  util::array_deleter<uint64_t>());
-    struct Error err = awkward_reduce_max_uint64_uint64_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_uint64_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      std::numeric_limits<uint64_t>::min());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_float32(const float* data,
+  ReducerAll::apply_float32(const float* data,
                             int64_t offset,
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<float> ptr(new float[(size_t)outlength],
-                               util::array_deleter<float>());
-    struct Error err = awkward_reduce_max_float32_float32_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_float32_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      -std::numeric_limits<float>::infinity());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerMax::apply_float64(const double* data,
+  ReducerAll::apply_float64(const double* data,
                             int64_t offset,
                             const Index64& starts,
                             const Index64& parents,
                             int64_t outlength) const {
-    std::shared_ptr<double> ptr(new double[(size_t)outlength],
-                                util::array_deleter<double>());
-    struct Error err = awkward_reduce_max_float64_float64_64(
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_float64_64(
       ptr.get(),
       data,
       offset,
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength,
-      -std::numeric_limits<double>::infinity());
+      outlength);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
-  ////////// argmin (argument minimum, in which -1 is the identity)
-
-  const std::string
-  ReducerArgmin::name() const {
-    return "argmin";
-  }
-
-  const std::string
-  ReducerArgmin::preferred_type() const {
-#if defined _MSC_VER || defined __i386__
-    return "q";
-#else
-    return "l";
-#endif
-  }
-
-  ssize_t
-  ReducerArgmin::preferred_typesize() const {
-    return 8;
-  }
-
-  const std::string
-  ReducerArgmin::return_type(const std::string& given_type) const {
-#if defined _MSC_VER || defined __i386__
-    return "q";
-#else
-    return "l";
-#endif
-  }
-
-  ssize_t
-  ReducerArgmin::return_typesize(const std::string& given_type) const {
-    return 8;
+  const std::shared_ptr<void>
+  ReducerAll::apply_strided_bool(const bool* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_bool(const bool* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_bool_64(
+  ReducerAll::apply_strided_int8(const int8_t* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_int8_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_int8(const int8_t* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_int8_64(
+  ReducerAll::apply_strided_uint8(const uint8_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_uint8_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_uint8(const uint8_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_uint8_64(
+  ReducerAll::apply_strided_int16(const int16_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_int16_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_int16(const int16_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_int16_64(
+  ReducerAll::apply_strided_uint16(const uint16_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_uint16_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_uint16(const uint16_t* data,
-                              int64_t offset,
-                              const Index64& starts,
-                              const Index64& parents,
-                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_uint16_64(
+  ReducerAll::apply_strided_int32(const int32_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_int32_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_int32(const int32_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_int32_64(
+  ReducerAll::apply_strided_uint32(const uint32_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_uint32_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_uint32(const uint32_t* data,
-                              int64_t offset,
-                              const Index64& starts,
-                              const Index64& parents,
-                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_uint32_64(
+  ReducerAll::apply_strided_int64(const int64_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_int64_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_int64(const int64_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_int64_64(
+  ReducerAll::apply_strided_uint64(const uint64_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_uint64_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_uint64(const uint64_t* data,
-                              int64_t offset,
-                              const Index64& starts,
-                              const Index64& parents,
-                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_uint64_64(
+  ReducerAll::apply_strided_float32(const float* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_float32_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmin::apply_float32(const float* data,
-                               int64_t offset,
-                               const Index64& starts,
-                               const Index64& parents,
-                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_float32_64(
-      ptr.get(),
-      data,
-      offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
-    util::handle_error(err, util::quote(name(), true), nullptr);
-    return ptr;
-  }
-
-  const std::shared_ptr<void>
-  ReducerArgmin::apply_float64(const double* data,
-                               int64_t offset,
-                               const Index64& starts,
-                               const Index64& parents,
-                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmin_float64_64(
+  ReducerAll::apply_strided_float64(const double* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_float64_strided,
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
-      parents.ptr().get(),
-      parents.offset(),
-      parents.length(),
-      outlength);
+      shape,
+      strides,
+      axis);
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
-  ////////// argmax (argument maximum, in which -1 is the identity)
-
-  const std::string
-  ReducerArgmax::name() const {
-    return "argmax";
-  }
+  ////////// min (minimum, in which infinity is the identity)
 
   const std::string
-  ReducerArgmax::preferred_type() const {
-#if defined _MSC_VER || defined __i386__
-    return "q";
-#else
-    return "l";
-#endif
-  }
-
-  ssize_t
-  ReducerArgmax::preferred_typesize() const {
-    return 8;
+  ReducerMin::name() const {
+    return "min";
   }
 
   const std::string
-  ReducerArgmax::return_type(const std::string& given_type) const {
-#if defined _MSC_VER || defined __i386__
-    return "q";
-#else
-    return "l";
-#endif
+  ReducerMin::preferred_type() const {
+    return "d";
   }
 
   ssize_t
-  ReducerArgmax::return_typesize(const std::string& given_type) const {
+  ReducerMin::preferred_typesize() const {
     return 8;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_bool(const bool* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_bool_64(
+  ReducerMin::apply_bool(const bool* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_prod_bool_bool_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
@@ -2626,218 +3451,485 @@ namespace awkward {
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_int8(const int8_t* data,
-                            int64_t offset,
-                            const Index64& starts,
-                            const Index64& parents,
-                            int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_int8_64(
+  ReducerMin::apply_int8(const int8_t* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
+                                util::array_deleter<int8_t>());
+    struct Error err = awkward_reduce_min_int8_int8_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<int8_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_uint8(const uint8_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_uint8_64(
+  ReducerMin::apply_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
+                                 util::array_deleter<uint8_t>());
+    struct Error err = awkward_reduce_min_uint8_uint8_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<uint8_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_int16(const int16_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_int16_64(
+  ReducerMin::apply_int16(const int16_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
+                                 util::array_deleter<int16_t>());
+    struct Error err = awkward_reduce_min_int16_int16_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<int16_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_uint16(const uint16_t* data,
-                              int64_t offset,
-                              const Index64& starts,
-                              const Index64& parents,
-                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_uint16_64(
+  ReducerMin::apply_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
+                                  util::array_deleter<uint16_t>());
+    struct Error err = awkward_reduce_min_uint16_uint16_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<uint16_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_int32(const int32_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_int32_64(
+  ReducerMin::apply_int32(const int32_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = awkward_reduce_min_int32_int32_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<int32_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_uint32(const uint32_t* data,
-                              int64_t offset,
-                              const Index64& starts,
-                              const Index64& parents,
-                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_uint32_64(
+  ReducerMin::apply_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = awkward_reduce_min_uint32_uint32_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<uint32_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_int64(const int64_t* data,
-                             int64_t offset,
-                             const Index64& starts,
-                             const Index64& parents,
-                             int64_t outlength) const {
+  ReducerMin::apply_int64(const int64_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
     std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
                                  util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_int64_64(
+    struct Error err = awkward_reduce_min_int64_int64_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<int64_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_uint64(const uint64_t* data,
-                              int64_t offset,
-                              const Index64& starts,
-                              const Index64& parents,
-                              int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_uint64_64(
+  ReducerMin::apply_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = awkward_reduce_min_uint64_uint64_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<uint64_t>::max());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_float32(const float* data,
-                               int64_t offset,
-                               const Index64& starts,
-                               const Index64& parents,
-                               int64_t outlength) const {
-    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                 util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_float32_64(
+  ReducerMin::apply_float32(const float* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<float> ptr(new float[(size_t)outlength],
+                               util::array_deleter<float>());
+    struct Error err = awkward_reduce_min_float32_float32_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
-      outlength);
+      outlength,
+      std::numeric_limits<float>::infinity());
     util::handle_error(err, util::quote(name(), true), nullptr);
     return ptr;
   }
 
   const std::shared_ptr<void>
-  ReducerArgmax::apply_float64(const double* data,
-                               int64_t offset,
-                               const Index64& starts,
-                               const Index64& parents,
-                               int64_t outlength) const {
+  ReducerMin::apply_float64(const double* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    struct Error err = awkward_reduce_min_float64_float64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<double>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_bool(const bool* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_prod_bool_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_int8(const int8_t* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
+                                util::array_deleter<int8_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_int8_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int8_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_uint8(const uint8_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
+                                 util::array_deleter<uint8_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_uint8_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint8_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_int16(const int16_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
+                                 util::array_deleter<int16_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_int16_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int16_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_uint16(const uint16_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
+                                  util::array_deleter<uint16_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_uint16_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint16_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_int32(const int32_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_int32_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int32_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_uint32(const uint32_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_uint32_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint32_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_int64(const int64_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
     std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
-                                
                                  util::array_deleter<int64_t>());
-    struct Error err = awkward_reduce_argmax_float64_64(
+    struct Error err = reduce_strided(
+      awkward_reduce_min_int64_int64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int64_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_uint64(const uint64_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_uint64_uint64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint64_t>::max());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_float32(const float* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<float> ptr(new float[(size_t)outlength],
+                               util::array_deleter<float>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_float32_float32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<float>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMin::apply_strided_float64(const double* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    struct Error err = reduce_strided(
+      awkward_reduce_min_float64_float64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<double>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// max (maximum, in which -infinity is the identity)
+
+  const std::string
+  ReducerMax::name() const {
+    return "max";
+  }
+
+  const std::string
+  ReducerMax::preferred_type() const {
+    return "d";
+  }
+
+  ssize_t
+  ReducerMax::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_bool(const bool* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = awkward_reduce_sum_bool_bool_64(
       ptr.get(),
       data,
       offset,
-      starts.ptr().get(),
-      starts.offset(),
       parents.ptr().get(),
       parents.offset(),
       parents.length(),
@@ -2846,4 +3938,2569 @@ namespace awkward {
     return ptr;
   }
 
+  const std::shared_ptr<void>
+  ReducerMax::apply_int8(const int8_t* data,
+                         int64_t offset,
+                         const Index64& starts,
+                         const Index64& parents,
+                         int64_t outlength) const {
+    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
+                                util::array_deleter<int8_t>());
+    struct Error err = awkward_reduce_max_int8_int8_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int8_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint8(const uint8_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
+                                 util::array_deleter<uint8_t>());
+    struct Error err = awkward_reduce_max_uint8_uint8_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint8_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_int16(const int16_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
+                                 util::array_deleter<int16_t>());
+    struct Error err = awkward_reduce_max_int16_int16_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int16_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint16(const uint16_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
+                                  util::array_deleter<uint16_t>());
+    struct Error err = awkward_reduce_max_uint16_uint16_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint16_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_int32(const int32_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = awkward_reduce_max_int32_int32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int32_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint32(const uint32_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = awkward_reduce_max_uint32_uint32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint32_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_int64(const int64_t* data,
+                          int64_t offset,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_max_int64_int64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<int64_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_uint64(const uint64_t* data,
+                           int64_t offset,
+                           const Index64& starts,
+                           const Index64& parents,
+                           int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = awkward_reduce_max_uint64_uint64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      std::numeric_limits<uint64_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_float32(const float* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<float> ptr(new float[(size_t)outlength],
+                               util::array_deleter<float>());
+    struct Error err = awkward_reduce_max_float32_float32_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      -std::numeric_limits<float>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_float64(const double* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    struct Error err = awkward_reduce_max_float64_float64_64(
+      ptr.get(),
+      data,
+      offset,
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength,
+      -std::numeric_limits<double>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_bool(const bool* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+    std::shared_ptr<bool> ptr(new bool[(size_t)outlength],
+                              util::array_deleter<bool>());
+    struct Error err = reduce_strided(
+      awkward_reduce_sum_bool_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_int8(const int8_t* data,
+                                 int64_t offset,
+                                 const std::vector<ssize_t>& shape,
+                                 const std::vector<ssize_t>& strides,
+                                 int64_t axis,
+                                 int64_t outlength) const {
+    std::shared_ptr<int8_t> ptr(new int8_t[(size_t)outlength],
+                                util::array_deleter<int8_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_int8_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int8_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_uint8(const uint8_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<uint8_t> ptr(new uint8_t[(size_t)outlength],
+                                 util::array_deleter<uint8_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_uint8_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint8_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_int16(const int16_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<int16_t> ptr(new int16_t[(size_t)outlength],
+                                 util::array_deleter<int16_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_int16_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int16_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_uint16(const uint16_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint16_t> ptr(new uint16_t[(size_t)outlength],
+                                  util::array_deleter<uint16_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_uint16_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint16_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_int32(const int32_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<int32_t> ptr(new int32_t[(size_t)outlength],
+                                 util::array_deleter<int32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_int32_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int32_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_uint32(const uint32_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint32_t> ptr(new uint32_t[(size_t)outlength],
+                                  util::array_deleter<uint32_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_uint32_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint32_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_int64(const int64_t* data,
+                                  int64_t offset,
+                                  const std::vector<ssize_t>& shape,
+                                  const std::vector<ssize_t>& strides,
+                                  int64_t axis,
+                                  int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_int64_int64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<int64_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_uint64(const uint64_t* data,
+                                   int64_t offset,
+                                   const std::vector<ssize_t>& shape,
+                                   const std::vector<ssize_t>& strides,
+                                   int64_t axis,
+                                   int64_t outlength) const {
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)outlength],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_uint64_uint64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      std::numeric_limits<uint64_t>::min());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_float32(const float* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<float> ptr(new float[(size_t)outlength],
+                               util::array_deleter<float>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_float32_float32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      -std::numeric_limits<float>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerMax::apply_strided_float64(const double* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    struct Error err = reduce_strided(
+      awkward_reduce_max_float64_float64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      -std::numeric_limits<double>::infinity());
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// argmin (argument minimum, in which -1 is the identity)
+
+  const std::string
+  ReducerArgmin::name() const {
+    return "argmin";
+  }
+
+  const std::string
+  ReducerArgmin::preferred_type() const {
+#if defined _MSC_VER || defined __i386__
+    return "q";
+#else
+    return "l";
+#endif
+  }
+
+  ssize_t
+  ReducerArgmin::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::string
+  ReducerArgmin::return_type(const std::string& given_type) const {
+#if defined _MSC_VER || defined __i386__
+    return "q";
+#else
+    return "l";
+#endif
+  }
+
+  ssize_t
+  ReducerArgmin::return_typesize(const std::string& given_type) const {
+    return 8;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_bool(const bool* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_bool_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int8(const int8_t* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_int8_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint8(const uint8_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_uint8_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int16(const int16_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_int16_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint16(const uint16_t* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_uint16_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int32(const int32_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_int32_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint32(const uint32_t* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_uint32_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_int64(const int64_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_int64_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_uint64(const uint64_t* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_uint64_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_float32(const float* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_float32_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_float64(const double* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmin_float64_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_bool(const bool* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_int8(const int8_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_uint8(const uint8_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_int16(const int16_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_uint16(const uint16_t* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_int32(const int32_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_uint32(const uint32_t* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_int64(const int64_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_int64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_uint64(const uint64_t* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_uint64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_float32(const float* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_float32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmin::apply_strided_float64(const double* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmin_float64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// argmax (argument maximum, in which -1 is the identity)
+
+  const std::string
+  ReducerArgmax::name() const {
+    return "argmax";
+  }
+
+  const std::string
+  ReducerArgmax::preferred_type() const {
+#if defined _MSC_VER || defined __i386__
+    return "q";
+#else
+    return "l";
+#endif
+  }
+
+  ssize_t
+  ReducerArgmax::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::string
+  ReducerArgmax::return_type(const std::string& given_type) const {
+#if defined _MSC_VER || defined __i386__
+    return "q";
+#else
+    return "l";
+#endif
+  }
+
+  ssize_t
+  ReducerArgmax::return_typesize(const std::string& given_type) const {
+    return 8;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_bool(const bool* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_bool_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int8(const int8_t* data,
+                            int64_t offset,
+                            const Index64& starts,
+                            const Index64& parents,
+                            int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_int8_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint8(const uint8_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_uint8_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int16(const int16_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_int16_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint16(const uint16_t* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_uint16_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int32(const int32_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_int32_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint32(const uint32_t* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_uint32_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_int64(const int64_t* data,
+                             int64_t offset,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_int64_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_uint64(const uint64_t* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_uint64_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_float32(const float* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_float32_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_float64(const double* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                
+                                 util::array_deleter<int64_t>());
+    struct Error err = awkward_reduce_argmax_float64_64(
+      ptr.get(),
+      data,
+      offset,
+      starts.ptr().get(),
+      starts.offset(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_bool(const bool* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_bool_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_int8(const int8_t* data,
+                                    int64_t offset,
+                                    const std::vector<ssize_t>& shape,
+                                    const std::vector<ssize_t>& strides,
+                                    int64_t axis,
+                                    int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_int8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_uint8(const uint8_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_uint8_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_int16(const int16_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_int16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_uint16(const uint16_t* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_uint16_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_int32(const int32_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_int32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_uint32(const uint32_t* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_uint32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_int64(const int64_t* data,
+                                     int64_t offset,
+                                     const std::vector<ssize_t>& shape,
+                                     const std::vector<ssize_t>& strides,
+                                     int64_t axis,
+                                     int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_int64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_uint64(const uint64_t* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_uint64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_float32(const float* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_float32_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  const std::shared_ptr<void>
+  ReducerArgmax::apply_strided_float64(const double* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                
+                                 util::array_deleter<int64_t>());
+    struct Error err = reduce_strided(
+      awkward_reduce_argmax_float64_strided,
+      ptr.get(),
+      data,
+      offset,
+      shape,
+      strides,
+      axis);
+    util::handle_error(err, util::quote(name(), true), nullptr);
+    return ptr;
+  }
+
+  ////////// quantile sketch
+
+  QuantileSketch::QuantileSketch(int64_t k)
+      : k_(k)
+      , count_(0)
+      , size_(0)
+      , maxsize_(0)
+      , coins_(0x9E3779B97F4A7C15ULL) {
+    if (k < 2) {
+      throw std::invalid_argument(
+        std::string("QuantileSketch k must be at least 2, not ")
+        + std::to_string(k));
+    }
+  }
+
+  int64_t
+  QuantileSketch::k() const {
+    return k_;
+  }
+
+  int64_t
+  QuantileSketch::count() const {
+    return count_;
+  }
+
+  int64_t
+  QuantileSketch::size() const {
+    return size_;
+  }
+
+  void
+  QuantileSketch::update(double x) {
+    if (std::isnan(x)) {
+      return;
+    }
+    if (levels_.empty()) {
+      levels_.push_back(std::vector<double>());
+      maxsize_ = capacity(0);
+    }
+    levels_[0].push_back(x);
+    count_++;
+    size_++;
+    if (size_ >= maxsize_) {
+      compress();
+    }
+  }
+
+  void
+  QuantileSketch::merge(const QuantileSketch& other) {
+    if (other.size_ == 0) {
+      return;
+    }
+    while (levels_.size() < other.levels_.size()) {
+      levels_.push_back(std::vector<double>());
+    }
+    for (size_t h = 0;  h < other.levels_.size();  h++) {
+      levels_[h].insert(levels_[h].end(),
+                        other.levels_[h].begin(),
+                        other.levels_[h].end());
+    }
+    count_ += other.count_;
+    size_ += other.size_;
+    compress();
+  }
+
+  double
+  QuantileSketch::quantile(double q) const {
+    if (size_ == 0) {
+      return std::numeric_limits<double>::quiet_NaN();
+    }
+    std::vector<std::pair<double, int64_t>> weighted;
+    weighted.reserve((size_t)size_);
+    int64_t total = 0;
+    for (size_t h = 0;  h < levels_.size();  h++) {
+      int64_t weight = (int64_t)1 << h;
+      for (auto x : levels_[h]) {
+        weighted.push_back(std::pair<double, int64_t>(x, weight));
+      }
+      total += weight*(int64_t)levels_[h].size();
+    }
+    std::sort(weighted.begin(), weighted.end());
+    // Same as NumPy's interpolation="lower" when all weights are 1.
+    double target = q*(double)(total - 1);
+    int64_t cumulative = 0;
+    for (auto pair : weighted) {
+      cumulative += pair.second;
+      if ((double)cumulative > target) {
+        return pair.first;
+      }
+    }
+    return weighted.back().first;
+  }
+
+  int64_t
+  QuantileSketch::flip() {
+    // xorshift64: a fixed seed keeps results reproducible, but unlike
+    // strict alternation, the choices do not correlate across levels.
+    coins_ ^= coins_ << 13;
+    coins_ ^= coins_ >> 7;
+    coins_ ^= coins_ << 17;
+    return (int64_t)(coins_ & 1);
+  }
+
+  int64_t
+  QuantileSketch::capacity(size_t level) const {
+    // Capacities shrink geometrically by 2/3 below the top level.
+    size_t depth = levels_.size() - level - 1;
+    double out = std::ceil((double)k_ * std::pow(2.0/3.0, (double)depth));
+    return std::max((int64_t)2, (int64_t)out);
+  }
+
+  void
+  QuantileSketch::compress() {
+    for (size_t h = 0;  h < levels_.size();  h++) {
+      if ((int64_t)levels_[h].size() >= capacity(h)) {
+        if (h + 1 == levels_.size()) {
+          levels_.push_back(std::vector<double>());
+        }
+        std::vector<double>& level = levels_[h];
+        std::sort(level.begin(), level.end());
+        // An odd value out stays behind, so that total weight is conserved.
+        size_t paired = level.size() - level.size() % 2;
+        std::vector<double>& next = levels_[h + 1];
+        for (size_t i = (size_t)flip();  i < paired;  i += 2) {
+          next.push_back(level[i]);
+        }
+        level.erase(level.begin(), level.begin() + (int64_t)paired);
+      }
+    }
+    size_ = 0;
+    maxsize_ = 0;
+    for (size_t h = 0;  h < levels_.size();  h++) {
+      size_ += (int64_t)levels_[h].size();
+      maxsize_ += capacity(h);
+    }
+  }
+
+  ////////// quantile (approximate, from a QuantileSketch of each group)
+
+  template <typename T>
+  const std::shared_ptr<void>
+  reduce_quantile(const T* data,
+                  int64_t offset,
+                  const Index64& parents,
+                  int64_t outlength,
+                  double q,
+                  int64_t k) {
+    std::vector<QuantileSketch> sketches((size_t)outlength,
+                                         QuantileSketch(k));
+    const int64_t* parentsptr = parents.ptr().get() + parents.offset();
+    for (int64_t i = 0;  i < parents.length();  i++) {
+      sketches[(size_t)parentsptr[i]].update((double)data[offset + i]);
+    }
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    for (int64_t i = 0;  i < outlength;  i++) {
+      ptr.get()[i] = sketches[(size_t)i].quantile(q);
+    }
+    return ptr;
+  }
+
+  template <typename T>
+  const std::shared_ptr<void>
+  reduce_quantile_strided(const T* data,
+                          int64_t offset,
+                          const std::vector<ssize_t>& shape,
+                          const std::vector<ssize_t>& strides,
+                          int64_t axis,
+                          int64_t outlength,
+                          double q,
+                          int64_t k) {
+    std::shared_ptr<double> ptr(new double[(size_t)outlength],
+                                util::array_deleter<double>());
+    for (int64_t i = 0;  i < outlength;  i++) {
+      // The outputs are in C order of all dimensions but 'axis'.
+      int64_t start = offset;
+      int64_t rest = i;
+      for (int64_t d = (int64_t)shape.size() - 1;  d >= 0;  d--) {
+        if (d != axis) {
+          start += (rest % (int64_t)shape[(size_t)d])*strides[(size_t)d];
+          rest /= (int64_t)shape[(size_t)d];
+        }
+      }
+      QuantileSketch sketch(k);
+      for (int64_t j = 0;  j < (int64_t)shape[(size_t)axis];  j++) {
+        sketch.update((double)data[start + j*strides[(size_t)axis]]);
+      }
+      ptr.get()[i] = sketch.quantile(q);
+    }
+    return ptr;
+  }
+
+  ReducerQuantile::ReducerQuantile(double q, int64_t k)
+      : q_(q)
+      , k_(k) {
+    if (!(0.0 <= q  &&  q <= 1.0)) {
+      throw std::invalid_argument(
+        std::string("quantile q must be between 0 and 1, not ")
+        + std::to_string(q));
+    }
+    if (k < 2) {
+      throw std::invalid_argument(
+        std::string("quantile k must be at least 2, not ")
+        + std::to_string(k));
+    }
+  }
+
+  double
+  ReducerQuantile::q() const {
+    return q_;
+  }
+
+  int64_t
+  ReducerQuantile::k() const {
+    return k_;
+  }
+
+  const std::string
+  ReducerQuantile::name() const {
+    return "quantile";
+  }
+
+  const std::string
+  ReducerQuantile::options() const {
+    std::stringstream out;
+    out.precision(17);
+    out << "q=" << q_ << ", k=" << k_;
+    return out.str();
+  }
+
+  const std::string
+  ReducerQuantile::preferred_type() const {
+    return "d";
+  }
+
+  ssize_t
+  ReducerQuantile::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::string
+  ReducerQuantile::return_type(const std::string& given_type) const {
+    return "d";
+  }
+
+  ssize_t
+  ReducerQuantile::return_typesize(const std::string& given_type) const {
+    return 8;
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_bool(const bool* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_int8(const int8_t* data,
+                              int64_t offset,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_uint8(const uint8_t* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_int16(const int16_t* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_uint16(const uint16_t* data,
+                                int64_t offset,
+                                const Index64& starts,
+                                const Index64& parents,
+                                int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_int32(const int32_t* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_uint32(const uint32_t* data,
+                                int64_t offset,
+                                const Index64& starts,
+                                const Index64& parents,
+                                int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_int64(const int64_t* data,
+                               int64_t offset,
+                               const Index64& starts,
+                               const Index64& parents,
+                               int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_uint64(const uint64_t* data,
+                                int64_t offset,
+                                const Index64& starts,
+                                const Index64& parents,
+                                int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_float32(const float* data,
+                                 int64_t offset,
+                                 const Index64& starts,
+                                 const Index64& parents,
+                                 int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_float64(const double* data,
+                                 int64_t offset,
+                                 const Index64& starts,
+                                 const Index64& parents,
+                                 int64_t outlength) const {
+    return reduce_quantile(data, offset, parents, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_bool(const bool* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_int8(const int8_t* data,
+                                      int64_t offset,
+                                      const std::vector<ssize_t>& shape,
+                                      const std::vector<ssize_t>& strides,
+                                      int64_t axis,
+                                      int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_uint8(const uint8_t* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_int16(const int16_t* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_uint16(const uint16_t* data,
+                                        int64_t offset,
+                                        const std::vector<ssize_t>& shape,
+                                        const std::vector<ssize_t>& strides,
+                                        int64_t axis,
+                                        int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_int32(const int32_t* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_uint32(const uint32_t* data,
+                                        int64_t offset,
+                                        const std::vector<ssize_t>& shape,
+                                        const std::vector<ssize_t>& strides,
+                                        int64_t axis,
+                                        int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_int64(const int64_t* data,
+                                       int64_t offset,
+                                       const std::vector<ssize_t>& shape,
+                                       const std::vector<ssize_t>& strides,
+                                       int64_t axis,
+                                       int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_uint64(const uint64_t* data,
+                                        int64_t offset,
+                                        const std::vector<ssize_t>& shape,
+                                        const std::vector<ssize_t>& strides,
+                                        int64_t axis,
+                                        int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_float32(const float* data,
+                                         int64_t offset,
+                                         const std::vector<ssize_t>& shape,
+                                         const std::vector<ssize_t>& strides,
+                                         int64_t axis,
+                                         int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  const std::shared_ptr<void>
+  ReducerQuantile::apply_strided_float64(const double* data,
+                                         int64_t offset,
+                                         const std::vector<ssize_t>& shape,
+                                         const std::vector<ssize_t>& strides,
+                                         int64_t axis,
+                                         int64_t outlength) const {
+    return reduce_quantile_strided(
+      data, offset, shape, strides, axis, outlength, q_, k_);
+  }
+
+  ////////// HyperLogLog
+
+  HyperLogLog::HyperLogLog(int64_t precision)
+      : precision_(precision) {
+    if (precision < 4  ||  precision > 18) {
+      throw std::invalid_argument(
+        std::string("HyperLogLog precision must be from 4 to 18, not ")
+        + std::to_string(precision));
+    }
+  }
+
+  int64_t
+  HyperLogLog::precision() const {
+    return precision_;
+  }
+
+  void
+  HyperLogLog::update(uint64_t hash) {
+    if (registers_.empty()) {
+      sparse_.push_back(hash);
+      if ((int64_t)sparse_.size() >= ((int64_t)1 << precision_) / 8) {
+        normalize();
+      }
+    }
+    else {
+      update_register(hash);
+    }
+  }
+
+  void
+  HyperLogLog::merge(const HyperLogLog& other) {
+    if (other.precision_ != precision_) {
+      throw std::invalid_argument(
+        std::string("cannot merge HyperLogLogs with precision ")
+        + std::to_string(precision_) + std::string(" and ")
+        + std::to_string(other.precision_));
+    }
+    sparse_.insert(sparse_.end(), other.sparse_.begin(), other.sparse_.end());
+    if (!other.registers_.empty()) {
+      densify();
+      for (size_t i = 0;  i < registers_.size();  i++) {
+        registers_[i] = std::max(registers_[i], other.registers_[i]);
+      }
+    }
+    else if (!registers_.empty()) {
+      densify();
+    }
+    else {
+      normalize();
+    }
+  }
+
+  double
+  HyperLogLog::estimate() const {
+    if (registers_.empty()) {
+      std::vector<uint64_t> hashes(sparse_);
+      std::sort(hashes.begin(), hashes.end());
+      return (double)(std::unique(hashes.begin(), hashes.end())
+                      - hashes.begin());
+    }
+    double m = (double)registers_.size();
+    double alpha = (m == 16 ? 0.673 :
+                    m == 32 ? 0.697 :
+                    m == 64 ? 0.709 : 0.7213 / (1.0 + 1.079 / m));
+    double sum = 0.0;
+    int64_t zeros = 0;
+    for (auto x : registers_) {
+      sum += std::ldexp(1.0, -(int)x);
+      if (x == 0) {
+        zeros++;
+      }
+    }
+    double out = alpha*m*m / sum;
+    if (out <= 2.5*m  &&  zeros > 0) {
+      // Linear counting is more accurate for small cardinalities.
+      out = m*std::log(m / (double)zeros);
+    }
+    return out;
+  }
+
+  void
+  HyperLogLog::normalize() {
+    std::sort(sparse_.begin(), sparse_.end());
+    sparse_.erase(std::unique(sparse_.begin(), sparse_.end()), sparse_.end());
+    if ((int64_t)sparse_.size() >= ((int64_t)1 << precision_) / 16) {
+      densify();
+    }
+  }
+
+  void
+  HyperLogLog::densify() {
+    if (registers_.empty()) {
+      registers_.resize((size_t)1 << precision_, 0);
+    }
+    for (auto hash : sparse_) {
+      update_register(hash);
+    }
+    sparse_.clear();
+    sparse_.shrink_to_fit();
+  }
+
+  void
+  HyperLogLog::update_register(uint64_t hash) {
+    // The first 'precision' bits pick a register; the rank is the position
+    // of the first 1 bit in the rest.
+    size_t index = (size_t)(hash >> (64 - precision_));
+    uint64_t rest = hash << precision_;
+    uint8_t rank = 1;
+    while (rank <= 64 - precision_  &&  (rest & (1ULL << 63)) == 0) {
+      rest <<= 1;
+      rank++;
+    }
+    if (rank > registers_[index]) {
+      registers_[index] = rank;
+    }
+  }
+
+  ////////// count_distinct (approximate, from a HyperLogLog of each group)
+
+  template <typename T>
+  const std::shared_ptr<void>
+  reduce_countdistinct(struct Error (*hash)(uint64_t*,
+                                            const T*,
+                                            int64_t,
+                                            int64_t,
+                                            int64_t),
+                       const T* data,
+                       int64_t offset,
+                       const Index64& parents,
+                       int64_t outlength,
+                       int64_t precision,
+                       const std::string& name) {
+    std::vector<uint64_t> hashes((size_t)parents.length());
+    struct Error err = hash(hashes.data(), data, offset, 1, parents.length());
+    util::handle_error(err, util::quote(name, true), nullptr);
+    std::vector<HyperLogLog> sketches((size_t)outlength,
+                                      HyperLogLog(precision));
+    const int64_t* parentsptr = parents.ptr().get() + parents.offset();
+    for (int64_t i = 0;  i < parents.length();  i++) {
+      sketches[(size_t)parentsptr[i]].update(hashes[(size_t)i]);
+    }
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    for (int64_t i = 0;  i < outlength;  i++) {
+      ptr.get()[i] = (int64_t)std::llround(sketches[(size_t)i].estimate());
+    }
+    return ptr;
+  }
+
+  template <typename T>
+  const std::shared_ptr<void>
+  reduce_countdistinct_strided(struct Error (*hash)(uint64_t*,
+                                                    const T*,
+                                                    int64_t,
+                                                    int64_t,
+                                                    int64_t),
+                               const T* data,
+                               int64_t offset,
+                               const std::vector<ssize_t>& shape,
+                               const std::vector<ssize_t>& strides,
+                               int64_t axis,
+                               int64_t outlength,
+                               int64_t precision,
+                               const std::string& name) {
+    int64_t reducelen = (int64_t)shape[(size_t)axis];
+    std::vector<uint64_t> hashes((size_t)reducelen);
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)outlength],
+                                 util::array_deleter<int64_t>());
+    for (int64_t i = 0;  i < outlength;  i++) {
+      // The outputs are in C order of all dimensions but 'axis'.
+      int64_t start = offset;
+      int64_t rest = i;
+      for (int64_t d = (int64_t)shape.size() - 1;  d >= 0;  d--) {
+        if (d != axis) {
+          start += (rest % (int64_t)shape[(size_t)d])*strides[(size_t)d];
+          rest /= (int64_t)shape[(size_t)d];
+        }
+      }
+      struct Error err = hash(hashes.data(),
+                              data,
+                              start,
+                              (int64_t)strides[(size_t)axis],
+                              reducelen);
+      util::handle_error(err, util::quote(name, true), nullptr);
+      HyperLogLog sketch(precision);
+      for (auto x : hashes) {
+        sketch.update(x);
+      }
+      ptr.get()[i] = (int64_t)std::llround(sketch.estimate());
+    }
+    return ptr;
+  }
+
+  ReducerCountDistinct::ReducerCountDistinct(int64_t precision)
+      : precision_(precision) {
+    if (precision < 4  ||  precision > 18) {
+      throw std::invalid_argument(
+        std::string("count_distinct precision must be from 4 to 18, not ")
+        + std::to_string(precision));
+    }
+  }
+
+  int64_t
+  ReducerCountDistinct::precision() const {
+    return precision_;
+  }
+
+  const std::string
+  ReducerCountDistinct::name() const {
+    return "count_distinct";
+  }
+
+  const std::string
+  ReducerCountDistinct::options() const {
+    return std::string("precision=") + std::to_string(precision_);
+  }
+
+  const std::string
+  ReducerCountDistinct::preferred_type() const {
+    return "d";
+  }
+
+  ssize_t
+  ReducerCountDistinct::preferred_typesize() const {
+    return 8;
+  }
+
+  const std::string
+  ReducerCountDistinct::return_type(const std::string& given_type) const {
+#if defined _MSC_VER || defined __i386__
+    return "q";
+#else
+    return "l";
+#endif
+  }
+
+  ssize_t
+  ReducerCountDistinct::return_typesize(const std::string& given_type) const {
+    return 8;
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_bool(const bool* data,
+                                   int64_t offset,
+                                   const Index64& starts,
+                                   const Index64& parents,
+                                   int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_frombool,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_int8(const int8_t* data,
+                                   int64_t offset,
+                                   const Index64& starts,
+                                   const Index64& parents,
+                                   int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_from8,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_uint8(const uint8_t* data,
+                                    int64_t offset,
+                                    const Index64& starts,
+                                    const Index64& parents,
+                                    int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_fromU8,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_int16(const int16_t* data,
+                                    int64_t offset,
+                                    const Index64& starts,
+                                    const Index64& parents,
+                                    int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_from16,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_uint16(const uint16_t* data,
+                                     int64_t offset,
+                                     const Index64& starts,
+                                     const Index64& parents,
+                                     int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_fromU16,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_int32(const int32_t* data,
+                                    int64_t offset,
+                                    const Index64& starts,
+                                    const Index64& parents,
+                                    int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_from32,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_uint32(const uint32_t* data,
+                                     int64_t offset,
+                                     const Index64& starts,
+                                     const Index64& parents,
+                                     int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_fromU32,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_int64(const int64_t* data,
+                                    int64_t offset,
+                                    const Index64& starts,
+                                    const Index64& parents,
+                                    int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_from64,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_uint64(const uint64_t* data,
+                                     int64_t offset,
+                                     const Index64& starts,
+                                     const Index64& parents,
+                                     int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_fromU64,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_float32(const float* data,
+                                      int64_t offset,
+                                      const Index64& starts,
+                                      const Index64& parents,
+                                      int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_fromfloat,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_float64(const double* data,
+                                      int64_t offset,
+                                      const Index64& starts,
+                                      const Index64& parents,
+                                      int64_t outlength) const {
+    return reduce_countdistinct(
+      awkward_numpyarray_hash64_fromdouble,
+      data,
+      offset,
+      parents,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_bool(const bool* data,
+                                           int64_t offset,
+                                           const std::vector<ssize_t>& shape,
+                                           const std::vector<ssize_t>& strides,
+                                           int64_t axis,
+                                           int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_frombool,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_int8(const int8_t* data,
+                                           int64_t offset,
+                                           const std::vector<ssize_t>& shape,
+                                           const std::vector<ssize_t>& strides,
+                                           int64_t axis,
+                                           int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_from8,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_uint8(const uint8_t* data,
+                                            int64_t offset,
+                                            const std::vector<ssize_t>& shape,
+                                            const std::vector<ssize_t>& strides,
+                                            int64_t axis,
+                                            int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_fromU8,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_int16(const int16_t* data,
+                                            int64_t offset,
+                                            const std::vector<ssize_t>& shape,
+                                            const std::vector<ssize_t>& strides,
+                                            int64_t axis,
+                                            int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_from16,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_uint16(const uint16_t* data,
+                                             int64_t offset,
+                                             const std::vector<ssize_t>& shape,
+                                             const std::vector<ssize_t>& strides,
+                                             int64_t axis,
+                                             int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_fromU16,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_int32(const int32_t* data,
+                                            int64_t offset,
+                                            const std::vector<ssize_t>& shape,
+                                            const std::vector<ssize_t>& strides,
+                                            int64_t axis,
+                                            int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_from32,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_uint32(const uint32_t* data,
+                                             int64_t offset,
+                                             const std::vector<ssize_t>& shape,
+                                             const std::vector<ssize_t>& strides,
+                                             int64_t axis,
+                                             int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_fromU32,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_int64(const int64_t* data,
+                                            int64_t offset,
+                                            const std::vector<ssize_t>& shape,
+                                            const std::vector<ssize_t>& strides,
+                                            int64_t axis,
+                                            int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_from64,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_uint64(const uint64_t* data,
+                                             int64_t offset,
+                                             const std::vector<ssize_t>& shape,
+                                             const std::vector<ssize_t>& strides,
+                                             int64_t axis,
+                                             int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_fromU64,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_float32(const float* data,
+                                              int64_t offset,
+                                              const std::vector<ssize_t>& shape,
+                                              const std::vector<ssize_t>& strides,
+                                              int64_t axis,
+                                              int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_fromfloat,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
+  const std::shared_ptr<void>
+  ReducerCountDistinct::apply_strided_float64(const double* data,
+                                              int64_t offset,
+                                              const std::vector<ssize_t>& shape,
+                                              const std::vector<ssize_t>& strides,
+                                              int64_t axis,
+                                              int64_t outlength) const {
+    return reduce_countdistinct_strided(
+      awkward_numpyarray_hash64_fromdouble,
+      data,
+      offset,
+      shape,
+      strides,
+      axis,
+      outlength,
+      precision_,
+      name());
+  }
+
 }
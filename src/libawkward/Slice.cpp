@@ -5,6 +5,7 @@
 #include <type_traits>
 
 #include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/operations.h"
 #include "awkward/util.h"
 
 #define AWKWARD_SLICE_NO_EXTERN_TEMPLATE
@@ -814,4 +815,58 @@ namespace awkward {
     }
     return false;
   }
+
+  bool
+  Slice::hasarrays() const {
+    for (auto item : items_) {
+      if (dynamic_cast<SliceArray64*>(item.get()) != nullptr  ||
+          dynamic_cast<SliceMissing64*>(item.get()) != nullptr  ||
+          dynamic_cast<SliceJagged64*>(item.get()) != nullptr) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  static void
+  sliceitem_fingerprint_part(const SliceItemPtr& item, uint64_t& hash) {
+    if (SliceArray64* array = dynamic_cast<SliceArray64*>(item.get())) {
+      array->index().fingerprint_part(hash);
+      for (auto x : array->shape()) {
+        util::fingerprint_combine(hash, (uint64_t)x);
+      }
+      for (auto x : array->strides()) {
+        util::fingerprint_combine(hash, (uint64_t)x);
+      }
+    }
+    else if (SliceMissing64* missing =
+             dynamic_cast<SliceMissing64*>(item.get())) {
+      missing->index().fingerprint_part(hash);
+      missing->originalmask().fingerprint_part(hash);
+      sliceitem_fingerprint_part(missing->content(), hash);
+    }
+    else if (SliceJagged64* jagged =
+             dynamic_cast<SliceJagged64*>(item.get())) {
+      jagged->offsets().fingerprint_part(hash);
+      sliceitem_fingerprint_part(jagged->content(), hash);
+    }
+  }
+
+  uint64_t
+  Slice::fingerprint() const {
+    // tostring captures everything but the full contents of the arrays
+    std::string repr = tostring();
+    uint64_t out;
+    struct Error err = awkward_buffer_hash64(
+      &out,
+      reinterpret_cast<const uint8_t*>(repr.data()),
+      0,
+      (int64_t)repr.length(),
+      0);
+    util::handle_error(err, "Slice", nullptr);
+    for (auto item : items_) {
+      sliceitem_fingerprint_part(item, out);
+    }
+    return out;
+  }
 }
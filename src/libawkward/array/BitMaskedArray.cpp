@@ -17,7 +17,6 @@
 #include "awkward/array/IndexedArray.h"
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #include "awkward/array/BitMaskedArray.h"
 
@@ -467,6 +466,14 @@ namespace awkward {
     }
   }
 
+  void
+  BitMaskedArray::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length_);
+    mask_.getitem_range_nowrap(0, (length_ + 7) / 8).fingerprint_part(hash);
+    content_.get()->getitem_range_nowrap(0, length_).get()->fingerprint_part(
+      hash);
+  }
+
   int64_t
   BitMaskedArray::length() const {
     return length_;
@@ -676,10 +683,9 @@ namespace awkward {
   }
 
   bool
-  BitMaskedArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+  BitMaskedArray::mergeable(const ContentPtr& othercontent,
+                            bool mergebool) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -801,6 +807,20 @@ namespace awkward {
                                                    depth);
   }
 
+  const ContentPtr
+  BitMaskedArray::packed() const {
+    int64_t bytelength = (length_ + 7) / 8;
+    IndexU8 mask = mask_.getitem_range_nowrap(0, bytelength).deep_copy();
+    ContentPtr content = content_.get()->getitem_range_nowrap(0, length_);
+    return std::make_shared<BitMaskedArray>(identities_,
+                                            parameters_,
+                                            mask,
+                                            content.get()->packed(),
+                                            valid_when_,
+                                            length_,
+                                            lsb_order_);
+  }
+
   const ContentPtr
   BitMaskedArray::getitem_next(const SliceAt& at,
                                const Slice& tail,
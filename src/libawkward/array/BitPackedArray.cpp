@@ -0,0 +1,615 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/identities.h"
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/util.h"
+
+#include "awkward/array/BitPackedArray.h"
+
+namespace awkward {
+  BitPackedArray::BitPackedArray(const IdentitiesPtr& identities,
+                                 const util::Parameters& parameters,
+                                 const IndexU8& bits,
+                                 int64_t length,
+                                 bool lsb_order)
+      : Content(identities, parameters)
+      , bits_(bits)
+      , length_(length)
+      , lsb_order_(lsb_order) {
+    if (length < 0) {
+      throw std::invalid_argument(
+        "BitPackedArray length must be non-negative");
+    }
+    if (bits.length() < (length + 7) / 8) {
+      throw std::invalid_argument(
+        "BitPackedArray bits must not be shorter than ceil(length / 8.0)");
+    }
+  }
+
+  const IndexU8
+  BitPackedArray::bits() const {
+    return bits_;
+  }
+
+  bool
+  BitPackedArray::lsb_order() const {
+    return lsb_order_;
+  }
+
+  int64_t
+  BitPackedArray::numtrue() const {
+    int64_t out;
+    struct Error err = awkward_bitpackedarray_getitem_numtrue(
+      &out,
+      bits_.ptr().get(),
+      bits_.offset(),
+      length_,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    return out;
+  }
+
+  const ContentPtr
+  BitPackedArray::toNumpyArray() const {
+    int64_t numbytes = (length_ + 7) / 8;
+    Index8 bytes(numbytes*8);
+    struct Error err = awkward_bitmaskedarray_to_bytemaskedarray(
+      bytes.ptr().get(),
+      bits_.ptr().get(),
+      bits_.offset(),
+      numbytes,
+      false,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    return std::make_shared<NumpyArray>(identities_,
+                                        parameters_,
+                                        bytes.ptr(),
+                                        std::vector<ssize_t>({ length_ }),
+                                        std::vector<ssize_t>({ 1 }),
+                                        0,
+                                        1,
+                                        "?");
+  }
+
+  const ContentPtr
+  BitPackedArray::array() const {
+    return toNumpyArray();
+  }
+
+  const std::string
+  BitPackedArray::classname() const {
+    return "BitPackedArray";
+  }
+
+  void
+  BitPackedArray::setidentities() {
+    if (length() <= kMaxInt32) {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities32>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities32* rawidentities =
+        reinterpret_cast<Identities32*>(newidentities.get());
+      struct Error err = awkward_new_identities32(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+    else {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities64>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities64* rawidentities =
+        reinterpret_cast<Identities64*>(newidentities.get());
+      struct Error err = awkward_new_identities64(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+  }
+
+  void
+  BitPackedArray::setidentities(const IdentitiesPtr& identities) {
+    if (identities.get() != nullptr  &&
+        length() != identities.get()->length()) {
+      util::handle_error(
+        failure("content and its identities must have the same length",
+                kSliceNone,
+                kSliceNone),
+        classname(),
+        identities_.get());
+    }
+    identities_ = identities;
+  }
+
+  const TypePtr
+  BitPackedArray::type(const util::TypeStrs& typestrs) const {
+    return form(true).get()->type(typestrs);
+  }
+
+  const FormPtr
+  BitPackedArray::form(bool materialize) const {
+    BitPackedArray empty(identities_.get() == nullptr
+                             ? identities_
+                             : identities_.get()->getitem_range_nowrap(0, 0),
+                         parameters_,
+                         IndexU8(0),
+                         0,
+                         lsb_order_);
+    return empty.toNumpyArray().get()->form(materialize);
+  }
+
+  bool
+  BitPackedArray::has_virtual_form() const {
+    return false;
+  }
+
+  bool
+  BitPackedArray::has_virtual_length() const {
+    return false;
+  }
+
+  const std::string
+  BitPackedArray::tostring_part(const std::string& indent,
+                                const std::string& pre,
+                                const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<" << classname() << " length=\"" << length_
+        << "\" lsb_order=\"" << (lsb_order_ ? "true" : "false") << "\">\n";
+    if (identities_.get() != nullptr) {
+      out << identities_.get()->tostring_part(
+               indent + std::string("    "), "", "\n");
+    }
+    if (!parameters_.empty()) {
+      out << parameters_tostring(indent + std::string("    "), "", "\n");
+    }
+    out << bits_.tostring_part(
+             indent + std::string("    "), "<bits>", "</bits>\n");
+    out << indent << "</" << classname() << ">" << post;
+    return out.str();
+  }
+
+  void
+  BitPackedArray::tojson_part(ToJson& builder,
+                          bool include_beginendlist) const {
+    toNumpyArray().get()->tojson_part(builder, include_beginendlist);
+  }
+
+  void
+  BitPackedArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
+    bits_.nbytes_part(largest);
+    if (identities_.get() != nullptr) {
+      identities_.get()->nbytes_part(largest);
+    }
+  }
+
+  void
+  BitPackedArray::fingerprint_part(uint64_t& hash) const {
+    toNumpyArray().get()->fingerprint_part(hash);
+  }
+
+  int64_t
+  BitPackedArray::length() const {
+    return length_;
+  }
+
+  const ContentPtr
+  BitPackedArray::shallow_copy() const {
+    return std::make_shared<BitPackedArray>(identities_,
+                                            parameters_,
+                                            bits_,
+                                            length_,
+                                            lsb_order_);
+  }
+
+  const ContentPtr
+  BitPackedArray::deep_copy(bool copyarrays,
+                            bool copyindexes,
+                            bool copyidentities) const {
+    IndexU8 bits = copyarrays ? bits_.deep_copy() : bits_;
+    IdentitiesPtr identities = identities_;
+    if (copyidentities  &&  identities_.get() != nullptr) {
+      identities = identities_.get()->deep_copy();
+    }
+    return std::make_shared<BitPackedArray>(identities,
+                                            parameters_,
+                                            bits,
+                                            length_,
+                                            lsb_order_);
+  }
+
+  void
+  BitPackedArray::check_for_iteration() const {
+    if (identities_.get() != nullptr  &&
+        identities_.get()->length() < length_) {
+      util::handle_error(
+        failure("len(identities) < len(array)", kSliceNone, kSliceNone),
+        identities_.get()->classname(),
+        nullptr);
+    }
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_nothing() const {
+    return getitem_range_nowrap(0, 0);
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_at(int64_t at) const {
+    int64_t regular_at = at;
+    if (regular_at < 0) {
+      regular_at += length_;
+    }
+    if (!(0 <= regular_at  &&  regular_at < length_)) {
+      util::handle_error(failure("index out of range", kSliceNone, at),
+                         classname(),
+                         identities_.get());
+    }
+    return getitem_at_nowrap(regular_at);
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_at_nowrap(int64_t at) const {
+    Index64 index(1);
+    index.setitem_at_nowrap(0, at);
+    ContentPtr one = carry(index);
+    return dynamic_cast<BitPackedArray*>(one.get())->toNumpyArray().get()
+             ->getitem_at_nowrap(0);
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_range(int64_t start, int64_t stop) const {
+    int64_t regular_start = start;
+    int64_t regular_stop = stop;
+    awkward_regularize_rangeslice(&regular_start, &regular_stop,
+      true, start != Slice::none(), stop != Slice::none(), length_);
+    if (identities_.get() != nullptr  &&
+        regular_stop > identities_.get()->length()) {
+      util::handle_error(
+        failure("index out of range", kSliceNone, stop),
+        identities_.get()->classname(),
+        nullptr);
+    }
+    return getitem_range_nowrap(regular_start, regular_stop);
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(start, stop);
+    }
+    // whole bytes can be shared; otherwise, the bits would need shifting
+    if (start % 8 == 0) {
+      return std::make_shared<BitPackedArray>(
+        identities,
+        parameters_,
+        bits_.getitem_range_nowrap(start / 8, (stop + 7) / 8),
+        stop - start,
+        lsb_order_);
+    }
+    int64_t first = start - start % 8;
+    BitPackedArray aligned(Identities::none(),
+                           parameters_,
+                           bits_.getitem_range_nowrap(first / 8,
+                                                      (stop + 7) / 8),
+                           stop - first,
+                           lsb_order_);
+    ContentPtr out = aligned.toNumpyArray().get()->getitem_range_nowrap(
+      start - first, stop - first);
+    out.get()->setidentities(identities);
+    return out;
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_field(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_fields(const std::vector<std::string>& keys) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next(const SliceItemPtr& head,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    if (head.get() == nullptr) {
+      return shallow_copy();
+    }
+    else {
+      return toNumpyArray().get()->getitem_next(head, tail, advanced);
+    }
+  }
+
+  const ContentPtr
+  BitPackedArray::carry(const Index64& carry) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_carry_64(carry);
+    }
+    IndexU8 bits((carry.length() + 7) / 8);
+    struct Error err = awkward_bitpackedarray_getitem_carry_64(
+      bits.ptr().get(),
+      bits_.ptr().get(),
+      bits_.offset(),
+      length_,
+      carry.ptr().get(),
+      carry.length(),
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    return std::make_shared<BitPackedArray>(identities,
+                                            parameters_,
+                                            bits,
+                                            carry.length(),
+                                            lsb_order_);
+  }
+
+  const std::string
+  BitPackedArray::purelist_parameter(const std::string& key) const {
+    return parameter(key);
+  }
+
+  int64_t
+  BitPackedArray::numfields() const {
+    return -1;
+  }
+
+  int64_t
+  BitPackedArray::fieldindex(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("key ") + util::quote(key, true)
+      + std::string(" does not exist (data are not records)"));
+  }
+
+  const std::string
+  BitPackedArray::key(int64_t fieldindex) const {
+    throw std::invalid_argument(
+      std::string("fieldindex \"") + std::to_string(fieldindex)
+      + std::string("\" does not exist (data are not records)"));
+  }
+
+  bool
+  BitPackedArray::haskey(const std::string& key) const {
+    return false;
+  }
+
+  const std::vector<std::string>
+  BitPackedArray::keys() const {
+    return std::vector<std::string>();
+  }
+
+  const std::string
+  BitPackedArray::validityerror(const std::string& path) const {
+    return std::string();
+  }
+
+  const ContentPtr
+  BitPackedArray::shallow_simplify() const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  BitPackedArray::num(int64_t axis, int64_t depth) const {
+    int64_t toaxis = axis_wrap_if_negative(axis);
+    if (toaxis == depth) {
+      Index64 out(1);
+      out.setitem_at_nowrap(0, length());
+      return NumpyArray(out).getitem_at_nowrap(0);
+    }
+    else {
+      throw std::invalid_argument("'axis' out of range for 'num'");
+    }
+  }
+
+  const std::pair<Index64, ContentPtr>
+  BitPackedArray::offsets_and_flattened(int64_t axis, int64_t depth) const {
+    return toNumpyArray().get()->offsets_and_flattened(axis, depth);
+  }
+
+  const ContentPtr
+  BitPackedArray::materialized() const {
+    return array();
+  }
+
+  bool
+  BitPackedArray::mergeable(const ContentPtr& other, bool mergebool) const {
+    return toNumpyArray().get()->mergeable(other, mergebool);
+  }
+
+  const ContentPtr
+  BitPackedArray::merge(const ContentPtr& other) const {
+    if (dynamic_cast<EmptyArray*>(other.get())  &&
+        parameters_equal(other.get()->parameters())) {
+      return shallow_copy();
+    }
+    ContentPtr out = toNumpyArray().get()->merge(other);
+    if (NumpyArray* raw = dynamic_cast<NumpyArray*>(out.get())) {
+      if (raw->format().compare("?") == 0  &&  raw->ndim() == 1) {
+        return raw->toBitPackedArray(lsb_order_);
+      }
+    }
+    return out;
+  }
+
+  const SliceItemPtr
+  BitPackedArray::asslice() const {
+    Index64 index(numtrue());
+    struct Error err = awkward_bitpackedarray_getitem_nonzero_64(
+      index.ptr().get(),
+      bits_.ptr().get(),
+      bits_.offset(),
+      length_,
+      lsb_order_);
+    util::handle_error(err, classname(), identities_.get());
+    std::vector<int64_t> shape({ index.length() });
+    std::vector<int64_t> strides({ 1 });
+    return std::make_shared<SliceArray64>(index, shape, strides, true);
+  }
+
+  const ContentPtr
+  BitPackedArray::fillna(const ContentPtr& value) const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  BitPackedArray::rpad(int64_t target, int64_t axis, int64_t depth) const {
+    return toNumpyArray().get()->rpad(target, axis, depth);
+  }
+
+  const ContentPtr
+  BitPackedArray::rpad_and_clip(int64_t target,
+                            int64_t axis,
+                            int64_t depth) const {
+    return toNumpyArray().get()->rpad_and_clip(target, axis, depth);
+  }
+
+  const ContentPtr
+  BitPackedArray::reduce_next(const Reducer& reducer,
+                          int64_t negaxis,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength,
+                          bool mask,
+                          bool keepdims) const {
+    return toNumpyArray().get()->reduce_next(reducer,
+                                             negaxis,
+                                             starts,
+                                             parents,
+                                             outlength,
+                                             mask,
+                                             keepdims);
+  }
+
+  const ContentPtr
+  BitPackedArray::localindex(int64_t axis, int64_t depth) const {
+    int64_t toaxis = axis_wrap_if_negative(axis);
+    if (toaxis == depth) {
+      return localindex_axis0();
+    }
+    else {
+      throw std::invalid_argument("'axis' out of range for localindex");
+    }
+  }
+
+  const ContentPtr
+  BitPackedArray::combinations(int64_t n,
+                           bool replacement,
+                           const util::RecordLookupPtr& recordlookup,
+                           const util::Parameters& parameters,
+                           int64_t axis,
+                           int64_t depth) const {
+    return toNumpyArray().get()->combinations(n,
+                                              replacement,
+                                              recordlookup,
+                                              parameters,
+                                              axis,
+                                              depth);
+  }
+
+  const ContentPtr
+  BitPackedArray::packed() const {
+    return std::make_shared<BitPackedArray>(
+      identities_,
+      parameters_,
+      bits_.getitem_range_nowrap(0, (length_ + 7) / 8),
+      length_,
+      lsb_order_);
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next(const SliceAt& at,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: BitPackedArray::getitem_next(at)");
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next(const SliceRange& range,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: BitPackedArray::getitem_next(range)");
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next(const SliceArray64& array,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: BitPackedArray::getitem_next(array)");
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next(const SliceField& field,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: BitPackedArray::getitem_next(field)");
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next(const SliceFields& fields,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: BitPackedArray::getitem_next(fields)");
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next(const SliceJagged64& jagged,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: BitPackedArray::getitem_next(jagged)");
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next_jagged(const Index64& slicestarts,
+                                  const Index64& slicestops,
+                                  const SliceArray64& slicecontent,
+                                  const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next_jagged(const Index64& slicestarts,
+                                  const Index64& slicestops,
+                                  const SliceMissing64& slicecontent,
+                                  const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+  const ContentPtr
+  BitPackedArray::getitem_next_jagged(const Index64& slicestarts,
+                                  const Index64& slicestops,
+                                  const SliceJagged64& slicecontent,
+                                  const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+}
@@ -21,7 +21,6 @@
 #include "awkward/array/UnionArray.h"
 #include "awkward/array/RegularArray.h"
 #include "awkward/array/ListOffsetArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #include "awkward/array/ByteMaskedArray.h"
 
@@ -220,7 +219,7 @@ namespace awkward {
       valid_when_);
     util::handle_error(err2, classname(), identities_.get());
 
-    return content_.get()->carry(nextcarry);
+    return content_.get()->carry_or_range(nextcarry);
   }
 
   const ContentPtr
@@ -466,6 +465,14 @@ namespace awkward {
     }
   }
 
+  void
+  ByteMaskedArray::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length());
+    mask_.fingerprint_part(hash);
+    content_.get()->getitem_range_nowrap(0, length()).get()->fingerprint_part(
+      hash);
+  }
+
   int64_t
   ByteMaskedArray::length() const {
     return mask_.length();
@@ -765,10 +772,9 @@ namespace awkward {
   }
 
   bool
-  ByteMaskedArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+  ByteMaskedArray::mergeable(const ContentPtr& othercontent,
+                             bool mergebool) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -1051,6 +1057,16 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  ByteMaskedArray::packed() const {
+    ContentPtr content = content_.get()->getitem_range_nowrap(0, length());
+    return std::make_shared<ByteMaskedArray>(identities_,
+                                             parameters_,
+                                             mask_.deep_copy(),
+                                             content.get()->packed(),
+                                             valid_when_);
+  }
+
   const ContentPtr
   ByteMaskedArray::getitem_next(const SliceAt& at,
                                 const Slice& tail,
@@ -0,0 +1,759 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <cstring>
+#include <limits>
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/identities.h"
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/reducers.h"
+#include "awkward/Reducer.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/util.h"
+
+#include "awkward/array/ConstantArray.h"
+
+namespace awkward {
+  // the only element of a NumpyArray of length 1, converted to T
+  template <typename T>
+  T
+  constant_value(const NumpyArray& value) {
+    const std::string format = value.format();
+    const uint8_t* ptr = reinterpret_cast<const uint8_t*>(value.byteptr());
+    if (format.compare("?") == 0) {
+      return (T)*reinterpret_cast<const bool*>(ptr);
+    }
+    else if (format.compare("b") == 0) {
+      return (T)*reinterpret_cast<const int8_t*>(ptr);
+    }
+    else if (format.compare("B") == 0  ||  format.compare("c") == 0) {
+      return (T)*reinterpret_cast<const uint8_t*>(ptr);
+    }
+    else if (format.compare("h") == 0) {
+      return (T)*reinterpret_cast<const int16_t*>(ptr);
+    }
+    else if (format.compare("H") == 0) {
+      return (T)*reinterpret_cast<const uint16_t*>(ptr);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("l") == 0) {
+#else
+    else if (format.compare("i") == 0) {
+#endif
+      return (T)*reinterpret_cast<const int32_t*>(ptr);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("L") == 0) {
+#else
+    else if (format.compare("I") == 0) {
+#endif
+      return (T)*reinterpret_cast<const uint32_t*>(ptr);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("q") == 0) {
+#else
+    else if (format.compare("l") == 0) {
+#endif
+      return (T)*reinterpret_cast<const int64_t*>(ptr);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("Q") == 0) {
+#else
+    else if (format.compare("L") == 0) {
+#endif
+      return (T)*reinterpret_cast<const uint64_t*>(ptr);
+    }
+    else if (format.compare("f") == 0) {
+      return (T)*reinterpret_cast<const float*>(ptr);
+    }
+    else if (format.compare("d") == 0) {
+      return (T)*reinterpret_cast<const double*>(ptr);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot apply reducers to ConstantArray with format \"")
+        + format + std::string("\""));
+    }
+  }
+
+  // sum, min, or max of each group, given the number of values in it
+  template <typename T>
+  const std::shared_ptr<void>
+  constant_reduce(const Reducer& reducer,
+                  const NumpyArray& value,
+                  const Index64& counts,
+                  int64_t outlength) {
+    T x = constant_value<T>(value);
+    T identity = T();
+    if (dynamic_cast<const ReducerMin*>(&reducer) != nullptr) {
+      identity = (std::numeric_limits<T>::has_infinity
+                      ? std::numeric_limits<T>::infinity()
+                      : std::numeric_limits<T>::max());
+    }
+    else if (dynamic_cast<const ReducerMax*>(&reducer) != nullptr) {
+      identity = (std::numeric_limits<T>::has_infinity
+                      ? -std::numeric_limits<T>::infinity()
+                      : std::numeric_limits<T>::lowest());
+    }
+    bool issum = (dynamic_cast<const ReducerSum*>(&reducer) != nullptr);
+    const int64_t* count = counts.ptr().get() + counts.offset();
+    std::shared_ptr<T> ptr(new T[(size_t)outlength],
+                           util::array_deleter<T>());
+    T* out = ptr.get();
+    for (int64_t i = 0;  i < outlength;  i++) {
+      if (issum) {
+        out[i] = (T)(x*(T)count[i]);
+      }
+      else {
+        out[i] = (count[i] == 0 ? identity : x);
+      }
+    }
+    return ptr;
+  }
+
+  ConstantArray::ConstantArray(const IdentitiesPtr& identities,
+                               const util::Parameters& parameters,
+                               const ContentPtr& value,
+                               int64_t length)
+      : Content(identities, parameters)
+      , value_(value)
+      , length_(length) {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(value.get());
+    if (raw == nullptr  ||  raw->isscalar()  ||  raw->length() != 1) {
+      throw std::invalid_argument(
+        "ConstantArray value must be a NumpyArray of length 1");
+    }
+    if (length < 0) {
+      throw std::invalid_argument("ConstantArray length must be non-negative");
+    }
+  }
+
+  const ContentPtr
+  ConstantArray::value() const {
+    return value_;
+  }
+
+  const ContentPtr
+  ConstantArray::array() const {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(value_.get());
+    std::vector<ssize_t> shape = raw->shape();
+    std::vector<ssize_t> strides = raw->strides();
+    shape[0] = (ssize_t)length_;
+    strides[0] = 0;
+    return std::make_shared<NumpyArray>(identities_,
+                                        parameters_,
+                                        raw->ptr(),
+                                        shape,
+                                        strides,
+                                        raw->byteoffset(),
+                                        raw->itemsize(),
+                                        raw->format());
+  }
+
+  const ContentPtr
+  ConstantArray::toNumpyArray() const {
+    ContentPtr out = array();
+    return std::make_shared<NumpyArray>(
+      dynamic_cast<NumpyArray*>(out.get())->contiguous());
+  }
+
+  const std::string
+  ConstantArray::classname() const {
+    return "ConstantArray";
+  }
+
+  void
+  ConstantArray::setidentities() {
+    if (length() <= kMaxInt32) {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities32>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities32* rawidentities =
+        reinterpret_cast<Identities32*>(newidentities.get());
+      struct Error err = awkward_new_identities32(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+    else {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities64>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities64* rawidentities =
+        reinterpret_cast<Identities64*>(newidentities.get());
+      struct Error err = awkward_new_identities64(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+  }
+
+  void
+  ConstantArray::setidentities(const IdentitiesPtr& identities) {
+    if (identities.get() != nullptr  &&
+        length() != identities.get()->length()) {
+      util::handle_error(
+        failure("content and its identities must have the same length",
+                kSliceNone,
+                kSliceNone),
+        classname(),
+        identities_.get());
+    }
+    identities_ = identities;
+  }
+
+  const TypePtr
+  ConstantArray::type(const util::TypeStrs& typestrs) const {
+    return array().get()->type(typestrs);
+  }
+
+  const FormPtr
+  ConstantArray::form(bool materialize) const {
+    return array().get()->form(materialize);
+  }
+
+  bool
+  ConstantArray::has_virtual_form() const {
+    return false;
+  }
+
+  bool
+  ConstantArray::has_virtual_length() const {
+    return false;
+  }
+
+  const std::string
+  ConstantArray::tostring_part(const std::string& indent,
+                               const std::string& pre,
+                               const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<" << classname() << " length=\"" << length_
+        << "\">\n";
+    if (identities_.get() != nullptr) {
+      out << identities_.get()->tostring_part(
+               indent + std::string("    "), "", "\n");
+    }
+    if (!parameters_.empty()) {
+      out << parameters_tostring(indent + std::string("    "), "", "\n");
+    }
+    out << value_.get()->tostring_part(
+             indent + std::string("    "), "<value>", "</value>\n");
+    out << indent << "</" << classname() << ">" << post;
+    return out.str();
+  }
+
+  void
+  ConstantArray::tojson_part(ToJson& builder,
+                             bool include_beginendlist) const {
+    array().get()->tojson_part(builder, include_beginendlist);
+  }
+
+  void
+  ConstantArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
+    value_.get()->nbytes_part(largest);
+    if (identities_.get() != nullptr) {
+      identities_.get()->nbytes_part(largest);
+    }
+  }
+
+  void
+  ConstantArray::fingerprint_part(uint64_t& hash) const {
+    array().get()->fingerprint_part(hash);
+  }
+
+  int64_t
+  ConstantArray::length() const {
+    return length_;
+  }
+
+  const ContentPtr
+  ConstantArray::shallow_copy() const {
+    return std::make_shared<ConstantArray>(identities_,
+                                           parameters_,
+                                           value_,
+                                           length_);
+  }
+
+  const ContentPtr
+  ConstantArray::deep_copy(bool copyarrays,
+                           bool copyindexes,
+                           bool copyidentities) const {
+    ContentPtr value = value_.get()->deep_copy(copyarrays,
+                                               copyindexes,
+                                               copyidentities);
+    IdentitiesPtr identities = identities_;
+    if (copyidentities  &&  identities_.get() != nullptr) {
+      identities = identities_.get()->deep_copy();
+    }
+    return std::make_shared<ConstantArray>(identities,
+                                           parameters_,
+                                           value,
+                                           length_);
+  }
+
+  void
+  ConstantArray::check_for_iteration() const {
+    if (identities_.get() != nullptr  &&
+        identities_.get()->length() < length_) {
+      util::handle_error(
+        failure("len(identities) < len(array)", kSliceNone, kSliceNone),
+        identities_.get()->classname(),
+        nullptr);
+    }
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_nothing() const {
+    return getitem_range_nowrap(0, 0);
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_at(int64_t at) const {
+    int64_t regular_at = at;
+    if (regular_at < 0) {
+      regular_at += length_;
+    }
+    if (!(0 <= regular_at  &&  regular_at < length_)) {
+      util::handle_error(failure("index out of range", kSliceNone, at),
+                         classname(),
+                         identities_.get());
+    }
+    return getitem_at_nowrap(regular_at);
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_at_nowrap(int64_t at) const {
+    return array().get()->getitem_at_nowrap(at);
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_range(int64_t start, int64_t stop) const {
+    int64_t regular_start = start;
+    int64_t regular_stop = stop;
+    awkward_regularize_rangeslice(&regular_start, &regular_stop,
+      true, start != Slice::none(), stop != Slice::none(), length_);
+    if (identities_.get() != nullptr  &&
+        regular_stop > identities_.get()->length()) {
+      util::handle_error(
+        failure("index out of range", kSliceNone, stop),
+        identities_.get()->classname(),
+        nullptr);
+    }
+    return getitem_range_nowrap(regular_start, regular_stop);
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(start, stop);
+    }
+    return std::make_shared<ConstantArray>(identities,
+                                           parameters_,
+                                           value_,
+                                           stop - start);
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_field(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_fields(const std::vector<std::string>& keys) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next(const SliceItemPtr& head,
+                              const Slice& tail,
+                              const Index64& advanced) const {
+    if (head.get() == nullptr) {
+      return shallow_copy();
+    }
+    else {
+      return array().get()->getitem_next(head, tail, advanced);
+    }
+  }
+
+  const ContentPtr
+  ConstantArray::carry(const Index64& carry) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_carry_64(carry);
+    }
+    return std::make_shared<ConstantArray>(identities,
+                                           parameters_,
+                                           value_,
+                                           carry.length());
+  }
+
+  const std::string
+  ConstantArray::purelist_parameter(const std::string& key) const {
+    return parameter(key);
+  }
+
+  int64_t
+  ConstantArray::numfields() const {
+    return -1;
+  }
+
+  int64_t
+  ConstantArray::fieldindex(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("key ") + util::quote(key, true)
+      + std::string(" does not exist (data are not records)"));
+  }
+
+  const std::string
+  ConstantArray::key(int64_t fieldindex) const {
+    throw std::invalid_argument(
+      std::string("fieldindex \"") + std::to_string(fieldindex)
+      + std::string("\" does not exist (data are not records)"));
+  }
+
+  bool
+  ConstantArray::haskey(const std::string& key) const {
+    return false;
+  }
+
+  const std::vector<std::string>
+  ConstantArray::keys() const {
+    return std::vector<std::string>();
+  }
+
+  const std::string
+  ConstantArray::validityerror(const std::string& path) const {
+    return value_.get()->validityerror(path + std::string(".value"));
+  }
+
+  const ContentPtr
+  ConstantArray::shallow_simplify() const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  ConstantArray::num(int64_t axis, int64_t depth) const {
+    return array().get()->num(axis, depth);
+  }
+
+  const std::pair<Index64, ContentPtr>
+  ConstantArray::offsets_and_flattened(int64_t axis, int64_t depth) const {
+    return array().get()->offsets_and_flattened(axis, depth);
+  }
+
+  const ContentPtr
+  ConstantArray::materialized() const {
+    return array();
+  }
+
+  bool
+  ConstantArray::mergeable(const ContentPtr& other, bool mergebool) const {
+    return array().get()->mergeable(other, mergebool);
+  }
+
+  const ContentPtr
+  ConstantArray::merge(const ContentPtr& other) const {
+    if (ConstantArray* raw = dynamic_cast<ConstantArray*>(other.get())) {
+      if (parameters_equal(raw->parameters())  &&  value_equal(*raw)) {
+        return std::make_shared<ConstantArray>(Identities::none(),
+                                               parameters_,
+                                               value_,
+                                               length_ + raw->length());
+      }
+    }
+    if (dynamic_cast<EmptyArray*>(other.get())  &&
+        parameters_equal(other.get()->parameters())) {
+      return shallow_copy();
+    }
+    return array().get()->merge(other);
+  }
+
+  const SliceItemPtr
+  ConstantArray::asslice() const {
+    return toNumpyArray().get()->asslice();
+  }
+
+  const ContentPtr
+  ConstantArray::fillna(const ContentPtr& value) const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  ConstantArray::rpad(int64_t target, int64_t axis, int64_t depth) const {
+    return array().get()->rpad(target, axis, depth);
+  }
+
+  const ContentPtr
+  ConstantArray::rpad_and_clip(int64_t target,
+                               int64_t axis,
+                               int64_t depth) const {
+    return array().get()->rpad_and_clip(target, axis, depth);
+  }
+
+  const ContentPtr
+  ConstantArray::reduce_next(const Reducer& reducer,
+                             int64_t negaxis,
+                             const Index64& starts,
+                             const Index64& parents,
+                             int64_t outlength,
+                             bool mask,
+                             bool keepdims) const {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(value_.get());
+    bool iscount = (dynamic_cast<const ReducerCount*>(&reducer) != nullptr);
+    if (raw->ndim() != 1  ||
+        !(iscount  ||
+          dynamic_cast<const ReducerSum*>(&reducer) != nullptr  ||
+          dynamic_cast<const ReducerMin*>(&reducer) != nullptr  ||
+          dynamic_cast<const ReducerMax*>(&reducer) != nullptr)) {
+      return array().get()->reduce_next(reducer,
+                                        negaxis,
+                                        starts,
+                                        parents,
+                                        outlength,
+                                        mask,
+                                        keepdims);
+    }
+
+    Index64 counts(outlength);
+    struct Error err = awkward_reduce_count_64(
+      counts.ptr().get(),
+      parents.ptr().get(),
+      parents.offset(),
+      parents.length(),
+      outlength);
+    util::handle_error(err, classname(), identities_.get());
+
+    std::string format = reducer.return_type(raw->format());
+    ssize_t itemsize = reducer.return_typesize(raw->format());
+    std::shared_ptr<void> ptr;
+    if (iscount) {
+      ptr = counts.ptr();
+    }
+    else if (format.compare("?") == 0) {
+      ptr = constant_reduce<bool>(reducer, *raw, counts, outlength);
+    }
+    else if (format.compare("b") == 0) {
+      ptr = constant_reduce<int8_t>(reducer, *raw, counts, outlength);
+    }
+    else if (format.compare("B") == 0  ||  format.compare("c") == 0) {
+      ptr = constant_reduce<uint8_t>(reducer, *raw, counts, outlength);
+    }
+    else if (format.compare("h") == 0) {
+      ptr = constant_reduce<int16_t>(reducer, *raw, counts, outlength);
+    }
+    else if (format.compare("H") == 0) {
+      ptr = constant_reduce<uint16_t>(reducer, *raw, counts, outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("l") == 0) {
+#else
+    else if (format.compare("i") == 0) {
+#endif
+      ptr = constant_reduce<int32_t>(reducer, *raw, counts, outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("L") == 0) {
+#else
+    else if (format.compare("I") == 0) {
+#endif
+      ptr = constant_reduce<uint32_t>(reducer, *raw, counts, outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("q") == 0) {
+#else
+    else if (format.compare("l") == 0) {
+#endif
+      ptr = constant_reduce<int64_t>(reducer, *raw, counts, outlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("Q") == 0) {
+#else
+    else if (format.compare("L") == 0) {
+#endif
+      ptr = constant_reduce<uint64_t>(reducer, *raw, counts, outlength);
+    }
+    else if (format.compare("f") == 0) {
+      ptr = constant_reduce<float>(reducer, *raw, counts, outlength);
+    }
+    else if (format.compare("d") == 0) {
+      ptr = constant_reduce<double>(reducer, *raw, counts, outlength);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot apply reducers to ConstantArray with format \"")
+        + raw->format() + std::string("\""));
+    }
+
+    std::vector<ssize_t> shape({ (ssize_t)outlength });
+    std::vector<ssize_t> strides({ itemsize });
+    ContentPtr out = std::make_shared<NumpyArray>(Identities::none(),
+                                                  util::Parameters(),
+                                                  ptr,
+                                                  shape,
+                                                  strides,
+                                                  0,
+                                                  itemsize,
+                                                  format);
+
+    if (mask) {
+      Index8 mask(outlength);
+      struct Error err = awkward_numpyarray_reduce_mask_bytemaskedarray(
+        mask.ptr().get(),
+        parents.ptr().get(),
+        parents.offset(),
+        parents.length(),
+        outlength);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ByteMaskedArray>(Identities::none(),
+                                              util::Parameters(),
+                                              mask,
+                                              out,
+                                              false);
+    }
+
+    if (keepdims) {
+      out = std::make_shared<RegularArray>(Identities::none(),
+                                           util::Parameters(),
+                                           out,
+                                           1);
+    }
+
+    return out;
+  }
+
+  const ContentPtr
+  ConstantArray::localindex(int64_t axis, int64_t depth) const {
+    return array().get()->localindex(axis, depth);
+  }
+
+  const ContentPtr
+  ConstantArray::combinations(int64_t n,
+                              bool replacement,
+                              const util::RecordLookupPtr& recordlookup,
+                              const util::Parameters& parameters,
+                              int64_t axis,
+                              int64_t depth) const {
+    return array().get()->combinations(n,
+                                       replacement,
+                                       recordlookup,
+                                       parameters,
+                                       axis,
+                                       depth);
+  }
+
+  const ContentPtr
+  ConstantArray::packed() const {
+    return toNumpyArray();
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next(const SliceAt& at,
+                              const Slice& tail,
+                              const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: ConstantArray::getitem_next(at)");
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next(const SliceRange& range,
+                              const Slice& tail,
+                              const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: ConstantArray::getitem_next(range)");
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next(const SliceArray64& array,
+                              const Slice& tail,
+                              const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: ConstantArray::getitem_next(array)");
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next(const SliceField& field,
+                              const Slice& tail,
+                              const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: ConstantArray::getitem_next(field)");
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next(const SliceFields& fields,
+                              const Slice& tail,
+                              const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: ConstantArray::getitem_next(fields)");
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next(const SliceJagged64& jagged,
+                              const Slice& tail,
+                              const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: ConstantArray::getitem_next(jagged)");
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next_jagged(const Index64& slicestarts,
+                                     const Index64& slicestops,
+                                     const SliceArray64& slicecontent,
+                                     const Slice& tail) const {
+    return array().get()->getitem_next_jagged(slicestarts,
+                                              slicestops,
+                                              slicecontent,
+                                              tail);
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next_jagged(const Index64& slicestarts,
+                                     const Index64& slicestops,
+                                     const SliceMissing64& slicecontent,
+                                     const Slice& tail) const {
+    return array().get()->getitem_next_jagged(slicestarts,
+                                              slicestops,
+                                              slicecontent,
+                                              tail);
+  }
+
+  const ContentPtr
+  ConstantArray::getitem_next_jagged(const Index64& slicestarts,
+                                     const Index64& slicestops,
+                                     const SliceJagged64& slicecontent,
+                                     const Slice& tail) const {
+    return array().get()->getitem_next_jagged(slicestarts,
+                                              slicestops,
+                                              slicecontent,
+                                              tail);
+  }
+
+  bool
+  ConstantArray::value_equal(const ConstantArray& other) const {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(value_.get());
+    NumpyArray* rawother = dynamic_cast<NumpyArray*>(other.value().get());
+    if (raw->format() != rawother->format()  ||
+        raw->itemsize() != rawother->itemsize()  ||
+        raw->shape() != rawother->shape()) {
+      return false;
+    }
+    NumpyArray left = raw->contiguous();
+    NumpyArray right = rawother->contiguous();
+    return std::memcmp(left.byteptr(),
+                       right.byteptr(),
+                       (size_t)(left.strides()[0])) == 0;
+  }
+
+}
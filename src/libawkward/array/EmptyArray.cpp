@@ -223,6 +223,11 @@ namespace awkward {
     }
   }
 
+  void
+  EmptyArray::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, 0);
+  }
+
   int64_t
   EmptyArray::length() const {
     return 0;
@@ -451,6 +456,11 @@ namespace awkward {
     return std::make_shared<EmptyArray>(identities_, util::Parameters());
   }
 
+  const ContentPtr
+  EmptyArray::packed() const {
+    return shallow_copy();
+  }
+
   const ContentPtr
   EmptyArray::getitem_next(const SliceAt& at,
                            const Slice& tail,
@@ -21,7 +21,6 @@
 #include "awkward/array/UnmaskedArray.h"
 #include "awkward/array/RegularArray.h"
 #include "awkward/array/ListOffsetArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #define AWKWARD_INDEXEDARRAY_NO_EXTERN_TEMPLATE
 #include "awkward/array/IndexedArray.h"
@@ -358,7 +357,7 @@ namespace awkward {
         content_.get()->length());
       util::handle_error(err2, classname(), identities_.get());
 
-      return content_.get()->carry(nextcarry);
+      return content_.get()->carry_or_range(nextcarry);
     }
     else {
       Index64 nextcarry(length());
@@ -370,7 +369,7 @@ namespace awkward {
         content_.get()->length());
       util::handle_error(err, classname(), identities_.get());
 
-      return content_.get()->carry(nextcarry);
+      return content_.get()->carry_or_range(nextcarry);
     }
   }
 
@@ -974,6 +973,14 @@ namespace awkward {
     }
   }
 
+  template <typename T, bool ISOPTION>
+  void
+  IndexedArrayOf<T, ISOPTION>::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length());
+    index_.fingerprint_part(hash);
+    content_.get()->fingerprint_part(hash);
+  }
+
   template <typename T, bool ISOPTION>
   int64_t
   IndexedArrayOf<T, ISOPTION>::length() const {
@@ -1341,11 +1348,9 @@ namespace awkward {
 
   template <typename T, bool ISOPTION>
   bool
-  IndexedArrayOf<T, ISOPTION>::mergeable(const ContentPtr& other,
+  IndexedArrayOf<T, ISOPTION>::mergeable(const ContentPtr& othercontent,
                                          bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -1397,10 +1402,9 @@ namespace awkward {
 
   template <typename T, bool ISOPTION>
   const ContentPtr
-  IndexedArrayOf<T, ISOPTION>::reverse_merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return reverse_merge(raw->array());
-    }
+  IndexedArrayOf<T, ISOPTION>::reverse_merge(
+    const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     int64_t theirlength = other.get()->length();
     int64_t mylength = length();
@@ -1458,10 +1462,8 @@ namespace awkward {
 
   template <typename T, bool ISOPTION>
   const ContentPtr
-  IndexedArrayOf<T, ISOPTION>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return merge(raw->array());
-    }
+  IndexedArrayOf<T, ISOPTION>::merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return merge_as_union(other);
@@ -1984,6 +1986,33 @@ namespace awkward {
     }
   }
 
+  template <typename T, bool ISOPTION>
+  const ContentPtr
+  IndexedArrayOf<T, ISOPTION>::packed() const {
+    // projecting is only cheaper if it does not duplicate content items;
+    // parameters such as "categorical" are lost in a plain projection
+    if (ISOPTION) {
+      int64_t numnull;
+      std::pair<Index64, IndexOf<T>> pair = nextcarry_outindex(numnull);
+      if (length() - numnull <= content_.get()->length()) {
+        ContentPtr content = content_.get()->carry(pair.first);
+        return std::make_shared<IndexedArrayOf<T, ISOPTION>>(
+          identities_,
+          parameters_,
+          pair.second,
+          content.get()->packed());
+      }
+    }
+    else if (parameters_.empty()  &&  length() <= content_.get()->length()) {
+      return project().get()->packed();
+    }
+    return std::make_shared<IndexedArrayOf<T, ISOPTION>>(
+      identities_,
+      parameters_,
+      index_.deep_copy(),
+      content_.get()->packed());
+  }
+
   template <typename T, bool ISOPTION>
   const ContentPtr
   IndexedArrayOf<T,
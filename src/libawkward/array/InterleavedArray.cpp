@@ -0,0 +1,555 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/identities.h"
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/util.h"
+
+#include "awkward/array/InterleavedArray.h"
+
+namespace awkward {
+  InterleavedArray::InterleavedArray(const IdentitiesPtr& identities,
+                                     const util::Parameters& parameters,
+                                     const ContentPtr& data,
+                                     const util::RecordLookupPtr& recordlookup)
+      : Content(identities, parameters)
+      , data_(data)
+      , recordlookup_(recordlookup) {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(data.get());
+    if (raw == nullptr  ||  raw->ndim() != 2) {
+      throw std::invalid_argument(
+        "InterleavedArray data must be a two-dimensional NumpyArray");
+    }
+    if (recordlookup_.get() != nullptr  &&
+        (int64_t)recordlookup_.get()->size() != (int64_t)raw->shape()[1]) {
+      throw std::invalid_argument(
+        "recordlookup and data must have the same number of fields");
+    }
+  }
+
+  const ContentPtr
+  InterleavedArray::data() const {
+    return data_;
+  }
+
+  const util::RecordLookupPtr
+  InterleavedArray::recordlookup() const {
+    return recordlookup_;
+  }
+
+  bool
+  InterleavedArray::istuple() const {
+    return recordlookup_.get() == nullptr;
+  }
+
+  const ContentPtr
+  InterleavedArray::field(int64_t fieldindex) const {
+    if (fieldindex < 0  ||  fieldindex >= numfields()) {
+      throw std::invalid_argument(
+        std::string("fieldindex ") + std::to_string(fieldindex)
+        + std::string(" for record with only " + std::to_string(numfields()))
+        + std::string(" fields"));
+    }
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(data_.get());
+    std::vector<ssize_t> shape({ raw->shape()[0] });
+    std::vector<ssize_t> strides({ raw->strides()[0] });
+    return std::make_shared<NumpyArray>(
+      Identities::none(),
+      util::Parameters(),
+      raw->ptr(),
+      shape,
+      strides,
+      raw->byteoffset() + (ssize_t)fieldindex*raw->strides()[1],
+      raw->itemsize(),
+      raw->format());
+  }
+
+  const ContentPtr
+  InterleavedArray::toRecordArray() const {
+    ContentPtrVec contents;
+    for (int64_t i = 0;  i < numfields();  i++) {
+      contents.push_back(field(i));
+    }
+    return std::make_shared<RecordArray>(identities_,
+                                         parameters_,
+                                         contents,
+                                         recordlookup_,
+                                         length());
+  }
+
+  const std::string
+  InterleavedArray::classname() const {
+    return "InterleavedArray";
+  }
+
+  void
+  InterleavedArray::setidentities() {
+    if (length() <= kMaxInt32) {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities32>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities32* rawidentities =
+        reinterpret_cast<Identities32*>(newidentities.get());
+      struct Error err = awkward_new_identities32(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+    else {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities64>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities64* rawidentities =
+        reinterpret_cast<Identities64*>(newidentities.get());
+      struct Error err = awkward_new_identities64(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+  }
+
+  void
+  InterleavedArray::setidentities(const IdentitiesPtr& identities) {
+    if (identities.get() != nullptr  &&
+        length() != identities.get()->length()) {
+      util::handle_error(
+        failure("content and its identities must have the same length",
+                kSliceNone,
+                kSliceNone),
+        classname(),
+        identities_.get());
+    }
+    identities_ = identities;
+  }
+
+  const TypePtr
+  InterleavedArray::type(const util::TypeStrs& typestrs) const {
+    return form(true).get()->type(typestrs);
+  }
+
+  const FormPtr
+  InterleavedArray::form(bool materialize) const {
+    return toRecordArray().get()->form(materialize);
+  }
+
+  bool
+  InterleavedArray::has_virtual_form() const {
+    return false;
+  }
+
+  bool
+  InterleavedArray::has_virtual_length() const {
+    return false;
+  }
+
+  const std::string
+  InterleavedArray::tostring_part(const std::string& indent,
+                                  const std::string& pre,
+                                  const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<" << classname();
+    if (!istuple()) {
+      out << " keys=\"";
+      for (size_t j = 0;  j < recordlookup_.get()->size();  j++) {
+        out << (j == 0 ? "" : " ") << recordlookup_.get()->at(j);
+      }
+      out << "\"";
+    }
+    out << ">\n";
+    if (identities_.get() != nullptr) {
+      out << identities_.get()->tostring_part(
+               indent + std::string("    "), "", "\n");
+    }
+    if (!parameters_.empty()) {
+      out << parameters_tostring(indent + std::string("    "), "", "\n");
+    }
+    out << data_.get()->tostring_part(
+             indent + std::string("    "), "<data>", "</data>\n");
+    out << indent << "</" << classname() << ">" << post;
+    return out.str();
+  }
+
+  void
+  InterleavedArray::tojson_part(ToJson& builder,
+                                bool include_beginendlist) const {
+    toRecordArray().get()->tojson_part(builder, include_beginendlist);
+  }
+
+  void
+  InterleavedArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
+    data_.get()->nbytes_part(largest);
+    if (identities_.get() != nullptr) {
+      identities_.get()->nbytes_part(largest);
+    }
+  }
+
+  void
+  InterleavedArray::fingerprint_part(uint64_t& hash) const {
+    toRecordArray().get()->fingerprint_part(hash);
+  }
+
+  int64_t
+  InterleavedArray::length() const {
+    return data_.get()->length();
+  }
+
+  const ContentPtr
+  InterleavedArray::shallow_copy() const {
+    return std::make_shared<InterleavedArray>(identities_,
+                                              parameters_,
+                                              data_,
+                                              recordlookup_);
+  }
+
+  const ContentPtr
+  InterleavedArray::deep_copy(bool copyarrays,
+                              bool copyindexes,
+                              bool copyidentities) const {
+    ContentPtr data = data_.get()->deep_copy(copyarrays,
+                                             copyindexes,
+                                             copyidentities);
+    IdentitiesPtr identities = identities_;
+    if (copyidentities  &&  identities_.get() != nullptr) {
+      identities = identities_.get()->deep_copy();
+    }
+    return std::make_shared<InterleavedArray>(identities,
+                                              parameters_,
+                                              data,
+                                              recordlookup_);
+  }
+
+  void
+  InterleavedArray::check_for_iteration() const {
+    if (identities_.get() != nullptr  &&
+        identities_.get()->length() < length()) {
+      util::handle_error(
+        failure("len(identities) < len(array)", kSliceNone, kSliceNone),
+        identities_.get()->classname(),
+        nullptr);
+    }
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_nothing() const {
+    return getitem_range_nowrap(0, 0);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_at(int64_t at) const {
+    int64_t regular_at = at;
+    int64_t len = length();
+    if (regular_at < 0) {
+      regular_at += len;
+    }
+    if (!(0 <= regular_at  &&  regular_at < len)) {
+      util::handle_error(failure("index out of range", kSliceNone, at),
+                         classname(),
+                         identities_.get());
+    }
+    return getitem_at_nowrap(regular_at);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_at_nowrap(int64_t at) const {
+    return toRecordArray().get()->getitem_at_nowrap(at);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_range(int64_t start, int64_t stop) const {
+    int64_t regular_start = start;
+    int64_t regular_stop = stop;
+    awkward_regularize_rangeslice(&regular_start, &regular_stop,
+      true, start != Slice::none(), stop != Slice::none(), length());
+    if (identities_.get() != nullptr  &&
+        regular_stop > identities_.get()->length()) {
+      util::handle_error(
+        failure("index out of range", kSliceNone, stop),
+        identities_.get()->classname(),
+        nullptr);
+    }
+    return getitem_range_nowrap(regular_start, regular_stop);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(start, stop);
+    }
+    return std::make_shared<InterleavedArray>(
+      identities,
+      parameters_,
+      data_.get()->getitem_range_nowrap(start, stop),
+      recordlookup_);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_field(const std::string& key) const {
+    return field(fieldindex(key));
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_fields(
+    const std::vector<std::string>& keys) const {
+    return toRecordArray().get()->getitem_fields(keys);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next(const SliceItemPtr& head,
+                                 const Slice& tail,
+                                 const Index64& advanced) const {
+    if (head.get() == nullptr) {
+      return shallow_copy();
+    }
+    else {
+      return toRecordArray().get()->getitem_next(head, tail, advanced);
+    }
+  }
+
+  const ContentPtr
+  InterleavedArray::carry(const Index64& carry) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_carry_64(carry);
+    }
+    return std::make_shared<InterleavedArray>(identities,
+                                              parameters_,
+                                              data_.get()->carry(carry),
+                                              recordlookup_);
+  }
+
+  const std::string
+  InterleavedArray::purelist_parameter(const std::string& key) const {
+    return parameter(key);
+  }
+
+  int64_t
+  InterleavedArray::numfields() const {
+    return (int64_t)dynamic_cast<NumpyArray*>(data_.get())->shape()[1];
+  }
+
+  int64_t
+  InterleavedArray::fieldindex(const std::string& key) const {
+    return util::fieldindex(recordlookup_, key, numfields());
+  }
+
+  const std::string
+  InterleavedArray::key(int64_t fieldindex) const {
+    return util::key(recordlookup_, fieldindex, numfields());
+  }
+
+  bool
+  InterleavedArray::haskey(const std::string& key) const {
+    return util::haskey(recordlookup_, key, numfields());
+  }
+
+  const std::vector<std::string>
+  InterleavedArray::keys() const {
+    return util::keys(recordlookup_, numfields());
+  }
+
+  const std::string
+  InterleavedArray::validityerror(const std::string& path) const {
+    return data_.get()->validityerror(path + std::string(".data"));
+  }
+
+  const ContentPtr
+  InterleavedArray::shallow_simplify() const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  InterleavedArray::num(int64_t axis, int64_t depth) const {
+    return toRecordArray().get()->num(axis, depth);
+  }
+
+  const std::pair<Index64, ContentPtr>
+  InterleavedArray::offsets_and_flattened(int64_t axis, int64_t depth) const {
+    return toRecordArray().get()->offsets_and_flattened(axis, depth);
+  }
+
+  const ContentPtr
+  InterleavedArray::materialized() const {
+    return toRecordArray();
+  }
+
+  bool
+  InterleavedArray::mergeable(const ContentPtr& other, bool mergebool) const {
+    return toRecordArray().get()->mergeable(other, mergebool);
+  }
+
+  const ContentPtr
+  InterleavedArray::merge(const ContentPtr& other) const {
+    if (InterleavedArray* raw =
+          dynamic_cast<InterleavedArray*>(other.get())) {
+      if (parameters_equal(raw->parameters())  &&
+          keys() == raw->keys()  &&
+          istuple() == raw->istuple()) {
+        return std::make_shared<InterleavedArray>(
+          Identities::none(),
+          parameters_,
+          data_.get()->merge(raw->data()),
+          recordlookup_);
+      }
+    }
+    if (dynamic_cast<EmptyArray*>(other.get())  &&
+        parameters_equal(other.get()->parameters())) {
+      return shallow_copy();
+    }
+    return toRecordArray().get()->merge(other);
+  }
+
+  const SliceItemPtr
+  InterleavedArray::asslice() const {
+    throw std::invalid_argument("cannot use records as a slice");
+  }
+
+  const ContentPtr
+  InterleavedArray::fillna(const ContentPtr& value) const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  InterleavedArray::rpad(int64_t target, int64_t axis, int64_t depth) const {
+    return toRecordArray().get()->rpad(target, axis, depth);
+  }
+
+  const ContentPtr
+  InterleavedArray::rpad_and_clip(int64_t target,
+                                  int64_t axis,
+                                  int64_t depth) const {
+    return toRecordArray().get()->rpad_and_clip(target, axis, depth);
+  }
+
+  const ContentPtr
+  InterleavedArray::reduce_next(const Reducer& reducer,
+                                int64_t negaxis,
+                                const Index64& starts,
+                                const Index64& parents,
+                                int64_t outlength,
+                                bool mask,
+                                bool keepdims) const {
+    return toRecordArray().get()->reduce_next(reducer,
+                                              negaxis,
+                                              starts,
+                                              parents,
+                                              outlength,
+                                              mask,
+                                              keepdims);
+  }
+
+  const ContentPtr
+  InterleavedArray::localindex(int64_t axis, int64_t depth) const {
+    return toRecordArray().get()->localindex(axis, depth);
+  }
+
+  const ContentPtr
+  InterleavedArray::combinations(int64_t n,
+                                 bool replacement,
+                                 const util::RecordLookupPtr& recordlookup,
+                                 const util::Parameters& parameters,
+                                 int64_t axis,
+                                 int64_t depth) const {
+    return toRecordArray().get()->combinations(n,
+                                               replacement,
+                                               recordlookup,
+                                               parameters,
+                                               axis,
+                                               depth);
+  }
+
+  const ContentPtr
+  InterleavedArray::packed() const {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(data_.get());
+    return std::make_shared<InterleavedArray>(
+      identities_,
+      parameters_,
+      std::make_shared<NumpyArray>(raw->contiguous()),
+      recordlookup_);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next(const SliceAt& at,
+                                 const Slice& tail,
+                                 const Index64& advanced) const {
+    return toRecordArray().get()->getitem_next(at, tail, advanced);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next(const SliceRange& range,
+                                 const Slice& tail,
+                                 const Index64& advanced) const {
+    return toRecordArray().get()->getitem_next(range, tail, advanced);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next(const SliceArray64& array,
+                                 const Slice& tail,
+                                 const Index64& advanced) const {
+    return toRecordArray().get()->getitem_next(array, tail, advanced);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next(const SliceField& field,
+                                 const Slice& tail,
+                                 const Index64& advanced) const {
+    return toRecordArray().get()->getitem_next(field, tail, advanced);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next(const SliceFields& fields,
+                                 const Slice& tail,
+                                 const Index64& advanced) const {
+    return toRecordArray().get()->getitem_next(fields, tail, advanced);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next(const SliceJagged64& jagged,
+                                 const Slice& tail,
+                                 const Index64& advanced) const {
+    return toRecordArray().get()->getitem_next(jagged, tail, advanced);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next_jagged(const Index64& slicestarts,
+                                        const Index64& slicestops,
+                                        const SliceArray64& slicecontent,
+                                        const Slice& tail) const {
+    return toRecordArray().get()->getitem_next_jagged(slicestarts,
+                                                      slicestops,
+                                                      slicecontent,
+                                                      tail);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next_jagged(const Index64& slicestarts,
+                                        const Index64& slicestops,
+                                        const SliceMissing64& slicecontent,
+                                        const Slice& tail) const {
+    return toRecordArray().get()->getitem_next_jagged(slicestarts,
+                                                      slicestops,
+                                                      slicecontent,
+                                                      tail);
+  }
+
+  const ContentPtr
+  InterleavedArray::getitem_next_jagged(const Index64& slicestarts,
+                                        const Index64& slicestops,
+                                        const SliceJagged64& slicecontent,
+                                        const Slice& tail) const {
+    return toRecordArray().get()->getitem_next_jagged(slicestarts,
+                                                      slicestops,
+                                                      slicecontent,
+                                                      tail);
+  }
+
+}
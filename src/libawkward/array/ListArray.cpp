@@ -20,7 +20,6 @@
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/BitMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #define AWKWARD_LISTARRAY_NO_EXTERN_TEMPLATE
 #include "awkward/array/ListArray.h"
@@ -293,6 +292,88 @@ namespace awkward {
     return broadcast_tooffsets64(offsets);
   }
 
+  template <typename T>
+  const ContentPtr
+  ListArrayOf<T>::toListOffsetArray(bool start_at_zero) const {
+    int64_t len = starts_.length();
+    IndexOf<T> offsets(len + 1);
+    struct Error err = util::awkward_listarray_compact_offsets<T>(
+      offsets.ptr().get(),
+      starts_.ptr().get(),
+      stops_.ptr().get(),
+      starts_.offset(),
+      stops_.offset(),
+      len);
+    if (err.str != nullptr) {
+      return toListOffsetArray64(start_at_zero);
+    }
+
+    int64_t carrylen = (int64_t)offsets.getitem_at_nowrap(len);
+    IndexOf<typename util::carry_of<T>::type> nextcarry(carrylen);
+    struct Error err2 = util::awkward_listarray_broadcast_tooffsets<T>(
+      nextcarry.ptr().get(),
+      offsets.ptr().get(),
+      offsets.offset(),
+      offsets.length(),
+      starts_.ptr().get(),
+      starts_.offset(),
+      stops_.ptr().get(),
+      stops_.offset(),
+      content_.get()->length());
+    util::handle_error(err2, classname(), identities_.get());
+
+    ContentPtr nextcontent = content_.get()->carry(nextcarry);
+
+    IdentitiesPtr identities;
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(0, len);
+    }
+    return std::make_shared<ListOffsetArrayOf<T>>(identities,
+                                                  parameters_,
+                                                  offsets,
+                                                  nextcontent);
+  }
+
+  template <typename T>
+  const ContentPtr
+  ListArrayOf<T>::hash64() const {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(content_.get());
+    if (raw == nullptr  ||  raw->ndim() != 1) {
+      throw std::invalid_argument(
+        classname() + std::string("::hash64 requires a one-dimensional "
+                                  "NumpyArray content"));
+    }
+    NumpyArray content = raw->contiguous();
+    int64_t length = starts_.length();
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)length],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = util::awkward_listarray_hash64<T>(
+      ptr.get(),
+      starts_.ptr().get(),
+      stops_.ptr().get(),
+      starts_.offset(),
+      stops_.offset(),
+      reinterpret_cast<const uint8_t*>(content.ptr().get()),
+      (int64_t)content.byteoffset(),
+      (int64_t)content.itemsize(),
+      length);
+    util::handle_error(err, classname(), identities_.get());
+    std::vector<ssize_t> shape({ (ssize_t)length });
+    std::vector<ssize_t> strides({ 8 });
+    return std::make_shared<NumpyArray>(Identities::none(),
+                                        util::Parameters(),
+                                        ptr,
+                                        shape,
+                                        strides,
+                                        0,
+                                        8,
+#if defined _MSC_VER || defined __i386__
+                                        "Q");
+#else
+                                        "L");
+#endif
+  }
+
   template <typename T>
   const std::string
   ListArrayOf<T>::classname() const {
@@ -506,6 +587,15 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  void
+  ListArrayOf<T>::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length());
+    starts_.fingerprint_part(hash);
+    stops_.getitem_range_nowrap(0, starts_.length()).fingerprint_part(hash);
+    content_.get()->fingerprint_part(hash);
+  }
+
   template <typename T>
   int64_t
   ListArrayOf<T>::length() const {
@@ -684,6 +774,19 @@ namespace awkward {
   template <typename T>
   const ContentPtr
   ListArrayOf<T>::carry(const Index64& carry) const {
+    return carry_generic<int64_t>(carry);
+  }
+
+  template <typename T>
+  const ContentPtr
+  ListArrayOf<T>::carry(const Index32& carry) const {
+    return carry_generic<int32_t>(carry);
+  }
+
+  template <typename T>
+  template <typename C>
+  const ContentPtr
+  ListArrayOf<T>::carry_generic(const IndexOf<C>& carry) const {
     int64_t lenstarts = starts_.length();
     if (stops_.length() < lenstarts) {
       util::handle_error(
@@ -693,7 +796,7 @@ namespace awkward {
     }
     IndexOf<T> nextstarts(carry.length());
     IndexOf<T> nextstops(carry.length());
-    struct Error err = util::awkward_listarray_getitem_carry_64<T>(
+    struct Error err = util::awkward_listarray_getitem_carry<T, C>(
       nextstarts.ptr().get(),
       nextstops.ptr().get(),
       starts_.ptr().get(),
@@ -706,7 +809,7 @@ namespace awkward {
     util::handle_error(err, classname(), identities_.get());
     IdentitiesPtr identities(nullptr);
     if (identities_.get() != nullptr) {
-      identities = identities_.get()->getitem_carry_64(carry);
+      identities = identities_.get()->getitem_carry_64(carry.to64());
     }
     return std::make_shared<ListArrayOf<T>>(identities,
                                             parameters_,
@@ -793,22 +896,21 @@ namespace awkward {
       return std::make_shared<NumpyArray>(tonum);
     }
     else {
-      return toListOffsetArray64(true).get()->num(axis, depth);
+      return toListOffsetArray(true).get()->num(axis, depth);
     }
   }
 
   template <typename T>
   const std::pair<Index64, ContentPtr>
   ListArrayOf<T>::offsets_and_flattened(int64_t axis, int64_t depth) const {
-    return toListOffsetArray64(true).get()->offsets_and_flattened(axis, depth);
+    return toListOffsetArray(true).get()->offsets_and_flattened(axis, depth);
   }
 
   template <typename T>
   bool
-  ListArrayOf<T>::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+  ListArrayOf<T>::mergeable(const ContentPtr& othercontent,
+                            bool mergebool) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -888,10 +990,8 @@ namespace awkward {
 
   template <typename T>
   const ContentPtr
-  ListArrayOf<T>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return merge(raw->array());
-    }
+  ListArrayOf<T>::merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return merge_as_union(other);
@@ -1203,9 +1303,37 @@ namespace awkward {
         );
         util::handle_error(err2, classname(), identities_.get());
 
-        Index64 index(tolength);
         IndexOf<T> starts(starts_.length());
         IndexOf<T> stops(starts_.length());
+
+        // 32-bit starts can only point to content that a 32-bit index reaches
+        if (std::is_same<T, int32_t>::value) {
+          Index32 index(tolength);
+          struct Error err3 = awkward_ListArray32_rpad_axis1_32(
+            index.ptr().get(),
+            reinterpret_cast<int32_t*>(starts_.ptr().get()),
+            reinterpret_cast<int32_t*>(stops_.ptr().get()),
+            reinterpret_cast<int32_t*>(starts.ptr().get()),
+            reinterpret_cast<int32_t*>(stops.ptr().get()),
+            target,
+            starts_.length(),
+            starts_.offset(),
+            stops_.offset());
+          util::handle_error(err3, classname(), identities_.get());
+
+          std::shared_ptr<IndexedOptionArray32> next =
+            std::make_shared<IndexedOptionArray32>(Identities::none(),
+                                                   util::Parameters(),
+                                                   index, content());
+          return std::make_shared<ListArrayOf<T>>(
+            Identities::none(),
+            parameters_,
+            starts,
+            stops,
+            next.get()->simplify_optiontype());
+        }
+
+        Index64 index(tolength);
         struct Error err3 = util::awkward_ListArray_rpad_axis1_64<T>(
           index.ptr().get(),
           starts_.ptr().get(),
@@ -1257,13 +1385,13 @@ namespace awkward {
                               int64_t outlength,
                               bool mask,
                               bool keepdims) const {
-    return toListOffsetArray64(true).get()->reduce_next(reducer,
-                                                        negaxis,
-                                                        starts,
-                                                        parents,
-                                                        outlength,
-                                                        mask,
-                                                        keepdims);
+    return toListOffsetArray(true).get()->reduce_next(reducer,
+                                                      negaxis,
+                                                      starts,
+                                                      parents,
+                                                      outlength,
+                                                      mask,
+                                                      keepdims);
   }
 
   template <typename T>
@@ -1384,6 +1512,25 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  const ContentPtr
+  ListArrayOf<T>::packed() const {
+    ContentPtr out = toListOffsetArray(true);
+    if (ListOffsetArrayOf<T>* raw =
+          dynamic_cast<ListOffsetArrayOf<T>*>(out.get())) {
+      return std::make_shared<ListOffsetArrayOf<T>>(
+        raw->identities(),
+        parameters_,
+        raw->offsets(),
+        raw->content().get()->packed());
+    }
+    ListOffsetArray64* raw = dynamic_cast<ListOffsetArray64*>(out.get());
+    return std::make_shared<ListOffsetArray64>(raw->identities(),
+                                               parameters_,
+                                               raw->offsets(),
+                                               raw->content().get()->packed());
+  }
+
   template <typename T>
   const ContentPtr
   ListArrayOf<T>::getitem_next(const SliceAt& at,
@@ -1403,8 +1550,8 @@ namespace awkward {
     }
     SliceItemPtr nexthead = tail.head();
     Slice nexttail = tail.tail();
-    Index64 nextcarry(lenstarts);
-    struct Error err = util::awkward_listarray_getitem_next_at_64<T>(
+    IndexOf<typename util::carry_of<T>::type> nextcarry(lenstarts);
+    struct Error err = util::awkward_listarray_getitem_next_at<T>(
       nextcarry.ptr().get(),
       starts_.ptr().get(),
       stops_.ptr().get(),
@@ -1453,9 +1600,9 @@ namespace awkward {
     util::handle_error(err1, classname(), identities_.get());
 
     IndexOf<T> nextoffsets(lenstarts + 1);
-    Index64 nextcarry(carrylength);
+    IndexOf<typename util::carry_of<T>::type> nextcarry(carrylength);
 
-    struct Error err2 = util::awkward_listarray_getitem_next_range_64<T>(
+    struct Error err2 = util::awkward_listarray_getitem_next_range<T>(
       nextoffsets.ptr().get(),
       nextcarry.ptr().get(),
       starts_.ptr().get(),
@@ -1517,9 +1664,10 @@ namespace awkward {
     Slice nexttail = tail.tail();
     Index64 flathead = array.ravel();
     if (advanced.length() == 0) {
-      Index64 nextcarry(lenstarts*flathead.length());
+      IndexOf<typename util::carry_of<T>::type>
+        nextcarry(lenstarts*flathead.length());
       Index64 nextadvanced(lenstarts*flathead.length());
-      struct Error err = util::awkward_listarray_getitem_next_array_64<T>(
+      struct Error err = util::awkward_listarray_getitem_next_array<T>(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
         starts_.ptr().get(),
@@ -1539,10 +1687,10 @@ namespace awkward {
         array.shape());
     }
     else {
-      Index64 nextcarry(lenstarts);
+      IndexOf<typename util::carry_of<T>::type> nextcarry(lenstarts);
       Index64 nextadvanced(lenstarts);
       struct Error err =
-        util::awkward_listarray_getitem_next_array_advanced_64<T>(
+        util::awkward_listarray_getitem_next_array_advanced<T>(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
         starts_.ptr().get(),
@@ -21,7 +21,6 @@
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/BitMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #define AWKWARD_LISTOFFSETARRAY_NO_EXTERN_TEMPLATE
 #include "awkward/array/ListOffsetArray.h"
@@ -248,6 +247,26 @@ namespace awkward {
     return out;
   }
 
+  template <typename T>
+  IndexOf<T>
+  ListOffsetArrayOf<T>::compact_offsets(bool start_at_zero) const {
+    if (!start_at_zero  ||
+        offsets_.getitem_at_nowrap(0) == 0) {
+      return offsets_;
+    }
+    else {
+      int64_t len = offsets_.length() - 1;
+      IndexOf<T> out(len + 1);
+      struct Error err = util::awkward_listoffsetarray_compact_offsets<T>(
+        out.ptr().get(),
+        offsets_.ptr().get(),
+        offsets_.offset(),
+        len);
+      util::handle_error(err, classname(), identities_.get());
+      return out;
+    }
+  }
+
   template <typename T>
   const ContentPtr
   ListOffsetArrayOf<T>::broadcast_tooffsets64(const Index64& offsets) const {
@@ -322,9 +341,126 @@ namespace awkward {
       return shallow_copy();
     }
     else {
+      // the compacted offsets start at zero and the content is contiguous,
+      // so it only needs to be trimmed, not carried
       Index64 offsets = compact_offsets64(start_at_zero);
-      return broadcast_tooffsets64(offsets);
+      int64_t start = (int64_t)offsets_.getitem_at_nowrap(0);
+      int64_t stop =
+        (int64_t)offsets_.getitem_at_nowrap(offsets_.length() - 1);
+      return std::make_shared<ListOffsetArray64>(
+        identities_,
+        parameters_,
+        offsets,
+        content_.get()->getitem_range_nowrap(start, stop));
+    }
+  }
+
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::hash64() const {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(content_.get());
+    if (raw == nullptr  ||  raw->ndim() != 1) {
+      throw std::invalid_argument(
+        classname() + std::string("::hash64 requires a one-dimensional "
+                                  "NumpyArray content"));
+    }
+    NumpyArray content = raw->contiguous();
+    int64_t length = offsets_.length() - 1;
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)length],
+                                  util::array_deleter<uint64_t>());
+    struct Error err = util::awkward_listarray_hash64<T>(
+      ptr.get(),
+      offsets_.ptr().get(),
+      offsets_.ptr().get(),
+      offsets_.offset(),
+      offsets_.offset() + 1,
+      reinterpret_cast<const uint8_t*>(content.ptr().get()),
+      (int64_t)content.byteoffset(),
+      (int64_t)content.itemsize(),
+      length);
+    util::handle_error(err, classname(), identities_.get());
+    std::vector<ssize_t> shape({ (ssize_t)length });
+    std::vector<ssize_t> strides({ 8 });
+    return std::make_shared<NumpyArray>(Identities::none(),
+                                        util::Parameters(),
+                                        ptr,
+                                        shape,
+                                        strides,
+                                        0,
+                                        8,
+#if defined _MSC_VER || defined __i386__
+                                        "Q");
+#else
+                                        "L");
+#endif
+  }
+
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::rolling(const std::string& reducer,
+                                int64_t window) const {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(content_.get());
+    if (raw == nullptr  ||  raw->ndim() != 1) {
+      throw std::invalid_argument(
+        classname() + std::string("::rolling requires a one-dimensional "
+                                  "NumpyArray content"));
+    }
+    bool isminmax = (reducer == "min"  ||  reducer == "max");
+    if (!isminmax  &&  reducer != "sum"  &&  reducer != "mean") {
+      throw std::invalid_argument(
+        classname() + std::string("::rolling reducer must be \"sum\", "
+                                  "\"mean\", \"min\", or \"max\", not ")
+        + util::quote(reducer, true));
+    }
+    ContentPtr compact = toListOffsetArray64(true);
+    ListOffsetArray64* list = dynamic_cast<ListOffsetArray64*>(compact.get());
+    Index64 offsets = list->offsets();
+    ContentPtr doubles = dynamic_cast<NumpyArray*>(
+      list->content().get())->astype("d");
+    NumpyArray content = dynamic_cast<NumpyArray*>(
+      doubles.get())->contiguous();
+    int64_t length = offsets.length() - 1;
+    int64_t total = offsets.getitem_at_nowrap(length);
+    std::shared_ptr<double> ptr(new double[(size_t)total],
+                                util::array_deleter<double>());
+    struct Error err;
+    if (isminmax) {
+      Index64 scratch(total);
+      err = awkward_listoffsetarray_rolling_minmax_64(
+        ptr.get(),
+        scratch.ptr().get(),
+        reinterpret_cast<const double*>(content.ptr().get()),
+        (int64_t)content.byteoffset() / 8,
+        offsets.ptr().get() + offsets.offset(),
+        length,
+        window,
+        reducer == "max");
+    }
+    else {
+      err = awkward_listoffsetarray_rolling_sum_64(
+        ptr.get(),
+        reinterpret_cast<const double*>(content.ptr().get()),
+        (int64_t)content.byteoffset() / 8,
+        offsets.ptr().get() + offsets.offset(),
+        length,
+        window,
+        reducer == "mean");
     }
+    util::handle_error(err, classname(), identities_.get());
+    std::vector<ssize_t> shape({ (ssize_t)total });
+    std::vector<ssize_t> strides({ 8 });
+    ContentPtr outcontent = std::make_shared<NumpyArray>(Identities::none(),
+                                                         util::Parameters(),
+                                                         ptr,
+                                                         shape,
+                                                         strides,
+                                                         0,
+                                                         8,
+                                                         "d");
+    return std::make_shared<ListOffsetArray64>(identities_,
+                                               util::Parameters(),
+                                               offsets,
+                                               outcontent);
   }
 
   template <typename T>
@@ -521,6 +657,17 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  void
+  ListOffsetArrayOf<T>::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length());
+    offsets_.fingerprint_part(hash);
+    int64_t start = (int64_t)offsets_.getitem_at_nowrap(0);
+    int64_t stop = (int64_t)offsets_.getitem_at_nowrap(offsets_.length() - 1);
+    content_.get()->getitem_range_nowrap(start, stop).get()->fingerprint_part(
+      hash);
+  }
+
   template <typename T>
   int64_t
   ListOffsetArrayOf<T>::length() const {
@@ -693,11 +840,24 @@ namespace awkward {
   template <typename T>
   const ContentPtr
   ListOffsetArrayOf<T>::carry(const Index64& carry) const {
+    return carry_generic<int64_t>(carry);
+  }
+
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::carry(const Index32& carry) const {
+    return carry_generic<int32_t>(carry);
+  }
+
+  template <typename T>
+  template <typename C>
+  const ContentPtr
+  ListOffsetArrayOf<T>::carry_generic(const IndexOf<C>& carry) const {
     IndexOf<T> starts = util::make_starts(offsets_);
     IndexOf<T> stops = util::make_stops(offsets_);
     IndexOf<T> nextstarts(carry.length());
     IndexOf<T> nextstops(carry.length());
-    struct Error err = util::awkward_listarray_getitem_carry_64<T>(
+    struct Error err = util::awkward_listarray_getitem_carry<T, C>(
       nextstarts.ptr().get(),
       nextstops.ptr().get(),
       starts.ptr().get(),
@@ -710,7 +870,7 @@ namespace awkward {
     util::handle_error(err, classname(), identities_.get());
     IdentitiesPtr identities(nullptr);
     if (identities_.get() != nullptr) {
-      identities = identities_.get()->getitem_carry_64(carry);
+      identities = identities_.get()->getitem_carry_64(carry.to64());
     }
     return std::make_shared<ListArrayOf<T>>(identities,
                                             parameters_,
@@ -802,11 +962,10 @@ namespace awkward {
     }
     else {
       ContentPtr next = content_.get()->num(axis, depth + 1);
-      Index64 offsets = compact_offsets64(true);
-      return std::make_shared<ListOffsetArray64>(Identities::none(),
-                                                 util::Parameters(),
-                                                 offsets,
-                                                 next);
+      return std::make_shared<ListOffsetArrayOf<T>>(Identities::none(),
+                                                    util::Parameters(),
+                                                    offsets_,
+                                                    next);
     }
   }
 
@@ -836,6 +995,27 @@ namespace awkward {
                                                         offsets_,
                                                         pair.second));
       }
+      int64_t innerlast =
+        inneroffsets.getitem_at_nowrap(inneroffsets.length() - 1);
+      if ((int64_t)((T)innerlast) == innerlast) {
+        // the flattened lists still fit in T: keep the narrower offsets
+        IndexOf<T> tooffsets(offsets_.length());
+        struct Error err = util::awkward_listoffsetarray_flatten_offsets<T>(
+          tooffsets.ptr().get(),
+          offsets_.ptr().get(),
+          offsets_.offset(),
+          offsets_.length(),
+          inneroffsets.ptr().get(),
+          inneroffsets.offset(),
+          inneroffsets.length());
+        util::handle_error(err, classname(), identities_.get());
+        return std::pair<Index64, ContentPtr>(
+                 Index64(0),
+                 std::make_shared<ListOffsetArrayOf<T>>(Identities::none(),
+                                                        util::Parameters(),
+                                                        tooffsets,
+                                                        pair.second));
+      }
       else {
         Index64 tooffsets(offsets_.length());
         struct Error err = util::awkward_listoffsetarray_flatten_offsets_64<T>(
@@ -859,11 +1039,9 @@ namespace awkward {
 
   template <typename T>
   bool
-  ListOffsetArrayOf<T>::mergeable(const ContentPtr& other,
+  ListOffsetArrayOf<T>::mergeable(const ContentPtr& othercontent,
                                   bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -943,10 +1121,8 @@ namespace awkward {
 
   template <typename T>
   const ContentPtr
-  ListOffsetArrayOf<T>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return merge(raw->array());
-    }
+  ListOffsetArrayOf<T>::merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return merge_as_union(other);
@@ -1331,6 +1507,26 @@ namespace awkward {
         &tolength);
       util::handle_error(err1, classname(), identities_.get());
 
+      // 32-bit offsets can only point to content that a 32-bit index reaches
+      if (std::is_same<T, int32_t>::value) {
+        Index32 outindex(tolength);
+        struct Error err2 = awkward_ListOffsetArray32_rpad_axis1_32(
+          outindex.ptr().get(),
+          reinterpret_cast<int32_t*>(offsets_.ptr().get()),
+          offsets_.offset(),
+          offsets_.length() - 1,
+          target);
+        util::handle_error(err2, classname(), identities_.get());
+
+        std::shared_ptr<IndexedOptionArray32> next =
+          std::make_shared<IndexedOptionArray32>(identities_,
+                                                 parameters_,
+                                                 outindex,
+                                                 content());
+        return std::make_shared<ListOffsetArrayOf<T>>(
+          identities_, parameters_, offsets, next.get()->simplify_optiontype());
+      }
+
       Index64 outindex(tolength);
       struct Error err2 = util::awkward_ListOffsetArray_rpad_axis1_64<T>(
         outindex.ptr().get(),
@@ -1402,13 +1598,15 @@ namespace awkward {
     }
   }
 
-  template <>
-  const ContentPtr ListOffsetArrayOf<int64_t>::reduce_next(
-    const Reducer& reducer,
-    int64_t negaxis,
-    const Index64& starts,
-    const Index64& parents,
-    int64_t outlength, bool mask, bool keepdims) const {
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::reduce_next(const Reducer& reducer,
+                                    int64_t negaxis,
+                                    const Index64& starts,
+                                    const Index64& parents,
+                                    int64_t outlength,
+                                    bool mask,
+                                    bool keepdims) const {
 
     std::pair<bool, int64_t> branchdepth = branch_depth();
 
@@ -1419,7 +1617,8 @@ namespace awkward {
 
       int64_t globalstart;
       int64_t globalstop;
-      struct Error err1 = awkward_listoffsetarray_reduce_global_startstop_64(
+      struct Error err1 =
+        util::awkward_listoffsetarray_reduce_global_startstop_64<T>(
         &globalstart,
         &globalstop,
         offsets_.ptr().get(),
@@ -1428,76 +1627,58 @@ namespace awkward {
       util::handle_error(err1, classname(), identities_.get());
       int64_t nextlen = globalstop - globalstart;
 
-      int64_t maxcount;
-      Index64 offsetscopy(offsets_.length());
+      // output list for each parent is as long as its longest list
+      Index64 outoffsets(outlength + 1);
       struct Error err2 =
-        awkward_listoffsetarray_reduce_nonlocal_maxcount_offsetscopy_64(
-        &maxcount,
-        offsetscopy.ptr().get(),
+        util::awkward_listoffsetarray_reduce_nonlocal_outoffsets_64<T>(
+        outoffsets.ptr().get(),
         offsets_.ptr().get(),
         offsets_.offset(),
-        offsets_.length() - 1);
+        offsets_.length() - 1,
+        parents.ptr().get(),
+        parents.offset(),
+        outlength);
       util::handle_error(err2, classname(), identities_.get());
+      int64_t nextoutlength = outoffsets.getitem_at_nowrap(outlength);
 
-      Index64 nextcarry(nextlen);
-      Index64 nextparents(nextlen);
-      int64_t maxnextparents;
-      Index64 distincts(maxcount * outlength);
+      Index64 nextstarts(nextoutlength);
       struct Error err3 =
-        awkward_listoffsetarray_reduce_nonlocal_preparenext_64(
-        nextcarry.ptr().get(),
-        nextparents.ptr().get(),
-        nextlen,
-        &maxnextparents,
-        distincts.ptr().get(),
-        maxcount * outlength,
-        offsetscopy.ptr().get(),
+        util::awkward_listoffsetarray_reduce_nonlocal_nextstarts_64<T>(
+        nextstarts.ptr().get(),
+        nextoutlength,
+        outoffsets.ptr().get(),
         offsets_.ptr().get(),
         offsets_.offset(),
         offsets_.length() - 1,
         parents.ptr().get(),
-        parents.offset(),
-        maxcount);
+        parents.offset());
       util::handle_error(err3, classname(), identities_.get());
 
-      Index64 nextstarts(maxnextparents + 1);
+      IndexOf<typename util::carry_of<T>::type> nextcarry(nextlen);
+      Index64 nextparents(nextlen);
       struct Error err4 =
-        awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
-        nextstarts.ptr().get(),
+        util::awkward_listoffsetarray_reduce_nonlocal_nextcarry<T>(
+        nextcarry.ptr().get(),
         nextparents.ptr().get(),
-        nextlen);
+        nextstarts.ptr().get(),
+        nextoutlength,
+        outoffsets.ptr().get(),
+        offsets_.ptr().get(),
+        offsets_.offset(),
+        offsets_.length() - 1,
+        parents.ptr().get(),
+        parents.offset());
       util::handle_error(err4, classname(), identities_.get());
 
       ContentPtr nextcontent = content_.get()->carry(nextcarry);
       ContentPtr outcontent = nextcontent.get()->reduce_next(
-        reducer, negaxis - 1, nextstarts, nextparents, maxnextparents + 1,
+        reducer, negaxis - 1, nextstarts, nextparents, nextoutlength,
         mask, false);
 
-      Index64 gaps(outlength);
-      struct Error err5 = awkward_listoffsetarray_reduce_nonlocal_findgaps_64(
-        gaps.ptr().get(),
-        parents.ptr().get(),
-        parents.offset(),
-        parents.length());
-      util::handle_error(err5, classname(), identities_.get());
-
-      Index64 outstarts(outlength);
-      Index64 outstops(outlength);
-      struct Error err6 =
-        awkward_listoffsetarray_reduce_nonlocal_outstartsstops_64(
-        outstarts.ptr().get(),
-        outstops.ptr().get(),
-        distincts.ptr().get(),
-        maxcount * outlength,
-        gaps.ptr().get(),
-        outlength);
-      util::handle_error(err6, classname(), identities_.get());
-
-      ContentPtr out = std::make_shared<ListArray64>(Identities::none(),
-                                                     util::Parameters(),
-                                                     outstarts,
-                                                     outstops,
-                                                     outcontent);
+      ContentPtr out = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                           util::Parameters(),
+                                                           outoffsets,
+                                                           outcontent);
       if (keepdims) {
         out = std::make_shared<RegularArray>(Identities::none(),
                                              util::Parameters(),
@@ -1510,7 +1691,8 @@ namespace awkward {
     else {
       int64_t globalstart;
       int64_t globalstop;
-      struct Error err1 = awkward_listoffsetarray_reduce_global_startstop_64(
+      struct Error err1 =
+        util::awkward_listoffsetarray_reduce_global_startstop_64<T>(
         &globalstart,
         &globalstop,
         offsets_.ptr().get(),
@@ -1519,7 +1701,8 @@ namespace awkward {
       util::handle_error(err1, classname(), identities_.get());
 
       Index64 nextparents(globalstop - globalstart);
-      struct Error err2 = awkward_listoffsetarray_reduce_local_nextparents_64(
+      struct Error err2 =
+        util::awkward_listoffsetarray_reduce_local_nextparents_64<T>(
         nextparents.ptr().get(),
         offsets_.ptr().get(),
         offsets_.offset(),
@@ -1529,7 +1712,7 @@ namespace awkward {
       ContentPtr trimmed = content_.get()->getitem_range_nowrap(globalstart,
                                                                 globalstop);
       ContentPtr outcontent = trimmed.get()->reduce_next(
-        reducer, negaxis, util::make_starts(offsets_), nextparents,
+        reducer, negaxis, util::make_starts(offsets_).to64(), nextparents,
         offsets_.length() - 1, mask, keepdims);
 
       Index64 outoffsets(outlength + 1);
@@ -1548,24 +1731,6 @@ namespace awkward {
     }
   }
 
-  template <typename T>
-  const ContentPtr
-  ListOffsetArrayOf<T>::reduce_next(const Reducer& reducer,
-                                    int64_t negaxis,
-                                    const Index64& starts,
-                                    const Index64& parents,
-                                    int64_t length,
-                                    bool mask,
-                                    bool keepdims) const {
-    return toListOffsetArray64(true).get()->reduce_next(reducer,
-                                                        negaxis,
-                                                        starts,
-                                                        parents,
-                                                        length,
-                                                        mask,
-                                                        keepdims);
-  }
-
   template <typename T>
   const ContentPtr
   ListOffsetArrayOf<T>::localindex(int64_t axis, int64_t depth) const {
@@ -1682,6 +1847,22 @@ namespace awkward {
     }
   }
 
+  template <typename T>
+  const ContentPtr
+  ListOffsetArrayOf<T>::packed() const {
+    // compact_offsets does not copy offsets that already start at zero
+    IndexOf<T> compact = compact_offsets(true);
+    IndexOf<T> offsets = (compact.ptr().get() == offsets_.ptr().get()
+                            ? compact.deep_copy() : compact);
+    int64_t start = (int64_t)offsets_.getitem_at_nowrap(0);
+    int64_t stop = (int64_t)offsets_.getitem_at_nowrap(offsets_.length() - 1);
+    ContentPtr content = content_.get()->getitem_range_nowrap(start, stop);
+    return std::make_shared<ListOffsetArrayOf<T>>(identities_,
+                                                  parameters_,
+                                                  offsets,
+                                                  content.get()->packed());
+  }
+
   template <typename T>
   const ContentPtr
   ListOffsetArrayOf<T>::getitem_next(const SliceAt& at,
@@ -1696,8 +1877,8 @@ namespace awkward {
     IndexOf<T> stops = util::make_stops(offsets_);
     SliceItemPtr nexthead = tail.head();
     Slice nexttail = tail.tail();
-    Index64 nextcarry(lenstarts);
-    struct Error err = util::awkward_listarray_getitem_next_at_64<T>(
+    IndexOf<typename util::carry_of<T>::type> nextcarry(lenstarts);
+    struct Error err = util::awkward_listarray_getitem_next_at<T>(
       nextcarry.ptr().get(),
       starts.ptr().get(),
       stops.ptr().get(),
@@ -1741,9 +1922,9 @@ namespace awkward {
     util::handle_error(err1, classname(), identities_.get());
 
     IndexOf<T> nextoffsets(lenstarts + 1);
-    Index64 nextcarry(carrylength);
+    IndexOf<typename util::carry_of<T>::type> nextcarry(carrylength);
 
-    struct Error err2 = util::awkward_listarray_getitem_next_range_64<T>(
+    struct Error err2 = util::awkward_listarray_getitem_next_range<T>(
       nextoffsets.ptr().get(),
       nextcarry.ptr().get(),
       starts.ptr().get(),
@@ -1800,9 +1981,10 @@ namespace awkward {
     Slice nexttail = tail.tail();
     Index64 flathead = array.ravel();
     if (advanced.length() == 0) {
-      Index64 nextcarry(lenstarts*flathead.length());
+      IndexOf<typename util::carry_of<T>::type>
+        nextcarry(lenstarts*flathead.length());
       Index64 nextadvanced(lenstarts*flathead.length());
-      struct Error err = util::awkward_listarray_getitem_next_array_64<T>(
+      struct Error err = util::awkward_listarray_getitem_next_array<T>(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
         starts.ptr().get(),
@@ -1822,10 +2004,10 @@ namespace awkward {
                array.shape());
     }
     else {
-      Index64 nextcarry(lenstarts);
+      IndexOf<typename util::carry_of<T>::type> nextcarry(lenstarts);
       Index64 nextadvanced(lenstarts);
       struct Error err =
-        util::awkward_listarray_getitem_next_array_advanced_64<T>(
+        util::awkward_listarray_getitem_next_array_advanced<T>(
         nextcarry.ptr().get(),
         nextadvanced.ptr().get(),
         starts.ptr().get(),
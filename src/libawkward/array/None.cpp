@@ -74,6 +74,11 @@ namespace awkward {
     throw std::runtime_error("undefined operation: None::nbytes_part");
   }
 
+  void
+  None::fingerprint_part(uint64_t& hash) const {
+    throw std::runtime_error("undefined operation: None::fingerprint_part");
+  }
+
   int64_t
   None::length() const {
     return -1;
@@ -237,6 +242,11 @@ namespace awkward {
     throw std::runtime_error("undefined operation: None::combinations");
   }
 
+  const ContentPtr
+  None::packed() const {
+    throw std::runtime_error("undefined operation: None::packed");
+  }
+
   const ContentPtr
   None::getitem_next(const SliceAt& at,
                      const Slice& tail,
@@ -13,13 +13,14 @@
 #include "awkward/type/RegularType.h"
 #include "awkward/type/ArrayType.h"
 #include "awkward/array/RegularArray.h"
+#include "awkward/array/ListOffsetArray.h"
 #include "awkward/array/EmptyArray.h"
 #include "awkward/array/IndexedArray.h"
 #include "awkward/array/UnionArray.h"
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/BitMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
-#include "awkward/array/VirtualArray.h"
+#include "awkward/array/BitPackedArray.h"
 #include "awkward/util.h"
 
 #include "awkward/array/NumpyArray.h"
@@ -60,6 +61,9 @@ namespace awkward {
     else if (format_.compare("f") == 0) {
       return "float32";
     }
+    else if (format_.compare("e") == 0) {
+      return "float16";
+    }
 #if defined _MSC_VER || defined __i386__
     else if (format_.compare("q") == 0) {
 #else
@@ -123,6 +127,12 @@ namespace awkward {
                 util::gettypestr(parameters_, typestrs),
                 PrimitiveType::float32);
     }
+    else if (format_.compare("e") == 0) {
+      out = std::make_shared<PrimitiveType>(
+                parameters_,
+                util::gettypestr(parameters_, typestrs),
+                PrimitiveType::float16);
+    }
 #if defined _MSC_VER || defined __i386__
     else if (format_.compare("q") == 0) {
 #else
@@ -613,6 +623,302 @@ namespace awkward {
     return out;
   }
 
+  const ContentPtr
+  NumpyArray::toBitPackedArray(bool lsb_order) const {
+    if (format_.compare("?") != 0  ||  ndim() != 1) {
+      throw std::invalid_argument(
+        "only one-dimensional arrays of booleans can be bit-packed");
+    }
+    IndexU8 bits((length() + 7) / 8);
+    struct Error err = awkward_numpyarray_to_bitpackedarray(
+      bits.ptr().get(),
+      reinterpret_cast<int8_t*>(ptr_.get()),
+      (int64_t)byteoffset_,
+      length(),
+      (int64_t)strides_[0],
+      lsb_order);
+    util::handle_error(err, classname(), identities_.get());
+    return std::make_shared<BitPackedArray>(identities_,
+                                            parameters_,
+                                            bits,
+                                            length(),
+                                            lsb_order);
+  }
+
+  const ContentPtr
+  NumpyArray::astype(const std::string& format) const {
+    if (format.compare(format_) == 0) {
+      if (iscontiguous()) {
+        return shallow_copy();
+      }
+      return contiguous().shallow_copy();
+    }
+    ssize_t itemsize;
+    if (format.compare("?") == 0  ||
+        format.compare("b") == 0  ||
+        format.compare("B") == 0) {
+      itemsize = 1;
+    }
+    else if (format.compare("e") == 0  ||
+             format.compare("h") == 0  ||
+             format.compare("H") == 0) {
+      itemsize = 2;
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("f") == 0  ||
+             format.compare("l") == 0  ||
+             format.compare("L") == 0) {
+#else
+    else if (format.compare("f") == 0  ||
+             format.compare("i") == 0  ||
+             format.compare("I") == 0) {
+#endif
+      itemsize = 4;
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("d") == 0  ||
+             format.compare("q") == 0  ||
+             format.compare("Q") == 0) {
+#else
+    else if (format.compare("d") == 0  ||
+             format.compare("l") == 0  ||
+             format.compare("L") == 0) {
+#endif
+      itemsize = 8;
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot convert Numpy format \"") + format_
+        + std::string("\" to \"") + format + std::string("\""));
+    }
+
+    std::vector<ssize_t> strides(shape_.size(), itemsize);
+    ssize_t length = 1;
+    for (int64_t i = ((int64_t)shape_.size()) - 1;  i >= 0;  i--) {
+      strides[(size_t)i] = itemsize*length;
+      length *= shape_[(size_t)i];
+    }
+    std::shared_ptr<void> ptr(new uint8_t[(size_t)(itemsize*length)],
+                              util::array_deleter<uint8_t>());
+    fill_as(format, ptr, 0);
+    return std::make_shared<NumpyArray>(identities_,
+                                        parameters_,
+                                        ptr,
+                                        shape_,
+                                        strides,
+                                        0,
+                                        itemsize,
+                                        format);
+  }
+
+  const ContentPtr
+  NumpyArray::hash64() const {
+    if (format_.compare("e") == 0) {
+      ContentPtr widened = astype("f");
+      return dynamic_cast<NumpyArray*>(widened.get())->hash64();
+    }
+    NumpyArray contig = contiguous();
+    ssize_t length = 1;
+    std::vector<ssize_t> strides(shape_.size(), 8);
+    for (int64_t i = ((int64_t)shape_.size()) - 1;  i >= 0;  i--) {
+      strides[(size_t)i] = 8*length;
+      length *= shape_[(size_t)i];
+    }
+    std::shared_ptr<uint64_t> ptr(new uint64_t[(size_t)length],
+                                  util::array_deleter<uint64_t>());
+    const void* data = contig.ptr().get();
+    int64_t offset = (int64_t)(contig.byteoffset() / itemsize_);
+    struct Error err;
+    if (format_.compare("?") == 0) {
+      err = awkward_numpyarray_hash64_frombool(
+        ptr.get(), reinterpret_cast<const bool*>(data), offset, 1, length);
+    }
+    else if (format_.compare("b") == 0) {
+      err = awkward_numpyarray_hash64_from8(
+        ptr.get(), reinterpret_cast<const int8_t*>(data), offset, 1, length);
+    }
+    else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
+      err = awkward_numpyarray_hash64_fromU8(
+        ptr.get(), reinterpret_cast<const uint8_t*>(data), offset, 1, length);
+    }
+    else if (format_.compare("h") == 0) {
+      err = awkward_numpyarray_hash64_from16(
+        ptr.get(), reinterpret_cast<const int16_t*>(data), offset, 1, length);
+    }
+    else if (format_.compare("H") == 0) {
+      err = awkward_numpyarray_hash64_fromU16(
+        ptr.get(), reinterpret_cast<const uint16_t*>(data), offset, 1,
+        length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("l") == 0) {
+#else
+    else if (format_.compare("i") == 0) {
+#endif
+      err = awkward_numpyarray_hash64_from32(
+        ptr.get(), reinterpret_cast<const int32_t*>(data), offset, 1, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("L") == 0) {
+#else
+    else if (format_.compare("I") == 0) {
+#endif
+      err = awkward_numpyarray_hash64_fromU32(
+        ptr.get(), reinterpret_cast<const uint32_t*>(data), offset, 1,
+        length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("q") == 0) {
+#else
+    else if (format_.compare("l") == 0) {
+#endif
+      err = awkward_numpyarray_hash64_from64(
+        ptr.get(), reinterpret_cast<const int64_t*>(data), offset, 1, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("Q") == 0) {
+#else
+    else if (format_.compare("L") == 0) {
+#endif
+      err = awkward_numpyarray_hash64_fromU64(
+        ptr.get(), reinterpret_cast<const uint64_t*>(data), offset, 1,
+        length);
+    }
+    else if (format_.compare("f") == 0) {
+      err = awkward_numpyarray_hash64_fromfloat(
+        ptr.get(), reinterpret_cast<const float*>(data), offset, 1, length);
+    }
+    else if (format_.compare("d") == 0) {
+      err = awkward_numpyarray_hash64_fromdouble(
+        ptr.get(), reinterpret_cast<const double*>(data), offset, 1, length);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot hash NumpyArray with format \"")
+        + format_ + std::string("\""));
+    }
+    util::handle_error(err, classname(), identities_.get());
+    return std::make_shared<NumpyArray>(Identities::none(),
+                                        util::Parameters(),
+                                        ptr,
+                                        shape_,
+                                        strides,
+                                        0,
+                                        8,
+#if defined _MSC_VER || defined __i386__
+                                        "Q");
+#else
+                                        "L");
+#endif
+  }
+
+  const ContentPtr
+  NumpyArray::searchsorted(const std::vector<double>& edges,
+                           bool right) const {
+    for (size_t i = 1;  i < edges.size();  i++) {
+      if (!(edges[i - 1] <= edges[i])) {
+        throw std::invalid_argument(
+          "searchsorted edges must be in non-decreasing order");
+      }
+    }
+    NumpyArray contig = contiguous();
+    ssize_t length = 1;
+    std::vector<ssize_t> strides(shape_.size(), 8);
+    for (int64_t i = ((int64_t)shape_.size()) - 1;  i >= 0;  i--) {
+      strides[(size_t)i] = 8*length;
+      length *= shape_[(size_t)i];
+    }
+    std::shared_ptr<int64_t> ptr(new int64_t[(size_t)length],
+                                 util::array_deleter<int64_t>());
+    const void* data = contig.ptr().get();
+    int64_t offset = (int64_t)(contig.byteoffset() / itemsize_);
+    struct Error err;
+    if (format_.compare("b") == 0) {
+      err = awkward_numpyarray_searchsorted_from8(
+        ptr.get(), reinterpret_cast<const int8_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+    else if (format_.compare("B") == 0) {
+      err = awkward_numpyarray_searchsorted_fromU8(
+        ptr.get(), reinterpret_cast<const uint8_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+    else if (format_.compare("h") == 0) {
+      err = awkward_numpyarray_searchsorted_from16(
+        ptr.get(), reinterpret_cast<const int16_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+    else if (format_.compare("H") == 0) {
+      err = awkward_numpyarray_searchsorted_fromU16(
+        ptr.get(), reinterpret_cast<const uint16_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("l") == 0) {
+#else
+    else if (format_.compare("i") == 0) {
+#endif
+      err = awkward_numpyarray_searchsorted_from32(
+        ptr.get(), reinterpret_cast<const int32_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("L") == 0) {
+#else
+    else if (format_.compare("I") == 0) {
+#endif
+      err = awkward_numpyarray_searchsorted_fromU32(
+        ptr.get(), reinterpret_cast<const uint32_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("q") == 0) {
+#else
+    else if (format_.compare("l") == 0) {
+#endif
+      err = awkward_numpyarray_searchsorted_from64(
+        ptr.get(), reinterpret_cast<const int64_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("Q") == 0) {
+#else
+    else if (format_.compare("L") == 0) {
+#endif
+      err = awkward_numpyarray_searchsorted_fromU64(
+        ptr.get(), reinterpret_cast<const uint64_t*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+    else if (format_.compare("f") == 0) {
+      err = awkward_numpyarray_searchsorted_fromfloat(
+        ptr.get(), reinterpret_cast<const float*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+    else if (format_.compare("d") == 0) {
+      err = awkward_numpyarray_searchsorted_fromdouble(
+        ptr.get(), reinterpret_cast<const double*>(data), offset, length,
+        edges.data(), 0, (int64_t)edges.size(), right);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("searchsorted is not supported for NumpyArray format \"")
+        + format_ + std::string("\""));
+    }
+    util::handle_error(err, classname(), identities_.get());
+    return std::make_shared<NumpyArray>(Identities::none(),
+                                        util::Parameters(),
+                                        ptr,
+                                        shape_,
+                                        strides,
+                                        0,
+                                        8,
+#if defined _MSC_VER || defined __i386__
+                                        "q");
+#else
+                                        "l");
+#endif
+  }
+
   bool
   NumpyArray::isscalar() const {
     return ndim() == 0;
@@ -861,6 +1167,9 @@ namespace awkward {
     else if (format_.compare("f") == 0) {
       tojson_real<float>(builder, include_beginendlist);
     }
+    else if (format_.compare("e") == 0) {
+      astype("f").get()->tojson_part(builder, include_beginendlist);
+    }
 #if defined _MSC_VER || defined __i386__
     else if (format_.compare("q") == 0) {
 #else
@@ -927,6 +1236,23 @@ namespace awkward {
     }
   }
 
+  void
+  NumpyArray::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length());
+    if (isscalar()) {
+      util::fingerprint_combine(hash, util::buffer_fingerprint(
+        ptr_, (int64_t)byteoffset_, (int64_t)itemsize_));
+    }
+    else if (iscontiguous()) {
+      util::fingerprint_combine(hash, util::buffer_fingerprint(
+        ptr_, (int64_t)byteoffset_, (int64_t)(shape_[0]*strides_[0])));
+    }
+    else {
+      util::fingerprint_combine(hash, util::buffer_fingerprint(
+        ptr_, (int64_t)byteoffset_, (int64_t)itemsize_, shape_, strides_));
+    }
+  }
+
   int64_t
   NumpyArray::length() const {
     if (isscalar()) {
@@ -1220,13 +1546,35 @@ namespace awkward {
 
   const ContentPtr
   NumpyArray::carry(const Index64& carry) const {
+    return carry_generic<int64_t>(carry);
+  }
+
+  const ContentPtr
+  NumpyArray::carry(const Index32& carry) const {
+    return carry_generic<int32_t>(carry);
+  }
+
+  template <typename C>
+  const ContentPtr
+  NumpyArray::carry_generic(const IndexOf<C>& carry) const {
+    // only the first dimension may have a non-contiguous stride; each row
+    // is copied whole into a compact buffer
+    std::vector<ssize_t> strides(shape_.size(), itemsize_);
+    for (int64_t i = ((int64_t)shape_.size()) - 1;  i > 0;  i--) {
+      if (strides_[(size_t)i] != strides[(size_t)i]) {
+        return contiguous().carry_generic<C>(carry);
+      }
+      strides[(size_t)i - 1] = strides[(size_t)i]*shape_[(size_t)i];
+    }
+
     std::shared_ptr<void> ptr(
-      new uint8_t[(size_t)(carry.length()*strides_[0])],
+      new uint8_t[(size_t)(carry.length()*strides[0])],
       util::array_deleter<uint8_t>());
-    struct Error err = awkward_numpyarray_getitem_next_null_64(
+    struct Error err = util::awkward_numpyarray_getitem_next_null_strided<C>(
       reinterpret_cast<uint8_t*>(ptr.get()),
       reinterpret_cast<uint8_t*>(ptr_.get()),
       carry.length(),
+      strides[0],
       strides_[0],
       byteoffset_,
       carry.ptr().get());
@@ -1234,7 +1582,7 @@ namespace awkward {
 
     IdentitiesPtr identities(nullptr);
     if (identities_.get() != nullptr) {
-      identities = identities_.get()->getitem_carry_64(carry);
+      identities = identities_.get()->getitem_carry_64(carry.to64());
     }
 
     std::vector<ssize_t> shape = { (ssize_t)carry.length() };
@@ -1243,7 +1591,7 @@ namespace awkward {
                                         parameters_,
                                         ptr,
                                         shape,
-                                        strides_,
+                                        strides,
                                         0,
                                         itemsize_,
                                         format_);
@@ -1425,10 +1773,8 @@ namespace awkward {
   }
 
   bool
-  NumpyArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+  NumpyArray::mergeable(const ContentPtr& othercontent, bool mergebool) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -1492,6 +1838,7 @@ namespace awkward {
 
       if (!(format_.compare("d") == 0  ||
             format_.compare("f") == 0  ||
+            format_.compare("e") == 0  ||
             format_.compare("q") == 0  ||
             format_.compare("Q") == 0  ||
             format_.compare("l") == 0  ||
@@ -1506,6 +1853,7 @@ namespace awkward {
             format_.compare("?") == 0  ||
             other_format.compare("d") == 0  ||
             other_format.compare("f") == 0  ||
+            other_format.compare("e") == 0  ||
             other_format.compare("q") == 0  ||
             other_format.compare("Q") == 0  ||
             other_format.compare("l") == 0  ||
@@ -1536,10 +1884,8 @@ namespace awkward {
   }
 
   const ContentPtr
-  NumpyArray::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return merge(raw->array());
-    }
+  NumpyArray::merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return merge_as_union(other);
@@ -1610,7 +1956,6 @@ namespace awkward {
       }
     }
 
-    NumpyArray contiguous_self = contiguous();
     if (NumpyArray* rawother = dynamic_cast<NumpyArray*>(other.get())) {
       if (ndim() != rawother->ndim()) {
         throw std::invalid_argument(
@@ -1623,8 +1968,10 @@ namespace awkward {
       std::string format;
       if (format_.compare("d") == 0  ||
           format_.compare("f") == 0  ||
+          format_.compare("e") == 0  ||
           other_format.compare("d") == 0  ||
-          other_format.compare("f") == 0) {
+          other_format.compare("f") == 0  ||
+          other_format.compare("e") == 0) {
         itemsize = 8;
         format = "d";
       }
@@ -1699,465 +2046,8 @@ namespace awkward {
         new uint8_t[(size_t)(itemsize*(self_flatlength + other_flatlength))],
         util::array_deleter<uint8_t>());
 
-      NumpyArray contiguous_other = rawother->contiguous();
-
-      int64_t self_offset = (contiguous_self.byteoffset() /
-                             contiguous_self.itemsize());
-      int64_t other_offset = (contiguous_other.byteoffset() /
-                              contiguous_other.itemsize());
-
-      struct Error err;
-      if (format.compare("d") == 0) {
-        if (format_.compare("d") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromdouble(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<double*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("f") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromfloat(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<float*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-        else if (format_.compare("q") == 0) {
-#else
-        else if (format_.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("Q") == 0) {
-#else
-          else if (format_.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("l") == 0) {
-#else
-          else if (format_.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("L") == 0) {
-#else
-          else if (format_.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("h") == 0) {
-          err = awkward_numpyarray_fill_todouble_from16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("H") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("b") == 0) {
-          err = awkward_numpyarray_fill_todouble_from8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("?") == 0) {
-          err = awkward_numpyarray_fill_todouble_frombool(
-                  reinterpret_cast<double*>(ptr.get()),
-                  0,
-                  reinterpret_cast<bool*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-
-        if (other_format.compare("d") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromdouble(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<double*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("f") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromfloat(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<float*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-        else if (other_format.compare("q") == 0) {
-#else
-        else if (other_format.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("Q") == 0) {
-#else
-          else if (other_format.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU64(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("l") == 0) {
-#else
-          else if (other_format.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_from32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("L") == 0) {
-#else
-          else if (other_format.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_todouble_fromU32(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("h") == 0) {
-          err = awkward_numpyarray_fill_todouble_from16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("H") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU16(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("b") == 0) {
-          err = awkward_numpyarray_fill_todouble_from8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("B") == 0  ||
-                 format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_todouble_fromU8(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("?") == 0) {
-          err = awkward_numpyarray_fill_todouble_frombool(
-                  reinterpret_cast<double*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<bool*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-      }
-
-      else if (format.compare("Q") == 0  ||  format.compare("L") == 0) {
-        err = awkward_numpyarray_fill_toU64_fromU64(
-                reinterpret_cast<uint64_t*>(ptr.get()),
-                0,
-                reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                self_offset,
-                self_flatlength);
-        util::handle_error(err, classname(), nullptr);
-        err = awkward_numpyarray_fill_toU64_fromU64(
-                reinterpret_cast<uint64_t*>(ptr.get()),
-                self_flatlength,
-                reinterpret_cast<uint64_t*>(contiguous_other.ptr().get()),
-                other_offset,
-                other_flatlength);
-        util::handle_error(err, classname(), nullptr);
-      }
-
-      else if (itemsize == 8) {
-#if defined _MSC_VER || defined __i386__
-        if (format_.compare("q") == 0) {
-#else
-        if (format_.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("Q") == 0) {
-#else
-          else if (format_.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("l") == 0) {
-#else
-          else if (format_.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (format_.compare("L") == 0) {
-#else
-          else if (format_.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint32_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("h") == 0) {
-          err = awkward_numpyarray_fill_to64_from16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("H") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint16_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("b") == 0) {
-          err = awkward_numpyarray_fill_to64_from8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<int8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<uint8_t*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else if (format_.compare("?") == 0) {
-          err = awkward_numpyarray_fill_to64_frombool(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  0,
-                  reinterpret_cast<bool*>(contiguous_self.ptr().get()),
-                  self_offset,
-                  self_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-
-#if defined _MSC_VER || defined __i386__
-        if (other_format.compare("q") == 0) {
-#else
-        if (other_format.compare("l") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("Q") == 0) {
-#else
-          else if (other_format.compare("L") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU64(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint64_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("l") == 0) {
-#else
-          else if (other_format.compare("i") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_from32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-#if defined _MSC_VER || defined __i386__
-          else if (other_format.compare("L") == 0) {
-#else
-          else if (other_format.compare("I") == 0) {
-#endif
-          err = awkward_numpyarray_fill_to64_fromU32(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint32_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("h") == 0) {
-          err = awkward_numpyarray_fill_to64_from16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("H") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU16(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint16_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("b") == 0) {
-          err = awkward_numpyarray_fill_to64_from8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<int8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("B") == 0  ||
-                 format_.compare("c") == 0) {
-          err = awkward_numpyarray_fill_to64_fromU8(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<uint8_t*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else if (other_format.compare("?") == 0) {
-          err = awkward_numpyarray_fill_to64_frombool(
-                  reinterpret_cast<int64_t*>(ptr.get()),
-                  self_flatlength,
-                  reinterpret_cast<bool*>(contiguous_other.ptr().get()),
-                  other_offset,
-                  other_flatlength);
-        }
-        else {
-          throw std::invalid_argument(
-            std::string("cannot merge Numpy format \"") + format_
-            + std::string("\" with \"") + other_format + std::string("\""));
-        }
-        util::handle_error(err, classname(), nullptr);
-      }
-
-      else {
-        err = awkward_numpyarray_fill_tobool_frombool(
-                reinterpret_cast<bool*>(ptr.get()),
-                0,
-                reinterpret_cast<bool*>(contiguous_self.ptr().get()),
-                self_offset,
-                self_flatlength);
-        util::handle_error(err, classname(), nullptr);
-        err = awkward_numpyarray_fill_tobool_frombool(
-                reinterpret_cast<bool*>(ptr.get()),
-                self_flatlength,
-                reinterpret_cast<bool*>(contiguous_other.ptr().get()),
-                other_offset,
-                other_flatlength);
-        util::handle_error(err, classname(), nullptr);
-      }
+      fill_as(format, ptr, 0);
+      rawother->fill_as(format, ptr, self_flatlength);
 
       return std::make_shared<NumpyArray>(Identities::none(),
                                           parameters_,
@@ -2178,8 +2068,10 @@ namespace awkward {
 
   const ContentPtr
   NumpyArray::merge_bytes(const std::shared_ptr<NumpyArray>& other) const {
-    NumpyArray contiguous_self = contiguous();
-    NumpyArray contiguous_other = other.get()->contiguous();
+    int64_t self_stride;
+    NumpyArray flat_self = flatstrided(self_stride);
+    int64_t other_stride;
+    NumpyArray flat_other = other.get()->flatstrided(other_stride);
 
     std::shared_ptr<void> ptr(
       new uint8_t[(size_t)(length() + other.get()->length())],
@@ -2190,17 +2082,19 @@ namespace awkward {
     err = awkward_numpyarray_fill_tobyte_frombyte(
             reinterpret_cast<int8_t*>(ptr.get()),
             0,
-            reinterpret_cast<int8_t*>(contiguous_self.ptr().get()),
-            (int64_t)contiguous_self.byteoffset(),
-            contiguous_self.length());
+            reinterpret_cast<int8_t*>(flat_self.ptr().get()),
+            (int64_t)flat_self.byteoffset(),
+            self_stride,
+            flat_self.length());
     util::handle_error(err, classname(), nullptr);
 
     err = awkward_numpyarray_fill_tobyte_frombyte(
             reinterpret_cast<int8_t*>(ptr.get()),
             length(),
-            reinterpret_cast<int8_t*>(contiguous_other.ptr().get()),
-            (int64_t)contiguous_other.byteoffset(),
-            contiguous_other.length());
+            reinterpret_cast<int8_t*>(flat_other.ptr().get()),
+            (int64_t)flat_other.byteoffset(),
+            other_stride,
+            flat_other.length());
     util::handle_error(err, classname(), nullptr);
 
     std::vector<ssize_t> shape({ (ssize_t)(length() + other.get()->length()) });
@@ -2215,6 +2109,395 @@ namespace awkward {
                                         format_);
   }
 
+  /// @brief The fill kernels that convert every format to one type, `TO`.
+  template <typename TO>
+  struct FillKernels {
+    template <typename FROM>
+    using Kernel = struct Error (*)(TO*,
+                                    int64_t,
+                                    const FROM*,
+                                    int64_t,
+                                    int64_t,
+                                    int64_t);
+    Kernel<bool> frombool;
+    Kernel<int8_t> from8;
+    Kernel<uint8_t> fromU8;
+    Kernel<int16_t> from16;
+    Kernel<uint16_t> fromU16;
+    Kernel<int32_t> from32;
+    Kernel<uint32_t> fromU32;
+    Kernel<int64_t> from64;
+    Kernel<uint64_t> fromU64;
+    Kernel<uint16_t> fromhalf;
+    Kernel<float> fromfloat;
+    Kernel<double> fromdouble;
+  };
+
+  template <typename TO, typename FROM>
+  struct Error
+  fill_with(typename FillKernels<TO>::template Kernel<FROM> kernel,
+            const std::shared_ptr<void>& toptr,
+            int64_t tooffset,
+            const std::shared_ptr<void>& fromptr,
+            int64_t fromoffset,
+            int64_t fromstride,
+            int64_t length) {
+    return kernel(reinterpret_cast<TO*>(toptr.get()),
+                  tooffset,
+                  reinterpret_cast<FROM*>(fromptr.get()),
+                  fromoffset,
+                  fromstride,
+                  length);
+  }
+
+  template <typename TO>
+  struct Error
+  fill_with(const FillKernels<TO>& kernels,
+            const std::string& fromformat,
+            const std::string& format,
+            const std::shared_ptr<void>& toptr,
+            int64_t tooffset,
+            const std::shared_ptr<void>& fromptr,
+            int64_t fromoffset,
+            int64_t fromstride,
+            int64_t length) {
+    if (fromformat.compare("?") == 0) {
+      return fill_with<TO, bool>(
+        kernels.frombool,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else if (fromformat.compare("b") == 0) {
+      return fill_with<TO, int8_t>(
+        kernels.from8,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else if (fromformat.compare("B") == 0  ||
+             fromformat.compare("c") == 0) {
+      return fill_with<TO, uint8_t>(
+        kernels.fromU8,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else if (fromformat.compare("h") == 0) {
+      return fill_with<TO, int16_t>(
+        kernels.from16,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else if (fromformat.compare("H") == 0) {
+      return fill_with<TO, uint16_t>(
+        kernels.fromU16,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (fromformat.compare("l") == 0) {
+#else
+    else if (fromformat.compare("i") == 0) {
+#endif
+      return fill_with<TO, int32_t>(
+        kernels.from32,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (fromformat.compare("L") == 0) {
+#else
+    else if (fromformat.compare("I") == 0) {
+#endif
+      return fill_with<TO, uint32_t>(
+        kernels.fromU32,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (fromformat.compare("q") == 0) {
+#else
+    else if (fromformat.compare("l") == 0) {
+#endif
+      return fill_with<TO, int64_t>(
+        kernels.from64,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (fromformat.compare("Q") == 0) {
+#else
+    else if (fromformat.compare("L") == 0) {
+#endif
+      return fill_with<TO, uint64_t>(
+        kernels.fromU64,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else if (fromformat.compare("e") == 0) {
+      return fill_with<TO, uint16_t>(
+        kernels.fromhalf,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else if (fromformat.compare("f") == 0) {
+      return fill_with<TO, float>(
+        kernels.fromfloat,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else if (fromformat.compare("d") == 0) {
+      return fill_with<TO, double>(
+        kernels.fromdouble,
+        toptr, tooffset, fromptr, fromoffset, fromstride, length);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot convert Numpy format \"") + fromformat
+        + std::string("\" to \"") + format + std::string("\""));
+    }
+  }
+
+  void
+  NumpyArray::fill_as(const std::string& format,
+                      const std::shared_ptr<void>& toptr,
+                      int64_t tooffset) const {
+    int64_t stride;
+    NumpyArray flat = flatstrided(stride);
+    int64_t offset = (int64_t)flat.byteoffset() / (int64_t)itemsize_;
+    int64_t length = 1;
+    for (auto x : shape_) {
+      length *= (int64_t)x;
+    }
+
+    struct Error err;
+    if (format.compare("d") == 0) {
+      FillKernels<double> kernels = {
+        awkward_numpyarray_fill_todouble_frombool,
+        awkward_numpyarray_fill_todouble_from8,
+        awkward_numpyarray_fill_todouble_fromU8,
+        awkward_numpyarray_fill_todouble_from16,
+        awkward_numpyarray_fill_todouble_fromU16,
+        awkward_numpyarray_fill_todouble_from32,
+        awkward_numpyarray_fill_todouble_fromU32,
+        awkward_numpyarray_fill_todouble_from64,
+        awkward_numpyarray_fill_todouble_fromU64,
+        awkward_numpyarray_fill_todouble_fromhalf,
+        awkward_numpyarray_fill_todouble_fromfloat,
+        awkward_numpyarray_fill_todouble_fromdouble
+      };
+      err = fill_with<double>(kernels, format_, format, toptr, tooffset,
+                              flat.ptr(), offset, stride, length);
+    }
+    else if (format.compare("f") == 0) {
+      FillKernels<float> kernels = {
+        awkward_numpyarray_fill_tofloat_frombool,
+        awkward_numpyarray_fill_tofloat_from8,
+        awkward_numpyarray_fill_tofloat_fromU8,
+        awkward_numpyarray_fill_tofloat_from16,
+        awkward_numpyarray_fill_tofloat_fromU16,
+        awkward_numpyarray_fill_tofloat_from32,
+        awkward_numpyarray_fill_tofloat_fromU32,
+        awkward_numpyarray_fill_tofloat_from64,
+        awkward_numpyarray_fill_tofloat_fromU64,
+        awkward_numpyarray_fill_tofloat_fromhalf,
+        awkward_numpyarray_fill_tofloat_fromfloat,
+        awkward_numpyarray_fill_tofloat_fromdouble
+      };
+      err = fill_with<float>(kernels, format_, format, toptr, tooffset,
+                             flat.ptr(), offset, stride, length);
+    }
+    else if (format.compare("e") == 0) {
+      FillKernels<uint16_t> kernels = {
+        awkward_numpyarray_fill_tohalf_frombool,
+        awkward_numpyarray_fill_tohalf_from8,
+        awkward_numpyarray_fill_tohalf_fromU8,
+        awkward_numpyarray_fill_tohalf_from16,
+        awkward_numpyarray_fill_tohalf_fromU16,
+        awkward_numpyarray_fill_tohalf_from32,
+        awkward_numpyarray_fill_tohalf_fromU32,
+        awkward_numpyarray_fill_tohalf_from64,
+        awkward_numpyarray_fill_tohalf_fromU64,
+        awkward_numpyarray_fill_tohalf_fromhalf,
+        awkward_numpyarray_fill_tohalf_fromfloat,
+        awkward_numpyarray_fill_tohalf_fromdouble
+      };
+      err = fill_with<uint16_t>(kernels, format_, format, toptr, tooffset,
+                                flat.ptr(), offset, stride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("q") == 0) {
+#else
+    else if (format.compare("l") == 0) {
+#endif
+      FillKernels<int64_t> kernels = {
+        awkward_numpyarray_fill_to64_frombool,
+        awkward_numpyarray_fill_to64_from8,
+        awkward_numpyarray_fill_to64_fromU8,
+        awkward_numpyarray_fill_to64_from16,
+        awkward_numpyarray_fill_to64_fromU16,
+        awkward_numpyarray_fill_to64_from32,
+        awkward_numpyarray_fill_to64_fromU32,
+        awkward_numpyarray_fill_to64_from64,
+        awkward_numpyarray_fill_to64_fromU64,
+        awkward_numpyarray_fill_to64_fromhalf,
+        awkward_numpyarray_fill_to64_fromfloat,
+        awkward_numpyarray_fill_to64_fromdouble
+      };
+      err = fill_with<int64_t>(kernels, format_, format, toptr, tooffset,
+                               flat.ptr(), offset, stride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("Q") == 0) {
+#else
+    else if (format.compare("L") == 0) {
+#endif
+      FillKernels<uint64_t> kernels = {
+        awkward_numpyarray_fill_toU64_frombool,
+        awkward_numpyarray_fill_toU64_from8,
+        awkward_numpyarray_fill_toU64_fromU8,
+        awkward_numpyarray_fill_toU64_from16,
+        awkward_numpyarray_fill_toU64_fromU16,
+        awkward_numpyarray_fill_toU64_from32,
+        awkward_numpyarray_fill_toU64_fromU32,
+        awkward_numpyarray_fill_toU64_from64,
+        awkward_numpyarray_fill_toU64_fromU64,
+        awkward_numpyarray_fill_toU64_fromhalf,
+        awkward_numpyarray_fill_toU64_fromfloat,
+        awkward_numpyarray_fill_toU64_fromdouble
+      };
+      err = fill_with<uint64_t>(kernels, format_, format, toptr, tooffset,
+                                flat.ptr(), offset, stride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("l") == 0) {
+#else
+    else if (format.compare("i") == 0) {
+#endif
+      FillKernels<int32_t> kernels = {
+        awkward_numpyarray_fill_to32_frombool,
+        awkward_numpyarray_fill_to32_from8,
+        awkward_numpyarray_fill_to32_fromU8,
+        awkward_numpyarray_fill_to32_from16,
+        awkward_numpyarray_fill_to32_fromU16,
+        awkward_numpyarray_fill_to32_from32,
+        awkward_numpyarray_fill_to32_fromU32,
+        awkward_numpyarray_fill_to32_from64,
+        awkward_numpyarray_fill_to32_fromU64,
+        awkward_numpyarray_fill_to32_fromhalf,
+        awkward_numpyarray_fill_to32_fromfloat,
+        awkward_numpyarray_fill_to32_fromdouble
+      };
+      err = fill_with<int32_t>(kernels, format_, format, toptr, tooffset,
+                               flat.ptr(), offset, stride, length);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format.compare("L") == 0) {
+#else
+    else if (format.compare("I") == 0) {
+#endif
+      FillKernels<uint32_t> kernels = {
+        awkward_numpyarray_fill_toU32_frombool,
+        awkward_numpyarray_fill_toU32_from8,
+        awkward_numpyarray_fill_toU32_fromU8,
+        awkward_numpyarray_fill_toU32_from16,
+        awkward_numpyarray_fill_toU32_fromU16,
+        awkward_numpyarray_fill_toU32_from32,
+        awkward_numpyarray_fill_toU32_fromU32,
+        awkward_numpyarray_fill_toU32_from64,
+        awkward_numpyarray_fill_toU32_fromU64,
+        awkward_numpyarray_fill_toU32_fromhalf,
+        awkward_numpyarray_fill_toU32_fromfloat,
+        awkward_numpyarray_fill_toU32_fromdouble
+      };
+      err = fill_with<uint32_t>(kernels, format_, format, toptr, tooffset,
+                                flat.ptr(), offset, stride, length);
+    }
+    else if (format.compare("h") == 0) {
+      FillKernels<int16_t> kernels = {
+        awkward_numpyarray_fill_to16_frombool,
+        awkward_numpyarray_fill_to16_from8,
+        awkward_numpyarray_fill_to16_fromU8,
+        awkward_numpyarray_fill_to16_from16,
+        awkward_numpyarray_fill_to16_fromU16,
+        awkward_numpyarray_fill_to16_from32,
+        awkward_numpyarray_fill_to16_fromU32,
+        awkward_numpyarray_fill_to16_from64,
+        awkward_numpyarray_fill_to16_fromU64,
+        awkward_numpyarray_fill_to16_fromhalf,
+        awkward_numpyarray_fill_to16_fromfloat,
+        awkward_numpyarray_fill_to16_fromdouble
+      };
+      err = fill_with<int16_t>(kernels, format_, format, toptr, tooffset,
+                               flat.ptr(), offset, stride, length);
+    }
+    else if (format.compare("H") == 0) {
+      FillKernels<uint16_t> kernels = {
+        awkward_numpyarray_fill_toU16_frombool,
+        awkward_numpyarray_fill_toU16_from8,
+        awkward_numpyarray_fill_toU16_fromU8,
+        awkward_numpyarray_fill_toU16_from16,
+        awkward_numpyarray_fill_toU16_fromU16,
+        awkward_numpyarray_fill_toU16_from32,
+        awkward_numpyarray_fill_toU16_fromU32,
+        awkward_numpyarray_fill_toU16_from64,
+        awkward_numpyarray_fill_toU16_fromU64,
+        awkward_numpyarray_fill_toU16_fromhalf,
+        awkward_numpyarray_fill_toU16_fromfloat,
+        awkward_numpyarray_fill_toU16_fromdouble
+      };
+      err = fill_with<uint16_t>(kernels, format_, format, toptr, tooffset,
+                                flat.ptr(), offset, stride, length);
+    }
+    else if (format.compare("b") == 0) {
+      FillKernels<int8_t> kernels = {
+        awkward_numpyarray_fill_to8_frombool,
+        awkward_numpyarray_fill_to8_from8,
+        awkward_numpyarray_fill_to8_fromU8,
+        awkward_numpyarray_fill_to8_from16,
+        awkward_numpyarray_fill_to8_fromU16,
+        awkward_numpyarray_fill_to8_from32,
+        awkward_numpyarray_fill_to8_fromU32,
+        awkward_numpyarray_fill_to8_from64,
+        awkward_numpyarray_fill_to8_fromU64,
+        awkward_numpyarray_fill_to8_fromhalf,
+        awkward_numpyarray_fill_to8_fromfloat,
+        awkward_numpyarray_fill_to8_fromdouble
+      };
+      err = fill_with<int8_t>(kernels, format_, format, toptr, tooffset,
+                              flat.ptr(), offset, stride, length);
+    }
+    else if (format.compare("B") == 0) {
+      FillKernels<uint8_t> kernels = {
+        awkward_numpyarray_fill_toU8_frombool,
+        awkward_numpyarray_fill_toU8_from8,
+        awkward_numpyarray_fill_toU8_fromU8,
+        awkward_numpyarray_fill_toU8_from16,
+        awkward_numpyarray_fill_toU8_fromU16,
+        awkward_numpyarray_fill_toU8_from32,
+        awkward_numpyarray_fill_toU8_fromU32,
+        awkward_numpyarray_fill_toU8_from64,
+        awkward_numpyarray_fill_toU8_fromU64,
+        awkward_numpyarray_fill_toU8_fromhalf,
+        awkward_numpyarray_fill_toU8_fromfloat,
+        awkward_numpyarray_fill_toU8_fromdouble
+      };
+      err = fill_with<uint8_t>(kernels, format_, format, toptr, tooffset,
+                               flat.ptr(), offset, stride, length);
+    }
+    else if (format.compare("?") == 0) {
+      FillKernels<bool> kernels = {
+        awkward_numpyarray_fill_tobool_frombool,
+        awkward_numpyarray_fill_tobool_from8,
+        awkward_numpyarray_fill_tobool_fromU8,
+        awkward_numpyarray_fill_tobool_from16,
+        awkward_numpyarray_fill_tobool_fromU16,
+        awkward_numpyarray_fill_tobool_from32,
+        awkward_numpyarray_fill_tobool_fromU32,
+        awkward_numpyarray_fill_tobool_from64,
+        awkward_numpyarray_fill_tobool_fromU64,
+        awkward_numpyarray_fill_tobool_fromhalf,
+        awkward_numpyarray_fill_tobool_fromfloat,
+        awkward_numpyarray_fill_tobool_fromdouble
+      };
+      err = fill_with<bool>(kernels, format_, format, toptr, tooffset,
+                            flat.ptr(), offset, stride, length);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot convert Numpy format \"") + format_
+        + std::string("\" to \"") + format + std::string("\""));
+    }
+    util::handle_error(err, classname(), identities_.get());
+  }
+
   const SliceItemPtr
   NumpyArray::asslice() const {
     if (ndim() != 1) {
@@ -2250,83 +2533,12 @@ namespace awkward {
              format_.compare("b") == 0  ||
              format_.compare("B") == 0  ||
              format_.compare("c") == 0) {
-      NumpyArray contiguous_self = contiguous();
-      int64_t offset = ((int64_t)contiguous_self.byteoffset() /
-                        (int64_t)itemsize_);
       Index64 index(length());
-      struct Error err;
-#if defined _MSC_VER || defined __i386__
-      if (format_.compare("Q") == 0) {
-#else
-      if (format_.compare("L") == 0) {
-#endif
-        err = awkward_numpyarray_fill_to64_fromU64(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint64_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-#if defined _MSC_VER || defined __i386__
-      else if (format_.compare("l") == 0) {
-#else
-      else if (format_.compare("i") == 0) {
-#endif
-        err = awkward_numpyarray_fill_to64_from32(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<int32_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
 #if defined _MSC_VER || defined __i386__
-      else if (format_.compare("L") == 0) {
+      fill_as("q", index.ptr(), 0);
 #else
-      else if (format_.compare("I") == 0) {
+      fill_as("l", index.ptr(), 0);
 #endif
-        err = awkward_numpyarray_fill_to64_fromU32(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint32_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("h") == 0) {
-        err = awkward_numpyarray_fill_to64_from16(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<int16_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("H") == 0) {
-        err = awkward_numpyarray_fill_to64_fromU16(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint16_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("b") == 0) {
-        err = awkward_numpyarray_fill_to64_from8(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<int8_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
-        err = awkward_numpyarray_fill_to64_fromU8(
-                index.ptr().get(),
-                0,
-                reinterpret_cast<uint8_t*>(contiguous_self.ptr().get()),
-                offset,
-                length());
-      }
-      else {
-        throw std::runtime_error("oops: check format_.compare cases above");
-      }
-      util::handle_error(err, classname(), identities_.get());
 
       std::vector<int64_t> shape({ (int64_t)shape_[0] });
       std::vector<int64_t> strides({ 1 });
@@ -2414,7 +2626,34 @@ namespace awkward {
     if (shape_.empty()) {
       throw std::runtime_error("attempting to reduce a scalar");
     }
+    else if (format_.compare("e") == 0) {
+      // half precision is reduced in single precision, widened in one pass
+      return astype("f").get()->reduce_next(reducer,
+                                            negaxis,
+                                            starts,
+                                            parents,
+                                            outlength,
+                                            mask,
+                                            keepdims);
+    }
     else if (shape_.size() != 1  ||  !iscontiguous()) {
+      // Reduce in place by walking the strides, unless the axis groups the
+      // first dimension by parents, which needs the general algorithm.
+      int64_t axis = (int64_t)shape_.size() - negaxis;
+      bool stridesinitems = (byteoffset_ % itemsize_ == 0);
+      for (auto x : strides_) {
+        stridesinitems = stridesinitems  &&  (x % itemsize_ == 0);
+      }
+      if (stridesinitems  &&
+          0 <= axis  &&  axis < (int64_t)shape_.size()  &&
+          (axis != 0  ||  outlength == 1)) {
+        return reduce_next_strided(reducer,
+                                   axis,
+                                   parents,
+                                   outlength,
+                                   mask,
+                                   keepdims);
+      }
       return toRegularArray().get()->reduce_next(reducer,
                                                  negaxis,
                                                  starts,
@@ -2564,6 +2803,242 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  NumpyArray::reduce_next_strided(const Reducer& reducer,
+                                  int64_t axis,
+                                  const Index64& parents,
+                                  int64_t outlength,
+                                  bool mask,
+                                  bool keepdims) const {
+    int64_t ndim = (int64_t)shape_.size();
+    std::vector<ssize_t> strides;
+    int64_t reducedlength = 1;
+    for (int64_t i = 0;  i < ndim;  i++) {
+      strides.push_back(strides_[(size_t)i] / itemsize_);
+      if (i != axis) {
+        reducedlength *= (int64_t)shape_[(size_t)i];
+      }
+    }
+
+    std::shared_ptr<void> ptr;
+    if (format_.compare("?") == 0) {
+      ptr = reducer.apply_strided_bool(
+        reinterpret_cast<bool*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+    else if (format_.compare("b") == 0) {
+      ptr = reducer.apply_strided_int8(
+        reinterpret_cast<int8_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+    else if (format_.compare("B") == 0  ||  format_.compare("c") == 0) {
+      ptr = reducer.apply_strided_uint8(
+        reinterpret_cast<uint8_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+    else if (format_.compare("h") == 0) {
+      ptr = reducer.apply_strided_int16(
+        reinterpret_cast<int16_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+    else if (format_.compare("H") == 0) {
+      ptr = reducer.apply_strided_uint16(
+        reinterpret_cast<uint16_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("l") == 0) {
+#else
+    else if (format_.compare("i") == 0) {
+#endif
+      ptr = reducer.apply_strided_int32(
+        reinterpret_cast<int32_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("L") == 0) {
+#else
+    else if (format_.compare("I") == 0) {
+#endif
+      ptr = reducer.apply_strided_uint32(
+        reinterpret_cast<uint32_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("q") == 0) {
+#else
+    else if (format_.compare("l") == 0) {
+#endif
+      ptr = reducer.apply_strided_int64(
+        reinterpret_cast<int64_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+#if defined _MSC_VER || defined __i386__
+    else if (format_.compare("Q") == 0) {
+#else
+    else if (format_.compare("L") == 0) {
+#endif
+      ptr = reducer.apply_strided_uint64(
+        reinterpret_cast<uint64_t*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+    else if (format_.compare("f") == 0) {
+      ptr = reducer.apply_strided_float32(
+        reinterpret_cast<float*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+    else if (format_.compare("d") == 0) {
+      ptr = reducer.apply_strided_float64(
+        reinterpret_cast<double*>(ptr_.get()),
+        byteoffset_ / itemsize_,
+        shape_,
+        strides,
+        axis,
+        reducedlength);
+    }
+    else {
+      throw std::invalid_argument(
+        std::string("cannot apply reducers to NumpyArray with format \"")
+        + format_ + std::string("\""));
+    }
+
+    std::string format = reducer.return_type(format_);
+    ssize_t itemsize = reducer.return_typesize(format_);
+    std::vector<ssize_t> outshape({ (ssize_t)reducedlength });
+    std::vector<ssize_t> outstrides({ itemsize });
+    ContentPtr out = std::make_shared<NumpyArray>(Identities::none(),
+                                                  util::Parameters(),
+                                                  ptr,
+                                                  outshape,
+                                                  outstrides,
+                                                  0,
+                                                  itemsize,
+                                                  format);
+
+    if (mask) {
+      Index8 bytemask(reducedlength);
+      struct Error err =
+        awkward_numpyarray_reduce_mask_strided_bytemaskedarray(
+        bytemask.ptr().get(),
+        reducedlength,
+        (int64_t)shape_[(size_t)axis]);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ByteMaskedArray>(Identities::none(),
+                                              util::Parameters(),
+                                              bytemask,
+                                              out,
+                                              false);
+    }
+
+    // Dimensions inside the reduced one are wrapped the way
+    // ListOffsetArray's nonlocal reduction wraps them: as ListOffsetArray64s,
+    // all empty if the reduced dimension has no items.
+    int64_t outerlength = 1;
+    for (int64_t i = 0;  i < axis;  i++) {
+      outerlength *= (int64_t)shape_[(size_t)i];
+    }
+    for (int64_t i = ndim - 1;  i > axis;  i--) {
+      int64_t length = outerlength;
+      for (int64_t j = axis + 1;  j < i;  j++) {
+        length *= (int64_t)shape_[(size_t)j];
+      }
+      bool empty = (i == axis + 1  &&  shape_[(size_t)axis] == 0);
+      Index64 offsets(length + 1);
+      struct Error err = awkward_regulararray_compact_offsets64(
+        offsets.ptr().get(),
+        length,
+        empty ? 0 : (int64_t)shape_[(size_t)i]);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                util::Parameters(),
+                                                offsets,
+                                                out);
+    }
+
+    if (keepdims) {
+      out = std::make_shared<RegularArray>(Identities::none(),
+                                           util::Parameters(),
+                                           out,
+                                           1);
+    }
+
+    // Dimensions outside the reduced one are wrapped the way
+    // ListOffsetArray's local reduction wraps them, with the first grouped
+    // by parents.
+    for (int64_t i = axis - 1;  i > 0;  i--) {
+      int64_t length = 1;
+      for (int64_t j = 0;  j < i;  j++) {
+        length *= (int64_t)shape_[(size_t)j];
+      }
+      Index64 offsets(length + 1);
+      struct Error err = awkward_regulararray_compact_offsets64(
+        offsets.ptr().get(),
+        length,
+        (int64_t)shape_[(size_t)i]);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                util::Parameters(),
+                                                offsets,
+                                                out);
+    }
+    if (axis > 0) {
+      Index64 outoffsets(outlength + 1);
+      struct Error err = awkward_listoffsetarray_reduce_local_outoffsets_64(
+        outoffsets.ptr().get(),
+        parents.ptr().get(),
+        parents.offset(),
+        parents.length(),
+        outlength);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ListOffsetArray64>(Identities::none(),
+                                                util::Parameters(),
+                                                outoffsets,
+                                                out);
+    }
+
+    return out;
+  }
+
   const ContentPtr
   NumpyArray::localindex(int64_t axis, int64_t depth) const {
     int64_t toaxis = axis_wrap_if_negative(axis);
@@ -2608,6 +3083,20 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  NumpyArray::packed() const {
+    if (isscalar()) {
+      return shallow_copy();
+    }
+    Index64 bytepos(shape_[0]);
+    struct Error err =
+      awkward_numpyarray_contiguous_init_64(bytepos.ptr().get(),
+                                            shape_[0],
+                                            strides_[0]);
+    util::handle_error(err, classname(), identities_.get());
+    return contiguous_next(bytepos).shallow_copy();
+  }
+
   const ContentPtr
   NumpyArray::getitem_next(const SliceAt& at,
                            const Slice& tail,
@@ -2753,6 +3242,42 @@ namespace awkward {
     }
   }
 
+  const NumpyArray
+  NumpyArray::flatstrided(int64_t& itemstride) const {
+    // dimensions of length 1 can have any stride; the single stride is
+    // that of the innermost dimension that is longer than 1
+    bool flat = (!isscalar()  &&  byteoffset_ % itemsize_ == 0);
+    ssize_t step = itemsize_;
+    ssize_t x = 0;
+    bool found = false;
+    for (ssize_t i = ndim() - 1;  flat  &&  i >= 0;  i--) {
+      if (shape_[(size_t)i] > 1) {
+        if (!found) {
+          step = strides_[(size_t)i];
+          x = step;
+          found = true;
+        }
+        flat = (strides_[(size_t)i] == x);
+        x *= shape_[(size_t)i];
+      }
+    }
+    if (flat  &&  step % itemsize_ == 0) {
+      itemstride = (int64_t)(step / itemsize_);
+      return NumpyArray(identities_,
+                        parameters_,
+                        ptr_,
+                        shape_,
+                        strides_,
+                        byteoffset_,
+                        itemsize_,
+                        format_);
+    }
+    else {
+      itemstride = 1;
+      return contiguous();
+    }
+  }
+
   const NumpyArray
   NumpyArray::contiguous_next(const Index64& bytepos) const {
     if (iscontiguous()) {
@@ -3651,7 +4176,16 @@ namespace awkward {
     }
     else if (ndim() == 1) {
       char* array = reinterpret_cast<char*>(byteptr());
-      builder.string(array, length());
+      if (strides_[0] == 1) {
+        builder.string(array, length());
+      }
+      else {
+        std::string gathered((size_t)length(), '\0');
+        for (int64_t i = 0;  i < length();  i++) {
+          gathered[(size_t)i] = array[i*strides_[0]];
+        }
+        builder.string(gathered.c_str(), length());
+      }
     }
     else {
       const std::vector<ssize_t> shape(shape_.begin() + 1, shape_.end());
@@ -0,0 +1,665 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/identities.h"
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/cpu-kernels/reducers.h"
+#include "awkward/Reducer.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/array/ByteMaskedArray.h"
+#include "awkward/array/RegularArray.h"
+#include "awkward/util.h"
+
+#include "awkward/array/QuantizedArray.h"
+
+namespace awkward {
+  QuantizedArray::QuantizedArray(const IdentitiesPtr& identities,
+                                 const util::Parameters& parameters,
+                                 const ContentPtr& data,
+                                 double scale,
+                                 double offset)
+      : Content(identities, parameters)
+      , data_(data)
+      , scale_(scale)
+      , offset_(offset) {
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(data.get());
+    std::string format = (raw == nullptr ? std::string("") : raw->format());
+    if (raw == nullptr  ||  raw->ndim() != 1  ||
+        !(format.compare("b") == 0  ||  format.compare("B") == 0  ||
+          format.compare("h") == 0  ||  format.compare("H") == 0  ||
+          format.compare("i") == 0  ||  format.compare("I") == 0  ||
+          format.compare("l") == 0  ||  format.compare("L") == 0  ||
+          format.compare("q") == 0  ||  format.compare("Q") == 0)) {
+      throw std::invalid_argument(
+        "QuantizedArray data must be a one-dimensional NumpyArray of "
+        "integers");
+    }
+  }
+
+  const ContentPtr
+  QuantizedArray::data() const {
+    return data_;
+  }
+
+  double
+  QuantizedArray::scale() const {
+    return scale_;
+  }
+
+  double
+  QuantizedArray::offset() const {
+    return offset_;
+  }
+
+  const ContentPtr
+  QuantizedArray::toNumpyArray() const {
+    ContentPtr widened =
+      dynamic_cast<NumpyArray*>(data_.get())->astype("d");
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(widened.get());
+    double* ptr = reinterpret_cast<double*>(raw->ptr().get());
+    struct Error err = awkward_quantizedarray_dequantize(
+      ptr,
+      ptr,
+      raw->length(),
+      scale_,
+      offset_);
+    util::handle_error(err, classname(), identities_.get());
+    return std::make_shared<NumpyArray>(identities_,
+                                        parameters_,
+                                        raw->ptr(),
+                                        raw->shape(),
+                                        raw->strides(),
+                                        0,
+                                        8,
+                                        "d");
+  }
+
+  const ContentPtr
+  QuantizedArray::array() const {
+    return toNumpyArray();
+  }
+
+  const std::string
+  QuantizedArray::classname() const {
+    return "QuantizedArray";
+  }
+
+  void
+  QuantizedArray::setidentities() {
+    if (length() <= kMaxInt32) {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities32>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities32* rawidentities =
+        reinterpret_cast<Identities32*>(newidentities.get());
+      struct Error err = awkward_new_identities32(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+    else {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities64>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities64* rawidentities =
+        reinterpret_cast<Identities64*>(newidentities.get());
+      struct Error err = awkward_new_identities64(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+  }
+
+  void
+  QuantizedArray::setidentities(const IdentitiesPtr& identities) {
+    if (identities.get() != nullptr  &&
+        length() != identities.get()->length()) {
+      util::handle_error(
+        failure("content and its identities must have the same length",
+                kSliceNone,
+                kSliceNone),
+        classname(),
+        identities_.get());
+    }
+    identities_ = identities;
+  }
+
+  const TypePtr
+  QuantizedArray::type(const util::TypeStrs& typestrs) const {
+    return form(true).get()->type(typestrs);
+  }
+
+  const FormPtr
+  QuantizedArray::form(bool materialize) const {
+    QuantizedArray empty(identities_.get() == nullptr
+                             ? identities_
+                             : identities_.get()->getitem_range_nowrap(0, 0),
+                         parameters_,
+                         data_.get()->getitem_range_nowrap(0, 0),
+                         scale_,
+                         offset_);
+    return empty.toNumpyArray().get()->form(materialize);
+  }
+
+  bool
+  QuantizedArray::has_virtual_form() const {
+    return false;
+  }
+
+  bool
+  QuantizedArray::has_virtual_length() const {
+    return false;
+  }
+
+  const std::string
+  QuantizedArray::tostring_part(const std::string& indent,
+                                const std::string& pre,
+                                const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<" << classname() << " scale=\"" << scale_
+        << "\" offset=\"" << offset_ << "\">\n";
+    if (identities_.get() != nullptr) {
+      out << identities_.get()->tostring_part(
+               indent + std::string("    "), "", "\n");
+    }
+    if (!parameters_.empty()) {
+      out << parameters_tostring(indent + std::string("    "), "", "\n");
+    }
+    out << data_.get()->tostring_part(
+             indent + std::string("    "), "<data>", "</data>\n");
+    out << indent << "</" << classname() << ">" << post;
+    return out.str();
+  }
+
+  void
+  QuantizedArray::tojson_part(ToJson& builder,
+                              bool include_beginendlist) const {
+    toNumpyArray().get()->tojson_part(builder, include_beginendlist);
+  }
+
+  void
+  QuantizedArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
+    data_.get()->nbytes_part(largest);
+    if (identities_.get() != nullptr) {
+      identities_.get()->nbytes_part(largest);
+    }
+  }
+
+  void
+  QuantizedArray::fingerprint_part(uint64_t& hash) const {
+    toNumpyArray().get()->fingerprint_part(hash);
+  }
+
+  int64_t
+  QuantizedArray::length() const {
+    return data_.get()->length();
+  }
+
+  const ContentPtr
+  QuantizedArray::shallow_copy() const {
+    return std::make_shared<QuantizedArray>(identities_,
+                                            parameters_,
+                                            data_,
+                                            scale_,
+                                            offset_);
+  }
+
+  const ContentPtr
+  QuantizedArray::deep_copy(bool copyarrays,
+                            bool copyindexes,
+                            bool copyidentities) const {
+    ContentPtr data = data_.get()->deep_copy(copyarrays,
+                                             copyindexes,
+                                             copyidentities);
+    IdentitiesPtr identities = identities_;
+    if (copyidentities  &&  identities_.get() != nullptr) {
+      identities = identities_.get()->deep_copy();
+    }
+    return std::make_shared<QuantizedArray>(identities,
+                                            parameters_,
+                                            data,
+                                            scale_,
+                                            offset_);
+  }
+
+  void
+  QuantizedArray::check_for_iteration() const {
+    if (identities_.get() != nullptr  &&
+        identities_.get()->length() < length()) {
+      util::handle_error(
+        failure("len(identities) < len(array)", kSliceNone, kSliceNone),
+        identities_.get()->classname(),
+        nullptr);
+    }
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_nothing() const {
+    return getitem_range_nowrap(0, 0);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_at(int64_t at) const {
+    int64_t regular_at = at;
+    if (regular_at < 0) {
+      regular_at += length();
+    }
+    if (!(0 <= regular_at  &&  regular_at < length())) {
+      util::handle_error(failure("index out of range", kSliceNone, at),
+                         classname(),
+                         identities_.get());
+    }
+    return getitem_at_nowrap(regular_at);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_at_nowrap(int64_t at) const {
+    return QuantizedArray(Identities::none(),
+                          parameters_,
+                          data_.get()->getitem_range_nowrap(at, at + 1),
+                          scale_,
+                          offset_).toNumpyArray().get()->getitem_at_nowrap(0);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_range(int64_t start, int64_t stop) const {
+    int64_t regular_start = start;
+    int64_t regular_stop = stop;
+    awkward_regularize_rangeslice(&regular_start, &regular_stop,
+      true, start != Slice::none(), stop != Slice::none(), length());
+    if (identities_.get() != nullptr  &&
+        regular_stop > identities_.get()->length()) {
+      util::handle_error(
+        failure("index out of range", kSliceNone, stop),
+        identities_.get()->classname(),
+        nullptr);
+    }
+    return getitem_range_nowrap(regular_start, regular_stop);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(start, stop);
+    }
+    return std::make_shared<QuantizedArray>(
+      identities,
+      parameters_,
+      data_.get()->getitem_range_nowrap(start, stop),
+      scale_,
+      offset_);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_field(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_fields(const std::vector<std::string>& keys) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next(const SliceItemPtr& head,
+                               const Slice& tail,
+                               const Index64& advanced) const {
+    if (head.get() == nullptr) {
+      return shallow_copy();
+    }
+    else {
+      return toNumpyArray().get()->getitem_next(head, tail, advanced);
+    }
+  }
+
+  const ContentPtr
+  QuantizedArray::carry(const Index64& carry) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_carry_64(carry);
+    }
+    return std::make_shared<QuantizedArray>(identities,
+                                            parameters_,
+                                            data_.get()->carry(carry),
+                                            scale_,
+                                            offset_);
+  }
+
+  const std::string
+  QuantizedArray::purelist_parameter(const std::string& key) const {
+    return parameter(key);
+  }
+
+  int64_t
+  QuantizedArray::numfields() const {
+    return -1;
+  }
+
+  int64_t
+  QuantizedArray::fieldindex(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("key ") + util::quote(key, true)
+      + std::string(" does not exist (data are not records)"));
+  }
+
+  const std::string
+  QuantizedArray::key(int64_t fieldindex) const {
+    throw std::invalid_argument(
+      std::string("fieldindex \"") + std::to_string(fieldindex)
+      + std::string("\" does not exist (data are not records)"));
+  }
+
+  bool
+  QuantizedArray::haskey(const std::string& key) const {
+    return false;
+  }
+
+  const std::vector<std::string>
+  QuantizedArray::keys() const {
+    return std::vector<std::string>();
+  }
+
+  const std::string
+  QuantizedArray::validityerror(const std::string& path) const {
+    return std::string();
+  }
+
+  const ContentPtr
+  QuantizedArray::shallow_simplify() const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  QuantizedArray::num(int64_t axis, int64_t depth) const {
+    int64_t toaxis = axis_wrap_if_negative(axis);
+    if (toaxis == depth) {
+      Index64 out(1);
+      out.setitem_at_nowrap(0, length());
+      return NumpyArray(out).getitem_at_nowrap(0);
+    }
+    else {
+      throw std::invalid_argument("'axis' out of range for 'num'");
+    }
+  }
+
+  const std::pair<Index64, ContentPtr>
+  QuantizedArray::offsets_and_flattened(int64_t axis, int64_t depth) const {
+    return toNumpyArray().get()->offsets_and_flattened(axis, depth);
+  }
+
+  const ContentPtr
+  QuantizedArray::materialized() const {
+    return array();
+  }
+
+  bool
+  QuantizedArray::mergeable(const ContentPtr& other, bool mergebool) const {
+    return toNumpyArray().get()->mergeable(other, mergebool);
+  }
+
+  const ContentPtr
+  QuantizedArray::merge(const ContentPtr& other) const {
+    if (dynamic_cast<EmptyArray*>(other.get())  &&
+        parameters_equal(other.get()->parameters())) {
+      return shallow_copy();
+    }
+    return toNumpyArray().get()->merge(other);
+  }
+
+  const SliceItemPtr
+  QuantizedArray::asslice() const {
+    return toNumpyArray().get()->asslice();
+  }
+
+  const ContentPtr
+  QuantizedArray::fillna(const ContentPtr& value) const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  QuantizedArray::rpad(int64_t target, int64_t axis, int64_t depth) const {
+    return toNumpyArray().get()->rpad(target, axis, depth);
+  }
+
+  const ContentPtr
+  QuantizedArray::rpad_and_clip(int64_t target,
+                                int64_t axis,
+                                int64_t depth) const {
+    return toNumpyArray().get()->rpad_and_clip(target, axis, depth);
+  }
+
+  const ContentPtr
+  QuantizedArray::reduce_next(const Reducer& reducer,
+                              int64_t negaxis,
+                              const Index64& starts,
+                              const Index64& parents,
+                              int64_t outlength,
+                              bool mask,
+                              bool keepdims) const {
+    // counts and positions do not depend on the scale (if it is positive)
+    if (dynamic_cast<const ReducerCount*>(&reducer) != nullptr  ||
+        (scale_ > 0  &&
+         (dynamic_cast<const ReducerArgmin*>(&reducer) != nullptr  ||
+          dynamic_cast<const ReducerArgmax*>(&reducer) != nullptr))) {
+      return data_.get()->reduce_next(reducer,
+                                      negaxis,
+                                      starts,
+                                      parents,
+                                      outlength,
+                                      mask,
+                                      keepdims);
+    }
+
+    bool issum = (dynamic_cast<const ReducerSum*>(&reducer) != nullptr);
+    bool ismin = (dynamic_cast<const ReducerMin*>(&reducer) != nullptr);
+    bool ismax = (dynamic_cast<const ReducerMax*>(&reducer) != nullptr);
+    // an empty group's min or max of integers is not the min or max of
+    // floating point numbers, so it has to be masked
+    if (!(issum  ||  (mask  &&  (ismin  ||  ismax)))) {
+      return toNumpyArray().get()->reduce_next(reducer,
+                                               negaxis,
+                                               starts,
+                                               parents,
+                                               outlength,
+                                               mask,
+                                               keepdims);
+    }
+
+    ReducerMin reducermin;
+    ReducerMax reducermax;
+    const Reducer* onintegers = &reducer;
+    if (scale_ < 0  &&  ismin) {
+      onintegers = &reducermax;
+    }
+    else if (scale_ < 0  &&  ismax) {
+      onintegers = &reducermin;
+    }
+    ContentPtr reduced = data_.get()->reduce_next(*onintegers,
+                                                  negaxis,
+                                                  starts,
+                                                  parents,
+                                                  outlength,
+                                                  false,
+                                                  false);
+    ContentPtr widened =
+      dynamic_cast<NumpyArray*>(reduced.get())->astype("d");
+    NumpyArray* raw = dynamic_cast<NumpyArray*>(widened.get());
+    double* ptr = reinterpret_cast<double*>(raw->ptr().get());
+
+    if (issum) {
+      Index64 counts(outlength);
+      struct Error err1 = awkward_reduce_count_64(
+        counts.ptr().get(),
+        parents.ptr().get(),
+        parents.offset(),
+        parents.length(),
+        outlength);
+      util::handle_error(err1, classname(), identities_.get());
+      struct Error err2 = awkward_quantizedarray_reduce_sum(
+        ptr,
+        ptr,
+        counts.ptr().get(),
+        outlength,
+        scale_,
+        offset_);
+      util::handle_error(err2, classname(), identities_.get());
+    }
+    else {
+      struct Error err = awkward_quantizedarray_dequantize(
+        ptr,
+        ptr,
+        outlength,
+        scale_,
+        offset_);
+      util::handle_error(err, classname(), identities_.get());
+    }
+
+    ContentPtr out = widened;
+    if (mask) {
+      Index8 mask(outlength);
+      struct Error err = awkward_numpyarray_reduce_mask_bytemaskedarray(
+        mask.ptr().get(),
+        parents.ptr().get(),
+        parents.offset(),
+        parents.length(),
+        outlength);
+      util::handle_error(err, classname(), nullptr);
+      out = std::make_shared<ByteMaskedArray>(Identities::none(),
+                                              util::Parameters(),
+                                              mask,
+                                              out,
+                                              false);
+    }
+    if (keepdims) {
+      out = std::make_shared<RegularArray>(Identities::none(),
+                                           util::Parameters(),
+                                           out,
+                                           1);
+    }
+    return out;
+  }
+
+  const ContentPtr
+  QuantizedArray::localindex(int64_t axis, int64_t depth) const {
+    return data_.get()->localindex(axis, depth);
+  }
+
+  const ContentPtr
+  QuantizedArray::combinations(int64_t n,
+                               bool replacement,
+                               const util::RecordLookupPtr& recordlookup,
+                               const util::Parameters& parameters,
+                               int64_t axis,
+                               int64_t depth) const {
+    return toNumpyArray().get()->combinations(n,
+                                              replacement,
+                                              recordlookup,
+                                              parameters,
+                                              axis,
+                                              depth);
+  }
+
+  const ContentPtr
+  QuantizedArray::packed() const {
+    return std::make_shared<QuantizedArray>(identities_,
+                                            parameters_,
+                                            data_.get()->packed(),
+                                            scale_,
+                                            offset_);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next(const SliceAt& at,
+                               const Slice& tail,
+                               const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: QuantizedArray::getitem_next(at)");
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next(const SliceRange& range,
+                               const Slice& tail,
+                               const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: QuantizedArray::getitem_next(range)");
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next(const SliceArray64& array,
+                               const Slice& tail,
+                               const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: QuantizedArray::getitem_next(array)");
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next(const SliceField& field,
+                               const Slice& tail,
+                               const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: QuantizedArray::getitem_next(field)");
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next(const SliceFields& fields,
+                               const Slice& tail,
+                               const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: QuantizedArray::getitem_next(fields)");
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next(const SliceJagged64& jagged,
+                               const Slice& tail,
+                               const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: QuantizedArray::getitem_next(jagged)");
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next_jagged(const Index64& slicestarts,
+                                      const Index64& slicestops,
+                                      const SliceArray64& slicecontent,
+                                      const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next_jagged(const Index64& slicestarts,
+                                      const Index64& slicestops,
+                                      const SliceMissing64& slicecontent,
+                                      const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+  const ContentPtr
+  QuantizedArray::getitem_next_jagged(const Index64& slicestarts,
+                                      const Index64& slicestops,
+                                      const SliceJagged64& slicecontent,
+                                      const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+}
@@ -0,0 +1,610 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/identities.h"
+#include "awkward/cpu-kernels/getitem.h"
+#include "awkward/array/NumpyArray.h"
+#include "awkward/array/EmptyArray.h"
+#include "awkward/util.h"
+
+#include "awkward/array/RangeArray.h"
+
+namespace awkward {
+  RangeArray::RangeArray(const IdentitiesPtr& identities,
+                         const util::Parameters& parameters,
+                         int64_t start,
+                         int64_t step,
+                         int64_t length)
+      : Content(identities, parameters)
+      , start_(start)
+      , step_(step)
+      , length_(length) {
+    if (length < 0) {
+      throw std::invalid_argument("RangeArray length must be non-negative");
+    }
+  }
+
+  RangeArray::RangeArray(int64_t length)
+      : RangeArray(Identities::none(), util::Parameters(), 0, 1, length) { }
+
+  int64_t
+  RangeArray::start() const {
+    return start_;
+  }
+
+  int64_t
+  RangeArray::step() const {
+    return step_;
+  }
+
+  int64_t
+  RangeArray::stop() const {
+    return start_ + step_*length_;
+  }
+
+  const ContentPtr
+  RangeArray::toNumpyArray() const {
+    Index64 values(length_);
+    struct Error err = awkward_rangearray_fill_64(
+      values.ptr().get(),
+      start_,
+      step_,
+      length_);
+    util::handle_error(err, classname(), identities_.get());
+    NumpyArray out(values);
+    return std::make_shared<NumpyArray>(identities_,
+                                        parameters_,
+                                        out.ptr(),
+                                        out.shape(),
+                                        out.strides(),
+                                        0,
+                                        out.itemsize(),
+                                        out.format());
+  }
+
+  const ContentPtr
+  RangeArray::array() const {
+    return toNumpyArray();
+  }
+
+  const SliceItemPtr
+  RangeArray::asslicerange(int64_t target) const {
+    if (length_ == 0  &&  target >= 0) {
+      return std::make_shared<SliceRange>(0, 0, 1);
+    }
+    int64_t last = start_ + step_*(length_ - 1);
+    if (step_ == 0  ||
+        start_ < 0  ||  start_ >= target  ||
+        last < 0  ||  last >= target) {
+      return SliceItemPtr(nullptr);
+    }
+    // a negative stop would count from the end of the array
+    int64_t end = stop();
+    if (end < 0) {
+      end = Slice::none();
+    }
+    return std::make_shared<SliceRange>(start_, end, step_);
+  }
+
+  const std::string
+  RangeArray::classname() const {
+    return "RangeArray";
+  }
+
+  void
+  RangeArray::setidentities() {
+    if (length() <= kMaxInt32) {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities32>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities32* rawidentities =
+        reinterpret_cast<Identities32*>(newidentities.get());
+      struct Error err = awkward_new_identities32(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+    else {
+      IdentitiesPtr newidentities =
+        std::make_shared<Identities64>(Identities::newref(),
+                                       Identities::FieldLoc(),
+                                       1,
+                                       length());
+      Identities64* rawidentities =
+        reinterpret_cast<Identities64*>(newidentities.get());
+      struct Error err = awkward_new_identities64(rawidentities->ptr().get(),
+                                                  length());
+      util::handle_error(err, classname(), identities_.get());
+      setidentities(newidentities);
+    }
+  }
+
+  void
+  RangeArray::setidentities(const IdentitiesPtr& identities) {
+    if (identities.get() != nullptr  &&
+        length() != identities.get()->length()) {
+      util::handle_error(
+        failure("content and its identities must have the same length",
+                kSliceNone,
+                kSliceNone),
+        classname(),
+        identities_.get());
+    }
+    identities_ = identities;
+  }
+
+  const TypePtr
+  RangeArray::type(const util::TypeStrs& typestrs) const {
+    return form(true).get()->type(typestrs);
+  }
+
+  const FormPtr
+  RangeArray::form(bool materialize) const {
+    RangeArray empty(identities_.get() == nullptr
+                         ? identities_
+                         : identities_.get()->getitem_range_nowrap(0, 0),
+                     parameters_,
+                     start_,
+                     step_,
+                     0);
+    return empty.toNumpyArray().get()->form(materialize);
+  }
+
+  bool
+  RangeArray::has_virtual_form() const {
+    return false;
+  }
+
+  bool
+  RangeArray::has_virtual_length() const {
+    return false;
+  }
+
+  const std::string
+  RangeArray::tostring_part(const std::string& indent,
+                            const std::string& pre,
+                            const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<" << classname() << " start=\"" << start_
+        << "\" step=\"" << step_ << "\" length=\"" << length_ << "\"";
+    if (identities_.get() == nullptr  &&  parameters_.empty()) {
+      out << "/>" << post;
+    }
+    else {
+      out << ">\n";
+      if (identities_.get() != nullptr) {
+        out << identities_.get()->tostring_part(
+                 indent + std::string("    "), "", "\n");
+      }
+      if (!parameters_.empty()) {
+        out << parameters_tostring(indent + std::string("    "), "", "\n");
+      }
+      out << indent << "</" << classname() << ">" << post;
+    }
+    return out.str();
+  }
+
+  void
+  RangeArray::tojson_part(ToJson& builder,
+                          bool include_beginendlist) const {
+    toNumpyArray().get()->tojson_part(builder, include_beginendlist);
+  }
+
+  void
+  RangeArray::nbytes_part(std::map<size_t, int64_t>& largest) const {
+    if (identities_.get() != nullptr) {
+      identities_.get()->nbytes_part(largest);
+    }
+  }
+
+  void
+  RangeArray::fingerprint_part(uint64_t& hash) const {
+    toNumpyArray().get()->fingerprint_part(hash);
+  }
+
+  int64_t
+  RangeArray::length() const {
+    return length_;
+  }
+
+  const ContentPtr
+  RangeArray::shallow_copy() const {
+    return std::make_shared<RangeArray>(identities_,
+                                        parameters_,
+                                        start_,
+                                        step_,
+                                        length_);
+  }
+
+  const ContentPtr
+  RangeArray::deep_copy(bool copyarrays,
+                        bool copyindexes,
+                        bool copyidentities) const {
+    IdentitiesPtr identities = identities_;
+    if (copyidentities  &&  identities_.get() != nullptr) {
+      identities = identities_.get()->deep_copy();
+    }
+    return std::make_shared<RangeArray>(identities,
+                                        parameters_,
+                                        start_,
+                                        step_,
+                                        length_);
+  }
+
+  void
+  RangeArray::check_for_iteration() const {
+    if (identities_.get() != nullptr  &&
+        identities_.get()->length() < length_) {
+      util::handle_error(
+        failure("len(identities) < len(array)", kSliceNone, kSliceNone),
+        identities_.get()->classname(),
+        nullptr);
+    }
+  }
+
+  const ContentPtr
+  RangeArray::getitem_nothing() const {
+    return getitem_range_nowrap(0, 0);
+  }
+
+  const ContentPtr
+  RangeArray::getitem_at(int64_t at) const {
+    int64_t regular_at = at;
+    if (regular_at < 0) {
+      regular_at += length_;
+    }
+    if (!(0 <= regular_at  &&  regular_at < length_)) {
+      util::handle_error(failure("index out of range", kSliceNone, at),
+                         classname(),
+                         identities_.get());
+    }
+    return getitem_at_nowrap(regular_at);
+  }
+
+  const ContentPtr
+  RangeArray::getitem_at_nowrap(int64_t at) const {
+    return std::make_shared<RangeArray>(Identities::none(),
+                                        parameters_,
+                                        start_ + step_*at,
+                                        step_,
+                                        1).get()->toNumpyArray().get()
+             ->getitem_at_nowrap(0);
+  }
+
+  const ContentPtr
+  RangeArray::getitem_range(int64_t start, int64_t stop) const {
+    int64_t regular_start = start;
+    int64_t regular_stop = stop;
+    awkward_regularize_rangeslice(&regular_start, &regular_stop,
+      true, start != Slice::none(), stop != Slice::none(), length_);
+    if (identities_.get() != nullptr  &&
+        regular_stop > identities_.get()->length()) {
+      util::handle_error(
+        failure("index out of range", kSliceNone, stop),
+        identities_.get()->classname(),
+        nullptr);
+    }
+    return getitem_range_nowrap(regular_start, regular_stop);
+  }
+
+  const ContentPtr
+  RangeArray::getitem_range_nowrap(int64_t start, int64_t stop) const {
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_range_nowrap(start, stop);
+    }
+    return std::make_shared<RangeArray>(identities,
+                                        parameters_,
+                                        start_ + step_*start,
+                                        step_,
+                                        stop - start);
+  }
+
+  const ContentPtr
+  RangeArray::getitem_field(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  RangeArray::getitem_fields(const std::vector<std::string>& keys) const {
+    throw std::invalid_argument(
+      std::string("cannot slice ") + classname()
+      + std::string(" by field name"));
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next(const SliceItemPtr& head,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    if (head.get() == nullptr) {
+      return shallow_copy();
+    }
+    else {
+      return toNumpyArray().get()->getitem_next(head, tail, advanced);
+    }
+  }
+
+  const ContentPtr
+  RangeArray::carry(const Index64& carry) const {
+    if (carry.length() != 0) {
+      // a contiguous carry of a range is a smaller range
+      bool isrange;
+      struct Error err = awkward_carry_isrange_64(
+        &isrange,
+        carry.ptr().get() + carry.offset(),
+        carry.length());
+      util::handle_error(err, classname(), identities_.get());
+      int64_t first = carry.getitem_at_nowrap(0);
+      if (isrange  &&  first >= 0  &&  first + carry.length() <= length_) {
+        return getitem_range_nowrap(first, first + carry.length());
+      }
+    }
+    IdentitiesPtr identities(nullptr);
+    if (identities_.get() != nullptr) {
+      identities = identities_.get()->getitem_carry_64(carry);
+    }
+    Index64 values(carry.length());
+    struct Error err = awkward_rangearray_getitem_carry_64(
+      values.ptr().get(),
+      start_,
+      step_,
+      length_,
+      carry.ptr().get(),
+      carry.length());
+    util::handle_error(err, classname(), identities_.get());
+    NumpyArray out(values);
+    return std::make_shared<NumpyArray>(identities,
+                                        parameters_,
+                                        out.ptr(),
+                                        out.shape(),
+                                        out.strides(),
+                                        0,
+                                        out.itemsize(),
+                                        out.format());
+  }
+
+  const std::string
+  RangeArray::purelist_parameter(const std::string& key) const {
+    return parameter(key);
+  }
+
+  int64_t
+  RangeArray::numfields() const {
+    return -1;
+  }
+
+  int64_t
+  RangeArray::fieldindex(const std::string& key) const {
+    throw std::invalid_argument(
+      std::string("key ") + util::quote(key, true)
+      + std::string(" does not exist (data are not records)"));
+  }
+
+  const std::string
+  RangeArray::key(int64_t fieldindex) const {
+    throw std::invalid_argument(
+      std::string("fieldindex \"") + std::to_string(fieldindex)
+      + std::string("\" does not exist (data are not records)"));
+  }
+
+  bool
+  RangeArray::haskey(const std::string& key) const {
+    return false;
+  }
+
+  const std::vector<std::string>
+  RangeArray::keys() const {
+    return std::vector<std::string>();
+  }
+
+  const std::string
+  RangeArray::validityerror(const std::string& path) const {
+    return std::string();
+  }
+
+  const ContentPtr
+  RangeArray::shallow_simplify() const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  RangeArray::num(int64_t axis, int64_t depth) const {
+    int64_t toaxis = axis_wrap_if_negative(axis);
+    if (toaxis == depth) {
+      Index64 out(1);
+      out.setitem_at_nowrap(0, length());
+      return NumpyArray(out).getitem_at_nowrap(0);
+    }
+    else {
+      throw std::invalid_argument("'axis' out of range for 'num'");
+    }
+  }
+
+  const std::pair<Index64, ContentPtr>
+  RangeArray::offsets_and_flattened(int64_t axis, int64_t depth) const {
+    return toNumpyArray().get()->offsets_and_flattened(axis, depth);
+  }
+
+  const ContentPtr
+  RangeArray::materialized() const {
+    return array();
+  }
+
+  bool
+  RangeArray::mergeable(const ContentPtr& other, bool mergebool) const {
+    return toNumpyArray().get()->mergeable(other, mergebool);
+  }
+
+  const ContentPtr
+  RangeArray::merge(const ContentPtr& other) const {
+    if (RangeArray* raw = dynamic_cast<RangeArray*>(other.get())) {
+      if (parameters_equal(raw->parameters())  &&
+          (raw->length() == 0  ||
+           (raw->start() == stop()  &&
+            (raw->step() == step_  ||  raw->length() == 1)))) {
+        return std::make_shared<RangeArray>(Identities::none(),
+                                            parameters_,
+                                            start_,
+                                            step_,
+                                            length_ + raw->length());
+      }
+    }
+    if (dynamic_cast<EmptyArray*>(other.get())  &&
+        parameters_equal(other.get()->parameters())) {
+      return shallow_copy();
+    }
+    return toNumpyArray().get()->merge(other);
+  }
+
+  const SliceItemPtr
+  RangeArray::asslice() const {
+    return toNumpyArray().get()->asslice();
+  }
+
+  const ContentPtr
+  RangeArray::fillna(const ContentPtr& value) const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  RangeArray::rpad(int64_t target, int64_t axis, int64_t depth) const {
+    return toNumpyArray().get()->rpad(target, axis, depth);
+  }
+
+  const ContentPtr
+  RangeArray::rpad_and_clip(int64_t target,
+                            int64_t axis,
+                            int64_t depth) const {
+    return toNumpyArray().get()->rpad_and_clip(target, axis, depth);
+  }
+
+  const ContentPtr
+  RangeArray::reduce_next(const Reducer& reducer,
+                          int64_t negaxis,
+                          const Index64& starts,
+                          const Index64& parents,
+                          int64_t outlength,
+                          bool mask,
+                          bool keepdims) const {
+    return toNumpyArray().get()->reduce_next(reducer,
+                                             negaxis,
+                                             starts,
+                                             parents,
+                                             outlength,
+                                             mask,
+                                             keepdims);
+  }
+
+  const ContentPtr
+  RangeArray::localindex(int64_t axis, int64_t depth) const {
+    return toNumpyArray().get()->localindex(axis, depth);
+  }
+
+  const ContentPtr
+  RangeArray::combinations(int64_t n,
+                           bool replacement,
+                           const util::RecordLookupPtr& recordlookup,
+                           const util::Parameters& parameters,
+                           int64_t axis,
+                           int64_t depth) const {
+    return toNumpyArray().get()->combinations(n,
+                                              replacement,
+                                              recordlookup,
+                                              parameters,
+                                              axis,
+                                              depth);
+  }
+
+  const ContentPtr
+  RangeArray::packed() const {
+    return shallow_copy();
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next(const SliceAt& at,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: RangeArray::getitem_next(at)");
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next(const SliceRange& range,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: RangeArray::getitem_next(range)");
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next(const SliceArray64& array,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: RangeArray::getitem_next(array)");
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next(const SliceField& field,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: RangeArray::getitem_next(field)");
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next(const SliceFields& fields,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: RangeArray::getitem_next(fields)");
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next(const SliceJagged64& jagged,
+                           const Slice& tail,
+                           const Index64& advanced) const {
+    throw std::runtime_error(
+            "undefined operation: RangeArray::getitem_next(jagged)");
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next_jagged(const Index64& slicestarts,
+                                  const Index64& slicestops,
+                                  const SliceArray64& slicecontent,
+                                  const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next_jagged(const Index64& slicestarts,
+                                  const Index64& slicestops,
+                                  const SliceMissing64& slicecontent,
+                                  const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+  const ContentPtr
+  RangeArray::getitem_next_jagged(const Index64& slicestarts,
+                                  const Index64& slicestops,
+                                  const SliceJagged64& slicecontent,
+                                  const Slice& tail) const {
+    return toNumpyArray().get()->getitem_next_jagged(slicestarts,
+                                                     slicestops,
+                                                     slicecontent,
+                                                     tail);
+  }
+
+}
@@ -140,6 +140,12 @@ namespace awkward {
     return array_.get()->nbytes_part(largest);
   }
 
+  void
+  Record::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)at_);
+    array_.get()->fingerprint_part(hash);
+  }
+
   int64_t
   Record::length() const {
     return -1;   // just like NumpyArray with ndim == 0, which is also a scalar
@@ -388,6 +394,13 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  Record::packed() const {
+    ContentPtr out = array_.get()->getitem_range_nowrap(at_, at_ + 1);
+    return std::make_shared<Record>(
+      std::dynamic_pointer_cast<RecordArray>(out.get()->packed()), 0);
+  }
+
   const ContentPtr
   Record::field(int64_t fieldindex) const {
     return array_.get()->field(fieldindex).get()->getitem_at_nowrap(at_);
@@ -16,7 +16,7 @@
 #include "awkward/array/BitMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
 #include "awkward/array/NumpyArray.h"
-#include "awkward/array/VirtualArray.h"
+#include "awkward/array/InterleavedArray.h"
 
 #include "awkward/array/RecordArray.h"
 
@@ -602,6 +602,15 @@ namespace awkward {
     }
   }
 
+  void
+  RecordArray::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length_);
+    for (auto content : contents_) {
+      content.get()->getitem_range_nowrap(0, length_).get()->fingerprint_part(
+        hash);
+    }
+  }
+
   int64_t
   RecordArray::length() const {
     return length_;
@@ -738,13 +747,24 @@ namespace awkward {
 
   const ContentPtr
   RecordArray::carry(const Index64& carry) const {
+    return carry_generic<int64_t>(carry);
+  }
+
+  const ContentPtr
+  RecordArray::carry(const Index32& carry) const {
+    return carry_generic<int32_t>(carry);
+  }
+
+  template <typename C>
+  const ContentPtr
+  RecordArray::carry_generic(const IndexOf<C>& carry) const {
     ContentPtrVec contents;
     for (auto content : contents_) {
       contents.push_back(content.get()->carry(carry));
     }
     IdentitiesPtr identities(nullptr);
     if (identities_.get() != nullptr) {
-      identities = identities_.get()->getitem_carry_64(carry);
+      identities = identities_.get()->getitem_carry_64(carry.to64());
     }
     return std::make_shared<RecordArray>(identities,
                                          parameters_,
@@ -867,10 +887,8 @@ namespace awkward {
   }
 
   bool
-  RecordArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+  RecordArray::mergeable(const ContentPtr& othercontent, bool mergebool) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -950,10 +968,8 @@ namespace awkward {
   }
 
   const ContentPtr
-  RecordArray::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return merge(raw->array());
-    }
+  RecordArray::merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return merge_as_union(other);
@@ -1219,6 +1235,20 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  RecordArray::packed() const {
+    ContentPtrVec contents;
+    for (auto content : contents_) {
+      contents.push_back(
+        content.get()->getitem_range_nowrap(0, length_).get()->packed());
+    }
+    return std::make_shared<RecordArray>(identities_,
+                                         parameters_,
+                                         contents,
+                                         recordlookup_,
+                                         length_);
+  }
+
   const ContentPtr
   RecordArray::field(int64_t fieldindex) const {
     if (fieldindex >= numfields()) {
@@ -1270,6 +1300,66 @@ namespace awkward {
                                          length_);
   }
 
+  bool
+  RecordArray::isinterleavable() const {
+    if (contents_.empty()) {
+      return false;
+    }
+    NumpyArray* first = dynamic_cast<NumpyArray*>(contents_[0].get());
+    for (auto content : contents_) {
+      NumpyArray* raw = dynamic_cast<NumpyArray*>(content.get());
+      if (raw == nullptr  ||
+          raw->ndim() != 1  ||
+          !raw->parameters().empty()  ||
+          raw->format() != first->format()  ||
+          raw->itemsize() != first->itemsize()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  const ContentPtr
+  RecordArray::toInterleavedArray() const {
+    if (!isinterleavable()) {
+      throw std::invalid_argument(
+        "only records whose fields are all one-dimensional numbers of the "
+        "same type can be interleaved");
+    }
+    NumpyArray* first = dynamic_cast<NumpyArray*>(contents_[0].get());
+    ssize_t itemsize = first->itemsize();
+    ssize_t tostride = itemsize*(ssize_t)contents_.size();
+    std::shared_ptr<void> ptr(new uint8_t[(size_t)(length_*tostride)],
+                              util::array_deleter<uint8_t>());
+    for (size_t j = 0;  j < contents_.size();  j++) {
+      NumpyArray* raw = dynamic_cast<NumpyArray*>(contents_[j].get());
+      struct Error err = awkward_interleavedarray_fill_field(
+        reinterpret_cast<uint8_t*>(ptr.get()) + (ssize_t)j*itemsize,
+        tostride,
+        reinterpret_cast<uint8_t*>(raw->ptr().get()),
+        raw->byteoffset(),
+        raw->strides()[0],
+        itemsize,
+        length_);
+      util::handle_error(err, classname(), identities_.get());
+    }
+    std::vector<ssize_t> shape({ (ssize_t)length_,
+                                 (ssize_t)contents_.size() });
+    std::vector<ssize_t> strides({ tostride, itemsize });
+    ContentPtr data = std::make_shared<NumpyArray>(Identities::none(),
+                                                   util::Parameters(),
+                                                   ptr,
+                                                   shape,
+                                                   strides,
+                                                   0,
+                                                   itemsize,
+                                                   first->format());
+    return std::make_shared<InterleavedArray>(identities_,
+                                              parameters_,
+                                              data,
+                                              recordlookup_);
+  }
+
   const ContentPtr
   RecordArray::getitem_next(const SliceItemPtr& head,
                             const Slice& tail,
@@ -20,7 +20,6 @@
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/BitMaskedArray.h"
 #include "awkward/array/UnmaskedArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #include "awkward/array/RegularArray.h"
 
@@ -424,6 +423,13 @@ namespace awkward {
     }
   }
 
+  void
+  RegularArray::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length());
+    content_.get()->getitem_range_nowrap(0, length()*size_).get()->
+      fingerprint_part(hash);
+  }
+
   int64_t
   RegularArray::length() const {
     return (size_ == 0
@@ -625,10 +631,9 @@ namespace awkward {
   }
 
   bool
-  RegularArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+  RegularArray::mergeable(const ContentPtr& othercontent,
+                          bool mergebool) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -707,10 +712,8 @@ namespace awkward {
   }
 
   const ContentPtr
-  RegularArray::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return merge(raw->array());
-    }
+  RegularArray::merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return merge_as_union(other);
@@ -879,6 +882,22 @@ namespace awkward {
                             int64_t outlength,
                             bool mask,
                             bool keepdims) const {
+    // Reshaped as a NumpyArray, fixed-size lists are reduced by striding
+    // through the data, without building parents for every item. (Reducing
+    // the outermost dimension by parents other than a single group still
+    // needs the general algorithm.)
+    std::shared_ptr<NumpyArray> view = numpy_view();
+    if (view.get() != nullptr  &&
+        (negaxis < view.get()->ndim()  ||
+         (negaxis == view.get()->ndim()  &&  outlength == 1))) {
+      return view.get()->reduce_next(reducer,
+                                     negaxis,
+                                     starts,
+                                     parents,
+                                     outlength,
+                                     mask,
+                                     keepdims);
+    }
     return toListOffsetArray64(true).get()->reduce_next(reducer,
                                                         negaxis,
                                                         starts,
@@ -888,6 +907,40 @@ namespace awkward {
                                                         keepdims);
   }
 
+  const std::shared_ptr<NumpyArray>
+  RegularArray::numpy_view() const {
+    std::shared_ptr<NumpyArray> inner(nullptr);
+    if (RegularArray* raw = dynamic_cast<RegularArray*>(content_.get())) {
+      inner = raw->numpy_view();
+    }
+    else if (NumpyArray* raw = dynamic_cast<NumpyArray*>(content_.get())) {
+      if (raw->ndim() != 0) {
+        inner = std::dynamic_pointer_cast<NumpyArray>(content_);
+      }
+    }
+    if (inner.get() == nullptr) {
+      return inner;
+    }
+
+    std::vector<ssize_t> innershape = inner.get()->shape();
+    std::vector<ssize_t> innerstrides = inner.get()->strides();
+    std::vector<ssize_t> shape({ (ssize_t)length(), (ssize_t)size_ });
+    std::vector<ssize_t> strides({ (ssize_t)size_*innerstrides[0],
+                                   innerstrides[0] });
+    shape.insert(shape.end(), innershape.begin() + 1, innershape.end());
+    strides.insert(strides.end(),
+                   innerstrides.begin() + 1,
+                   innerstrides.end());
+    return std::make_shared<NumpyArray>(Identities::none(),
+                                        util::Parameters(),
+                                        inner.get()->ptr(),
+                                        shape,
+                                        strides,
+                                        inner.get()->byteoffset(),
+                                        inner.get()->itemsize(),
+                                        inner.get()->format());
+  }
+
   const ContentPtr
   RegularArray::localindex(int64_t axis, int64_t depth) const {
     int64_t toaxis = axis_wrap_if_negative(axis);
@@ -1006,6 +1059,16 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  RegularArray::packed() const {
+    ContentPtr content = content_.get()->getitem_range_nowrap(0,
+                                                              length()*size_);
+    return std::make_shared<RegularArray>(identities_,
+                                          parameters_,
+                                          content.get()->packed(),
+                                          size_);
+  }
+
   const ContentPtr
   RegularArray::getitem_next(const SliceAt& at,
                              const Slice& tail,
@@ -14,7 +14,6 @@
 #include "awkward/array/IndexedArray.h"
 #include "awkward/array/NumpyArray.h"
 #include "awkward/array/RegularArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #define AWKWARD_UNIONARRAY_NO_EXTERN_TEMPLATE
 #include "awkward/array/UnionArray.h"
@@ -418,7 +417,7 @@ namespace awkward {
       index);
     util::handle_error(err, classname(), identities_.get());
     Index64 nextcarry(tmpcarry.ptr(), 0, lenout);
-    return contents_[(size_t)index].get()->carry(nextcarry);
+    return contents_[(size_t)index].get()->carry_or_range(nextcarry);
   }
 
   template <typename T, typename I>
@@ -905,6 +904,17 @@ namespace awkward {
     }
   }
 
+  template <typename T, typename I>
+  void
+  UnionArrayOf<T, I>::fingerprint_part(uint64_t& hash) const {
+    util::fingerprint_combine(hash, (uint64_t)length());
+    tags_.fingerprint_part(hash);
+    index_.getitem_range_nowrap(0, tags_.length()).fingerprint_part(hash);
+    for (auto content : contents_) {
+      content.get()->fingerprint_part(hash);
+    }
+  }
+
   template <typename T, typename I>
   int64_t
   UnionArrayOf<T, I>::length() const {
@@ -1351,11 +1361,9 @@ namespace awkward {
 
   template <typename T, typename I>
   bool
-  UnionArrayOf<T, I>::mergeable(const ContentPtr& other,
+  UnionArrayOf<T, I>::mergeable(const ContentPtr& othercontent,
                                 bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -1365,10 +1373,8 @@ namespace awkward {
 
   template <typename T, typename I>
   const ContentPtr
-  UnionArrayOf<T, I>::reverse_merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return reverse_merge(raw->array());
-    }
+  UnionArrayOf<T, I>::reverse_merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     int64_t theirlength = other.get()->length();
     int64_t mylength = length();
@@ -1449,10 +1455,8 @@ namespace awkward {
 
   template <typename T, typename I>
   const ContentPtr
-  UnionArrayOf<T, I>::merge(const ContentPtr& other) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return merge(raw->array());
-    }
+  UnionArrayOf<T, I>::merge(const ContentPtr& othercontent) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return merge_as_union(other);
@@ -1798,6 +1802,22 @@ namespace awkward {
     }
   }
 
+  template <typename T, typename I>
+  const ContentPtr
+  UnionArrayOf<T, I>::packed() const {
+    IndexOf<T> tags = tags_.deep_copy();
+    IndexOf<I> index = regular_index(tags);
+    ContentPtrVec contents;
+    for (int64_t i = 0;  i < numcontents();  i++) {
+      contents.push_back(project(i).get()->packed());
+    }
+    return std::make_shared<UnionArrayOf<T, I>>(identities_,
+                                                parameters_,
+                                                tags,
+                                                index,
+                                                contents);
+  }
+
   template <typename T, typename I>
   const ContentPtr
   UnionArrayOf<T, I>::getitem_next(const SliceAt& at,
@@ -17,7 +17,6 @@
 #include "awkward/array/IndexedArray.h"
 #include "awkward/array/ByteMaskedArray.h"
 #include "awkward/array/BitMaskedArray.h"
-#include "awkward/array/VirtualArray.h"
 
 #include "awkward/array/UnmaskedArray.h"
 
@@ -354,6 +353,11 @@ namespace awkward {
     content_.get()->nbytes_part(largest);
   }
 
+  void
+  UnmaskedArray::fingerprint_part(uint64_t& hash) const {
+    content_.get()->fingerprint_part(hash);
+  }
+
   int64_t
   UnmaskedArray::length() const {
     return content_.get()->length();
@@ -585,10 +589,9 @@ namespace awkward {
   }
 
   bool
-  UnmaskedArray::mergeable(const ContentPtr& other, bool mergebool) const {
-    if (VirtualArray* raw = dynamic_cast<VirtualArray*>(other.get())) {
-      return mergeable(raw->array(), mergebool);
-    }
+  UnmaskedArray::mergeable(const ContentPtr& othercontent,
+                           bool mergebool) const {
+    ContentPtr other = othercontent.get()->materialized();
 
     if (!parameters_equal(other.get()->parameters())) {
       return false;
@@ -755,6 +758,13 @@ namespace awkward {
     }
   }
 
+  const ContentPtr
+  UnmaskedArray::packed() const {
+    return std::make_shared<UnmaskedArray>(identities_,
+                                           parameters_,
+                                           content_.get()->packed());
+  }
+
   const ContentPtr
   UnmaskedArray::getitem_next(const SliceAt& at,
                               const Slice& tail,
@@ -370,6 +370,11 @@ namespace awkward {
   void
   VirtualArray::nbytes_part(std::map<size_t, int64_t>& largest) const { }
 
+  void
+  VirtualArray::fingerprint_part(uint64_t& hash) const {
+    array().get()->fingerprint_part(hash);
+  }
+
   int64_t
   VirtualArray::length() const {
     int64_t out = generator_.get()->length();
@@ -579,6 +584,11 @@ namespace awkward {
     return array().get()->offsets_and_flattened(axis, depth);
   }
 
+  const ContentPtr
+  VirtualArray::materialized() const {
+    return array().get()->materialized();
+  }
+
   bool
   VirtualArray::mergeable(const ContentPtr& other, bool mergebool) const {
     return array().get()->mergeable(other, mergebool);
@@ -648,6 +658,11 @@ namespace awkward {
                                        depth);
   }
 
+  const ContentPtr
+  VirtualArray::packed() const {
+    return array().get()->packed();
+  }
+
   const ContentPtr
   VirtualArray::getitem(const Slice& where) const {
     ContentPtr peek = peek_array();
@@ -0,0 +1,376 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <sstream>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/array/IndexedArray.h"
+#include "awkward/array/ListOffsetArray.h"
+#include "awkward/array/RecordArray.h"
+#include "awkward/array/UnionArray.h"
+#include "awkward/array/UnmaskedArray.h"
+#include "awkward/partition/IrregularlyPartitionedArray.h"
+
+#include "awkward/builder/ChunkedArrayBuilder.h"
+
+namespace awkward {
+  namespace {
+    bool
+    sametype(const ContentPtr& one, const ContentPtr& two) {
+      util::TypeStrs typestrs;
+      return one.get()->type(typestrs).get()->equal(
+        two.get()->type(typestrs), true);
+    }
+
+    // Gives a chunk the type of `like`, a snapshot of the tail (which has
+    // seen every value so far), following the ways that an ArrayBuilder's
+    // type can grow: integers become reals, values become optional, records
+    // gain (optional) fields, unions gain contents, unknown types become
+    // known, and lists follow their contents.
+    const ContentPtr
+    retype(const ContentPtr& chunk, const ContentPtr& like) {
+      if (sametype(chunk, like)) {
+        return chunk;
+      }
+      int64_t length = chunk.get()->length();
+
+      if (IndexedOptionArray64* likeoption =
+          dynamic_cast<IndexedOptionArray64*>(like.get())) {
+        if (IndexedOptionArray64* option =
+            dynamic_cast<IndexedOptionArray64*>(chunk.get())) {
+          return std::make_shared<IndexedOptionArray64>(
+            option->identities(),
+            option->parameters(),
+            option->index(),
+            retype(option->content(), likeoption->content()));
+        }
+        return std::make_shared<UnmaskedArray>(
+          Identities::none(),
+          util::Parameters(),
+          retype(chunk, likeoption->content()));
+      }
+
+      else if (UnionArray8_64* likeunion =
+               dynamic_cast<UnionArray8_64*>(like.get())) {
+        // a UnionBuilder keeps its first contents and appends new ones
+        ContentPtrVec contents;
+        for (int64_t i = 0;  i < likeunion->numcontents();  i++) {
+          contents.push_back(
+            likeunion->content(i).get()->getitem_range_nowrap(0, 0));
+        }
+        if (UnionArray8_64* rawunion =
+            dynamic_cast<UnionArray8_64*>(chunk.get())) {
+          if (rawunion->numcontents() <= likeunion->numcontents()) {
+            for (int64_t i = 0;  i < rawunion->numcontents();  i++) {
+              contents[(size_t)i] = retype(rawunion->content(i),
+                                           likeunion->content(i));
+            }
+            return std::make_shared<UnionArray8_64>(rawunion->identities(),
+                                                    rawunion->parameters(),
+                                                    rawunion->tags(),
+                                                    rawunion->index(),
+                                                    contents);
+          }
+        }
+        else {
+          contents[0] = retype(chunk, likeunion->content(0));
+          Index8 tags(length);
+          struct Error err1 = awkward_unionarray_filltags_to8_const(
+            tags.ptr().get(),
+            0,
+            length,
+            0);
+          util::handle_error(err1, "ChunkedArrayBuilder", nullptr);
+          Index64 index(length);
+          struct Error err2 = awkward_unionarray_fillindex_to64_count(
+            index.ptr().get(),
+            0,
+            length);
+          util::handle_error(err2, "ChunkedArrayBuilder", nullptr);
+          return std::make_shared<UnionArray8_64>(Identities::none(),
+                                                  util::Parameters(),
+                                                  tags,
+                                                  index,
+                                                  contents);
+        }
+      }
+
+      else if (ListOffsetArray64* likelist =
+               dynamic_cast<ListOffsetArray64*>(like.get())) {
+        if (ListOffsetArray64* list =
+            dynamic_cast<ListOffsetArray64*>(chunk.get())) {
+          return std::make_shared<ListOffsetArray64>(
+            list->identities(),
+            list->parameters(),
+            list->offsets(),
+            retype(list->content(), likelist->content()));
+        }
+      }
+
+      else if (RecordArray* likerecord =
+               dynamic_cast<RecordArray*>(like.get())) {
+        if (RecordArray* record = dynamic_cast<RecordArray*>(chunk.get())) {
+          ContentPtrVec contents;
+          for (auto key : likerecord->keys()) {
+            ContentPtr likefield = likerecord->field(key);
+            if (record->haskey(key)) {
+              contents.push_back(retype(record->field(key), likefield));
+            }
+            else if (IndexedOptionArray64* likeoption =
+                     dynamic_cast<IndexedOptionArray64*>(likefield.get())) {
+              // a field that was added later: None in the earlier records
+              Index64 index(length);
+              struct Error err = awkward_index_rpad_and_clip_axis0_64(
+                index.ptr().get(),
+                length,
+                0);
+              util::handle_error(err, "ChunkedArrayBuilder", nullptr);
+              contents.push_back(std::make_shared<IndexedOptionArray64>(
+                Identities::none(),
+                likeoption->parameters(),
+                index,
+                likeoption->content().get()->getitem_range_nowrap(0, 0)));
+            }
+            else {
+              return chunk;
+            }
+          }
+          return std::make_shared<RecordArray>(record->identities(),
+                                               record->parameters(),
+                                               contents,
+                                               likerecord->recordlookup(),
+                                               length);
+        }
+      }
+
+      // numbers that became reals and unknown types that became known
+      ContentPtr empty = like.get()->getitem_range_nowrap(0, 0);
+      if (chunk.get()->mergeable(empty, false)) {
+        return chunk.get()->merge(empty);
+      }
+      return chunk;
+    }
+  }
+
+  ChunkedArrayBuilder::ChunkedArrayBuilder(const ArrayBuilderOptions& options,
+                                           int64_t chunksize)
+      : chunksize_(chunksize)
+      , tail_(options)
+      , depth_(0) {
+    if (chunksize <= 0) {
+      throw std::invalid_argument(
+        "ChunkedArrayBuilder chunksize must be positive");
+    }
+  }
+
+  int64_t
+  ChunkedArrayBuilder::chunksize() const {
+    return chunksize_;
+  }
+
+  const std::string
+  ChunkedArrayBuilder::tostring() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    int64_t length = (stops_.empty() ? 0 : stops_.back()) + tail_.length();
+    std::stringstream out;
+    out << "<ChunkedArrayBuilder length=\"" << length << "\" chunks=\""
+        << chunks_.size() << "\" chunksize=\"" << chunksize_ << "\"/>";
+    return out.str();
+  }
+
+  int64_t
+  ChunkedArrayBuilder::length() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (stops_.empty() ? 0 : stops_.back()) + tail_.length();
+  }
+
+  int64_t
+  ChunkedArrayBuilder::numchunks() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int64_t)chunks_.size();
+  }
+
+  void
+  ChunkedArrayBuilder::seal() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (depth_ != 0) {
+      throw std::invalid_argument(
+        "cannot seal a ChunkedArrayBuilder in the middle of an entry");
+    }
+    seal_nolock();
+  }
+
+  const PartitionedArrayPtr
+  ChunkedArrayBuilder::snapshot() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    ContentPtrVec partitions(chunks_);
+    std::vector<int64_t> stops(stops_);
+    // a partly filled entry is not included: lists, tuples, and records
+    // only count toward the length when they are ended
+    ContentPtr tail = tail_.snapshot();
+    if (!partitions.empty()  &&  !sametype(partitions.back(), tail)) {
+      // the type has changed since the last seal; the chunks are retyped
+      // for good by the next seal
+      for (auto& partition : partitions) {
+        partition = retype(partition, tail);
+      }
+    }
+    int64_t length = tail_.length();
+    if (length > 0  ||  partitions.empty()) {
+      partitions.push_back(tail);
+      stops.push_back((stops_.empty() ? 0 : stops_.back()) + length);
+    }
+    return std::make_shared<IrregularlyPartitionedArray>(partitions, stops);
+  }
+
+  void
+  ChunkedArrayBuilder::null() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.null();
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::boolean(bool x) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.boolean(x);
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::integer(int64_t x) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.integer(x);
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::real(double x) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.real(x);
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::bytestring(const std::string& x) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.bytestring(x);
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::string(const std::string& x) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.string(x);
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::beginlist() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.beginlist();
+    depth_++;
+  }
+
+  void
+  ChunkedArrayBuilder::endlist() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.endlist();
+    depth_--;
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::begintuple(int64_t numfields) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.begintuple(numfields);
+    depth_++;
+  }
+
+  void
+  ChunkedArrayBuilder::index(int64_t index) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.index(index);
+  }
+
+  void
+  ChunkedArrayBuilder::endtuple() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.endtuple();
+    depth_--;
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::beginrecord() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.beginrecord();
+    depth_++;
+  }
+
+  void
+  ChunkedArrayBuilder::beginrecord_check(const std::string& name) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.beginrecord_check(name);
+    depth_++;
+  }
+
+  void
+  ChunkedArrayBuilder::field_check(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.field_check(key);
+  }
+
+  void
+  ChunkedArrayBuilder::endrecord() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.endrecord();
+    depth_--;
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::append(const ContentPtr& array, int64_t at) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    tail_.append(array, at);
+    maybeseal();
+  }
+
+  void
+  ChunkedArrayBuilder::extend(const ContentPtr& array) {
+    std::lock_guard<std::mutex> lock(mutex_);
+    // one element at a time, so that chunks are sealed at #chunksize;
+    // the same array must be passed each time, since the tail refers to it
+    for (int64_t i = 0;  i < array.get()->length();  i++) {
+      tail_.append_nowrap(array, i);
+      maybeseal();
+    }
+  }
+
+  void
+  ChunkedArrayBuilder::maybeseal() {
+    if (depth_ == 0  &&  tail_.length() >= chunksize_) {
+      seal_nolock();
+    }
+  }
+
+  void
+  ChunkedArrayBuilder::seal_nolock() {
+    int64_t length = tail_.length();
+    if (length > 0) {
+      ContentPtr chunk = tail_.snapshot();
+      // all partitions of a snapshot must have the same type, so if the
+      // type has changed since the last seal, the earlier chunks follow it
+      if (!chunks_.empty()  &&  !sametype(chunks_.back(), chunk)) {
+        for (auto& earlier : chunks_) {
+          earlier = retype(earlier, chunk);
+        }
+      }
+      chunks_.push_back(chunk);
+      stops_.push_back((stops_.empty() ? 0 : stops_.back()) + length);
+      // clear allocates new buffers, so the chunk's buffers are never
+      // written again; the tail keeps what it knows about the type
+      tail_.clear();
+    }
+  }
+}
@@ -53,7 +53,8 @@ namespace awkward {
       , length_(length)
       , begun_(begun)
       , nextindex_(nextindex)
-      , nexttotry_(nexttotry) { }
+      , nexttotry_(nexttotry)
+      , cleared_(false) { }
 
   const std::string
   RecordBuilder::name() const {
@@ -77,14 +78,15 @@ namespace awkward {
 
   void
   RecordBuilder::clear() {
+    // keys_ and contents_ are kept together, so that the fields (the type
+    // knowledge) survive and stay aligned with their keys
     for (auto x : contents_) {
       x.get()->clear();
     }
-    keys_.clear();
-    pointers_.clear();
-    name_ = "";
-    nameptr_ = nullptr;
-    length_ = -1;
+    // fields that first appear after this are missing from the cleared
+    // records, so they are optional, as if those records were still here
+    cleared_ = (cleared_  ||  length_ > 0);
+    length_ = (length_ == -1 ? -1 : 0);
     begun_ = false;
     nextindex_ = -1;
     nexttotry_ = 0;
@@ -400,7 +402,7 @@ namespace awkward {
       } while (i != nexttotry_);
       nextindex_ = wrap_around;
       nexttotry_ = 0;
-      if (length_ == 0) {
+      if (length_ == 0  &&  !cleared_) {
         contents_.push_back(UnknownBuilder::fromempty(options_));
       }
       else {
@@ -445,7 +447,7 @@ namespace awkward {
       } while (i != nexttotry_);
       nextindex_ = wrap_around;
       nexttotry_ = 0;
-      if (length_ == 0) {
+      if (length_ == 0  &&  !cleared_) {
         contents_.push_back(UnknownBuilder::fromempty(options_));
       }
       else {
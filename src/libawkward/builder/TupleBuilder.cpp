@@ -56,7 +56,7 @@ namespace awkward {
     for (auto x : contents_) {
       x.get()->clear();
     }
-    length_ = -1;
+    length_ = (length_ == -1 ? -1 : 0);
     begun_ = false;
     nextindex_ = -1;
   }
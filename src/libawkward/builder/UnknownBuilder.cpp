@@ -30,7 +30,8 @@ namespace awkward {
   UnknownBuilder::UnknownBuilder(const ArrayBuilderOptions& options,
                                  int64_t nullcount)
       : options_(options)
-      , nullcount_(nullcount) { }
+      , nullcount_(nullcount)
+      , cleared_(false) { }
 
   const std::string
   UnknownBuilder::classname() const {
@@ -44,12 +45,14 @@ namespace awkward {
 
   void
   UnknownBuilder::clear() {
+    // the cleared Nones still make the type optional
+    cleared_ = (cleared_  ||  nullcount_ != 0);
     nullcount_ = 0;
   }
 
   const ContentPtr
   UnknownBuilder::snapshot() const {
-    if (nullcount_ == 0) {
+    if (nullcount_ == 0  &&  !cleared_) {
       return std::make_shared<EmptyArray>(Identities::none(),
                                           util::Parameters());
     }
@@ -83,7 +86,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::boolean(bool x) {
     BuilderPtr out = BoolBuilder::fromempty(options_);
-    if (nullcount_ != 0) {
+    if (nullcount_ != 0  ||  cleared_) {
       out = OptionBuilder::fromnulls(options_, nullcount_, out);
     }
     out.get()->boolean(x);
@@ -93,7 +96,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::integer(int64_t x) {
     BuilderPtr out = Int64Builder::fromempty(options_);
-    if (nullcount_ != 0) {
+    if (nullcount_ != 0  ||  cleared_) {
       out = OptionBuilder::fromnulls(options_, nullcount_, out);
     }
     out.get()->integer(x);
@@ -103,7 +106,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::real(double x) {
     BuilderPtr out = Float64Builder::fromempty(options_);
-    if (nullcount_ != 0) {
+    if (nullcount_ != 0  ||  cleared_) {
       out = OptionBuilder::fromnulls(options_, nullcount_, out);
     }
     out.get()->real(x);
@@ -113,7 +116,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::string(const char* x, int64_t length, const char* encoding) {
     BuilderPtr out = StringBuilder::fromempty(options_, encoding);
-    if (nullcount_ != 0) {
+    if (nullcount_ != 0  ||  cleared_) {
       out = OptionBuilder::fromnulls(options_, nullcount_, out);
     }
     out.get()->string(x, length, encoding);
@@ -123,7 +126,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::beginlist() {
     BuilderPtr out = ListBuilder::fromempty(options_);
-    if (nullcount_ != 0) {
+    if (nullcount_ != 0  ||  cleared_) {
       out = OptionBuilder::fromnulls(options_, nullcount_, out);
     }
     out.get()->beginlist();
@@ -139,7 +142,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::begintuple(int64_t numfields) {
     BuilderPtr out = TupleBuilder::fromempty(options_);
-    if (nullcount_ != 0) {
+    if (nullcount_ != 0  ||  cleared_) {
       out = OptionBuilder::fromnulls(options_, nullcount_, out);
     }
     out.get()->begintuple(numfields);
@@ -161,7 +164,7 @@ namespace awkward {
   const BuilderPtr
   UnknownBuilder::beginrecord(const char* name, bool check) {
     BuilderPtr out = RecordBuilder::fromempty(options_);
-    if (nullcount_ != 0) {
+    if (nullcount_ != 0  ||  cleared_) {
       out = OptionBuilder::fromnulls(options_, nullcount_, out);
     }
     out.get()->beginrecord(name, check);
@@ -0,0 +1,256 @@
+// BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "awkward/cpu-kernels/operations.h"
+#include "awkward/array/NumpyArray.h"
+
+#include "awkward/partition/PartitionIndex.h"
+
+namespace awkward {
+  ////////// BloomFilter
+
+  BloomFilter::BloomFilter(int64_t numbits, int64_t numhashes)
+      : numbits_(numbits)
+      , numhashes_(numhashes) {
+    if (numbits < 1) {
+      throw std::invalid_argument("BloomFilter numbits must be at least 1");
+    }
+    if (numhashes < 1) {
+      throw std::invalid_argument("BloomFilter numhashes must be at least 1");
+    }
+    bits_.resize((size_t)((numbits + 63) / 64), 0);
+  }
+
+  BloomFilter
+  BloomFilter::forcount(int64_t count, double falsepositive) {
+    if (!(falsepositive > 0.0  &&  falsepositive < 1.0)) {
+      throw std::invalid_argument(
+        "BloomFilter falsepositive must be between 0 and 1 (exclusive)");
+    }
+    double ln2 = std::log(2.0);
+    double n = (double)std::max(count, (int64_t)1);
+    double numbits = std::ceil(-n * std::log(falsepositive) / (ln2*ln2));
+    double numhashes = std::round(numbits / n * ln2);
+    return BloomFilter(std::max((int64_t)numbits, (int64_t)64),
+                       std::max((int64_t)numhashes, (int64_t)1));
+  }
+
+  int64_t
+  BloomFilter::numbits() const {
+    return numbits_;
+  }
+
+  int64_t
+  BloomFilter::numhashes() const {
+    return numhashes_;
+  }
+
+  void
+  BloomFilter::add(uint64_t hash) {
+    // double hashing: bit i is (h1 + i*h2) mod numbits
+    uint64_t h1 = hash;
+    uint64_t h2 = ((hash >> 32) | (hash << 32)) | 1;
+    for (int64_t i = 0;  i < numhashes_;  i++) {
+      uint64_t bit = (h1 + (uint64_t)i*h2) % (uint64_t)numbits_;
+      bits_[(size_t)(bit >> 6)] |= ((uint64_t)1 << (bit & 63));
+    }
+  }
+
+  bool
+  BloomFilter::mightcontain(uint64_t hash) const {
+    uint64_t h1 = hash;
+    uint64_t h2 = ((hash >> 32) | (hash << 32)) | 1;
+    for (int64_t i = 0;  i < numhashes_;  i++) {
+      uint64_t bit = (h1 + (uint64_t)i*h2) % (uint64_t)numbits_;
+      if ((bits_[(size_t)(bit >> 6)] & ((uint64_t)1 << (bit & 63))) == 0) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  ////////// PartitionIndex
+
+  // combines the hashes of a key's columns, in order
+  inline uint64_t
+  combine_keyhash(uint64_t hash, uint64_t columnhash) {
+    hash = (hash ^ columnhash)*0x9E3779B97F4A7C15ULL;
+    return hash ^ (hash >> 32);
+  }
+
+  PartitionIndex::PartitionIndex(int64_t numkeys,
+                                 double falsepositive,
+                                 bool hashindex)
+      : numkeys_(numkeys)
+      , falsepositive_(falsepositive)
+      , hashindex_(hashindex) {
+    if (numkeys < 1) {
+      throw std::invalid_argument(
+        "PartitionIndex must have at least one key column");
+    }
+    if (!(falsepositive > 0.0  &&  falsepositive < 1.0)) {
+      throw std::invalid_argument(
+        "PartitionIndex falsepositive must be between 0 and 1 (exclusive)");
+    }
+  }
+
+  int64_t
+  PartitionIndex::numkeys() const {
+    return numkeys_;
+  }
+
+  double
+  PartitionIndex::falsepositive() const {
+    return falsepositive_;
+  }
+
+  bool
+  PartitionIndex::hashindex() const {
+    return hashindex_;
+  }
+
+  int64_t
+  PartitionIndex::numpartitions() const {
+    return (int64_t)stops_.size();
+  }
+
+  int64_t
+  PartitionIndex::length() const {
+    return stops_.empty() ? 0 : stops_.back();
+  }
+
+  const std::vector<int64_t>
+  PartitionIndex::stops() const {
+    return stops_;
+  }
+
+  void
+  PartitionIndex::append(const ContentPtrVec& keys) {
+    if ((int64_t)keys.size() != numkeys_) {
+      throw std::invalid_argument(
+        std::string("PartitionIndex has ") + std::to_string(numkeys_)
+        + std::string(" key columns, but ") + std::to_string(keys.size())
+        + std::string(" were given"));
+    }
+    int64_t length = -1;
+    std::vector<ContentPtr> columnhashes;
+    for (auto key : keys) {
+      NumpyArray* raw = dynamic_cast<NumpyArray*>(key.get());
+      std::string format = (raw == nullptr ? "" : raw->format());
+      if (raw == nullptr  ||  raw->ndim() != 1  ||
+          !(format == "b"  ||  format == "B"  ||  format == "h"  ||
+            format == "H"  ||  format == "i"  ||  format == "I"  ||
+            format == "l"  ||  format == "L"  ||  format == "q"  ||
+            format == "Q")) {
+        throw std::invalid_argument(
+          "PartitionIndex keys must be one-dimensional NumpyArrays "
+          "of integers");
+      }
+      if (length >= 0  &&  raw->length() != length) {
+        throw std::invalid_argument(
+          "PartitionIndex key columns must all have the same length");
+      }
+      length = raw->length();
+      columnhashes.push_back(raw->hash64());
+    }
+
+    int64_t start = this->length();
+    BloomFilter bloom = BloomFilter::forcount(length, falsepositive_);
+    for (int64_t i = 0;  i < length;  i++) {
+      uint64_t hash = 0;
+      for (auto columnhash : columnhashes) {
+        NumpyArray* raw = dynamic_cast<NumpyArray*>(columnhash.get());
+        hash = combine_keyhash(
+          hash, reinterpret_cast<uint64_t*>(raw->byteptr())[i]);
+      }
+      bloom.add(hash);
+      if (hashindex_) {
+        positions_.emplace(hash, start + i);
+      }
+    }
+    blooms_.push_back(bloom);
+    stops_.push_back(start + length);
+  }
+
+  const std::vector<int64_t>
+  PartitionIndex::candidates(const std::vector<int64_t>& key) const {
+    uint64_t hash = keyhash(key);
+    std::vector<int64_t> out;
+    for (int64_t partitionid = 0;
+         partitionid < (int64_t)blooms_.size();
+         partitionid++) {
+      if (blooms_[(size_t)partitionid].mightcontain(hash)) {
+        out.push_back(partitionid);
+      }
+    }
+    return out;
+  }
+
+  const std::vector<std::pair<int64_t, int64_t>>
+  PartitionIndex::find(const std::vector<int64_t>& key) const {
+    if (!hashindex_) {
+      throw std::invalid_argument(
+        "PartitionIndex was built without a hash index (hashindex=False)");
+    }
+    uint64_t hash = keyhash(key);
+    std::vector<int64_t> ats;
+    auto range = positions_.equal_range(hash);
+    for (auto it = range.first;  it != range.second;  ++it) {
+      ats.push_back(it->second);
+    }
+    std::sort(ats.begin(), ats.end());
+    std::vector<std::pair<int64_t, int64_t>> out;
+    for (auto at : ats) {
+      int64_t partitionid;
+      int64_t index;
+      partitionid_index_at(at, partitionid, index);
+      out.push_back(std::pair<int64_t, int64_t>(partitionid, index));
+    }
+    return out;
+  }
+
+  void
+  PartitionIndex::partitionid_index_at(int64_t at,
+                                       int64_t& partitionid,
+                                       int64_t& index) const {
+    if (at < 0) {
+      partitionid = -1;
+      index = -1;
+      return;
+    }
+    auto it = std::upper_bound(stops_.begin(), stops_.end(), at);
+    partitionid = (int64_t)(it - stops_.begin());
+    if (it == stops_.end()) {
+      index = 0;
+    }
+    else {
+      index = at - (partitionid == 0 ? 0 : stops_[(size_t)partitionid - 1]);
+    }
+  }
+
+  uint64_t
+  PartitionIndex::keyhash(const std::vector<int64_t>& key) const {
+    if ((int64_t)key.size() != numkeys_) {
+      throw std::invalid_argument(
+        std::string("PartitionIndex has ") + std::to_string(numkeys_)
+        + std::string(" key columns, but the key has ")
+        + std::to_string(key.size()) + std::string(" values"));
+    }
+    uint64_t hash = 0;
+    for (auto value : key) {
+      uint64_t columnhash;
+      struct Error err = awkward_numpyarray_hash64_from64(
+        &columnhash,
+        &value,
+        0,
+        1,
+        1);
+      util::handle_error(err, "PartitionIndex", nullptr);
+      hash = combine_keyhash(hash, columnhash);
+    }
+    return hash;
+  }
+}
@@ -38,6 +38,7 @@ namespace awkward {
       case uint64:  s = "uint64"; break;
       case float32: s = "float32"; break;
       case float64: s = "float64"; break;
+      case float16: s = "float16"; break;
       default:      s = "unknown"; break;
     }
     if (parameters_.empty()) {
@@ -118,6 +119,7 @@ namespace awkward {
 #endif
       case float32: itemsize = 4; format = "f"; break;
       case float64: itemsize = 8; format = "d"; break;
+      case float16: itemsize = 2; format = "e"; break;
       default: throw std::runtime_error(
                  std::string("unexpected dtype: ") + std::to_string(dtype_));
     }
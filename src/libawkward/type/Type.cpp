@@ -13,7 +13,7 @@ namespace rj = rapidjson;
 
 namespace awkward {
   Type::Type(const util::Parameters& parameters, const std::string& typestr)
-      : parameters_(parameters)
+      : parameters_(parameters.intern())
       , typestr_(typestr) { }
 
   Type::~Type() = default;
@@ -30,7 +30,7 @@ namespace awkward {
 
   void
   Type::setparameters(const util::Parameters& parameters) {
-    parameters_ = parameters;
+    parameters_ = parameters.intern();
   }
 
   const std::string
@@ -45,6 +45,7 @@ namespace awkward {
   void
   Type::setparameter(const std::string& key, const std::string& value) {
     parameters_[key] = value;
+    parameters_ = parameters_.intern();
   }
 
   bool
@@ -2,6 +2,9 @@
 
 #include <sstream>
 #include <set>
+#include <algorithm>
+#include <mutex>
+#include <tuple>
 
 #include "rapidjson/document.h"
 
@@ -82,24 +85,64 @@ namespace awkward {
       return out;
     }
 
+    RecordLookup::RecordLookup(const RecordLookup& other)
+        : std::vector<std::string>(other) { }
+
+    RecordLookup&
+    RecordLookup::operator=(const RecordLookup& other) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      std::vector<std::string>::operator=(other);
+      index_.clear();
+      indexed_ = 0;
+      return *this;
+    }
+
+    int64_t
+    RecordLookup::position(const std::string& key) const {
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (indexed_ != size()) {
+        index_.clear();
+        index_.reserve(size());
+        for (size_t i = 0;  i < size();  i++) {
+          index_.emplace(at(i), (int64_t)i);
+        }
+        indexed_ = size();
+      }
+      auto found = index_.find(key);
+      if (found == index_.end()) {
+        return -1;
+      }
+      return found->second;
+    }
+
+    // Parses a non-negative decimal integer without exceptions; returns -1
+    // if the key is anything else.
+    static int64_t
+    numeric_key(const std::string& key) {
+      if (key.empty()  ||  key.length() > 18) {
+        return -1;
+      }
+      int64_t out = 0;
+      for (auto c : key) {
+        if (c < '0'  ||  c > '9') {
+          return -1;
+        }
+        out = out*10 + (int64_t)(c - '0');
+      }
+      return out;
+    }
+
     int64_t
     fieldindex(const RecordLookupPtr& recordlookup,
                const std::string& key,
                int64_t numfields) {
       int64_t out = -1;
       if (recordlookup.get() != nullptr) {
-        for (size_t i = 0;  i < recordlookup.get()->size();  i++) {
-          if (recordlookup.get()->at(i) == key) {
-            out = (int64_t)i;
-            break;
-          }
-        }
+        out = recordlookup.get()->position(key);
       }
       if (out == -1) {
-        try {
-          out = (int64_t)std::stoi(key);
-        }
-        catch (std::invalid_argument err) {
+        out = numeric_key(key);
+        if (out == -1) {
           throw std::invalid_argument(
             std::string("key ") + quote(key, true)
             + std::string(" does not exist (not in record)"));
@@ -136,13 +179,12 @@ namespace awkward {
     haskey(const RecordLookupPtr& recordlookup,
            const std::string& key,
            int64_t numfields) {
-      try {
-        fieldindex(recordlookup, key, numfields);
-      }
-      catch (std::invalid_argument err) {
-        return false;
+      if (recordlookup.get() != nullptr  &&
+          recordlookup.get()->position(key) != -1) {
+        return true;
       }
-      return true;
+      int64_t out = numeric_key(key);
+      return 0 <= out  &&  out < numfields;
     }
 
     const std::vector<std::string>
@@ -162,6 +204,132 @@ namespace awkward {
       return out;
     }
 
+    Parameters::Parameters()
+        : map_(nullptr)
+        , interned_(false) { }
+
+    Parameters::Parameters(const Map& map)
+        : map_(map.empty() ? nullptr : std::make_shared<Map>(map))
+        , interned_(false) { }
+
+    // shared by all empty Parameters so that they do not allocate
+    static const Parameters::Map emptymap;
+
+    Parameters::const_iterator
+    Parameters::begin() const {
+      return map_.get() == nullptr ? emptymap.begin() : map_.get()->begin();
+    }
+
+    Parameters::const_iterator
+    Parameters::end() const {
+      return map_.get() == nullptr ? emptymap.end() : map_.get()->end();
+    }
+
+    Parameters::const_iterator
+    Parameters::find(const std::string& key) const {
+      return map_.get() == nullptr ? emptymap.end() : map_.get()->find(key);
+    }
+
+    size_t
+    Parameters::count(const std::string& key) const {
+      return map_.get() == nullptr ? 0 : map_.get()->count(key);
+    }
+
+    size_t
+    Parameters::size() const {
+      return map_.get() == nullptr ? 0 : map_.get()->size();
+    }
+
+    bool
+    Parameters::empty() const {
+      return map_.get() == nullptr  ||  map_.get()->empty();
+    }
+
+    std::string&
+    Parameters::operator[](const std::string& key) {
+      return detach()[key];
+    }
+
+    size_t
+    Parameters::erase(const std::string& key) {
+      if (count(key) == 0) {
+        return 0;
+      }
+      return detach().erase(key);
+    }
+
+    bool
+    Parameters::operator==(const Parameters& other) const {
+      if (same(other)) {
+        return true;
+      }
+      if (size() != other.size()) {
+        return false;
+      }
+      return std::equal(begin(), end(), other.begin());
+    }
+
+    bool
+    Parameters::operator!=(const Parameters& other) const {
+      return !(*this == other);
+    }
+
+    bool
+    Parameters::same(const Parameters& other) const {
+      return map_.get() == other.map_.get();
+    }
+
+    // Every interned map, keyed by its contents. The pool only holds weak
+    // references, so a map is freed when the last node using it is; expired
+    // entries are swept whenever the pool doubles in size.
+    static std::mutex intern_mutex;
+    static std::map<Parameters::Map, std::weak_ptr<Parameters::Map>>
+      intern_pool;
+    static size_t intern_sweep = 64;
+
+    const Parameters
+    Parameters::intern() const {
+      if (interned_  ||  empty()) {
+        return *this;
+      }
+      Parameters out;
+      std::lock_guard<std::mutex> lock(intern_mutex);
+      auto found = intern_pool.find(*map_.get());
+      if (found != intern_pool.end()) {
+        out.map_ = found->second.lock();
+      }
+      if (out.map_.get() == nullptr) {
+        if (intern_pool.size() >= intern_sweep) {
+          for (auto it = intern_pool.begin();  it != intern_pool.end();  ) {
+            if (it->second.expired()) {
+              it = intern_pool.erase(it);
+            }
+            else {
+              ++it;
+            }
+          }
+          intern_sweep = std::max((size_t)64, 2*intern_pool.size());
+        }
+        // always a new map: non-interned copies of map_ may modify it
+        out.map_ = std::make_shared<Map>(*map_.get());
+        intern_pool[*map_.get()] = out.map_;
+      }
+      out.interned_ = true;
+      return out;
+    }
+
+    Parameters::Map&
+    Parameters::detach() {
+      if (map_.get() == nullptr) {
+        map_ = std::make_shared<Map>();
+      }
+      else if (interned_  ||  map_.use_count() > 1) {
+        map_ = std::make_shared<Map>(*map_.get());
+      }
+      interned_ = false;
+      return *map_.get();
+    }
+
     bool
     parameter_equals(const Parameters& parameters,
                      const std::string& key,
@@ -183,6 +351,9 @@ namespace awkward {
 
     bool
     parameters_equal(const Parameters& self, const Parameters& other) {
+      if (self.same(other)) {
+        return true;
+      }
       std::set<std::string> checked;
       for (auto pair : self) {
         if (!parameter_equals(other, pair.first, pair.second)) {
@@ -289,6 +460,118 @@ namespace awkward {
       return std::string();
     }
 
+    // Hashes of buffer ranges, keyed by address, range, and (for strided
+    // arrays) the shape and strides, which are empty for a contiguous
+    // range. The weak reference identifies the buffer: if it has expired or
+    // belongs to another control block, the address has been reused.
+    // Expired entries are swept whenever the cache doubles in size.
+    struct FingerprintEntry {
+      std::weak_ptr<void> owner;
+      uint64_t hash;
+    };
+    using FingerprintKey = std::tuple<const void*,
+                                      int64_t,
+                                      int64_t,
+                                      std::vector<int64_t>>;
+    static std::mutex fingerprint_mutex;
+    static std::map<FingerprintKey, FingerprintEntry> fingerprint_cache;
+    static size_t fingerprint_sweep = 64;
+
+    static bool
+    fingerprint_cached(const std::shared_ptr<void>& ptr,
+                       const FingerprintKey& key,
+                       uint64_t& hash) {
+      std::lock_guard<std::mutex> lock(fingerprint_mutex);
+      auto found = fingerprint_cache.find(key);
+      if (found != fingerprint_cache.end()) {
+        const std::weak_ptr<void>& owner = found->second.owner;
+        if (!owner.expired()  &&
+            !owner.owner_before(ptr)  &&  !ptr.owner_before(owner)) {
+          hash = found->second.hash;
+          return true;
+        }
+      }
+      return false;
+    }
+
+    static void
+    fingerprint_store(const std::shared_ptr<void>& ptr,
+                      const FingerprintKey& key,
+                      uint64_t hash) {
+      std::lock_guard<std::mutex> lock(fingerprint_mutex);
+      if (fingerprint_cache.size() >= fingerprint_sweep) {
+        for (auto it = fingerprint_cache.begin();
+             it != fingerprint_cache.end();  ) {
+          if (it->second.owner.expired()) {
+            it = fingerprint_cache.erase(it);
+          }
+          else {
+            ++it;
+          }
+        }
+        fingerprint_sweep = std::max((size_t)64, 2*fingerprint_cache.size());
+      }
+      FingerprintEntry entry = { ptr, hash };
+      fingerprint_cache[key] = entry;
+    }
+
+    uint64_t
+    buffer_fingerprint(const std::shared_ptr<void>& ptr,
+                       int64_t byteoffset,
+                       int64_t bytelength) {
+      FingerprintKey key(ptr.get(),
+                         byteoffset,
+                         bytelength,
+                         std::vector<int64_t>());
+      uint64_t out;
+      if (fingerprint_cached(ptr, key, out)) {
+        return out;
+      }
+      struct Error err = awkward_buffer_hash64(
+        &out,
+        reinterpret_cast<const uint8_t*>(ptr.get()),
+        byteoffset,
+        bytelength,
+        0);
+      handle_error(err, "fingerprint", nullptr);
+      fingerprint_store(ptr, key, out);
+      return out;
+    }
+
+    uint64_t
+    buffer_fingerprint(const std::shared_ptr<void>& ptr,
+                       int64_t byteoffset,
+                       int64_t itemsize,
+                       const std::vector<ssize_t>& shape,
+                       const std::vector<ssize_t>& strides) {
+      std::vector<int64_t> layout(shape.begin(), shape.end());
+      layout.insert(layout.end(), strides.begin(), strides.end());
+      int64_t ndim = (int64_t)shape.size();
+      FingerprintKey key(ptr.get(), byteoffset, itemsize, layout);
+      uint64_t out;
+      if (fingerprint_cached(ptr, key, out)) {
+        return out;
+      }
+      struct Error err = awkward_buffer_hash64_strided(
+        &out,
+        reinterpret_cast<const uint8_t*>(ptr.get()),
+        byteoffset,
+        layout.data(),
+        layout.data() + ndim,
+        ndim,
+        itemsize,
+        0);
+      handle_error(err, "fingerprint", nullptr);
+      fingerprint_store(ptr, key, out);
+      return out;
+    }
+
+    void
+    fingerprint_combine(uint64_t& hash, uint64_t value) {
+      // mixing step in the style of boost::hash_combine
+      hash ^= value + 0x9e3779b97f4a7c15ULL + (hash << 12) + (hash >> 4);
+    }
+
     template <>
     Error awkward_identities32_from_listoffsetarray<int32_t>(
       int32_t* toptr,
@@ -1028,15 +1311,52 @@ namespace awkward {
     }
 
     template <>
-    Error awkward_listarray_getitem_next_at_64<int32_t>(
-      int64_t* tocarry,
+    Error awkward_numpyarray_getitem_next_null_strided<int32_t>(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t len,
+      int64_t tostride,
+      int64_t fromstride,
+      int64_t offset,
+      const int32_t* pos) {
+      return awkward_numpyarray_getitem_next_null_strided_32(
+        toptr,
+        fromptr,
+        len,
+        tostride,
+        fromstride,
+        offset,
+        pos);
+    }
+    template <>
+    Error awkward_numpyarray_getitem_next_null_strided<int64_t>(
+      uint8_t* toptr,
+      const uint8_t* fromptr,
+      int64_t len,
+      int64_t tostride,
+      int64_t fromstride,
+      int64_t offset,
+      const int64_t* pos) {
+      return awkward_numpyarray_getitem_next_null_strided_64(
+        toptr,
+        fromptr,
+        len,
+        tostride,
+        fromstride,
+        offset,
+        pos);
+    }
+
+    template <>
+    Error awkward_listarray_getitem_next_at<int32_t>(
+      int32_t* tocarry,
       const int32_t* fromstarts,
       const int32_t* fromstops,
       int64_t lenstarts,
       int64_t startsoffset,
       int64_t stopsoffset,
       int64_t at) {
-      return awkward_listarray32_getitem_next_at_64(
+      return awkward_listarray32_getitem_next_at_32(
         tocarry,
         fromstarts,
         fromstops,
@@ -1046,7 +1366,7 @@ namespace awkward {
         at);
     }
     template <>
-    Error awkward_listarray_getitem_next_at_64<uint32_t>(
+    Error awkward_listarray_getitem_next_at<uint32_t>(
       int64_t* tocarry,
       const uint32_t* fromstarts,
       const uint32_t* fromstops,
@@ -1064,7 +1384,7 @@ namespace awkward {
         at);
     }
     template <>
-    Error awkward_listarray_getitem_next_at_64<int64_t>(
+    Error awkward_listarray_getitem_next_at<int64_t>(
       int64_t* tocarry,
       const int64_t* fromstarts,
       const int64_t* fromstops,
@@ -1150,9 +1470,9 @@ namespace awkward {
     }
 
     template <>
-    Error awkward_listarray_getitem_next_range_64<int32_t>(
+    Error awkward_listarray_getitem_next_range<int32_t>(
       int32_t* tooffsets,
-      int64_t* tocarry,
+      int32_t* tocarry,
       const int32_t* fromstarts,
       const int32_t* fromstops,
       int64_t lenstarts,
@@ -1161,7 +1481,7 @@ namespace awkward {
       int64_t start,
       int64_t stop,
       int64_t step) {
-      return awkward_listarray32_getitem_next_range_64(
+      return awkward_listarray32_getitem_next_range_32(
         tooffsets,
         tocarry,
         fromstarts,
@@ -1174,7 +1494,7 @@ namespace awkward {
         step);
     }
     template <>
-    Error awkward_listarray_getitem_next_range_64<uint32_t>(
+    Error awkward_listarray_getitem_next_range<uint32_t>(
       uint32_t* tooffsets,
       int64_t* tocarry,
       const uint32_t* fromstarts,
@@ -1198,7 +1518,7 @@ namespace awkward {
         step);
     }
     template <>
-    Error awkward_listarray_getitem_next_range_64<int64_t>(
+    Error awkward_listarray_getitem_next_range<int64_t>(
       int64_t* tooffsets,
       int64_t* tocarry,
       const int64_t* fromstarts,
@@ -1291,8 +1611,8 @@ namespace awkward {
     }
 
     template <>
-    Error awkward_listarray_getitem_next_array_64<int32_t>(
-      int64_t* tocarry,
+    Error awkward_listarray_getitem_next_array<int32_t>(
+      int32_t* tocarry,
       int64_t* toadvanced,
       const int32_t* fromstarts,
       const int32_t* fromstops,
@@ -1302,7 +1622,7 @@ namespace awkward {
       int64_t lenstarts,
       int64_t lenarray,
       int64_t lencontent) {
-      return awkward_listarray32_getitem_next_array_64(
+      return awkward_listarray32_getitem_next_array_32(
         tocarry,
         toadvanced,
         fromstarts,
@@ -1315,7 +1635,7 @@ namespace awkward {
         lencontent);
     }
     template <>
-    Error awkward_listarray_getitem_next_array_64<uint32_t>(
+    Error awkward_listarray_getitem_next_array<uint32_t>(
       int64_t* tocarry,
       int64_t* toadvanced,
       const uint32_t* fromstarts,
@@ -1339,7 +1659,7 @@ namespace awkward {
         lencontent);
     }
     template <>
-    Error awkward_listarray_getitem_next_array_64<int64_t>(
+    Error awkward_listarray_getitem_next_array<int64_t>(
       int64_t* tocarry,
       int64_t* toadvanced,
       const int64_t* fromstarts,
@@ -1364,8 +1684,8 @@ namespace awkward {
     }
 
     template <>
-    Error awkward_listarray_getitem_next_array_advanced_64<int32_t>(
-      int64_t* tocarry,
+    Error awkward_listarray_getitem_next_array_advanced<int32_t>(
+      int32_t* tocarry,
       int64_t* toadvanced,
       const int32_t* fromstarts,
       const int32_t* fromstops,
@@ -1376,7 +1696,7 @@ namespace awkward {
       int64_t lenstarts,
       int64_t lenarray,
       int64_t lencontent) {
-      return awkward_listarray32_getitem_next_array_advanced_64(
+      return awkward_listarray32_getitem_next_array_advanced_32(
         tocarry,
         toadvanced,
         fromstarts,
@@ -1390,7 +1710,7 @@ namespace awkward {
         lencontent);
     }
     template <>
-    Error awkward_listarray_getitem_next_array_advanced_64<uint32_t>(
+    Error awkward_listarray_getitem_next_array_advanced<uint32_t>(
       int64_t* tocarry,
       int64_t* toadvanced,
       const uint32_t* fromstarts,
@@ -1416,7 +1736,7 @@ namespace awkward {
         lencontent);
     }
     template <>
-    Error awkward_listarray_getitem_next_array_advanced_64<int64_t>(
+    Error awkward_listarray_getitem_next_array_advanced<int64_t>(
       int64_t* tocarry,
       int64_t* toadvanced,
       const int64_t* fromstarts,
@@ -1443,7 +1763,7 @@ namespace awkward {
     }
 
     template <>
-    Error awkward_listarray_getitem_carry_64<int32_t>(
+    Error awkward_listarray_getitem_carry<int32_t, int64_t>(
       int32_t* tostarts,
       int32_t* tostops,
       const int32_t* fromstarts,
@@ -1465,7 +1785,7 @@ namespace awkward {
         lencarry);
     }
     template <>
-    Error awkward_listarray_getitem_carry_64<uint32_t>(
+    Error awkward_listarray_getitem_carry<uint32_t, int64_t>(
       uint32_t* tostarts,
       uint32_t* tostops,
       const uint32_t* fromstarts,
@@ -1487,7 +1807,7 @@ namespace awkward {
         lencarry);
     }
     template <>
-    Error awkward_listarray_getitem_carry_64<int64_t>(
+    Error awkward_listarray_getitem_carry<int64_t, int64_t>(
       int64_t* tostarts,
       int64_t* tostops,
       const int64_t* fromstarts,
@@ -1508,6 +1828,72 @@ namespace awkward {
         lenstarts,
         lencarry);
     }
+    template <>
+    Error awkward_listarray_getitem_carry<int32_t, int32_t>(
+      int32_t* tostarts,
+      int32_t* tostops,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      const int32_t* fromcarry,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lencarry) {
+      return awkward_listarray32_getitem_carry_32(
+        tostarts,
+        tostops,
+        fromstarts,
+        fromstops,
+        fromcarry,
+        startsoffset,
+        stopsoffset,
+        lenstarts,
+        lencarry);
+    }
+    template <>
+    Error awkward_listarray_getitem_carry<uint32_t, int32_t>(
+      uint32_t* tostarts,
+      uint32_t* tostops,
+      const uint32_t* fromstarts,
+      const uint32_t* fromstops,
+      const int32_t* fromcarry,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lencarry) {
+      return awkward_listarrayU32_getitem_carry_32(
+        tostarts,
+        tostops,
+        fromstarts,
+        fromstops,
+        fromcarry,
+        startsoffset,
+        stopsoffset,
+        lenstarts,
+        lencarry);
+    }
+    template <>
+    Error awkward_listarray_getitem_carry<int64_t, int32_t>(
+      int64_t* tostarts,
+      int64_t* tostops,
+      const int64_t* fromstarts,
+      const int64_t* fromstops,
+      const int32_t* fromcarry,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t lenstarts,
+      int64_t lencarry) {
+      return awkward_listarray64_getitem_carry_32(
+        tostarts,
+        tostops,
+        fromstarts,
+        fromstops,
+        fromcarry,
+        startsoffset,
+        stopsoffset,
+        lenstarts,
+        lencarry);
+    }
 
     template <>
     Error awkward_listarray_num_64<int32_t>(
@@ -1613,6 +1999,61 @@ namespace awkward {
         inneroffsetslen);
     }
 
+    template <>
+    Error awkward_listoffsetarray_flatten_offsets<int32_t>(
+      int32_t* tooffsets,
+      const int32_t* outeroffsets,
+      int64_t outeroffsetsoffset,
+      int64_t outeroffsetslen,
+      const int64_t* inneroffsets,
+      int64_t inneroffsetsoffset,
+      int64_t inneroffsetslen) {
+      return awkward_listoffsetarray32_flatten_offsets_32(
+        tooffsets,
+        outeroffsets,
+        outeroffsetsoffset,
+        outeroffsetslen,
+        inneroffsets,
+        inneroffsetsoffset,
+        inneroffsetslen);
+    }
+    template <>
+    Error awkward_listoffsetarray_flatten_offsets<uint32_t>(
+      uint32_t* tooffsets,
+      const uint32_t* outeroffsets,
+      int64_t outeroffsetsoffset,
+      int64_t outeroffsetslen,
+      const int64_t* inneroffsets,
+      int64_t inneroffsetsoffset,
+      int64_t inneroffsetslen) {
+      return awkward_listoffsetarrayU32_flatten_offsetsU32(
+        tooffsets,
+        outeroffsets,
+        outeroffsetsoffset,
+        outeroffsetslen,
+        inneroffsets,
+        inneroffsetsoffset,
+        inneroffsetslen);
+    }
+    template <>
+    Error awkward_listoffsetarray_flatten_offsets<int64_t>(
+      int64_t* tooffsets,
+      const int64_t* outeroffsets,
+      int64_t outeroffsetsoffset,
+      int64_t outeroffsetslen,
+      const int64_t* inneroffsets,
+      int64_t inneroffsetsoffset,
+      int64_t inneroffsetslen) {
+      return awkward_listoffsetarray64_flatten_offsets_64(
+        tooffsets,
+        outeroffsets,
+        outeroffsetsoffset,
+        outeroffsetslen,
+        inneroffsets,
+        inneroffsetsoffset,
+        inneroffsetslen);
+    }
+
     template <>
     Error awkward_indexedarray_flatten_none2empty_64<int32_t>(
       int64_t* outoffsets,
@@ -2449,15 +2890,32 @@ namespace awkward {
         stopsoffset,
         length);
     }
+
     template <>
-    Error awkward_listarray_compact_offsets64(
-      int64_t* tooffsets,
+    Error awkward_listarray_compact_offsets<int32_t>(
+      int32_t* tooffsets,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t length) {
+      return awkward_listarray32_compact_offsets32(
+        tooffsets,
+        fromstarts,
+        fromstops,
+        startsoffset,
+        stopsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listarray_compact_offsets<uint32_t>(
+      uint32_t* tooffsets,
       const uint32_t* fromstarts,
       const uint32_t* fromstops,
       int64_t startsoffset,
       int64_t stopsoffset,
       int64_t length) {
-      return awkward_listarrayU32_compact_offsets64(
+      return awkward_listarrayU32_compact_offsetsU32(
         tooffsets,
         fromstarts,
         fromstops,
@@ -2466,7 +2924,7 @@ namespace awkward {
         length);
     }
     template <>
-    Error awkward_listarray_compact_offsets64(
+    Error awkward_listarray_compact_offsets<int64_t>(
       int64_t* tooffsets,
       const int64_t* fromstarts,
       const int64_t* fromstops,
@@ -2481,21 +2939,120 @@ namespace awkward {
         stopsoffset,
         length);
     }
-
     template <>
-    Error awkward_listoffsetarray_compact_offsets64(
+    Error awkward_listarray_compact_offsets64(
       int64_t* tooffsets,
-      const int32_t* fromoffsets,
-      int64_t offsetsoffset,
+      const uint32_t* fromstarts,
+      const uint32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
       int64_t length) {
-      return awkward_listoffsetarray32_compact_offsets64(
+      return awkward_listarrayU32_compact_offsets64(
         tooffsets,
-        fromoffsets,
-        offsetsoffset,
+        fromstarts,
+        fromstops,
+        startsoffset,
+        stopsoffset,
         length);
     }
     template <>
-    Error awkward_listoffsetarray_compact_offsets64(
+    Error awkward_listarray_compact_offsets64(
+      int64_t* tooffsets,
+      const int64_t* fromstarts,
+      const int64_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      int64_t length) {
+      return awkward_listarray64_compact_offsets64(
+        tooffsets,
+        fromstarts,
+        fromstops,
+        startsoffset,
+        stopsoffset,
+        length);
+    }
+
+    template <>
+    Error awkward_listarray_hash64(
+      uint64_t* tohash,
+      const int32_t* fromstarts,
+      const int32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      const uint8_t* fromcontent,
+      int64_t contentoffset,
+      int64_t itemsize,
+      int64_t length) {
+      return awkward_listarray32_hash64(
+        tohash,
+        fromstarts,
+        fromstops,
+        startsoffset,
+        stopsoffset,
+        fromcontent,
+        contentoffset,
+        itemsize,
+        length);
+    }
+    template <>
+    Error awkward_listarray_hash64(
+      uint64_t* tohash,
+      const uint32_t* fromstarts,
+      const uint32_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      const uint8_t* fromcontent,
+      int64_t contentoffset,
+      int64_t itemsize,
+      int64_t length) {
+      return awkward_listarrayU32_hash64(
+        tohash,
+        fromstarts,
+        fromstops,
+        startsoffset,
+        stopsoffset,
+        fromcontent,
+        contentoffset,
+        itemsize,
+        length);
+    }
+    template <>
+    Error awkward_listarray_hash64(
+      uint64_t* tohash,
+      const int64_t* fromstarts,
+      const int64_t* fromstops,
+      int64_t startsoffset,
+      int64_t stopsoffset,
+      const uint8_t* fromcontent,
+      int64_t contentoffset,
+      int64_t itemsize,
+      int64_t length) {
+      return awkward_listarray64_hash64(
+        tohash,
+        fromstarts,
+        fromstops,
+        startsoffset,
+        stopsoffset,
+        fromcontent,
+        contentoffset,
+        itemsize,
+        length);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_compact_offsets64(
+      int64_t* tooffsets,
+      const int32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_compact_offsets64(
+        tooffsets,
+        fromoffsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_compact_offsets64(
       int64_t* tooffsets,
       const uint32_t* fromoffsets,
       int64_t offsetsoffset,
@@ -2519,6 +3076,43 @@ namespace awkward {
         length);
     }
 
+    template <>
+    Error awkward_listoffsetarray_compact_offsets(
+      int32_t* tooffsets,
+      const int32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_compact_offsets32(
+        tooffsets,
+        fromoffsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_compact_offsets(
+      uint32_t* tooffsets,
+      const uint32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarrayU32_compact_offsetsU32(
+        tooffsets,
+        fromoffsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_compact_offsets(
+      int64_t* tooffsets,
+      const int64_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray64_compact_offsets64(
+        tooffsets,
+        fromoffsets,
+        offsetsoffset,
+        length);
+    }
+
     template <>
     Error awkward_listarray_broadcast_tooffsets64<int32_t>(
       int64_t* tocarry,
@@ -2586,6 +3180,73 @@ namespace awkward {
         lencontent);
     }
 
+    template <>
+    Error awkward_listarray_broadcast_tooffsets<int32_t>(
+      int32_t* tocarry,
+      const int32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t offsetslength,
+      const int32_t* fromstarts,
+      int64_t startsoffset,
+      const int32_t* fromstops,
+      int64_t stopsoffset,
+      int64_t lencontent) {
+      return awkward_listarray32_broadcast_tooffsets32(
+        tocarry,
+        fromoffsets,
+        offsetsoffset,
+        offsetslength,
+        fromstarts,
+        startsoffset,
+        fromstops,
+        stopsoffset,
+        lencontent);
+    }
+    template <>
+    Error awkward_listarray_broadcast_tooffsets<uint32_t>(
+      int64_t* tocarry,
+      const uint32_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t offsetslength,
+      const uint32_t* fromstarts,
+      int64_t startsoffset,
+      const uint32_t* fromstops,
+      int64_t stopsoffset,
+      int64_t lencontent) {
+      return awkward_listarrayU32_broadcast_tooffsetsU32(
+        tocarry,
+        fromoffsets,
+        offsetsoffset,
+        offsetslength,
+        fromstarts,
+        startsoffset,
+        fromstops,
+        stopsoffset,
+        lencontent);
+    }
+    template <>
+    Error awkward_listarray_broadcast_tooffsets<int64_t>(
+      int64_t* tocarry,
+      const int64_t* fromoffsets,
+      int64_t offsetsoffset,
+      int64_t offsetslength,
+      const int64_t* fromstarts,
+      int64_t startsoffset,
+      const int64_t* fromstops,
+      int64_t stopsoffset,
+      int64_t lencontent) {
+      return awkward_listarray64_broadcast_tooffsets64(
+        tocarry,
+        fromoffsets,
+        offsetsoffset,
+        offsetslength,
+        fromstarts,
+        startsoffset,
+        fromstops,
+        stopsoffset,
+        lencontent);
+    }
+
     template <>
     Error awkward_listoffsetarray_toRegularArray<int32_t>(
       int64_t* size,
@@ -3329,6 +3990,275 @@ namespace awkward {
         length);
     }
 
+    template <>
+    Error awkward_listoffsetarray_reduce_global_startstop_64<int32_t>(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_reduce_global_startstop_64(
+        globalstart,
+        globalstop,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_global_startstop_64<uint32_t>(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarrayU32_reduce_global_startstop_64(
+        globalstart,
+        globalstop,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_global_startstop_64<int64_t>(
+      int64_t* globalstart,
+      int64_t* globalstop,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return ::awkward_listoffsetarray_reduce_global_startstop_64(
+        globalstart,
+        globalstop,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_outoffsets_64<int32_t>(
+      int64_t* outoffsets,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t outlength) {
+      return awkward_listoffsetarray32_reduce_nonlocal_outoffsets_64(
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset,
+        outlength);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_outoffsets_64<uint32_t>(
+      int64_t* outoffsets,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t outlength) {
+      return awkward_listoffsetarrayU32_reduce_nonlocal_outoffsets_64(
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset,
+        outlength);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_outoffsets_64<int64_t>(
+      int64_t* outoffsets,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset,
+      int64_t outlength) {
+      return ::awkward_listoffsetarray_reduce_nonlocal_outoffsets_64(
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset,
+        outlength);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_nextstarts_64<int32_t>(
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset) {
+      return awkward_listoffsetarray32_reduce_nonlocal_nextstarts_64(
+        nextstarts,
+        nextoutlength,
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_nextstarts_64<uint32_t>(
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset) {
+      return awkward_listoffsetarrayU32_reduce_nonlocal_nextstarts_64(
+        nextstarts,
+        nextoutlength,
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_nextstarts_64<int64_t>(
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset) {
+      return ::awkward_listoffsetarray_reduce_nonlocal_nextstarts_64(
+        nextstarts,
+        nextoutlength,
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_nextcarry<int32_t>(
+      int32_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset) {
+      return awkward_listoffsetarray32_reduce_nonlocal_nextcarry_32(
+        nextcarry,
+        nextparents,
+        nextstarts,
+        nextoutlength,
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_nextcarry<uint32_t>(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset) {
+      return awkward_listoffsetarrayU32_reduce_nonlocal_nextcarry_64(
+        nextcarry,
+        nextparents,
+        nextstarts,
+        nextoutlength,
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_nonlocal_nextcarry<int64_t>(
+      int64_t* nextcarry,
+      int64_t* nextparents,
+      int64_t* nextstarts,
+      int64_t nextoutlength,
+      const int64_t* outoffsets,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length,
+      const int64_t* parents,
+      int64_t parentsoffset) {
+      return awkward_listoffsetarray_reduce_nonlocal_nextcarry_64(
+        nextcarry,
+        nextparents,
+        nextstarts,
+        nextoutlength,
+        outoffsets,
+        offsets,
+        offsetsoffset,
+        length,
+        parents,
+        parentsoffset);
+    }
+
+    template <>
+    Error awkward_listoffsetarray_reduce_local_nextparents_64<int32_t>(
+      int64_t* nextparents,
+      const int32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarray32_reduce_local_nextparents_64(
+        nextparents,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_local_nextparents_64<uint32_t>(
+      int64_t* nextparents,
+      const uint32_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return awkward_listoffsetarrayU32_reduce_local_nextparents_64(
+        nextparents,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+    template <>
+    Error awkward_listoffsetarray_reduce_local_nextparents_64<int64_t>(
+      int64_t* nextparents,
+      const int64_t* offsets,
+      int64_t offsetsoffset,
+      int64_t length) {
+      return ::awkward_listoffsetarray_reduce_local_nextparents_64(
+        nextparents,
+        offsets,
+        offsetsoffset,
+        length);
+    }
+
     template <>
     Error awkward_UnionArray_fillna_64<int32_t>(
       int64_t* toindex,
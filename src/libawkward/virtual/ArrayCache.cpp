@@ -1,6 +1,8 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
 #include <atomic>
+#include <sstream>
+#include <stdexcept>
 
 #include "awkward/virtual/ArrayCache.h"
 
@@ -14,6 +16,93 @@ namespace awkward {
     return out;
   }
 
+  ////////// MemoryCache
+
+  MemoryCache::MemoryCache(int64_t max_bytes)
+      : max_bytes_(max_bytes)
+      , current_bytes_(0) {
+    if (max_bytes < 0) {
+      throw std::invalid_argument(
+        std::string("MemoryCache max_bytes must be non-negative, not ")
+        + std::to_string(max_bytes));
+    }
+  }
+
+  int64_t
+  MemoryCache::max_bytes() const {
+    return max_bytes_;
+  }
+
+  int64_t
+  MemoryCache::current_bytes() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return current_bytes_;
+  }
+
+  int64_t
+  MemoryCache::length() const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return (int64_t)entries_.size();
+  }
+
+  void
+  MemoryCache::clear() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    order_.clear();
+    entries_.clear();
+    current_bytes_ = 0;
+  }
+
+  ContentPtr
+  MemoryCache::get(const std::string& key) const {
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = entries_.find(key);
+    if (found == entries_.end()) {
+      return ContentPtr(nullptr);
+    }
+    order_.splice(order_.begin(), order_, found->second);
+    return found->second->value;
+  }
+
+  void
+  MemoryCache::set(const std::string& key, const ContentPtr& value) {
+    int64_t nbytes = value.get()->nbytes();
+    std::lock_guard<std::mutex> lock(mutex_);
+    auto found = entries_.find(key);
+    if (found != entries_.end()) {
+      current_bytes_ -= found->second->nbytes;
+      order_.erase(found->second);
+      entries_.erase(found);
+    }
+    if (nbytes > max_bytes_) {
+      return;
+    }
+    shrink(max_bytes_ - nbytes);
+    order_.push_front(Entry{ key, value, nbytes });
+    entries_[key] = order_.begin();
+    current_bytes_ += nbytes;
+  }
+
+  const std::string
+  MemoryCache::tostring_part(const std::string& indent,
+                             const std::string& pre,
+                             const std::string& post) const {
+    std::stringstream out;
+    out << indent << pre << "<MemoryCache max_bytes=\"" << max_bytes_
+        << "\" current_bytes=\"" << current_bytes() << "\" length=\""
+        << length() << "\"/>" << post;
+    return out.str();
+  }
+
+  void
+  MemoryCache::shrink(int64_t max_bytes) {
+    while (!order_.empty()  &&  current_bytes_ > max_bytes) {
+      current_bytes_ -= order_.back().nbytes;
+      entries_.erase(order_.back().key);
+      order_.pop_back();
+    }
+  }
+
   // Note: if you're creating a pure C++ cache (and it's not ridiculously
   // large), define it in
   // include/awkward/virtual/ArrayCache.h and implement it in this file.
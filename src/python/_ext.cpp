@@ -38,7 +38,11 @@ PYBIND11_MODULE(_ext, m) {
 
   make_Iterator(m, "Iterator");
   make_ArrayBuilder(m, "ArrayBuilder");
+  make_ChunkedArrayBuilder(m, "ChunkedArrayBuilder");
   make_PersistentSharedPtr(m, "_PersistentSharedPtr");
+  make_QuantileSketch(m, "QuantileSketch");
+  make_HyperLogLog(m, "HyperLogLog");
+  make_BinnedLookup(m, "BinnedLookup");
   make_Content(m, "Content");
 
   make_EmptyArray(m, "EmptyArray");
@@ -74,6 +78,12 @@ PYBIND11_MODULE(_ext, m) {
 
   make_VirtualArray(m, "VirtualArray");
 
+  make_ConstantArray(m, "ConstantArray");
+  make_RangeArray(m, "RangeArray");
+  make_InterleavedArray(m, "InterleavedArray");
+  make_BitPackedArray(m, "BitPackedArray");
+  make_QuantizedArray(m, "QuantizedArray");
+
   m.def("_slice_tostring", [](py::object obj) -> std::string {
     return toslice(obj).tostring();
   });
@@ -112,6 +122,9 @@ PYBIND11_MODULE(_ext, m) {
   make_PyArrayGenerator(m, "ArrayGenerator");
   make_SliceGenerator(m, "SliceGenerator");
   make_PyArrayCache(m, "ArrayCache");
+  make_MemoryCache(m, "MemoryCache");
+  make_setmemocache(m, "setmemocache");
+  make_memocache(m, "memocache");
 
   ////////// io.h
 
@@ -122,5 +135,6 @@ PYBIND11_MODULE(_ext, m) {
 
   make_PartitionedArray(m, "PartitionedArray");
   make_IrregularlyPartitionedArray(m, "IrregularlyPartitionedArray");
+  make_PartitionIndex(m, "PartitionIndex");
 
 }
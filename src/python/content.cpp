@@ -1,5 +1,9 @@
 // BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
 
+#include <cstring>
+#include <limits>
+#include <sstream>
+
 #include <pybind11/numpy.h>
 
 #include "awkward/python/identities.h"
@@ -124,6 +128,26 @@ box(const std::shared_ptr<ak::Content>& content) {
            dynamic_cast<ak::VirtualArray*>(content.get())) {
     return py::cast(*raw);
   }
+  else if (ak::ConstantArray* raw =
+           dynamic_cast<ak::ConstantArray*>(content.get())) {
+    return py::cast(*raw);
+  }
+  else if (ak::RangeArray* raw =
+           dynamic_cast<ak::RangeArray*>(content.get())) {
+    return py::cast(*raw);
+  }
+  else if (ak::InterleavedArray* raw =
+           dynamic_cast<ak::InterleavedArray*>(content.get())) {
+    return py::cast(*raw);
+  }
+  else if (ak::BitPackedArray* raw =
+           dynamic_cast<ak::BitPackedArray*>(content.get())) {
+    return py::cast(*raw);
+  }
+  else if (ak::QuantizedArray* raw =
+           dynamic_cast<ak::QuantizedArray*>(content.get())) {
+    return py::cast(*raw);
+  }
   else {
     throw std::runtime_error("missing boxer for Content subtype");
   }
@@ -243,6 +267,26 @@ unbox_content(const py::handle& obj) {
     return obj.cast<ak::VirtualArray*>()->shallow_copy();
   }
   catch (py::cast_error err) { }
+  try {
+    return obj.cast<ak::ConstantArray*>()->shallow_copy();
+  }
+  catch (py::cast_error err) { }
+  try {
+    return obj.cast<ak::RangeArray*>()->shallow_copy();
+  }
+  catch (py::cast_error err) { }
+  try {
+    return obj.cast<ak::InterleavedArray*>()->shallow_copy();
+  }
+  catch (py::cast_error err) { }
+  try {
+    return obj.cast<ak::BitPackedArray*>()->shallow_copy();
+  }
+  catch (py::cast_error err) { }
+  try {
+    return obj.cast<ak::QuantizedArray*>()->shallow_copy();
+  }
+  catch (py::cast_error err) { }
   throw std::invalid_argument("content argument must be a Content subtype");
 }
 
@@ -418,6 +462,16 @@ toslice_part(ak::Slice& slice, py::object obj) {
               = dynamic_cast<ak::VirtualArray*>(content.get())) {
           content = raw->array();
         }
+        else if (ak::ConstantArray* raw
+                   = dynamic_cast<ak::ConstantArray*>(content.get())) {
+          content = raw->toNumpyArray();
+          obj = box(content);
+        }
+        else if (ak::RangeArray* raw
+                   = dynamic_cast<ak::RangeArray*>(content.get())) {
+          content = raw->toNumpyArray();
+          obj = box(content);
+        }
       }
       else if (py::isinstance<ak::ArrayBuilder>(obj)) {
         content = unbox_content(obj.attr("snapshot")());
@@ -646,6 +700,25 @@ tojson_file(const T& self,
   fclose(file);
 }
 
+template <typename T>
+const ak::ContentPtr
+getitem_slice(const T& self, const ak::Slice& slice) {
+  if (!slice.hasarrays()) {
+    return self.getitem(slice);
+  }
+  std::stringstream operation;
+  operation << "getitem(" << std::hex << slice.fingerprint() << ")";
+  return self.memoized(operation.str(), [&]() -> const ak::ContentPtr {
+    return self.getitem(slice);
+  });
+}
+
+template <>
+const ak::ContentPtr
+getitem_slice(const ak::ArrayBuilder& self, const ak::Slice& slice) {
+  return self.getitem(slice);
+}
+
 template <typename T>
 py::object
 getitem(const T& self, const py::object& obj) {
@@ -690,13 +763,247 @@ getitem(const T& self, const py::object& obj) {
     }
     // control flow can pass through here; don't make the last line an 'else'!
   }
-  return box(self.getitem(toslice(obj)));
+  if (py::isinstance<ak::RangeArray>(obj)) {
+    // positions in a range select like a range slice, rather than a carry
+    ak::SliceItemPtr range =
+      obj.cast<ak::RangeArray*>()->asslicerange(self.length());
+    if (range.get() != nullptr) {
+      ak::Slice slice;
+      slice.append(range);
+      slice.become_sealed();
+      return box(self.getitem(slice));
+    }
+  }
+  return box(getitem_slice(self, toslice(obj)));
 }
 
 ////////// ArrayBuilder
 
+// NumPy's scalar type objects, imported once on first use.
+//
+// The handles are deliberately never released so that they do not
+// outlive the interpreter during module teardown.
+struct NumpyTypes {
+  py::handle bool_;
+  py::handle integer;
+  py::handle floating;
+};
+
+const NumpyTypes&
+numpy_types() {
+  static const NumpyTypes types = []() -> NumpyTypes {
+    py::module numpy = py::module::import("numpy");
+    return NumpyTypes{ numpy.attr("bool_").release(),
+                       numpy.attr("integer").release(),
+                       numpy.attr("floating").release() };
+  }();
+  return types;
+}
+
+template <typename T>
+inline T
+load_unaligned(const uint8_t* ptr) {
+  T out;
+  std::memcpy(&out, ptr, sizeof(T));
+  return out;
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, bool x) {
+  self.boolean(x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, int8_t x) {
+  self.integer((int64_t)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, uint8_t x) {
+  self.integer((int64_t)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, int16_t x) {
+  self.integer((int64_t)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, uint16_t x) {
+  self.integer((int64_t)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, int32_t x) {
+  self.integer((int64_t)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, uint32_t x) {
+  self.integer((int64_t)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, int64_t x) {
+  self.integer(x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, uint64_t x) {
+  if (x > (uint64_t)std::numeric_limits<int64_t>::max()) {
+    throw std::invalid_argument(
+      std::string("cannot convert ") + std::to_string(x)
+      + std::string(" (type uint64) to an array element: too large for "
+                    "int64"));
+  }
+  self.integer((int64_t)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, float x) {
+  self.real((double)x);
+}
+
+template <typename BUILDER>
+inline void
+append_value(BUILDER& self, double x) {
+  self.real(x);
+}
+
+// Walks a strided buffer one dimension at a time, appending
+// each innermost value directly from memory (without creating Python
+// objects) and each outer dimension as a nested list.
+template <typename T, typename BUILDER>
 void
-builder_fromiter(ak::ArrayBuilder& self, const py::handle& obj) {
+builder_frombuffer_next(BUILDER& self,
+                        const uint8_t* ptr,
+                        const py::buffer_info& info,
+                        ssize_t dim) {
+  if (dim == info.ndim) {
+    append_value(self, load_unaligned<T>(ptr));
+  }
+  else if (dim + 1 == info.ndim) {
+    ssize_t length = info.shape[(size_t)dim];
+    ssize_t stride = info.strides[(size_t)dim];
+    self.beginlist();
+    for (ssize_t i = 0;  i < length;  i++) {
+      append_value(self, load_unaligned<T>(ptr + i*stride));
+    }
+    self.endlist();
+  }
+  else {
+    ssize_t length = info.shape[(size_t)dim];
+    ssize_t stride = info.strides[(size_t)dim];
+    self.beginlist();
+    for (ssize_t i = 0;  i < length;  i++) {
+      builder_frombuffer_next<T>(self, ptr + i*stride, info, dim + 1);
+    }
+    self.endlist();
+  }
+}
+
+template <typename T, typename BUILDER>
+bool
+builder_frombuffer_as(BUILDER& self, const py::buffer_info& info) {
+  builder_frombuffer_next<T>(self,
+                             reinterpret_cast<const uint8_t*>(info.ptr),
+                             info,
+                             0);
+  return true;
+}
+
+// Appends the contents of an object supporting the buffer
+// protocol (NumPy array or scalar, `array.array`, `memoryview`, ...)
+// in bulk.
+//
+// Returns `false` without appending anything if the buffer's format is
+// not a native-endian boolean, integer, or floating-point type; the
+// caller should then fall back to Python iteration.
+template <typename BUILDER>
+bool
+builder_frombuffer(BUILDER& self, const py::handle& obj) {
+  py::buffer_info info;
+  try {
+    info = py::reinterpret_borrow<py::buffer>(obj).request();
+  }
+  catch (py::error_already_set& exc) {
+    exc.restore();
+    PyErr_Clear();
+    return false;
+  }
+  if (info.shape.size() != (size_t)info.ndim  ||
+      info.strides.size() != (size_t)info.ndim) {
+    return false;
+  }
+
+  std::string format(info.format);
+  size_t start = format.find_first_not_of("@=<>!");
+  if (start != 0) {
+    uint16_t one = 1;
+    bool little = (*reinterpret_cast<uint8_t*>(&one) == 1);
+    std::string order = format.substr(0, start);
+    if ((little  &&  (order.find_first_of(">!") != std::string::npos))  ||
+        (!little  &&  (order.find('<') != std::string::npos))) {
+      return false;
+    }
+    format.erase(0, start);
+  }
+  if (format.length() != 1) {
+    return false;
+  }
+
+  switch (format[0]) {
+    case '?':
+      return (info.itemsize == 1  &&  builder_frombuffer_as<bool>(self,
+                                                                  info));
+    case 'b':
+    case 'h':
+    case 'i':
+    case 'l':
+    case 'q':
+      switch (info.itemsize) {
+        case 1: return builder_frombuffer_as<int8_t>(self, info);
+        case 2: return builder_frombuffer_as<int16_t>(self, info);
+        case 4: return builder_frombuffer_as<int32_t>(self, info);
+        case 8: return builder_frombuffer_as<int64_t>(self, info);
+        default: return false;
+      }
+    case 'B':
+    case 'H':
+    case 'I':
+    case 'L':
+    case 'Q':
+      switch (info.itemsize) {
+        case 1: return builder_frombuffer_as<uint8_t>(self, info);
+        case 2: return builder_frombuffer_as<uint16_t>(self, info);
+        case 4: return builder_frombuffer_as<uint32_t>(self, info);
+        case 8: return builder_frombuffer_as<uint64_t>(self, info);
+        default: return false;
+      }
+    case 'f':
+      return (info.itemsize == sizeof(float)  &&
+              builder_frombuffer_as<float>(self, info));
+    case 'd':
+      return (info.itemsize == sizeof(double)  &&
+              builder_frombuffer_as<double>(self, info));
+    default:
+      return false;
+  }
+}
+
+template <typename BUILDER>
+void
+builder_fromiter(BUILDER& self, const py::handle& obj) {
   if (obj.is(py::none())) {
     self.null();
   }
@@ -715,6 +1022,10 @@ builder_fromiter(ak::ArrayBuilder& self, const py::handle& obj) {
   else if (py::isinstance<py::str>(obj)) {
     self.string(obj.cast<std::string>());
   }
+  else if (PyObject_CheckBuffer(obj.ptr())  &&
+           builder_frombuffer(self, obj)) {
+    return;
+  }
   else if (py::isinstance<py::tuple>(obj)) {
     py::tuple tup = obj.cast<py::tuple>();
     self.begintuple(tup.size());
@@ -746,21 +1057,13 @@ builder_fromiter(ak::ArrayBuilder& self, const py::handle& obj) {
     }
     self.endlist();
   }
-  else if (py::isinstance<py::array>(obj)) {
-    py::iterable seq = obj.attr("tolist")().cast<py::iterable>();
-    self.beginlist();
-    for (auto x : seq) {
-      builder_fromiter(self, x);
-    }
-    self.endlist();
-  }
-  else if (py::isinstance(obj, py::module::import("numpy").attr("bool_"))) {
+  else if (py::isinstance(obj, numpy_types().bool_)) {
     self.boolean(obj.cast<bool>());
   }
-  else if (py::isinstance(obj, py::module::import("numpy").attr("integer"))) {
+  else if (py::isinstance(obj, numpy_types().integer)) {
     self.integer(obj.cast<int64_t>());
   }
-  else if (py::isinstance(obj, py::module::import("numpy").attr("floating"))) {
+  else if (py::isinstance(obj, numpy_types().floating)) {
     self.real(obj.cast<double>());
   }
   else {
@@ -834,7 +1137,72 @@ make_ArrayBuilder(const py::handle& m, const std::string& name) {
               const std::shared_ptr<ak::Content>& array) {
         self.extend(array);
       })
-      .def("fromiter", &builder_fromiter)
+      .def("fromiter", &builder_fromiter<ak::ArrayBuilder>)
+  );
+}
+
+////////// ChunkedArrayBuilder
+
+py::class_<ak::ChunkedArrayBuilder, std::shared_ptr<ak::ChunkedArrayBuilder>>
+make_ChunkedArrayBuilder(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::ChunkedArrayBuilder,
+                     std::shared_ptr<ak::ChunkedArrayBuilder>>(m, name.c_str())
+      .def(py::init([](int64_t chunksize, int64_t initial, double resize)
+                    -> std::shared_ptr<ak::ChunkedArrayBuilder> {
+        return std::make_shared<ak::ChunkedArrayBuilder>(
+          ak::ArrayBuilderOptions(initial, resize), chunksize);
+      }), py::arg("chunksize") = 65536,
+          py::arg("initial") = 1024,
+          py::arg("resize") = 1.5)
+      .def("__repr__", &ak::ChunkedArrayBuilder::tostring)
+      .def("__len__", &ak::ChunkedArrayBuilder::length)
+      .def_property_readonly("chunksize", &ak::ChunkedArrayBuilder::chunksize)
+      .def_property_readonly("numchunks", &ak::ChunkedArrayBuilder::numchunks)
+      .def("seal", &ak::ChunkedArrayBuilder::seal)
+      .def("snapshot", &ak::ChunkedArrayBuilder::snapshot)
+      .def("null", &ak::ChunkedArrayBuilder::null)
+      .def("boolean", &ak::ChunkedArrayBuilder::boolean)
+      .def("integer", &ak::ChunkedArrayBuilder::integer)
+      .def("real", &ak::ChunkedArrayBuilder::real)
+      .def("bytestring",
+           [](ak::ChunkedArrayBuilder& self, const py::bytes& x) -> void {
+        self.bytestring(x.cast<std::string>());
+      })
+      .def("string",
+           [](ak::ChunkedArrayBuilder& self, const py::str& x) -> void {
+        self.string(x.cast<std::string>());
+      })
+      .def("beginlist", &ak::ChunkedArrayBuilder::beginlist)
+      .def("endlist", &ak::ChunkedArrayBuilder::endlist)
+      .def("begintuple", &ak::ChunkedArrayBuilder::begintuple)
+      .def("index", &ak::ChunkedArrayBuilder::index)
+      .def("endtuple", &ak::ChunkedArrayBuilder::endtuple)
+      .def("beginrecord",
+           [](ak::ChunkedArrayBuilder& self, const py::object& name) -> void {
+        if (name.is(py::none())) {
+          self.beginrecord();
+        }
+        else {
+          self.beginrecord_check(name.cast<std::string>());
+        }
+      }, py::arg("name") = py::none())
+      .def("field",
+           [](ak::ChunkedArrayBuilder& self, const std::string& x) -> void {
+        self.field_check(x);
+      })
+      .def("endrecord", &ak::ChunkedArrayBuilder::endrecord)
+      .def("append",
+           [](ak::ChunkedArrayBuilder& self,
+              const std::shared_ptr<ak::Content>& array,
+              int64_t at) {
+        self.append(array, at);
+      })
+      .def("extend",
+           [](ak::ChunkedArrayBuilder& self,
+              const std::shared_ptr<ak::Content>& array) {
+        self.extend(array);
+      })
+      .def("fromiter", &builder_fromiter<ak::ChunkedArrayBuilder>)
   );
 }
 
@@ -885,6 +1253,125 @@ make_PersistentSharedPtr(const py::handle& m, const std::string& name) {
              .def("ptr", &PersistentSharedPtr::ptr);
 }
 
+////////// QuantileSketch
+
+py::class_<ak::QuantileSketch, std::shared_ptr<ak::QuantileSketch>>
+make_QuantileSketch(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::QuantileSketch,
+                     std::shared_ptr<ak::QuantileSketch>>(m, name.c_str())
+      .def(py::init<int64_t>(), py::arg("k") = 200)
+      .def_property_readonly("k", &ak::QuantileSketch::k)
+      .def_property_readonly("count", &ak::QuantileSketch::count)
+      .def_property_readonly("size", &ak::QuantileSketch::size)
+      .def("update",
+           [](ak::QuantileSketch& self,
+              const py::array_t<double, py::array::c_style |
+                                        py::array::forcecast>& values)
+           -> void {
+        py::buffer_info info = values.request();
+        const double* ptr = reinterpret_cast<const double*>(info.ptr);
+        for (ssize_t i = 0;  i < info.size;  i++) {
+          self.update(ptr[i]);
+        }
+      })
+      .def("merge", &ak::QuantileSketch::merge)
+      .def("quantile", &ak::QuantileSketch::quantile)
+      .def("__repr__", [](const ak::QuantileSketch& self) -> std::string {
+        return std::string("<QuantileSketch k=\"")
+               + std::to_string(self.k()) + std::string("\" count=\"")
+               + std::to_string(self.count()) + std::string("\"/>");
+      })
+  );
+}
+
+////////// HyperLogLog
+
+py::class_<ak::HyperLogLog, std::shared_ptr<ak::HyperLogLog>>
+make_HyperLogLog(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::HyperLogLog,
+                     std::shared_ptr<ak::HyperLogLog>>(m, name.c_str())
+      .def(py::init<int64_t>(), py::arg("precision") = 12)
+      .def_property_readonly("precision", &ak::HyperLogLog::precision)
+      .def("update",
+           [](ak::HyperLogLog& self,
+              const py::array_t<uint64_t, py::array::c_style |
+                                          py::array::forcecast>& hashes)
+           -> void {
+        py::buffer_info info = hashes.request();
+        const uint64_t* ptr = reinterpret_cast<const uint64_t*>(info.ptr);
+        for (ssize_t i = 0;  i < info.size;  i++) {
+          self.update(ptr[i]);
+        }
+      })
+      .def("merge", &ak::HyperLogLog::merge)
+      .def("estimate", &ak::HyperLogLog::estimate)
+      .def("__repr__", [](const ak::HyperLogLog& self) -> std::string {
+        return std::string("<HyperLogLog precision=\"")
+               + std::to_string(self.precision()) + std::string("\"/>");
+      })
+  );
+}
+
+////////// BinnedLookup
+
+py::class_<ak::BinnedLookup, std::shared_ptr<ak::BinnedLookup>>
+make_BinnedLookup(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::BinnedLookup,
+                     std::shared_ptr<ak::BinnedLookup>>(m, name.c_str())
+      .def(py::init([](const py::array_t<double, py::array::c_style |
+                                                 py::array::forcecast>& table,
+                       const std::vector<std::vector<double>>& edges)
+                    -> ak::BinnedLookup {
+        py::buffer_info info = table.request();
+        if (info.ndim != (ssize_t)edges.size()) {
+          throw std::invalid_argument(
+            std::string("BinnedLookup table has ") + std::to_string(info.ndim)
+            + std::string(" dimensions, but ") + std::to_string(edges.size())
+            + std::string(" axes of edges were given"));
+        }
+        for (size_t k = 0;  k < edges.size();  k++) {
+          if (info.shape[k] + 1 != (ssize_t)edges[k].size()) {
+            throw std::invalid_argument(
+              std::string("BinnedLookup table has ")
+              + std::to_string(info.shape[k]) + std::string(" bins on axis ")
+              + std::to_string(k) + std::string(", but ")
+              + std::to_string(edges[k].size()) + std::string(" edges"));
+          }
+        }
+        const double* ptr = reinterpret_cast<const double*>(info.ptr);
+        return ak::BinnedLookup(edges,
+                                std::vector<double>(ptr, ptr + info.size));
+      }), py::arg("table"), py::arg("edges"))
+      .def_property_readonly("numaxes", &ak::BinnedLookup::numaxes)
+      .def_property_readonly("edges", &ak::BinnedLookup::edges)
+      .def_property_readonly("shape", &ak::BinnedLookup::shape)
+      .def_property_readonly("table", [](const ak::BinnedLookup& self)
+                                      -> py::object {
+        std::vector<double> table = self.table();
+        std::vector<ssize_t> shape;
+        for (auto x : self.shape()) {
+          shape.push_back((ssize_t)x);
+        }
+        return py::array_t<double>(shape, table.data());
+      })
+      .def("evaluate", [](const ak::BinnedLookup& self,
+                          const std::vector<ak::ContentPtr>& inputs,
+                          bool interpolate) -> py::object {
+        return box(self.evaluate(inputs, interpolate));
+      }, py::arg("inputs"), py::arg("interpolate") = false)
+      .def("__repr__", [](const ak::BinnedLookup& self) -> std::string {
+        std::stringstream out;
+        out << "<BinnedLookup shape=\"";
+        std::vector<int64_t> shape = self.shape();
+        for (size_t k = 0;  k < shape.size();  k++) {
+          out << (k == 0 ? "" : " ") << shape[k];
+        }
+        out << "\"/>";
+        return out.str();
+      })
+  );
+}
+
 py::class_<ak::Content, std::shared_ptr<ak::Content>>
 make_Content(const py::handle& m, const std::string& name) {
   return py::class_<ak::Content, std::shared_ptr<ak::Content>>(m,
@@ -1081,6 +1568,7 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
                py::arg("maxdecimals") = py::none(),
                py::arg("buffersize") = 65536)
           .def_property_readonly("nbytes", &T::nbytes)
+          .def_property_readonly("fingerprint", &T::fingerprint)
           .def("deep_copy",
                &T::deep_copy,
                py::arg("copyarrays") = true,
@@ -1129,7 +1617,12 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
             return box(self.fillna(unbox_content(value)));
           })
           .def("num", [](const T& self, int64_t axis) -> py::object {
-            return box(self.num(axis, 0));
+            std::string operation = std::string("num(")
+              + std::to_string(axis) + std::string(")");
+            return box(self.memoized(operation,
+                                     [&]() -> const ak::ContentPtr {
+              return self.num(axis, 0);
+            }));
           }, py::arg("axis") = 1)
           .def("flatten", [](const T& self, int64_t axis) -> py::object {
             std::pair<ak::Index64, std::shared_ptr<ak::Content>> pair =
@@ -1243,6 +1736,32 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
           }, py::arg("axis") = -1,
              py::arg("mask") = true,
              py::arg("keepdims") = false)
+          .def("quantile",
+               [](const T& self,
+                  double q,
+                  int64_t axis,
+                  bool mask,
+                  bool keepdims,
+                  int64_t k) -> py::object {
+            ak::ReducerQuantile reducer(q, k);
+            return box(self.reduce(reducer, axis, mask, keepdims));
+          }, py::arg("q"),
+             py::arg("axis") = -1,
+             py::arg("mask") = true,
+             py::arg("keepdims") = false,
+             py::arg("k") = 200)
+          .def("count_distinct",
+               [](const T& self,
+                  int64_t axis,
+                  bool mask,
+                  bool keepdims,
+                  int64_t precision) -> py::object {
+            ak::ReducerCountDistinct reducer(precision);
+            return box(self.reduce(reducer, axis, mask, keepdims));
+          }, py::arg("axis") = -1,
+             py::arg("mask") = false,
+             py::arg("keepdims") = false,
+             py::arg("precision") = 12)
           .def("localindex", [](const T& self, int64_t axis) -> py::object {
             return box(self.localindex(axis, 0));
           }, py::arg("axis") = 1)
@@ -1264,17 +1783,38 @@ content_methods(py::class_<T, std::shared_ptr<T>, ak::Content>& x) {
                   "if provided, the length of 'keys' must be 'n'");
               }
             }
-            return box(self.combinations(n,
-                                         replacement,
-                                         recordlookup,
-                                         dict2parameters(parameters),
-                                         axis,
-                                         0));
+            ak::util::Parameters params = dict2parameters(parameters);
+            std::stringstream operation;
+            operation << "combinations(" << n << ", "
+                      << (replacement ? "true" : "false") << ", "
+                      << axis;
+            if (recordlookup.get() != nullptr) {
+              for (auto key : *recordlookup.get()) {
+                operation << ", " << ak::util::quote(key, true);
+              }
+            }
+            for (auto pair : params) {
+              operation << ", " << ak::util::quote(pair.first, true)
+                        << ": " << pair.second;
+            }
+            operation << ")";
+            return box(self.memoized(operation.str(),
+                                     [&]() -> const ak::ContentPtr {
+              return self.combinations(n,
+                                       replacement,
+                                       recordlookup,
+                                       params,
+                                       axis,
+                                       0);
+            }));
           }, py::arg("n"),
              py::arg("replacement") = false,
              py::arg("keys") = py::none(),
              py::arg("parameters") = py::none(),
              py::arg("axis") = 1)
+          .def("packed", [](const T& self) -> py::object {
+            return box(self.packed());
+          })
 
   ;
 }
@@ -1543,6 +2083,9 @@ make_ListArrayOf(const py::handle& m, const std::string& name) {
            py::arg("start_at_zero") = true)
       .def("broadcast_tooffsets64", &ak::ListArrayOf<T>::broadcast_tooffsets64)
       .def("toRegularArray", &ak::ListArrayOf<T>::toRegularArray)
+      .def("hash64", [](const ak::ListArrayOf<T>& self) -> py::object {
+        return box(self.hash64());
+      })
       .def("simplify", [](const ak::ListArrayOf<T>& self) {
         return box(self.shallow_simplify());
       })
@@ -1599,6 +2142,14 @@ make_ListOffsetArrayOf(const py::handle& m, const std::string& name) {
       .def("broadcast_tooffsets64",
            &ak::ListOffsetArrayOf<T>::broadcast_tooffsets64)
       .def("toRegularArray", &ak::ListOffsetArrayOf<T>::toRegularArray)
+      .def("hash64", [](const ak::ListOffsetArrayOf<T>& self) -> py::object {
+        return box(self.hash64());
+      })
+      .def("rolling", [](const ak::ListOffsetArrayOf<T>& self,
+                         const std::string& reducer,
+                         int64_t window) -> py::object {
+        return box(self.rolling(reducer, window));
+      }, py::arg("reducer"), py::arg("window"))
       .def("simplify", [](const ak::ListOffsetArrayOf<T>& self) {
         return box(self.shallow_simplify());
       })
@@ -1672,6 +2223,24 @@ make_NumpyArray(const py::handle& m, const std::string& name) {
       .def_property_readonly("isscalar", &ak::NumpyArray::isscalar)
       .def_property_readonly("isempty", &ak::NumpyArray::isempty)
       .def("toRegularArray", &ak::NumpyArray::toRegularArray)
+      .def("toBitPackedArray", [](const ak::NumpyArray& self,
+                                  bool lsb_order) -> py::object {
+        return box(self.toBitPackedArray(lsb_order));
+      }, py::arg("lsb_order") = true)
+      .def("astype", [](const ak::NumpyArray& self,
+                        const py::object& dtype) -> py::object {
+        py::object format =
+          py::module::import("numpy").attr("dtype")(dtype).attr("char");
+        return box(self.astype(format.cast<std::string>()));
+      }, py::arg("dtype"))
+      .def("hash64", [](const ak::NumpyArray& self) -> py::object {
+        return box(self.hash64());
+      })
+      .def("searchsorted", [](const ak::NumpyArray& self,
+                              const std::vector<double>& edges,
+                              bool right) -> py::object {
+        return box(self.searchsorted(edges, right));
+      }, py::arg("edges"), py::arg("right") = false)
 
       .def_property_readonly("iscontiguous", &ak::NumpyArray::iscontiguous)
       .def("contiguous", &ak::NumpyArray::contiguous)
@@ -1925,6 +2494,12 @@ make_RecordArray(const py::handle& m, const std::string& name) {
                              [](const ak::RecordArray& self) -> py::object {
         return box(self.astuple());
       })
+      .def_property_readonly("isinterleavable",
+                             &ak::RecordArray::isinterleavable)
+      .def("toInterleavedArray", [](const ak::RecordArray& self)
+                                 -> py::object {
+        return box(self.toInterleavedArray());
+      })
       .def("simplify", [](const ak::RecordArray& self) {
         return box(self.shallow_simplify());
       })
@@ -2141,3 +2716,226 @@ make_VirtualArray(const py::handle& m, const std::string& name) {
       .def_property_readonly("cache_key", &ak::VirtualArray::cache_key)
   );
 }
+
+////////// ConstantArray
+
+py::class_<ak::ConstantArray, std::shared_ptr<ak::ConstantArray>, ak::Content>
+make_ConstantArray(const py::handle& m, const std::string& name) {
+  return content_methods(py::class_<ak::ConstantArray,
+                         std::shared_ptr<ak::ConstantArray>,
+                         ak::Content>(m, name.c_str())
+      .def(py::init([](const py::object& value,
+                       int64_t length,
+                       const py::object& identities,
+                       const py::object& parameters) -> ak::ConstantArray {
+        std::shared_ptr<ak::Content> content(nullptr);
+        if (py::isinstance<ak::Content>(value)) {
+          content = unbox_content(value);
+        }
+        else {
+          py::object numpy = py::module::import("numpy");
+          py::object array = numpy.attr("expand_dims")(
+                               numpy.attr("asarray")(value), 0);
+          content = unbox_content(py::module::import("awkward1")
+                                  .attr("layout")
+                                  .attr("NumpyArray")(array));
+        }
+        return ak::ConstantArray(unbox_identities_none(identities),
+                                 dict2parameters(parameters),
+                                 content,
+                                 length);
+      }), py::arg("value"),
+          py::arg("length"),
+          py::arg("identities") = py::none(),
+          py::arg("parameters") = py::none())
+      .def_property_readonly("value", [](const ak::ConstantArray& self)
+                                      -> py::object {
+        return box(self.value());
+      })
+      .def_property_readonly("array", [](const ak::ConstantArray& self)
+                                      -> py::object {
+        return box(self.array());
+      })
+      .def("toNumpyArray", [](const ak::ConstantArray& self) -> py::object {
+        return box(self.toNumpyArray());
+      })
+  );
+}
+
+////////// RangeArray
+
+py::class_<ak::RangeArray, std::shared_ptr<ak::RangeArray>, ak::Content>
+make_RangeArray(const py::handle& m, const std::string& name) {
+  return content_methods(py::class_<ak::RangeArray,
+                         std::shared_ptr<ak::RangeArray>,
+                         ak::Content>(m, name.c_str())
+      .def(py::init([](int64_t start,
+                       int64_t step,
+                       int64_t length,
+                       const py::object& identities,
+                       const py::object& parameters) -> ak::RangeArray {
+        return ak::RangeArray(unbox_identities_none(identities),
+                              dict2parameters(parameters),
+                              start,
+                              step,
+                              length);
+      }), py::arg("start"),
+          py::arg("step"),
+          py::arg("length"),
+          py::arg("identities") = py::none(),
+          py::arg("parameters") = py::none())
+      .def_property_readonly("start", &ak::RangeArray::start)
+      .def_property_readonly("step", &ak::RangeArray::step)
+      .def_property_readonly("stop", &ak::RangeArray::stop)
+      .def_property_readonly("array", [](const ak::RangeArray& self)
+                                      -> py::object {
+        return box(self.array());
+      })
+      .def("toNumpyArray", [](const ak::RangeArray& self) -> py::object {
+        return box(self.toNumpyArray());
+      })
+  );
+}
+
+////////// InterleavedArray
+
+py::class_<ak::InterleavedArray,
+           std::shared_ptr<ak::InterleavedArray>,
+           ak::Content>
+make_InterleavedArray(const py::handle& m, const std::string& name) {
+  return content_methods(py::class_<ak::InterleavedArray,
+                         std::shared_ptr<ak::InterleavedArray>,
+                         ak::Content>(m, name.c_str())
+      .def(py::init([](const py::object& data,
+                       const py::object& keys,
+                       const py::object& identities,
+                       const py::object& parameters) -> ak::InterleavedArray {
+        std::shared_ptr<ak::Content> content(nullptr);
+        if (py::isinstance<ak::Content>(data)) {
+          content = unbox_content(data);
+        }
+        else {
+          content = unbox_content(py::module::import("awkward1")
+                                  .attr("layout")
+                                  .attr("NumpyArray")(data));
+        }
+        std::shared_ptr<ak::util::RecordLookup> recordlookup(nullptr);
+        if (!keys.is(py::none())) {
+          recordlookup = std::make_shared<ak::util::RecordLookup>();
+          for (auto x : keys) {
+            recordlookup.get()->push_back(x.cast<std::string>());
+          }
+        }
+        return ak::InterleavedArray(unbox_identities_none(identities),
+                                    dict2parameters(parameters),
+                                    content,
+                                    recordlookup);
+      }), py::arg("data"),
+          py::arg("keys") = py::none(),
+          py::arg("identities") = py::none(),
+          py::arg("parameters") = py::none())
+      .def_property_readonly("data", [](const ak::InterleavedArray& self)
+                                     -> py::object {
+        return box(self.data());
+      })
+      .def_property_readonly("istuple", &ak::InterleavedArray::istuple)
+      .def("field", [](const ak::InterleavedArray& self, int64_t fieldindex)
+                    -> py::object {
+        return box(self.field(fieldindex));
+      })
+      .def_property_readonly("array", [](const ak::InterleavedArray& self)
+                                      -> py::object {
+        return box(self.toRecordArray());
+      })
+      .def("toRecordArray", [](const ak::InterleavedArray& self)
+                            -> py::object {
+        return box(self.toRecordArray());
+      })
+  );
+}
+
+////////// BitPackedArray
+
+py::class_<ak::BitPackedArray,
+           std::shared_ptr<ak::BitPackedArray>,
+           ak::Content>
+make_BitPackedArray(const py::handle& m, const std::string& name) {
+  return content_methods(py::class_<ak::BitPackedArray,
+                         std::shared_ptr<ak::BitPackedArray>,
+                         ak::Content>(m, name.c_str())
+      .def(py::init([](const ak::IndexU8& bits,
+                       int64_t length,
+                       bool lsb_order,
+                       const py::object& identities,
+                       const py::object& parameters) -> ak::BitPackedArray {
+        return ak::BitPackedArray(unbox_identities_none(identities),
+                                  dict2parameters(parameters),
+                                  bits,
+                                  length,
+                                  lsb_order);
+      }), py::arg("bits"),
+          py::arg("length"),
+          py::arg("lsb_order") = true,
+          py::arg("identities") = py::none(),
+          py::arg("parameters") = py::none())
+      .def_property_readonly("bits", &ak::BitPackedArray::bits)
+      .def_property_readonly("lsb_order", &ak::BitPackedArray::lsb_order)
+      .def_property_readonly("numtrue", &ak::BitPackedArray::numtrue)
+      .def_property_readonly("array", [](const ak::BitPackedArray& self)
+                                      -> py::object {
+        return box(self.array());
+      })
+      .def("toNumpyArray", [](const ak::BitPackedArray& self) -> py::object {
+        return box(self.toNumpyArray());
+      })
+  );
+}
+
+////////// QuantizedArray
+
+py::class_<ak::QuantizedArray,
+           std::shared_ptr<ak::QuantizedArray>,
+           ak::Content>
+make_QuantizedArray(const py::handle& m, const std::string& name) {
+  return content_methods(py::class_<ak::QuantizedArray,
+                         std::shared_ptr<ak::QuantizedArray>,
+                         ak::Content>(m, name.c_str())
+      .def(py::init([](const py::object& data,
+                       double scale,
+                       double offset,
+                       const py::object& identities,
+                       const py::object& parameters) -> ak::QuantizedArray {
+        std::shared_ptr<ak::Content> content(nullptr);
+        if (py::isinstance<ak::Content>(data)) {
+          content = unbox_content(data);
+        }
+        else {
+          content = unbox_content(py::module::import("awkward1")
+                                  .attr("layout")
+                                  .attr("NumpyArray")(data));
+        }
+        return ak::QuantizedArray(unbox_identities_none(identities),
+                                  dict2parameters(parameters),
+                                  content,
+                                  scale,
+                                  offset);
+      }), py::arg("data"),
+          py::arg("scale"),
+          py::arg("offset") = 0.0,
+          py::arg("identities") = py::none(),
+          py::arg("parameters") = py::none())
+      .def_property_readonly("data", [](const ak::QuantizedArray& self)
+                                     -> py::object {
+        return box(self.data());
+      })
+      .def_property_readonly("scale", &ak::QuantizedArray::scale)
+      .def_property_readonly("offset", &ak::QuantizedArray::offset)
+      .def_property_readonly("array", [](const ak::QuantizedArray& self)
+                                      -> py::object {
+        return box(self.array());
+      })
+      .def("toNumpyArray", [](const ak::QuantizedArray& self) -> py::object {
+        return box(self.toNumpyArray());
+      })
+  );
+}
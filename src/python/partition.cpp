@@ -155,3 +155,53 @@ make_IrregularlyPartitionedArray(const py::handle& m, const std::string& name) {
 
   );
 }
+
+////////// PartitionIndex
+
+py::class_<ak::PartitionIndex, std::shared_ptr<ak::PartitionIndex>>
+make_PartitionIndex(const py::handle& m, const std::string& name) {
+  return py::class_<ak::PartitionIndex,
+                    std::shared_ptr<ak::PartitionIndex>>(m, name.c_str())
+      .def(py::init([](int64_t numkeys, double falsepositive, bool hashindex)
+                    -> ak::PartitionIndex {
+        return ak::PartitionIndex(numkeys, falsepositive, hashindex);
+      }), py::arg("numkeys"),
+          py::arg("falsepositive") = 0.01,
+          py::arg("hashindex") = false)
+      .def_property_readonly("numkeys", &ak::PartitionIndex::numkeys)
+      .def_property_readonly("falsepositive",
+                             &ak::PartitionIndex::falsepositive)
+      .def_property_readonly("hashindex", &ak::PartitionIndex::hashindex)
+      .def_property_readonly("numpartitions",
+                             &ak::PartitionIndex::numpartitions)
+      .def_property_readonly("stops", &ak::PartitionIndex::stops)
+      .def("__len__", &ak::PartitionIndex::length)
+      .def("append", &ak::PartitionIndex::append)
+      .def("candidates", &ak::PartitionIndex::candidates)
+      .def("find", [](const ak::PartitionIndex& self,
+                      const std::vector<int64_t>& key) -> py::object {
+        py::list out;
+        for (auto x : self.find(key)) {
+          out.append(py::make_tuple(x.first, x.second));
+        }
+        return out;
+      })
+      .def("partitionid_index_at", [](const ak::PartitionIndex& self,
+                                      int64_t at) -> py::object {
+        int64_t partitionid;
+        int64_t index;
+        self.partitionid_index_at(at, partitionid, index);
+        return py::make_tuple(partitionid, index);
+      })
+      .def("__repr__", [](const ak::PartitionIndex& self) -> std::string {
+        return std::string("<PartitionIndex numkeys=\"")
+               + std::to_string(self.numkeys())
+               + std::string("\" numpartitions=\"")
+               + std::to_string(self.numpartitions())
+               + std::string("\" length=\"")
+               + std::to_string(self.length())
+               + std::string("\" hashindex=\"")
+               + (self.hashindex() ? "true" : "false")
+               + std::string("\"/>");
+      });
+}
@@ -341,6 +341,11 @@ make_PrimitiveType(const py::handle& m, const std::string& name) {
                                    typestr2str(typestr),
                                    ak::PrimitiveType::float64);
         }
+        else if (dtype == std::string("float16")) {
+          return ak::PrimitiveType(dict2parameters(parameters),
+                                   typestr2str(typestr),
+                                   ak::PrimitiveType::float16);
+        }
         else {
           throw std::invalid_argument(
             std::string("unrecognized primitive type: ") + dtype);
@@ -362,6 +367,7 @@ make_PrimitiveType(const py::handle& m, const std::string& name) {
           case ak::PrimitiveType::uint64: return std::string("uint64");
           case ak::PrimitiveType::float32: return std::string("float32");
           case ak::PrimitiveType::float64: return std::string("float64");
+          case ak::PrimitiveType::float16: return std::string("float16");
           default:
           throw std::invalid_argument(
             std::string("unrecognized primitive type: ")
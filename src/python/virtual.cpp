@@ -390,3 +390,77 @@ make_PyArrayCache(const py::handle& m, const std::string& name) {
 
   );
 }
+
+////////// MemoryCache
+
+py::class_<ak::MemoryCache, std::shared_ptr<ak::MemoryCache>>
+make_MemoryCache(const py::handle& m, const std::string& name) {
+  return (py::class_<ak::MemoryCache,
+                     std::shared_ptr<ak::MemoryCache>>(m, name.c_str())
+      .def(py::init<int64_t>(),
+           py::arg("max_bytes"))
+      .def_property_readonly("max_bytes", &ak::MemoryCache::max_bytes)
+      .def_property_readonly("current_bytes",
+                             &ak::MemoryCache::current_bytes)
+      .def("__repr__", [](const ak::MemoryCache& self) -> std::string {
+        return self.tostring_part("", "", "");
+      })
+      .def("__getitem__", [](const ak::MemoryCache& self,
+                             const std::string& key) -> py::object {
+        ak::ContentPtr out = self.get(key);
+        if (out.get() == nullptr) {
+          throw py::key_error(key);
+        }
+        return box(out);
+      })
+      .def("__setitem__", [](ak::MemoryCache& self,
+                             const std::string& key,
+                             const py::object& value) -> void {
+        self.set(key, unbox_content(value));
+      })
+      .def("__contains__", [](const ak::MemoryCache& self,
+                              const std::string& key) -> bool {
+        return self.get(key).get() != nullptr;
+      })
+      .def("__len__", &ak::MemoryCache::length)
+      .def("clear", &ak::MemoryCache::clear)
+  );
+}
+
+////////// memocache
+
+void
+make_setmemocache(py::module& m, const std::string& name) {
+  m.def(name.c_str(), [](const py::object& cache) -> void {
+    if (cache.is(py::none())) {
+      ak::Content::setmemocache(nullptr);
+    }
+    else if (py::isinstance<ak::MemoryCache>(cache)) {
+      ak::Content::setmemocache(
+        cache.cast<std::shared_ptr<ak::MemoryCache>>());
+    }
+    else if (py::isinstance<PyArrayCache>(cache)) {
+      ak::Content::setmemocache(cache.cast<std::shared_ptr<PyArrayCache>>());
+    }
+    else {
+      throw std::invalid_argument(
+        "memoization cache must be a MemoryCache, an ArrayCache, or None");
+    }
+  }, py::arg("cache"));
+}
+
+void
+make_memocache(py::module& m, const std::string& name) {
+  m.def(name.c_str(), []() -> py::object {
+    std::shared_ptr<ak::ArrayCache> cache = ak::Content::memocache();
+    if (std::shared_ptr<ak::MemoryCache> ptr =
+          std::dynamic_pointer_cast<ak::MemoryCache>(cache)) {
+      return py::cast(ptr);
+    }
+    else if (std::shared_ptr<PyArrayCache> ptr =
+               std::dynamic_pointer_cast<PyArrayCache>(cache)) {
+      return py::cast(ptr);
+    }
+    return py::none();
+  });
+}
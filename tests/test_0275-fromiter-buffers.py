@@ -0,0 +1,47 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import array
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_numpy_arrays_in_lists():
+    data = [numpy.array([1, 2, 3], dtype=numpy.int32), numpy.array([], dtype=numpy.int32), numpy.array([4, 5], dtype=numpy.int32)]
+    result = awkward1.from_iter(data, highlevel=False)
+    assert awkward1.to_list(result) == [[1, 2, 3], [], [4, 5]]
+    assert str(awkward1.type(result)) == "var * int64"
+
+    data = [numpy.array([1.1, 2.2, 3.3]), numpy.array([4.4], dtype=numpy.float32)]
+    assert awkward1.to_list(awkward1.from_iter(data, highlevel=False)) == [[1.1, 2.2, 3.3], [numpy.float32(4.4)]]
+
+    data = [numpy.array([True, False]), numpy.array([False])]
+    assert awkward1.to_list(awkward1.from_iter(data, highlevel=False)) == [[True, False], [False]]
+
+def test_numpy_arrays_in_records():
+    data = [{"x": numpy.arange(3), "y": 1}, {"x": numpy.arange(0), "y": 2}]
+    assert awkward1.to_list(awkward1.from_iter(data, highlevel=False)) == [{"x": [0, 1, 2], "y": 1}, {"x": [], "y": 2}]
+
+def test_multidimensional_and_strided():
+    data = numpy.arange(2*3*4).reshape(2, 3, 4)
+    assert awkward1.to_list(awkward1.from_iter([data], highlevel=False)) == [data.tolist()]
+    assert awkward1.to_list(awkward1.from_iter([data[:, ::2, ::-1]], highlevel=False)) == [data[:, ::2, ::-1].tolist()]
+    assert awkward1.to_list(awkward1.from_iter([data.T], highlevel=False)) == [data.T.tolist()]
+
+def test_other_buffers():
+    data = [array.array("i", [1, 2, 3]), memoryview(array.array("d", [1.5, 2.5]))]
+    assert awkward1.to_list(awkward1.from_iter(data, highlevel=False)) == [[1, 2, 3], [1.5, 2.5]]
+
+def test_scalars_and_fallbacks():
+    data = [numpy.int32(5), numpy.float32(2.5), numpy.bool_(True), numpy.array(3)]
+    assert awkward1.to_list(awkward1.from_iter(data, highlevel=False)) == [5, 2.5, True, 3]
+
+    data = [numpy.array([1, 2, 3], dtype=">i4"), numpy.array(["one", "two"])]
+    assert awkward1.to_list(awkward1.from_iter(data, highlevel=False)) == [[1, 2, 3], ["one", "two"]]
+
+    with pytest.raises(ValueError):
+        awkward1.from_iter([numpy.array([2**64 - 1], dtype=numpy.uint64)], highlevel=False)
@@ -0,0 +1,99 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+primes = [x for x in range(2, 1000) if all(x % n != 0 for n in range(2, x))]
+
+def views():
+    base = numpy.array(primes[:2*3*5*7], dtype=numpy.int64)
+    yield base.reshape(2, 3, 5, 7)[0]
+    yield base.reshape(2, 3, 5, 7)[0].T
+    yield base.reshape(2, 3, 5, 7)[1, ::2, 1:4, ::3]
+    yield base.reshape(2, 3, 5, 7).transpose(2, 0, 3, 1)
+    yield base.reshape(6, 35)[:, ::5]
+    yield base[::3]
+    yield base.reshape(2, 3, 35)[:, :, 0]
+
+def test_sum_prod_min_max():
+    for nparray in views():
+        layout = awkward1.layout.NumpyArray(nparray)
+        for axis in range(nparray.ndim):
+            assert awkward1.to_list(layout.sum(axis=axis)) == nparray.sum(axis=axis).tolist()
+            assert awkward1.to_list(layout.min(axis=axis)) == nparray.min(axis=axis).tolist()
+            assert awkward1.to_list(layout.max(axis=axis)) == nparray.max(axis=axis).tolist()
+
+            small = awkward1.layout.NumpyArray(nparray % 3)
+            assert awkward1.to_list(small.prod(axis=axis)) == (nparray % 3).prod(axis=axis).tolist()
+
+def test_argmin_argmax():
+    for nparray in views():
+        layout = awkward1.layout.NumpyArray(nparray % 7)
+        for axis in range(nparray.ndim):
+            assert awkward1.to_list(layout.argmin(axis=axis)) == (nparray % 7).argmin(axis=axis).tolist()
+            assert awkward1.to_list(layout.argmax(axis=axis)) == (nparray % 7).argmax(axis=axis).tolist()
+
+def test_count_any_all():
+    for nparray in views():
+        layout = awkward1.layout.NumpyArray(nparray % 2 == 0)
+        for axis in range(nparray.ndim):
+            assert awkward1.to_list(layout.count(axis=axis)) == numpy.full(numpy.delete(nparray.shape, axis), nparray.shape[axis]).tolist()
+            assert awkward1.to_list(layout.count_nonzero(axis=axis)) == numpy.count_nonzero(nparray % 2 == 0, axis=axis).tolist()
+            assert awkward1.to_list(layout.any(axis=axis)) == (nparray % 2 == 0).any(axis=axis).tolist()
+            assert awkward1.to_list(layout.all(axis=axis)) == (nparray % 2 == 0).all(axis=axis).tolist()
+
+def test_float32_and_int32():
+    for nparray in views():
+        for dtype in (numpy.float32, numpy.int32):
+            converted = nparray.astype(dtype)[..., ::-1]
+            layout = awkward1.layout.NumpyArray(converted)
+            for axis in range(nparray.ndim):
+                assert awkward1.to_list(layout.sum(axis=axis)) == converted.sum(axis=axis).tolist()
+                assert awkward1.to_list(layout.max(axis=axis)) == converted.max(axis=axis).tolist()
+
+def test_keepdims():
+    for nparray in views():
+        layout = awkward1.layout.NumpyArray(nparray)
+        for axis in range(nparray.ndim):
+            assert awkward1.to_list(layout.sum(axis=axis, keepdims=True)) == nparray.sum(axis=axis, keepdims=True).tolist()
+
+def test_same_type_as_regular():
+    for nparray in views():
+        if nparray.ndim > 3:
+            continue
+        layout = awkward1.layout.NumpyArray(nparray)
+        regular = layout.toRegularArray()
+        for axis in range(nparray.ndim):
+            for keepdims in (False, True):
+                for mask in (False, True):
+                    one = layout.max(axis=axis, mask=mask, keepdims=keepdims)
+                    two = regular.max(axis=axis, mask=mask, keepdims=keepdims)
+                    assert awkward1.to_list(one) == awkward1.to_list(two)
+                    if isinstance(two, awkward1.layout.Content):
+                        assert str(awkward1.type(one)) == str(awkward1.type(two))
+
+def test_empty_dimensions():
+    nparray = numpy.zeros((3, 0, 4), dtype=numpy.float64).transpose(0, 2, 1)
+    layout = awkward1.layout.NumpyArray(nparray)
+    assert awkward1.to_list(layout.sum(axis=2)) == [[0.0, 0.0, 0.0, 0.0]] * 3
+    assert awkward1.to_list(layout.max(axis=2, mask=True)) == [[None, None, None, None]] * 3
+    assert awkward1.to_list(layout.sum(axis=1)) == [[], [], []]
+
+    nparray = numpy.zeros((3, 0, 4), dtype=numpy.float64)
+    layout = awkward1.layout.NumpyArray(nparray)
+    assert awkward1.to_list(layout.sum(axis=1)) == [[], [], []]
+    assert awkward1.to_list(layout.sum(axis=2)) == [[], [], []]
+
+def test_inside_lists():
+    nparray = numpy.array(primes[:4*3*5], dtype=numpy.int64).reshape(4, 5, 3).transpose(0, 2, 1)
+    content = awkward1.layout.NumpyArray(nparray)
+    offsets = awkward1.layout.Index64(numpy.array([0, 1, 1, 4], dtype=numpy.int64))
+    array = awkward1.layout.ListOffsetArray64(offsets, content)
+    assert awkward1.to_list(array.sum(axis=-1)) == [nparray[:1].sum(axis=-1).tolist(), [], nparray[1:].sum(axis=-1).tolist()]
+    assert awkward1.to_list(array.sum(axis=-2)) == [nparray[:1].sum(axis=-2).tolist(), [], nparray[1:].sum(axis=-2).tolist()]
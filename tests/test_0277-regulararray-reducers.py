@@ -0,0 +1,74 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_fixed_sizes():
+    for size in range(1, 18):
+        nparray = (numpy.arange(size*5, dtype=numpy.float64) * 1.5) % 7
+        regular = awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray), size)
+        expected = nparray.reshape(5, size)
+        for axis in (0, 1):
+            assert awkward1.to_list(regular.sum(axis=axis)) == expected.sum(axis=axis).tolist()
+            assert awkward1.to_list(regular.min(axis=axis)) == expected.min(axis=axis).tolist()
+            assert awkward1.to_list(regular.max(axis=axis)) == expected.max(axis=axis).tolist()
+            assert awkward1.to_list(regular.argmin(axis=axis)) == expected.argmin(axis=axis).tolist()
+            assert awkward1.to_list(regular.argmax(axis=axis)) == expected.argmax(axis=axis).tolist()
+            assert awkward1.to_list(regular.count_nonzero(axis=axis)) == numpy.count_nonzero(expected, axis=axis).tolist()
+
+        small = awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray % 2 + 1), size)
+        for axis in (0, 1):
+            assert awkward1.to_list(small.prod(axis=axis)) == (expected % 2 + 1).prod(axis=axis).tolist()
+
+        ints = awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray.astype(numpy.int32)), size)
+        assert awkward1.to_list(ints.sum(axis=1)) == nparray.astype(numpy.int32).reshape(5, size).sum(axis=1).tolist()
+        bools = awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray > 3), size)
+        assert awkward1.to_list(bools.any(axis=1)) == (nparray > 3).reshape(5, size).any(axis=1).tolist()
+        assert awkward1.to_list(bools.all(axis=1)) == (nparray > 3).reshape(5, size).all(axis=1).tolist()
+
+def test_unreachable_content():
+    content = awkward1.layout.NumpyArray(numpy.arange(3*7 + 2, dtype=numpy.int64))
+    regular = awkward1.layout.RegularArray(content, 3)
+    expected = numpy.arange(3*7, dtype=numpy.int64).reshape(7, 3)
+    assert awkward1.to_list(regular.sum(axis=1)) == expected.sum(axis=1).tolist()
+    assert awkward1.to_list(regular.sum(axis=0)) == expected.sum(axis=0).tolist()
+
+def test_nested():
+    nparray = numpy.arange(2*3*4, dtype=numpy.int64)
+    regular = awkward1.layout.RegularArray(awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray), 4), 3)
+    expected = nparray.reshape(2, 3, 4)
+    for axis in range(3):
+        for keepdims in (False, True):
+            assert awkward1.to_list(regular.sum(axis=axis, keepdims=keepdims)) == expected.sum(axis=axis, keepdims=keepdims).tolist()
+
+    multidim = awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray.reshape(6, 4)), 3)
+    for axis in range(3):
+        assert awkward1.to_list(multidim.max(axis=axis)) == expected.max(axis=axis).tolist()
+
+def test_same_type_as_listoffsetarray():
+    nparray = numpy.arange(5*3, dtype=numpy.int64)
+    regular = awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray), 3)
+    offsets = awkward1.layout.Index64(numpy.arange(0, 5*3 + 1, 3, dtype=numpy.int64))
+    listoffset = awkward1.layout.ListOffsetArray64(offsets, awkward1.layout.NumpyArray(nparray))
+    for axis in (0, 1):
+        for mask in (False, True):
+            for keepdims in (False, True):
+                one = regular.max(axis=axis, mask=mask, keepdims=keepdims)
+                two = listoffset.max(axis=axis, mask=mask, keepdims=keepdims)
+                assert awkward1.to_list(one) == awkward1.to_list(two)
+                assert str(awkward1.type(one)) == str(awkward1.type(two))
+
+def test_inside_lists():
+    nparray = numpy.arange(5*3, dtype=numpy.int64)
+    regular = awkward1.layout.RegularArray(awkward1.layout.NumpyArray(nparray), 3)
+    offsets = awkward1.layout.Index64(numpy.array([0, 2, 2, 5], dtype=numpy.int64))
+    array = awkward1.layout.ListOffsetArray64(offsets, regular)
+    expected = nparray.reshape(5, 3)
+    assert awkward1.to_list(array.sum(axis=-1)) == [expected[:2].sum(axis=-1).tolist(), [], expected[2:].sum(axis=-1).tolist()]
+    assert awkward1.to_list(array.sum(axis=-2)) == [expected[:2].sum(axis=-2).tolist(), [], expected[2:].sum(axis=-2).tolist()]
@@ -0,0 +1,40 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_carry():
+    base = numpy.arange(5*4, dtype=numpy.int64).reshape(5, 4)
+    index = awkward1.layout.Index64(numpy.array([2, 0, 1, 2], dtype=numpy.int64))
+    for nparray in (base[::2], base[::-2], base[::2, 1:3], base[:, ::2], base.T[1:], base[:, 0]):
+        indexedarray = awkward1.layout.IndexedArray64(index, awkward1.layout.NumpyArray(nparray))
+        projected = indexedarray.project()
+        assert awkward1.to_list(projected) == nparray[[2, 0, 1, 2]].tolist()
+        assert projected.strides == numpy.ascontiguousarray(nparray[[2, 0, 1, 2]]).strides
+
+def test_merge():
+    one = numpy.arange(20, dtype=numpy.int64)
+    two = numpy.arange(10, dtype=numpy.float64) * 1.5
+    for x in (one[::2], one[::-3], one.reshape(5, 4)[:, 1]):
+        for y in (two[::3], two[::-1], two.astype(numpy.int32)[1::2], one[::5]):
+            merged = awkward1.layout.NumpyArray(x).merge(awkward1.layout.NumpyArray(y))
+            assert awkward1.to_list(merged) == numpy.concatenate([x, y]).tolist()
+
+    nparray = one.reshape(5, 4)
+    for x in (nparray[::2], nparray[:, ::-1], nparray[:, :1]):
+        merged = awkward1.layout.NumpyArray(x).merge(awkward1.layout.NumpyArray(x[::-1]))
+        assert awkward1.to_list(merged) == numpy.concatenate([x, x[::-1]]).tolist()
+
+def test_bytes():
+    nparray = numpy.frombuffer(b"abcdefgh", dtype=numpy.uint8)
+    one = awkward1.layout.NumpyArray(nparray[::2], parameters={"__array__": "char"})
+    two = awkward1.layout.NumpyArray(nparray[::-3], parameters={"__array__": "char"})
+    assert one.tojson() == '"aceg"'
+    assert two.tojson() == '"heb"'
+    assert one.merge(two).tojson() == '"acegheb"'
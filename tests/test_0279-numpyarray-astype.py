@@ -0,0 +1,73 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+dtypes = [numpy.float64, numpy.float32, numpy.int64, numpy.uint64, numpy.int32, numpy.uint32, numpy.int16, numpy.uint16, numpy.int8, numpy.uint8, numpy.bool_]
+
+def test_astype():
+    base = numpy.arange(3*4*5).reshape(3, 4, 5) % 23
+    for dtype in dtypes:
+        for nparray in (base.astype(dtype), base.astype(dtype)[:, ::2, 1:], base.astype(dtype).transpose(2, 0, 1), base.astype(dtype)[0, 0, ::-2]):
+            layout = awkward1.layout.NumpyArray(nparray)
+
+            asdouble = layout.astype(numpy.float64)
+            assert numpy.asarray(asdouble).dtype == numpy.dtype(numpy.float64)
+            assert numpy.asarray(asdouble).tolist() == nparray.astype(numpy.float64).tolist()
+            assert asdouble.iscontiguous
+
+            if dtype not in (numpy.float64, numpy.float32):
+                asint = layout.astype(numpy.int64)
+                assert numpy.asarray(asint).dtype == numpy.dtype(numpy.int64)
+                assert numpy.asarray(asint).tolist() == nparray.astype(numpy.int64).tolist()
+
+            assert numpy.asarray(layout.astype(dtype)).tolist() == nparray.tolist()
+            assert layout.astype(dtype).iscontiguous
+
+            for todtype in dtypes + [numpy.float16]:
+                converted = layout.astype(todtype)
+                assert numpy.asarray(converted).dtype == numpy.dtype(todtype)
+                assert numpy.asarray(converted).tolist() == nparray.astype(todtype).tolist()
+
+def test_narrowing():
+    nparray = numpy.array([-300, -129, -1, 0, 127, 128, 255, 256, 70000], dtype=numpy.int64)
+    layout = awkward1.layout.NumpyArray(nparray)
+    for dtype in (numpy.int32, numpy.uint32, numpy.int16, numpy.uint16, numpy.int8, numpy.uint8, numpy.bool_):
+        assert numpy.asarray(layout.astype(dtype)).tolist() == nparray.astype(dtype).tolist()
+
+    nparray = numpy.array([-2.75, -0.5, 0.0, 0.5, 2.75, 100.25])
+    layout = awkward1.layout.NumpyArray(nparray)
+    for dtype in (numpy.float32, numpy.int64, numpy.int32, numpy.int16, numpy.int8, numpy.bool_):
+        assert numpy.asarray(layout.astype(dtype)).tolist() == nparray.astype(dtype).tolist()
+
+def test_int_to_float32():
+    nparray = numpy.array([-2**24, -3, 0, 7, 2**24, 2**24 + 1, 2**40], dtype=numpy.int64)
+    for dtype in (numpy.int64, numpy.int32, numpy.int16, numpy.uint8):
+        layout = awkward1.layout.NumpyArray(nparray.astype(dtype)[::-1])
+        asfloat = layout.astype(numpy.float32)
+        assert numpy.asarray(asfloat).dtype == numpy.dtype(numpy.float32)
+        assert numpy.asarray(asfloat).tolist() == nparray.astype(dtype)[::-1].astype(numpy.float32).tolist()
+
+def test_unsupported():
+    layout = awkward1.layout.NumpyArray(numpy.arange(10, dtype=numpy.float64))
+    with pytest.raises(ValueError):
+        layout.astype(numpy.complex128)
+
+    layout = awkward1.layout.NumpyArray(numpy.array([1, 2**63], dtype=numpy.uint64))
+    with pytest.raises(ValueError):
+        layout.astype(numpy.int64)
+
+def test_merge_mixed_precision():
+    one = numpy.arange(10, dtype=numpy.float32) * 0.5
+    two = numpy.arange(5, dtype=numpy.int16)
+    three = numpy.array([True, False, True])
+    for x in (one, two, three):
+        for y in (one, two, three, numpy.arange(4, dtype=numpy.uint8)[::-1]):
+            merged = awkward1.layout.NumpyArray(x).merge(awkward1.layout.NumpyArray(y))
+            assert awkward1.to_list(merged) == numpy.concatenate([x, y]).tolist()
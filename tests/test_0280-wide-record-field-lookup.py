@@ -0,0 +1,47 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_wide_record():
+    content = awkward1.layout.NumpyArray(numpy.arange(5, dtype=numpy.int64))
+    keys = ["branch_{0}".format(i) for i in range(1500)]
+    array = awkward1.layout.RecordArray([content] * 1500, keys)
+    for i in (0, 1, 750, 1499):
+        assert array.fieldindex("branch_{0}".format(i)) == i
+        assert array.haskey("branch_{0}".format(i))
+        assert array[1].fieldindex("branch_{0}".format(i)) == i
+        assert array.form.fieldindex("branch_{0}".format(i)) == i
+        assert awkward1.type(array).fieldindex("branch_{0}".format(i)) == i
+    assert not array.haskey("branch_1500")
+    assert awkward1.to_list(array["branch_1499"]) == [0, 1, 2, 3, 4]
+    assert awkward1.to_list(array[2:4]["branch_7"]) == [2, 3]
+    with pytest.raises(ValueError):
+        array.fieldindex("branch_1500")
+
+def test_numeric_keys():
+    content = awkward1.layout.NumpyArray(numpy.arange(5, dtype=numpy.int64))
+    array = awkward1.layout.RecordArray([content, content, content], ["x", "y", "1"])
+    assert array.fieldindex("x") == 0
+    assert array.fieldindex("1") == 2
+    assert array.fieldindex("0") == 0
+    assert array.haskey("0")
+    assert not array.haskey("3")
+    assert not array.haskey("-1")
+    assert not array.haskey("2x")
+    assert not array.haskey("")
+    with pytest.raises(ValueError):
+        array.fieldindex("99999999999999999999")
+
+    tuple = awkward1.layout.RecordArray([content, content])
+    assert tuple.istuple
+    assert tuple.fieldindex("1") == 1
+    assert tuple.haskey("0")
+    assert not tuple.haskey("2")
+    assert not tuple.haskey("x")
@@ -0,0 +1,33 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_copy_on_write():
+    one = awkward1.layout.NumpyArray(numpy.arange(10), parameters={"x": 1, "y": [1, 2]})
+    two = one[2:5]
+    assert two.parameters == {"x": 1, "y": [1, 2]}
+    two.setparameter("x", 2)
+    assert one.parameters == {"x": 1, "y": [1, 2]}
+    assert two.parameters == {"x": 2, "y": [1, 2]}
+    two.setparameter("y", None)
+    assert one.parameters == {"x": 1, "y": [1, 2]}
+    assert two.parameters == {"x": 2}
+
+def test_equal_parameters():
+    content = awkward1.layout.NumpyArray(numpy.arange(10))
+    offsets = awkward1.layout.Index64(numpy.array([0, 3, 3, 5, 10], dtype=numpy.int64))
+    arrays = [awkward1.layout.ListOffsetArray64(offsets, content, parameters={"__array__": "string-like", "n": 3}) for i in range(3)]
+    assert all(x.form == arrays[0].form for x in arrays)
+    assert all(awkward1.type(x) == awkward1.type(arrays[0]) for x in arrays)
+    arrays[1].setparameter("n", 4)
+    assert arrays[1].form != arrays[0].form
+    assert arrays[2].form == arrays[0].form
+    merged = arrays[0].merge(arrays[2])
+    assert merged.parameters == {"__array__": "string-like", "n": 3}
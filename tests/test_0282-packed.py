@@ -0,0 +1,77 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_listarray():
+    content = awkward1.layout.NumpyArray(numpy.arange(10) * 1.1)
+    starts = awkward1.layout.Index64(numpy.array([6, 3, 3, 0], dtype=numpy.int64))
+    stops = awkward1.layout.Index64(numpy.array([9, 5, 3, 1], dtype=numpy.int64))
+    listarray = awkward1.layout.ListArray64(starts, stops, content)
+    packed = listarray.packed()
+    assert isinstance(packed, awkward1.layout.ListOffsetArray64)
+    assert numpy.asarray(packed.offsets).tolist() == [0, 3, 5, 5, 6]
+    assert len(packed.content) == 6
+    assert awkward1.to_list(packed) == awkward1.to_list(listarray)
+
+def test_listoffsetarray():
+    content = awkward1.layout.NumpyArray(numpy.arange(10) * 1.1)
+    offsets = awkward1.layout.Index32(numpy.array([0, 3, 3, 5, 6, 10], dtype=numpy.int32))
+    listoffsetarray = awkward1.layout.ListOffsetArray32(offsets, content)
+    for sliced in (listoffsetarray[2:4], listoffsetarray[:2], listoffsetarray[4:]):
+        packed = sliced.packed()
+        assert numpy.asarray(packed.offsets)[0] == 0
+        assert len(packed.content) == numpy.asarray(packed.offsets)[-1]
+        assert awkward1.to_list(packed) == awkward1.to_list(sliced)
+
+def test_indexedarray():
+    content = awkward1.layout.NumpyArray(numpy.arange(10) * 1.1)
+    index = awkward1.layout.Index64(numpy.array([8, -1, 2, -1], dtype=numpy.int64))
+    optionarray = awkward1.layout.IndexedOptionArray64(index, content)
+    packed = optionarray.packed()
+    assert isinstance(packed, awkward1.layout.IndexedOptionArray64)
+    assert numpy.asarray(packed.index).tolist() == [0, -1, 1, -1]
+    assert len(packed.content) == 2
+    assert awkward1.to_list(packed) == awkward1.to_list(optionarray)
+
+    index = awkward1.layout.Index64(numpy.array([8, 2, 2], dtype=numpy.int64))
+    packed = awkward1.layout.IndexedArray64(index, content).packed()
+    assert isinstance(packed, awkward1.layout.NumpyArray)
+    assert awkward1.to_list(packed) == [8.8, 2.2, 2.2]
+
+    index = awkward1.layout.Index64(numpy.array([1, 0, 1, 1, 0], dtype=numpy.int64))
+    categorical = awkward1.layout.IndexedArray64(index, content[:2], parameters={"__array__": "categorical"})
+    packed = categorical.packed()
+    assert isinstance(packed, awkward1.layout.IndexedArray64)
+    assert packed.parameters == {"__array__": "categorical"}
+    assert awkward1.to_list(packed) == [1.1, 0.0, 1.1, 1.1, 0.0]
+
+def test_record_and_masked():
+    content = awkward1.layout.NumpyArray(numpy.arange(10) * 1.1)
+    recordarray = awkward1.layout.RecordArray([content, content[::-1]], ["x", "y"], 3)
+    packed = recordarray.packed()
+    assert [len(packed.field(i)) for i in range(2)] == [3, 3]
+    assert awkward1.to_list(packed) == awkward1.to_list(recordarray)
+
+    mask = awkward1.layout.Index8(numpy.array([False, True, False, True], dtype=numpy.bool_))
+    bytemasked = awkward1.layout.ByteMaskedArray(mask, content, valid_when=True)
+    packed = bytemasked.packed()
+    assert len(packed.content) == 4
+    assert awkward1.to_list(packed) == [None, 1.1, None, 3.3]
+
+    regulararray = awkward1.layout.RegularArray(content, 3)
+    packed = regulararray.packed()
+    assert len(packed.content) == 9
+    assert awkward1.to_list(packed) == awkward1.to_list(regulararray)
+
+def test_numpyarray():
+    nparray = numpy.arange(2*3*5).reshape(2, 3, 5)[:, ::2, 1:]
+    packed = awkward1.layout.NumpyArray(nparray).packed()
+    assert packed.iscontiguous
+    assert awkward1.to_list(packed) == nparray.tolist()
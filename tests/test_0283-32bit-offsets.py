@@ -0,0 +1,76 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+content = awkward1.layout.NumpyArray(numpy.arange(10) * 1.1)
+offsets = awkward1.layout.Index32(numpy.array([0, 3, 3, 5, 6, 10], dtype=numpy.int32))
+listoffsetarray = awkward1.layout.ListOffsetArray32(offsets, content)
+
+def test_rpad():
+    for array in (listoffsetarray, listoffsetarray[2:]):
+        padded = array.rpad(3, 1)
+        assert isinstance(padded, awkward1.layout.ListOffsetArray32)
+        assert isinstance(padded.content, awkward1.layout.IndexedOptionArray32)
+        assert awkward1.to_list(padded) == [x + [None] * (3 - len(x)) for x in awkward1.to_list(array)]
+
+    starts = awkward1.layout.Index32(numpy.array([6, 1], dtype=numpy.int32))
+    stops = awkward1.layout.Index32(numpy.array([8, 2], dtype=numpy.int32))
+    listarray = awkward1.layout.ListArray32(starts, stops, content)
+    padded = listarray.rpad(3, 1)
+    assert isinstance(padded, awkward1.layout.ListArray32)
+    assert isinstance(padded.content, awkward1.layout.IndexedOptionArray32)
+    assert awkward1.to_list(padded) == [[6.6, 7.7, None], [1.1, None, None]]
+
+def test_packed():
+    packed = listoffsetarray[2:].packed()
+    assert isinstance(packed, awkward1.layout.ListOffsetArray32)
+    assert numpy.asarray(packed.offsets).tolist() == [0, 2, 3, 7]
+    assert len(packed.content) == 7
+    assert awkward1.to_list(packed) == awkward1.to_list(listoffsetarray[2:])
+
+def test_num_and_flatten():
+    regulararray = awkward1.layout.RegularArray(content, 2)
+    nested = awkward1.layout.ListOffsetArray32(awkward1.layout.Index32(numpy.array([0, 1, 3, 5], dtype=numpy.int32)), regulararray)
+    sliced = nested[1:]
+    num = sliced.num(2)
+    assert isinstance(num, awkward1.layout.ListOffsetArray32)
+    assert awkward1.to_list(num) == [[2, 2], [2, 2]]
+
+    sliced = listoffsetarray[2:]
+    assert awkward1.to_list(sliced.flatten(1)) == [3.3, 4.4, 5.5, 6.6, 7.7, 8.8, 9.9]
+    assert awkward1.to_list(sliced.count(axis=1)) == [2, 1, 4]
+
+nested = awkward1.layout.ListOffsetArray32(awkward1.layout.Index32(numpy.array([0, 2, 3, 5], dtype=numpy.int32)), listoffsetarray)
+
+def test_getitem():
+    assert isinstance(nested[:, 1:], awkward1.layout.ListOffsetArray32)
+    assert awkward1.to_list(nested[:, 1:]) == [[[]], [], [[6.6, 7.7, 8.8, 9.9]]]
+    assert isinstance(nested[:, 0], awkward1.layout.ListArray32)
+    assert awkward1.to_list(nested[:, 0]) == [[0.0, 1.1, 2.2], [3.3, 4.4], [5.5]]
+    assert awkward1.to_list(nested[:, [0]]) == [[[0.0, 1.1, 2.2]], [[3.3, 4.4]], [[5.5]]]
+    assert awkward1.to_list(nested[[0, 0], [1, 0]]) == [[], [0.0, 1.1, 2.2]]
+
+def test_deep_flatten_and_reduce():
+    flattened = nested.flatten(2)
+    assert isinstance(flattened, awkward1.layout.ListOffsetArray32)
+    assert awkward1.to_list(flattened) == [[0.0, 1.1, 2.2], [3.3, 4.4], [5.5, 6.6, 7.7, 8.8, 9.9]]
+    assert awkward1.to_list(nested.count(axis=-1)) == [[3, 0], [2], [1, 4]]
+    assert awkward1.to_list(nested.count(axis=-2)) == [[1, 1, 1], [1, 1], [2, 1, 1, 1]]
+
+def test_listarray_packed():
+    starts = awkward1.layout.Index32(numpy.array([3, 0, 1], dtype=numpy.int32))
+    stops = awkward1.layout.Index32(numpy.array([5, 2, 2], dtype=numpy.int32))
+    listarray = awkward1.layout.ListArray32(starts, stops, listoffsetarray)
+    packed = listarray.packed()
+    assert isinstance(packed, awkward1.layout.ListOffsetArray32)
+    assert numpy.asarray(packed.offsets).tolist() == [0, 2, 4, 5]
+    assert awkward1.to_list(packed) == awkward1.to_list(listarray)
+    assert isinstance(listarray.flatten(2), awkward1.layout.ListOffsetArray32)
+    assert awkward1.to_list(listarray.flatten(2)) == [[5.5, 6.6, 7.7, 8.8, 9.9], [0.0, 1.1, 2.2], []]
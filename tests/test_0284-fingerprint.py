@@ -0,0 +1,42 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_equal_content():
+    one = awkward1.Array([[1.1, 2.2, 3.3], [], [4.4, 5.5]]).layout
+    two = awkward1.Array([[1.1, 2.2, 3.3], [], [4.4, 5.5]]).layout
+    three = awkward1.Array([[1.1, 2.2, 3.3], [], [4.4, 5.6]]).layout
+    assert one.fingerprint == one.fingerprint
+    assert one.fingerprint == two.fingerprint
+    assert one.fingerprint != three.fingerprint
+    assert one[:2].fingerprint == three[:2].fingerprint
+    assert one[:2].fingerprint != one.fingerprint
+
+def test_form_and_parameters():
+    nparray = numpy.arange(12, dtype=numpy.int64)
+    one = awkward1.layout.NumpyArray(nparray)
+    assert one.fingerprint != awkward1.layout.NumpyArray(nparray.view(numpy.float64)).fingerprint
+    assert one.fingerprint != awkward1.layout.NumpyArray(nparray.reshape(3, 4)).fingerprint
+    assert one.fingerprint != awkward1.layout.NumpyArray(nparray, parameters={"x": 1}).fingerprint
+    assert awkward1.layout.NumpyArray(nparray[::2]).fingerprint == awkward1.layout.NumpyArray(nparray[::2].copy()).fingerprint
+
+def test_records():
+    content = awkward1.layout.NumpyArray(numpy.arange(10))
+    one = awkward1.layout.RecordArray([content, content], ["x", "y"], 5)
+    two = awkward1.layout.RecordArray([content[:5], content[:5]], ["x", "y"])
+    three = awkward1.layout.RecordArray([content[:5], content[:5]], ["x", "z"])
+    assert one.fingerprint == two.fingerprint
+    assert one.fingerprint != three.fingerprint
+
+def test_strided():
+    nparray = numpy.arange(24, dtype=numpy.float64).reshape(4, 6)
+    for view in (nparray[:, 1], nparray[::2], nparray.T, nparray[:0, ::2]):
+        assert awkward1.layout.NumpyArray(view).fingerprint == awkward1.layout.NumpyArray(view.copy()).fingerprint
+    assert awkward1.layout.NumpyArray(nparray[:, 1]).fingerprint != awkward1.layout.NumpyArray(nparray[:, 2]).fingerprint
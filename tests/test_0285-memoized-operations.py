@@ -0,0 +1,89 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_memorycache():
+    one = awkward1.layout.NumpyArray(numpy.arange(10, dtype=numpy.int64))
+    two = awkward1.layout.NumpyArray(numpy.arange(5, dtype=numpy.int64))
+    cache = awkward1.layout.MemoryCache(100)
+    cache["one"] = one
+    assert "one" in cache
+    assert cache.current_bytes == 80
+    cache["two"] = two
+    assert "one" not in cache
+    assert "two" in cache
+    assert cache.current_bytes == 40
+    cache["big"] = awkward1.layout.NumpyArray(numpy.arange(100))
+    assert "big" not in cache
+    assert len(cache) == 1
+    cache.clear()
+    assert len(cache) == 0
+    with pytest.raises(KeyError):
+        cache["two"]
+
+def buffer(layout):
+    # results found in the cache share buffers with the first result
+    for name in ("offsets", "starts"):
+        if hasattr(layout, name):
+            return numpy.asarray(getattr(layout, name)).ctypes.data
+    return numpy.asarray(layout).ctypes.data
+
+def test_memoized():
+    content = awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3, 4.4, 5.5]))
+    offsets = awkward1.layout.Index64(numpy.array([0, 3, 3, 5], dtype=numpy.int64))
+    array = awkward1.layout.ListOffsetArray64(offsets, content)
+    cache = awkward1.layout.MemoryCache(1024**2)
+    awkward1.layout.setmemocache(cache)
+    try:
+        assert awkward1.layout.memocache() is cache
+
+        sum1 = array.sum(axis=-1, mask=False, keepdims=False)
+        assert len(cache) == 1
+        assert awkward1.to_list(sum1) == pytest.approx([6.6, 0.0, 9.9])
+        assert buffer(array.sum(axis=-1, mask=False, keepdims=False)) == buffer(sum1)
+        assert buffer(array.max(axis=-1, mask=True, keepdims=False)) != buffer(sum1)
+        assert len(cache) == 2
+
+        # an equal array (not the same object) finds the same results
+        copy = awkward1.layout.ListOffsetArray64(
+            awkward1.layout.Index64(numpy.array([0, 3, 3, 5], dtype=numpy.int64)),
+            awkward1.layout.NumpyArray(numpy.array([1.1, 2.2, 3.3, 4.4, 5.5])))
+        assert buffer(copy.sum(axis=-1, mask=False, keepdims=False)) == buffer(sum1)
+
+        num = array.num(axis=1)
+        assert awkward1.to_list(num) == [3, 0, 2]
+        assert buffer(array.num(axis=1)) == buffer(num)
+
+        pairs = array.combinations(2, axis=1)
+        assert buffer(array.combinations(2, axis=1)) == buffer(pairs)
+        assert buffer(array.combinations(2, axis=1, keys=["x", "y"])) != buffer(pairs)
+        assert buffer(array.combinations(2, replacement=True, axis=1)) != buffer(pairs)
+
+        picked = array[numpy.array([2, 0])]
+        assert awkward1.to_list(picked) == [[4.4, 5.5], [1.1, 2.2, 3.3]]
+        assert buffer(array[numpy.array([2, 0])]) == buffer(picked)
+        assert buffer(array[numpy.array([2, 1])]) != buffer(picked)
+
+        # ranges are cheap views and not memoized
+        before = len(cache)
+        array[1:]
+        assert len(cache) == before
+
+        # changing a result does not change the cached one
+        sum1.setparameter("x", 123)
+        sum2 = array.sum(axis=-1, mask=False, keepdims=False)
+        assert sum2.parameter("x") is None
+        sum2.setidentities()
+        assert array.sum(axis=-1, mask=False, keepdims=False).identities is None
+    finally:
+        awkward1.layout.setmemocache(None)
+
+    assert awkward1.layout.memocache() is None
+    assert buffer(array.sum(axis=-1, mask=False, keepdims=False)) != buffer(sum1)
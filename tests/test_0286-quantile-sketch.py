@@ -0,0 +1,59 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_exact_for_small_groups():
+    array = awkward1.Array([[5, 1, 3], [], [4, 2, 8, 6], [7]])
+    for q in (0.0, 0.1, 0.25, 0.5, 0.9, 1.0):
+        expected = [numpy.quantile(x, q, interpolation="lower") if len(x) > 0 else None for x in awkward1.to_list(array)]
+        assert awkward1.to_list(awkward1.quantile(array, q, axis=-1)) == expected
+    assert awkward1.to_list(awkward1.quantile(array, 0.5, axis=-1, keepdims=True)) == [[3], [None], [4], [7]]
+    out = awkward1.to_list(awkward1.quantile(array, 0.5, axis=-1, mask_identity=False))
+    assert out[0] == 3 and numpy.isnan(out[1])
+
+def test_regular():
+    nparray = numpy.arange(4*3*5, dtype=numpy.float32).reshape(4, 3, 5)[:, ::-1]
+    layout = awkward1.layout.NumpyArray(nparray)
+    for axis in (0, 1, 2):
+        assert awkward1.to_list(layout.quantile(0.5, axis=axis, mask=False)) == numpy.quantile(nparray, 0.5, axis=axis, interpolation="lower").tolist()
+
+def test_approximate():
+    data = numpy.random.RandomState(12345).normal(0, 1, 200000)
+    array = awkward1.Array(awkward1.layout.NumpyArray(data))
+    for q in (0.01, 0.5, 0.99):
+        estimate = awkward1.quantile(array, q, axis=0)
+        rank = numpy.searchsorted(numpy.sort(data), estimate) / len(data)
+        assert abs(rank - q) < 0.02
+
+def test_sketch_merge():
+    data = numpy.random.RandomState(12345).exponential(1, 100000)
+    one = awkward1.layout.QuantileSketch(200)
+    two = awkward1.layout.QuantileSketch(200)
+    one.update(data[:30000])
+    two.update(data[30000:])
+    one.merge(two)
+    assert one.count == len(data)
+    assert one.size < 1000
+    rank = numpy.searchsorted(numpy.sort(data), one.quantile(0.9)) / len(data)
+    assert abs(rank - 0.9) < 0.02
+
+def test_partitioned():
+    data = numpy.random.RandomState(12345).uniform(0, 1, 30000)
+    array = awkward1.partitioned(lambda i: data[i*10000 : (i + 1)*10000], 3)
+    rank = numpy.searchsorted(numpy.sort(data), awkward1.quantile(array, 0.5)) / len(data)
+    assert abs(rank - 0.5) < 0.02
+    assert awkward1.quantile(awkward1.Array([[], []]), 0.5) is None
+
+def test_bad_q():
+    array = awkward1.layout.NumpyArray(numpy.arange(10.0))
+    with pytest.raises(ValueError):
+        array.quantile(1.5, axis=0)
+    with pytest.raises(ValueError):
+        awkward1.layout.QuantileSketch(1)
@@ -0,0 +1,69 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_exact_for_small_groups():
+    array = awkward1.Array([[5, 1, 5, 3], [], [4, 4, 4, 2, 4], [7]])
+    assert awkward1.to_list(awkward1.count_distinct(array, axis=-1)) == [3, 0, 2, 1]
+    assert awkward1.to_list(awkward1.count_distinct(array, axis=-1, mask_identity=True)) == [3, None, 2, 1]
+    assert awkward1.to_list(awkward1.count_distinct(array, axis=-1, keepdims=True)) == [[3], [0], [2], [1]]
+    assert awkward1.count_distinct(array) == 7
+
+def test_regular():
+    nparray = numpy.array([[1, 1, 2], [3, 3, 3], [1, 2, 3], [0, -0.0, 0]])
+    layout = awkward1.layout.NumpyArray(nparray)
+    assert awkward1.to_list(layout.count_distinct(axis=1)) == [2, 1, 3, 1]
+    assert awkward1.to_list(layout.count_distinct(axis=0)) == [3, 4, 3]
+
+def test_hash64():
+    one = awkward1.layout.NumpyArray(numpy.array([1, -1, 2**40], dtype=numpy.int64))
+    two = awkward1.layout.NumpyArray(numpy.array([1, -1], dtype=numpy.int8))
+    assert numpy.asarray(one.hash64()).tolist()[:2] == numpy.asarray(two.hash64()).tolist()
+    assert numpy.asarray(one.hash64()).dtype == numpy.dtype(numpy.uint64)
+
+    strings = awkward1.Array(["abc", "abc", "xy", "abc", ""]).layout
+    hashes = numpy.asarray(strings.hash64()).tolist()
+    assert hashes[0] == hashes[1] == hashes[3]
+    assert len(set(hashes)) == 3
+    assert numpy.asarray(strings[2:4].hash64()).tolist() == hashes[2:4]
+
+def test_strings():
+    array = awkward1.Array([["one", "two", "one"], [], ["three", "three"]])
+    assert awkward1.to_list(awkward1.count_distinct(array, axis=-1)) == [2, 0, 1]
+    assert awkward1.count_distinct(array) == 3
+
+def test_approximate():
+    data = numpy.random.RandomState(12345).randint(0, 1000000, 3000000)
+    exact = len(numpy.unique(data))
+    estimate = awkward1.count_distinct(awkward1.Array(data), axis=0)
+    assert abs(estimate - exact) / exact < 0.05
+
+def test_partitioned():
+    data = numpy.random.RandomState(12345).randint(0, 50000, 300000)
+    array = awkward1.partitioned(lambda i: data[i*100000 : (i + 1)*100000], 3)
+    exact = len(numpy.unique(data))
+    assert abs(awkward1.count_distinct(array) - exact) / exact < 0.05
+
+def test_sketch_merge():
+    hashes = numpy.asarray(awkward1.layout.NumpyArray(numpy.arange(100000)).hash64())
+    one = awkward1.layout.HyperLogLog(12)
+    two = awkward1.layout.HyperLogLog(12)
+    one.update(hashes[:60000])
+    two.update(hashes[40000:])
+    one.merge(two)
+    assert abs(one.estimate() - 100000) / 100000 < 0.05
+    with pytest.raises(ValueError):
+        one.merge(awkward1.layout.HyperLogLog(10))
+
+def test_bad_precision():
+    with pytest.raises(ValueError):
+        awkward1.layout.HyperLogLog(3)
+    with pytest.raises(ValueError):
+        awkward1.layout.NumpyArray(numpy.arange(10)).count_distinct(axis=0, precision=19)
@@ -0,0 +1,103 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import json
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_zonemap_of():
+    assert awkward1.partition.zonemap_of(awkward1.Array([3, 1, 2]).layout) == {"min": 1, "max": 3, "nulls": 0}
+    assert awkward1.partition.zonemap_of(awkward1.Array([[3.3, None], [], None, [numpy.nan, -1.1]]).layout) == {"min": -1.1, "max": 3.3, "nulls": 2}
+    assert awkward1.partition.zonemap_of(awkward1.Array([]).layout) == {"min": None, "max": None, "nulls": 0}
+    assert awkward1.partition.zonemap_of(awkward1.Array(["one", "two"]).layout) is None
+    assert awkward1.partition.zonemaps_of(awkward1.Array([{"x": 1, "y": {"z": 2.2}}]).layout) == {"x": {"min": 1, "max": 1, "nulls": 0}, "y.z": {"min": 2.2, "max": 2.2, "nulls": 0}}
+
+def test_computed_on_first_scan():
+    data = [{"run": i // 7, "x": i * 1.1} for i in range(100)]
+    array = awkward1.partitioned(lambda i: data[i*10 : (i + 1)*10], 10)
+    assert array.layout.zonemaps == {}
+    for cut in (array.run == 3, 3 == array.run, array.run < 2, 2 > array.run, array.run >= 13):
+        assert awkward1.partitions(cut) == [10] * 10
+    assert awkward1.to_list(array[array.run == 3]) == [x for x in data if x["run"] == 3]
+    assert awkward1.to_list(array[array.run >= 13]) == [x for x in data if x["run"] >= 13]
+    assert awkward1.to_list(array[array.run < 2]) == [x for x in data if x["run"] < 2]
+    assert array.layout.zonemaps["run"][0] == {"min": 0, "max": 1, "nulls": 0}
+    assert array.run.layout.zonemap() == array.layout.zonemaps["run"]
+    assert array.run.layout.zonemaps == {"": array.layout.zonemaps["run"]}
+    assert len(array[array.run == 3]) == 7
+
+def test_skip_partitions():
+    counter = [0] * 10
+    def generate(i, field):
+        def generate():
+            counter[i] += 1
+            if field == "run":
+                return numpy.arange(i*10, (i + 1)*10, dtype=numpy.int64)
+            else:
+                return numpy.arange(10) * 1.1
+        return generate
+
+    def partition(i):
+        return awkward1.zip({"run": awkward1.virtual(generate(i, "run"), length=10, form="int64"),
+                             "x": awkward1.virtual(generate(i, "x"), length=10, form="float64")},
+                            depth_limit=1)
+
+    zonemaps = {"run": [{"min": i*10, "max": i*10 + 9, "nulls": 0} for i in range(10)]}
+    array = awkward1.partitioned(partition, 10, zonemaps=zonemaps)
+    assert counter == [0] * 10
+
+    selected = array[array.run == 25]
+    assert len(selected) == 1
+    assert counter[2] > 0
+    assert counter[:2] + counter[3:] == [0] * 9
+    assert awkward1.to_list(selected) == [{"run": 25, "x": 5.5}]
+
+    with pytest.raises(ValueError):
+        awkward1.partitioned(partition, 10, zonemaps={"run": []})
+
+def test_computed_at_write():
+    array = awkward1.partitioned(lambda i: awkward1.Array([{"x": i, "y": "str"}] * 3), 4, zonemaps=True)
+    assert array.layout.zonemaps == {"x": [{"min": i, "max": i, "nulls": 0} for i in range(4)]}
+    assert awkward1.to_list(array[array.x > 2].x) == [3, 3, 3]
+
+def test_nulls_not_skipped():
+    data = [1, None, 3, 4, 5, 6]
+    array = awkward1.partitioned(lambda i: data[i*3 : (i + 1)*3], 2)
+    assert awkward1.to_list(array[array == 100]) == awkward1.to_list(awkward1.Array(data)[awkward1.Array(data) == 100])
+
+def test_zonemap_keys():
+    for path in [(), ("x",), ("y", "z"), ("a.b", "c\\d"), ("x.",)]:
+        assert awkward1.partition.zonemap_path(awkward1.partition.zonemap_key(path)) == path
+    assert awkward1.partition.zonemap_key(("a.b", "c")) == "a\\.b.c"
+
+def test_json_roundtrip():
+    data = [{"run": i, "y": {"z": i * 1.1}} for i in range(12)]
+    array = awkward1.partitioned(lambda i: data[i*3 : (i + 1)*3], 4, zonemaps=True)
+    zonemaps = array.layout.zonemaps
+    assert json.loads(json.dumps(zonemaps)) == zonemaps
+    assert zonemaps["y.z"][1] == {"min": pytest.approx(3.3), "max": pytest.approx(5.5), "nulls": 0}
+
+    # save the Form and zone maps; later, skip partitions without reading them
+    form = array.layout.partition(0).form.tojson()
+    saved = json.dumps(zonemaps)
+    lengths = awkward1.partitions(array)
+
+    counter = [0] * 4
+    def read(i):
+        counter[i] += 1
+        return array.layout.partition(i)
+
+    def generate(i):
+        return awkward1.virtual(read, args=(i,), form=form, length=lengths[i])
+
+    for loaded in (saved, json.loads(saved)):
+        counter[:] = [0] * 4
+        again = awkward1.partitioned(generate, len(lengths), zonemaps=loaded)
+        assert again.layout.zonemaps == zonemaps
+        assert awkward1.to_list(again[again.run == 7]) == [data[7]]
+        assert counter[:2] + counter[3:] == [0, 0, 0]
@@ -0,0 +1,61 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def events(i):
+    return awkward1.zip({"run": numpy.full(1000, i // 10, dtype=numpy.int32),
+                         "event": numpy.arange(i*1000, (i + 1)*1000),
+                         "x": numpy.arange(1000) * 1.1})
+
+def test_bloom_filters():
+    array = awkward1.partitioned(events, 50)
+    index = awkward1.partition.PartitionIndex(array, ["run", "event"])
+    assert not index.hashindex
+    assert 23 in index.candidates((2, 23456))
+    assert len(index.candidates((2, 23456))) < 5
+    assert index.find((2, 23456)) == [(23, 456)]
+    assert index.find((3, 23456)) == []
+    assert index.find([4, 49999]) == [(49, 999)]
+    assert sum(len(index.candidates((-1, i))) for i in range(1000)) < 0.05 * 1000 * 50
+
+def test_hash_index():
+    array = awkward1.partitioned(events, 50)
+    index = awkward1.partition.PartitionIndex(array, ["run", "event"], hashindex=True)
+    assert index.hashindex
+    for run, event in ((0, 0), (2, 23456), (4, 49999)):
+        matches = index.find((run, event))
+        assert len(matches) == 1
+        partitionid, i = matches[0]
+        assert array.layout.partition(partitionid)[i]["event"] == event
+        assert array.layout.partitionid_index_at(event) == (partitionid, i)
+    assert index.find((3, 23456)) == []
+
+def test_duplicates_and_types():
+    data = awkward1.Array([{"k": 1}, {"k": 2}, {"k": 1}, {"k": 3}, {"k": 1}])
+    array = awkward1.repartition(data, 2)
+    for hashindex in (False, True):
+        index = awkward1.partition.PartitionIndex(array, "k", hashindex=hashindex)
+        assert index.find(1) == [(0, 0), (1, 0), (2, 0)]
+        assert index.find(4) == []
+
+    unsigned = awkward1.Array(numpy.array([1, 2**63 + 5, 7], dtype=numpy.uint64))
+    array = awkward1.Array(awkward1.partition.IrregularlyPartitionedArray([unsigned.layout[:2], unsigned.layout[2:]]))
+    index = awkward1.partition.PartitionIndex(awkward1.zip({"k": array}), "k", hashindex=True)
+    assert index.find(2**63 + 5) == [(0, 1)]
+
+def test_errors():
+    array = awkward1.partitioned(lambda i: awkward1.zip({"x": numpy.arange(3) * 1.1}), 2)
+    with pytest.raises(ValueError):
+        awkward1.partition.PartitionIndex(array, "x")
+    array = awkward1.partitioned(events, 2)
+    with pytest.raises(ValueError):
+        awkward1.partition.PartitionIndex(array, ["run", "event"]).find(3)
+    with pytest.raises(ValueError):
+        awkward1.partition.PartitionIndex(array, "run", falsepositive=1.5)
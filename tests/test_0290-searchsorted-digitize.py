@@ -0,0 +1,56 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_flat():
+    edges = numpy.array([0.0, 1.5, 1.5, 3.0, 10.0])
+    values = numpy.array([-1, 0, 1.5, 2, 3, 9.9, 10, 11, numpy.nan])
+    for side in ("left", "right"):
+        assert awkward1.to_list(awkward1.searchsorted(edges, values, side=side)) == numpy.searchsorted(edges, values, side=side).tolist()
+    for dtype in (numpy.int8, numpy.uint16, numpy.int32, numpy.uint32, numpy.int64, numpy.float32):
+        ints = numpy.arange(-2, 12, dtype=numpy.int64).astype(dtype)
+        assert awkward1.to_list(awkward1.searchsorted(edges, ints)) == numpy.searchsorted(edges, ints).tolist()
+    layout = awkward1.layout.NumpyArray(numpy.arange(12).reshape(3, 4)[:, ::2])
+    assert awkward1.to_list(layout.searchsorted([2, 5])) == numpy.searchsorted([2, 5], numpy.arange(12).reshape(3, 4)[:, ::2]).tolist()
+    assert awkward1.to_list(layout.searchsorted([2, 5], right=True)) == numpy.searchsorted([2, 5], numpy.arange(12).reshape(3, 4)[:, ::2], side="right").tolist()
+
+def test_jagged():
+    array = awkward1.Array([[5, 15, 0], [], None, [[25.5], [-5, 10]]])
+    assert awkward1.to_list(awkward1.searchsorted([0, 10, 20], array)) == [[1, 2, 0], [], None, [[3], [0, 1]]]
+    assert awkward1.to_list(awkward1.searchsorted([0, 10, 20], array, side="right")) == [[1, 2, 1], [], None, [[3], [0, 2]]]
+    assert awkward1.to_list(numpy.searchsorted([0, 10, 20], array)) == [[1, 2, 0], [], None, [[3], [0, 1]]]
+    assert awkward1.to_list(awkward1.searchsorted([20, 0, 10], array, sorter=[1, 2, 0])) == [[1, 2, 0], [], None, [[3], [0, 1]]]
+    assert str(awkward1.type(awkward1.searchsorted([0.0], awkward1.Array([[1.1], []])))) == "2 * var * int64"
+
+def test_records_and_partitions():
+    array = awkward1.Array([{"x": 1.1, "y": [1, 2]}, {"x": 2.2, "y": []}])
+    assert awkward1.to_list(awkward1.searchsorted([1.5, 2.5], array)) == [{"x": 0, "y": [0, 1]}, {"x": 1, "y": []}]
+    partitioned = awkward1.repartition(awkward1.Array([[1, 2], [], [3, 4, 5]]), 2)
+    out = awkward1.searchsorted([2, 4], partitioned)
+    assert awkward1.partitions(out) == [2, 1]
+    assert awkward1.to_list(out) == [[0, 0], [], [1, 1, 2]]
+
+def test_digitize():
+    bins = numpy.array([0.0, 1.0, 2.5, 4.0])
+    values = numpy.array([-1, 0, 0.5, 1, 2.5, 3, 4, 5])
+    for b in (bins, bins[::-1]):
+        for right in (False, True):
+            assert awkward1.to_list(awkward1.digitize(values, b, right=right)) == numpy.digitize(values, b, right=right).tolist()
+    jagged = awkward1.Array([[-1, 0.5], [], [3, 5]])
+    assert awkward1.to_list(awkward1.digitize(jagged, bins)) == [[0, 1], [], [3, 4]]
+    assert awkward1.to_list(numpy.digitize(jagged, bins[::-1])) == [[4, 3], [], [1, 0]]
+
+def test_errors():
+    with pytest.raises(ValueError):
+        awkward1.searchsorted([3, 1, 2], awkward1.Array([1, 2]))
+    with pytest.raises(ValueError):
+        awkward1.searchsorted([[1, 2]], awkward1.Array([1, 2]))
+    with pytest.raises(ValueError):
+        awkward1.searchsorted([1, 2], awkward1.Array([1, 2]), side="middle")
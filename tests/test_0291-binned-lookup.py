@@ -0,0 +1,60 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+table = numpy.array([[1.0, 2.0, 3.0], [4.0, 5.0, 6.0]])
+pt_edges = [0, 10, 20]
+eta_edges = [-1, 0, 1, 2]
+
+def test_jagged():
+    jets = awkward1.Array([[{"pt": 5, "eta": -0.5}, {"pt": 15, "eta": 1.5}], [], [{"pt": 100, "eta": 0.5}, {"pt": -3, "eta": 0.5}, {"pt": 10, "eta": 0}]])
+    sf = awkward1.binned_lookup(table, [pt_edges, eta_edges], [jets.pt, jets.eta])
+    assert awkward1.to_list(sf) == [[1.0, 6.0], [], [5.0, 2.0, 5.0]]
+
+    flat = awkward1.flatten(jets)
+    i = numpy.clip(numpy.searchsorted(pt_edges, numpy.asarray(flat.pt), side="right") - 1, 0, 1)
+    j = numpy.clip(numpy.searchsorted(eta_edges, numpy.asarray(flat.eta), side="right") - 1, 0, 2)
+    assert awkward1.to_list(awkward1.flatten(sf)) == table[i, j].tolist()
+
+def test_interpolate():
+    pt = awkward1.Array([[10.0, 5.0], [0.0, 20.0, 10.0]])
+    eta = awkward1.Array([[0.0, -0.5], [-5.0, 5.0, 1.0]])
+    out = awkward1.binned_lookup(table, [pt_edges, eta_edges], [pt, eta], interpolate=True)
+    assert awkward1.to_list(out) == [[3.0, 1.0], [1.0, 6.0, 4.0]]
+
+def test_prebuilt_and_broadcast():
+    lookup = awkward1.layout.BinnedLookup(table, [pt_edges, eta_edges])
+    assert lookup.numaxes == 2
+    assert lookup.shape == [2, 3]
+    assert lookup.table.tolist() == table.tolist()
+    pt = awkward1.Array([[5, 15], [], [15]])
+    assert awkward1.to_list(awkward1.binned_lookup(lookup, None, [pt, 0.5])) == [[2.0, 5.0], [], [5.0]]
+    assert awkward1.to_list(awkward1.binned_lookup(lookup, None, [pt, awkward1.Array([-0.5, 0.0, 1.5])])) == [[1.0, 4.0], [], [6.0]]
+    assert numpy.isnan(awkward1.to_list(awkward1.binned_lookup(lookup, None, [[numpy.nan], [0.0]]))[0])
+
+def test_one_and_three_dimensions():
+    out = awkward1.binned_lookup([7.0, 8.0], [[0, 1, 2]], [awkward1.Array([[0.5, 1.5, 9], [None]])])
+    assert awkward1.to_list(out) == [[7.0, 8.0, 8.0], [None]]
+    cube = numpy.arange(2*3*4, dtype=numpy.float64).reshape(2, 3, 4)
+    x = awkward1.Array([[0.5, 1.5]])
+    y = awkward1.Array([[2.5, 0.5]])
+    z = awkward1.Array([[3.5, 1.5]])
+    out = awkward1.binned_lookup(cube, [[0, 1, 2], [0, 1, 2, 3], [0, 1, 2, 3, 4]], [x, y, z])
+    assert awkward1.to_list(out) == [[cube[0, 2, 3], cube[1, 0, 1]]]
+
+def test_errors():
+    with pytest.raises(ValueError):
+        awkward1.binned_lookup(table, [pt_edges], [awkward1.Array([1])])
+    with pytest.raises(ValueError):
+        awkward1.binned_lookup(table, [pt_edges, [0, 1, 2]], [awkward1.Array([1]), awkward1.Array([1])])
+    with pytest.raises(ValueError):
+        awkward1.binned_lookup(table, [[0, 20, 10], eta_edges], [awkward1.Array([1]), awkward1.Array([1])])
+    with pytest.raises(ValueError):
+        awkward1.binned_lookup(table, [pt_edges, eta_edges], [awkward1.Array([1])])
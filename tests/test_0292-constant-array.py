@@ -0,0 +1,74 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_basic():
+    constant = awkward1.layout.ConstantArray(2.5, 5)
+    assert len(constant) == 5
+    assert awkward1.to_list(constant) == [2.5, 2.5, 2.5, 2.5, 2.5]
+    assert constant[-1] == 2.5
+    assert str(awkward1.type(constant)) == "float64"
+    assert constant.form == awkward1.layout.NumpyArray(numpy.array([2.5])).form
+    assert constant.nbytes == 8
+    assert numpy.asarray(constant.array).strides == (0,)
+    assert numpy.asarray(constant.toNumpyArray()).tolist() == [2.5] * 5
+
+    with pytest.raises(ValueError):
+        awkward1.layout.ConstantArray(awkward1.layout.NumpyArray(numpy.array([1, 2])), 5)
+
+def test_getitem_carry():
+    constant = awkward1.layout.ConstantArray(numpy.int32(3), 10)
+    assert isinstance(constant[2:7], awkward1.layout.ConstantArray)
+    assert len(constant[2:7]) == 5
+    assert isinstance(constant[::3], awkward1.layout.ConstantArray)
+    assert awkward1.to_list(constant[::3]) == [3, 3, 3, 3]
+    assert isinstance(constant[[9, 0, 0]], awkward1.layout.ConstantArray)
+    assert awkward1.to_list(constant[[9, 0, 0]]) == [3, 3, 3]
+    with pytest.raises(ValueError):
+        constant[10]
+
+    offsets = awkward1.layout.Index64(numpy.array([0, 3, 3, 10], dtype=numpy.int64))
+    jagged = awkward1.layout.ListOffsetArray64(offsets, constant)
+    sliced = jagged[:, 1:]
+    assert awkward1.to_list(sliced) == [[3, 3], [], [3, 3, 3, 3, 3, 3]]
+    assert isinstance(sliced.content, awkward1.layout.ConstantArray)
+
+def test_reduce():
+    offsets = awkward1.layout.Index64(numpy.array([0, 3, 3, 10], dtype=numpy.int64))
+    jagged = awkward1.Array(
+        awkward1.layout.ListOffsetArray64(
+            offsets, awkward1.layout.ConstantArray(numpy.int8(100), 10)
+        )
+    )
+    expected = awkward1.Array([[100] * 3, [], [100] * 7])
+    for reducer in (awkward1.sum, awkward1.count, awkward1.min, awkward1.max, awkward1.prod, awkward1.argmax):
+        assert awkward1.to_list(reducer(jagged, axis=1)) == awkward1.to_list(reducer(expected, axis=1))
+    assert awkward1.to_list(awkward1.sum(jagged, axis=1)) == [300, 0, 700]
+    assert awkward1.to_list(awkward1.min(jagged, axis=1, mask_identity=False)) == [100, 127, 100]
+    assert awkward1.sum(jagged, axis=None) == 1000
+
+def test_merge():
+    one = awkward1.layout.ConstantArray(1.5, 3)
+    two = awkward1.layout.ConstantArray(1.5, 2)
+    three = awkward1.layout.ConstantArray(2.5, 2)
+    merged = one.merge(two)
+    assert isinstance(merged, awkward1.layout.ConstantArray)
+    assert len(merged) == 5
+    assert awkward1.to_list(one.merge(three)) == [1.5, 1.5, 1.5, 2.5, 2.5]
+    assert awkward1.to_list(awkward1.layout.NumpyArray(numpy.array([1.1, 2.2])).merge(one)) == [1.1, 2.2, 1.5, 1.5, 1.5]
+    assert awkward1.to_list(awkward1.concatenate([one, three])) == [1.5, 1.5, 1.5, 2.5, 2.5]
+
+def test_with_field():
+    events = awkward1.Array([{"x": 1}, {"x": 2}, {"x": 3}])
+    events["weight"] = 0.5
+    assert isinstance(events.layout.field("weight"), awkward1.layout.ConstantArray)
+    assert awkward1.to_list(events.weight) == [0.5, 0.5, 0.5]
+    assert awkward1.to_list(events.weight * events.x) == [0.5, 1.0, 1.5]
+    assert awkward1.sum(events.weight) == 1.5
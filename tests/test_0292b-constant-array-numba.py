@@ -0,0 +1,42 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+numba = pytest.importorskip("numba")
+
+def test_with_field():
+    events = awkward1.Array([{"x": 1.1}, {"x": 2.2}, {"x": 3.3}])
+    events["w"] = 0.5
+    assert isinstance(events.layout.field("w"), awkward1.layout.ConstantArray)
+
+    @numba.njit
+    def f1(events):
+        out = 0.0
+        for event in events:
+            out += event.x * event.w
+        return out
+
+    assert f1(events) == pytest.approx(3.3)
+
+    @numba.njit
+    def f2(x):
+        return x
+
+    assert awkward1.to_list(f2(events)) == [{"x": 1.1, "w": 0.5}, {"x": 2.2, "w": 0.5}, {"x": 3.3, "w": 0.5}]
+
+def test_layout():
+    constant = awkward1.layout.ConstantArray(numpy.int32(3), 4)
+    assert numba.typeof(constant) == numba.typeof(constant.toNumpyArray())
+
+    @numba.njit
+    def f1(x):
+        return x[1] + x[3]
+
+    assert f1(awkward1.Array(constant)) == 6
@@ -0,0 +1,75 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_basic():
+    array = awkward1.layout.RangeArray(3, 2, 5)
+    assert len(array) == 5
+    assert (array.start, array.step, array.stop) == (3, 2, 13)
+    assert awkward1.to_list(array) == [3, 5, 7, 9, 11]
+    assert array[-1] == 11
+    assert str(awkward1.type(array)) == "int64"
+    assert array.form == awkward1.layout.NumpyArray(numpy.arange(5)).form
+    assert array.nbytes == 0
+    assert numpy.asarray(array.toNumpyArray()).tolist() == [3, 5, 7, 9, 11]
+
+    with pytest.raises(ValueError):
+        awkward1.layout.RangeArray(0, 1, -1)
+
+def test_getitem_carry():
+    array = awkward1.layout.RangeArray(10, -1, 10)
+    assert isinstance(array[2:7], awkward1.layout.RangeArray)
+    assert awkward1.to_list(array[2:7]) == [8, 7, 6, 5, 4]
+    assert awkward1.to_list(array[::3]) == [10, 7, 4, 1]
+    assert awkward1.to_list(array[[9, 0, 0]]) == [1, 10, 10]
+    assert isinstance(array[[2, 3, 4]], awkward1.layout.RangeArray)
+    assert awkward1.to_list(array[[2, 3, 4]]) == [8, 7, 6]
+    with pytest.raises(ValueError):
+        array[10]
+
+    offsets = awkward1.layout.Index64(numpy.array([0, 3, 3, 10], dtype=numpy.int64))
+    jagged = awkward1.layout.ListOffsetArray64(offsets, array)
+    assert awkward1.to_list(jagged[:, 1:]) == [[9, 8], [], [6, 5, 4, 3, 2, 1]]
+    assert awkward1.to_list(awkward1.sum(awkward1.Array(jagged), axis=1)) == [27, 0, 28]
+
+def test_slice_by_range():
+    data = awkward1.Array([[1, 2], [], [3], [4, 5, 6], [7]]).layout
+    assert awkward1.to_list(data[awkward1.layout.RangeArray(1, 1, 3)]) == [[], [3], [4, 5, 6]]
+    assert awkward1.to_list(data[awkward1.layout.RangeArray(4, -2, 3)]) == [[7], [3], [1, 2]]
+    assert awkward1.to_list(data[awkward1.layout.RangeArray(0, 0, 2)]) == [[1, 2], [1, 2]]
+    assert awkward1.to_list(data[awkward1.layout.RangeArray(0, 1, 0)]) == []
+    with pytest.raises(ValueError):
+        data[awkward1.layout.RangeArray(3, 1, 3)]
+
+def test_merge():
+    one = awkward1.layout.RangeArray(0, 2, 3)
+    two = awkward1.layout.RangeArray(6, 2, 2)
+    merged = one.merge(two)
+    assert isinstance(merged, awkward1.layout.RangeArray)
+    assert awkward1.to_list(merged) == [0, 2, 4, 6, 8]
+    assert awkward1.to_list(two.merge(one)) == [6, 8, 0, 2, 4]
+    assert awkward1.to_list(awkward1.layout.NumpyArray(numpy.array([1.1])).merge(one)) == [1.1, 0, 2, 4]
+
+def test_localindex():
+    array = awkward1.from_iter([[0.0, 1.1, 2.2], [], [3.3, 4.4]], highlevel=False)
+    assert isinstance(array.localindex(0), awkward1.layout.RangeArray)
+    assert awkward1.to_list(awkward1.local_index(array, axis=0)) == [0, 1, 2]
+    assert awkward1.to_numpy(awkward1.local_index(array, axis=0)).tolist() == [0, 1, 2]
+
+def test_project_is_range():
+    content = awkward1.layout.RangeArray(0, 1, 5)
+    index = awkward1.layout.Index64(numpy.array([1, 2, 3], dtype=numpy.int64))
+    indexed = awkward1.layout.IndexedOptionArray64(index, content)
+    assert isinstance(indexed.project(), awkward1.layout.RangeArray)
+    assert awkward1.to_list(indexed.project()) == [1, 2, 3]
+
+    index = awkward1.layout.Index64(numpy.array([1, -1, 3], dtype=numpy.int64))
+    indexed = awkward1.layout.IndexedOptionArray64(index, content)
+    assert awkward1.to_list(indexed.project()) == [1, 3]
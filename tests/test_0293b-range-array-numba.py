@@ -0,0 +1,57 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+numba = pytest.importorskip("numba")
+
+def test_local_index():
+    array = awkward1.Array([[0.0, 1.1, 2.2], [], [3.3, 4.4]])
+    index = awkward1.local_index(array, axis=0)
+    assert isinstance(index.layout, awkward1.layout.RangeArray)
+
+    @numba.njit
+    def f1(x):
+        out = 0
+        for xi in x:
+            out += xi
+        return out
+
+    assert f1(index) == 3
+
+    @numba.njit
+    def f2(x):
+        return x
+
+    assert awkward1.to_list(f2(index)) == [0, 1, 2]
+
+def test_layout():
+    array = awkward1.layout.RangeArray(3, 2, 5)
+    assert numba.typeof(array) == numba.typeof(array.toNumpyArray())
+
+    @numba.njit
+    def f1(x):
+        return x[1] + x[4]
+
+    assert f1(awkward1.Array(array)) == 16
+
+def test_in_record():
+    array = awkward1.Array([{"x": 1.1}, {"x": 2.2}, {"x": 3.3}])
+    layout = awkward1.layout.RecordArray(
+        [array.layout.field("x"), awkward1.layout.RangeArray(0, 1, 3)], ["x", "i"]
+    )
+
+    @numba.njit
+    def f1(events):
+        out = 0.0
+        for event in events:
+            out += event.x * event.i
+        return out
+
+    assert f1(awkward1.Array(layout)) == pytest.approx(8.8)
@@ -0,0 +1,61 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_basic():
+    data = numpy.array([[1.1, 10, 100], [2.2, 20, 200], [3.3, 30, 300]])
+    array = awkward1.layout.InterleavedArray(data, ["x", "y", "z"])
+    assert len(array) == 3
+    assert array.keys() == ["x", "y", "z"]
+    assert awkward1.to_list(array) == [{"x": 1.1, "y": 10, "z": 100}, {"x": 2.2, "y": 20, "z": 200}, {"x": 3.3, "y": 30, "z": 300}]
+    assert awkward1.to_list(array["y"]) == [10, 20, 30]
+    assert numpy.asarray(array["y"]).strides == (24,)
+    assert array.form == array.toRecordArray().form
+    assert str(awkward1.type(array)) == '{"x": float64, "y": float64, "z": float64}'
+
+    tuples = awkward1.layout.InterleavedArray(data)
+    assert tuples.istuple
+    assert awkward1.to_list(tuples[1]) == (2.2, 20, 200)
+
+    with pytest.raises(ValueError):
+        awkward1.layout.InterleavedArray(data, ["x", "y"])
+
+def test_conversion():
+    record = awkward1.Array([{"x": 1, "y": 2}, {"x": 3, "y": 4}]).layout
+    assert record.isinterleavable
+    array = record.toInterleavedArray()
+    assert isinstance(array, awkward1.layout.InterleavedArray)
+    assert numpy.asarray(array.data).tolist() == [[1, 2], [3, 4]]
+    assert awkward1.to_list(array.toRecordArray()) == awkward1.to_list(record)
+
+    mixed = awkward1.Array([{"x": 1, "y": 2.2}]).layout
+    assert not mixed.isinterleavable
+    with pytest.raises(ValueError):
+        mixed.toInterleavedArray()
+
+def test_getitem_carry():
+    array = awkward1.interleaved(awkward1.Array([[{"x": 1.1, "y": 1.0}, {"x": 2.2, "y": 2.0}], [], [{"x": 3.3, "y": 3.0}]]))
+    assert isinstance(array.layout.content, awkward1.layout.InterleavedArray)
+    assert isinstance(array[::-1].layout.content, awkward1.layout.InterleavedArray)
+    assert awkward1.to_list(array[::-1].x) == [[3.3], [], [1.1, 2.2]]
+    assert isinstance(array[:, 1:].layout.content, awkward1.layout.InterleavedArray)
+    assert awkward1.to_list(array[:, 1:]) == [[{"x": 2.2, "y": 2}], [], []]
+    assert awkward1.to_list(array.x + array.y) == [[2.1, 4.2], [], [6.3]]
+    assert awkward1.to_list(array[array.x > 2]) == [[{"x": 2.2, "y": 2}], [], [{"x": 3.3, "y": 3}]]
+
+def test_merge():
+    one = awkward1.Array([{"x": 1.1, "y": 1.0}]).layout.toInterleavedArray()
+    two = awkward1.Array([{"x": 2.2, "y": 2.0}]).layout.toInterleavedArray()
+    merged = one.merge(two)
+    assert isinstance(merged, awkward1.layout.InterleavedArray)
+    assert awkward1.to_list(merged) == [{"x": 1.1, "y": 1.0}, {"x": 2.2, "y": 2.0}]
+    record = awkward1.Array([{"x": 3.3, "y": 3.0}]).layout
+    assert awkward1.to_list(record.merge(one)) == [{"x": 3.3, "y": 3.0}, {"x": 1.1, "y": 1.0}]
+    assert awkward1.to_list(awkward1.concatenate([one, record])) == [{"x": 1.1, "y": 1.0}, {"x": 3.3, "y": 3.0}]
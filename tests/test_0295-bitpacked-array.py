@@ -0,0 +1,78 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_basic():
+    values = numpy.array([True, False, False, True, True, False, True, True, False, True])
+    for lsb_order in (True, False):
+        array = awkward1.layout.NumpyArray(values).toBitPackedArray(lsb_order)
+        assert isinstance(array, awkward1.layout.BitPackedArray)
+        assert array.lsb_order is lsb_order
+        assert len(array) == 10
+        assert len(array.bits) == 2
+        assert array.numtrue == 6
+        assert awkward1.to_list(array) == values.tolist()
+        assert array[3] and not array[2]
+        assert str(awkward1.type(array)) == "bool"
+        assert array.form == awkward1.layout.NumpyArray(values).form
+        assert numpy.asarray(array.toNumpyArray()).tolist() == values.tolist()
+
+    bits = awkward1.layout.IndexU8(numpy.packbits(values))
+    array = awkward1.layout.BitPackedArray(bits, 10, lsb_order=False)
+    assert awkward1.to_list(array) == values.tolist()
+
+    with pytest.raises(ValueError):
+        awkward1.layout.BitPackedArray(bits, 17)
+    with pytest.raises(ValueError):
+        awkward1.layout.NumpyArray(numpy.arange(3)).toBitPackedArray()
+
+def test_getitem_carry():
+    values = numpy.random.RandomState(12345).randint(2, size=100).astype(numpy.bool_)
+    array = awkward1.layout.NumpyArray(values).toBitPackedArray()
+    assert isinstance(array[16:90], awkward1.layout.BitPackedArray)
+    assert awkward1.to_list(array[16:90]) == values[16:90].tolist()
+    assert awkward1.to_list(array[13:90]) == values[13:90].tolist()
+    assert isinstance(array[[99, 0, 5, 5]], awkward1.layout.BitPackedArray)
+    assert awkward1.to_list(array[[99, 0, 5, 5]]) == values[[99, 0, 5, 5]].tolist()
+    assert awkward1.to_list(array[::-7]) == values[::-7].tolist()
+    with pytest.raises(ValueError):
+        array[100]
+
+def test_mask():
+    values = numpy.random.RandomState(12345).randint(2, size=100).astype(numpy.bool_)
+    data = numpy.arange(100) * 1.1
+    for lsb_order in (True, False):
+        mask = awkward1.layout.NumpyArray(values).toBitPackedArray(lsb_order)
+        assert awkward1.to_list(awkward1.layout.NumpyArray(data)[mask]) == data[values].tolist()
+        assert awkward1.to_list(awkward1.Array(data)[awkward1.Array(mask)]) == data[values].tolist()
+
+    array = awkward1.Array([[0.0, 1.1, 2.2], [], [3.3, 4.4], [5.5], [6.6, 7.7, 8.8, 9.9]])
+    mask = awkward1.bitpacked(array > 3)
+    assert isinstance(mask.layout.content, awkward1.layout.BitPackedArray)
+    assert awkward1.to_list(array[mask]) == [[], [], [3.3, 4.4], [5.5], [6.6, 7.7, 8.8, 9.9]]
+    assert awkward1.to_list(array[mask[2:]]) == awkward1.to_list(array[2:][array[2:] > 3])
+
+def test_merge():
+    one = awkward1.layout.NumpyArray(numpy.array([True, False, True])).toBitPackedArray()
+    two = awkward1.layout.NumpyArray(numpy.array([False, True])).toBitPackedArray()
+    merged = one.merge(two)
+    assert isinstance(merged, awkward1.layout.BitPackedArray)
+    assert awkward1.to_list(merged) == [True, False, True, False, True]
+    assert awkward1.to_list(awkward1.concatenate([one, two])) == [True, False, True, False, True]
+    assert awkward1.to_list(awkward1.layout.NumpyArray(numpy.array([2.2])).merge(one)) == [2.2, 1.0, 0.0, 1.0]
+
+def test_bitpacked():
+    array = awkward1.Array([{"x": [True, False], "y": 1}, {"x": [], "y": 2}, {"x": [True], "y": 3}])
+    packed = awkward1.bitpacked(array)
+    assert isinstance(packed.layout.field("x").content, awkward1.layout.BitPackedArray)
+    assert awkward1.to_list(packed) == awkward1.to_list(array)
+    assert awkward1.to_list(awkward1.sum(packed.x, axis=1)) == [1, 0, 1]
+    assert awkward1.to_list(~packed.x) == [[False, True], [], [False]]
+    assert packed.layout.nbytes < array.layout.nbytes
@@ -0,0 +1,77 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_float16():
+    values = numpy.array([1.5, 2.25, -3.0, 0.5, numpy.inf, 6e-8, 65504], dtype=numpy.float16)
+    array = awkward1.layout.NumpyArray(values)
+    assert array.format == "e"
+    assert str(awkward1.type(array)) == "float16"
+    assert awkward1.to_list(array) == values.tolist()
+    assert awkward1.to_list(array.merge(awkward1.layout.NumpyArray(numpy.array([10.0])))) == values.tolist() + [10.0]
+    assert awkward1.from_json(awkward1.to_json(array[:4])).layout.format == "d"
+
+    halves = numpy.arange(65536, dtype=numpy.uint16).view(numpy.float16)
+    finite = halves[numpy.isfinite(halves)]
+    assert numpy.asarray(awkward1.layout.NumpyArray(finite).astype("f")).tolist() == finite.astype(numpy.float32).tolist()
+    floats = numpy.random.RandomState(12345).normal(0, 1000, 10000).astype(numpy.float32)
+    assert numpy.asarray(awkward1.layout.NumpyArray(floats).astype("e")).view(numpy.uint16).tolist() == floats.astype(numpy.float16).view(numpy.uint16).tolist()
+
+    # doubles round to half directly, not through float
+    doubles = numpy.array([1 + 2**-11 + 2**-40, 1 + 2**-11, 1 + 3 * 2**-11, 65519.99, 65520.0, 2**-25, 2**-25 + 2**-60])
+    assert numpy.asarray(awkward1.layout.NumpyArray(doubles).astype("e")).view(numpy.uint16).tolist() == doubles.astype(numpy.float16).view(numpy.uint16).tolist()
+    assert numpy.asarray(awkward1.layout.NumpyArray(doubles).astype("e")).tolist()[0] == 1 + 2**-10
+
+def test_float16_reduce():
+    array = awkward1.Array([[1.5, 2.25, -3.0], [], [0.5]])
+    half = awkward1.Array(
+        awkward1.layout.ListOffsetArray64(
+            array.layout.offsets,
+            awkward1.layout.NumpyArray(numpy.asarray(array.layout.content).astype(numpy.float16)),
+        )
+    )
+    assert awkward1.to_list(awkward1.sum(half, axis=1)) == [0.75, 0.0, 0.5]
+    assert awkward1.to_list(awkward1.max(half, axis=1)) == [2.25, None, 0.5]
+    assert awkward1.to_list(awkward1.argmin(half, axis=1)) == [2, None, 0]
+    assert str(awkward1.type(half)) == "3 * var * float16"
+
+def test_quantized_basic():
+    array = awkward1.layout.QuantizedArray(numpy.array([1, 2, -3, 4], dtype=numpy.int16), 0.5, 10.0)
+    assert (array.scale, array.offset) == (0.5, 10.0)
+    assert awkward1.to_list(array) == [10.5, 11.0, 8.5, 12.0]
+    assert array[-1] == 12.0
+    assert str(awkward1.type(array)) == "float64"
+    assert array.nbytes == 8
+    assert isinstance(array[1:3], awkward1.layout.QuantizedArray)
+    assert isinstance(array[[3, 0, 0]], awkward1.layout.QuantizedArray)
+    assert awkward1.to_list(array[[3, 0, 0]]) == [12.0, 10.5, 10.5]
+    assert awkward1.to_list(array.merge(array)) == [10.5, 11.0, 8.5, 12.0] * 2
+
+    with pytest.raises(ValueError):
+        awkward1.layout.QuantizedArray(numpy.array([1.1, 2.2]), 0.5)
+
+def test_quantized_reduce():
+    array = awkward1.Array([[0.0, 1.1, 2.2], [], [3.3, 4.4], [5.5], [6.6, 7.7, 8.8, 9.9]])
+    for scale in (0.1, -0.1):
+        quantized = awkward1.quantized(array, scale, offset=1.0)
+        assert isinstance(quantized.layout.content, awkward1.layout.QuantizedArray)
+        assert quantized.layout.nbytes < array.layout.nbytes
+        assert numpy.allclose(awkward1.flatten(quantized), awkward1.flatten(array))
+        for reducer in (awkward1.sum, awkward1.count, awkward1.min, awkward1.max, awkward1.argmin, awkward1.argmax, awkward1.prod):
+            expected = awkward1.to_list(reducer(array, axis=1))
+            result = awkward1.to_list(reducer(quantized, axis=1))
+            assert [None if x is None else pytest.approx(x) for x in result] == expected
+
+def test_quantized_range():
+    with pytest.raises(ValueError):
+        awkward1.quantized(awkward1.Array([1.0, 1000.0]), 0.01, dtype=numpy.int8)
+    with pytest.raises(ValueError):
+        awkward1.quantized(awkward1.Array([1.0, numpy.nan]), 0.01)
+    assert awkward1.to_list(awkward1.quantized(awkward1.Array([1.0, 2.5]), 0.5, dtype=numpy.uint8)) == [1.0, 2.5]
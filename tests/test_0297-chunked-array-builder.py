@@ -0,0 +1,117 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+import threading
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_chunks():
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=3)
+    assert len(builder) == 0
+    assert len(builder.snapshot()) == 0
+    for i in range(10):
+        builder.beginlist()
+        for j in range(i % 3):
+            builder.real(j + 0.5)
+        builder.endlist()
+    assert len(builder) == 10
+    assert builder.numchunks == 3
+
+    snapshot = builder.snapshot()
+    assert isinstance(snapshot, awkward1._ext.IrregularlyPartitionedArray)
+    assert snapshot.stops == [3, 6, 9, 10]
+    expected = [[0.5, 1.5][: i % 3] for i in range(10)]
+    array = awkward1.Array(awkward1.partition.PartitionedArray.from_ext(snapshot))
+    assert awkward1.to_list(array) == expected
+
+    # sealed chunks are shared by later snapshots, not copied
+    later = builder.snapshot()
+    assert numpy.asarray(later.partition(0).content).ctypes.data == numpy.asarray(snapshot.partition(0).content).ctypes.data
+
+def test_partial_entry():
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=100)
+    builder.fromiter({"x": 1, "y": [1.1]})
+    builder.beginrecord()
+    builder.field("x")
+    builder.integer(2)
+    assert len(builder.snapshot()) == 1
+    with pytest.raises(ValueError):
+        builder.seal()
+    builder.field("y")
+    builder.beginlist()
+    builder.endlist()
+    builder.endrecord()
+    builder.seal()
+    assert builder.numchunks == 1
+    assert awkward1.to_list(builder.snapshot().partition(0)) == [{"x": 1, "y": [1.1]}, {"x": 2, "y": []}]
+
+def test_extend():
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=4)
+    builder.extend(awkward1.Array([1, 2, 3, 4, 5, 6, 7, 8, 9, 10]).layout)
+    assert builder.snapshot().stops == [4, 8, 10]
+    assert awkward1.to_list(builder.snapshot().partition(2)) == [9, 10]
+
+def test_concurrent_readers():
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=50)
+    lengths = []
+    lasts = []
+
+    def read():
+        for i in range(200):
+            snapshot = builder.snapshot()
+            lengths.append(len(snapshot))
+            if len(snapshot) > 0:
+                last = snapshot.partition(snapshot.numpartitions - 1)
+                lasts.append((awkward1.to_list(last)[-1], len(snapshot) - 1))
+
+    reader = threading.Thread(target=read)
+    reader.start()
+    for i in range(2000):
+        builder.integer(i)
+    reader.join()
+    assert lengths == sorted(lengths)
+    assert all(x == y for x, y in lasts)
+    assert len(builder.snapshot()) == 2000
+
+def test_type_change_after_seal():
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=2)
+    builder.integer(1)
+    builder.integer(2)
+    builder.real(2.5)
+    array = awkward1.Array(awkward1.partition.PartitionedArray.from_ext(builder.snapshot()))
+    assert str(awkward1.type(array)) == "3 * float64"
+    assert awkward1.to_list(array) == [1.0, 2.0, 2.5]
+    builder.integer(3)
+    array = awkward1.Array(awkward1.partition.PartitionedArray.from_ext(builder.snapshot()))
+    assert str(awkward1.type(array)) == "4 * float64"
+
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=2)
+    builder.integer(1)
+    builder.integer(2)
+    builder.null()
+    builder.integer(3)
+    builder.integer(4)
+    array = awkward1.Array(awkward1.partition.PartitionedArray.from_ext(builder.snapshot()))
+    assert str(awkward1.type(array)) == "5 * ?int64"
+    assert awkward1.to_list(array) == [1, 2, None, 3, 4]
+
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=1)
+    builder.null()
+    builder.integer(3)
+    array = awkward1.Array(awkward1.partition.PartitionedArray.from_ext(builder.snapshot()))
+    assert str(awkward1.type(array)) == "2 * ?int64"
+    assert awkward1.to_list(array) == [None, 3]
+
+def test_new_field_after_seal():
+    builder = awkward1.layout.ChunkedArrayBuilder(chunksize=1)
+    builder.fromiter({"x": 1})
+    builder.fromiter({"x": 2, "y": 2.2})
+    builder.fromiter([1.5, "two"])
+    array = awkward1.Array(awkward1.partition.PartitionedArray.from_ext(builder.snapshot()))
+    assert awkward1.to_list(array) == [{"x": 1, "y": None}, {"x": 2, "y": 2.2}, [1.5, "two"]]
+    str(array)
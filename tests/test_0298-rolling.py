@@ -0,0 +1,65 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def brute(lists, window, reducer):
+    out = []
+    for x in lists:
+        out.append([])
+        for j in range(len(x)):
+            part = x[max(0, j - window + 1) : j + 1]
+            if reducer == "sum":
+                out[-1].append(sum(part))
+            elif reducer == "mean":
+                out[-1].append(sum(part) / len(part))
+            elif reducer == "min":
+                out[-1].append(min(part))
+            else:
+                out[-1].append(max(part))
+    return out
+
+def test_basic():
+    array = awkward1.Array([[1, 2, 3, 4], [], [5, 6]])
+    assert awkward1.to_list(awkward1.rolling(array, 2)) == [[1, 3, 5, 7], [], [5, 11]]
+    assert awkward1.to_list(awkward1.rolling(array, 2, reducer="max", partial=False)) == [[None, 2, 3, 4], [], [None, 6]]
+    assert str(awkward1.type(awkward1.rolling(array, 3))) == "3 * var * float64"
+
+    with pytest.raises(ValueError):
+        awkward1.rolling(array, 0)
+    with pytest.raises(ValueError):
+        awkward1.rolling(array, 2, reducer="median")
+    with pytest.raises(ValueError):
+        awkward1.rolling(awkward1.Array([1, 2, 3]), 2)
+    with pytest.raises(ValueError):
+        awkward1.rolling(awkward1.Array(["one", "two"]), 2)
+
+def test_brute():
+    random = numpy.random.RandomState(12345)
+    lists = [random.randint(-10, 10, random.randint(0, 12)).tolist() for i in range(100)]
+    array = awkward1.Array(lists)
+    for window in (1, 2, 3, 7, 20):
+        for reducer in ("sum", "mean", "min", "max"):
+            assert awkward1.to_list(awkward1.rolling(array, window, reducer=reducer)) == pytest.approx(brute(lists, window, reducer))
+            assert awkward1.to_list(awkward1.rolling(array[50::-3], window, reducer=reducer)) == pytest.approx(brute(lists[50::-3], window, reducer))
+
+def test_nan():
+    array = awkward1.Array([[1.0, numpy.nan, 3.0, 4.0, 5.0]])
+    assert numpy.isnan(awkward1.to_list(awkward1.rolling(array, 2))[0][:3]).all()
+    assert awkward1.to_list(awkward1.rolling(array, 2))[0][3:] == [7.0, 9.0]
+    assert awkward1.to_list(awkward1.rolling(array, 2, reducer="min")) == [[1.0, 1.0, 3.0, 3.0, 4.0]]
+
+def test_structure():
+    array = awkward1.Array([{"x": [[1, 2], [3]], "y": 1}, {"x": [], "y": 2}, {"x": [[4, 5, 6]], "y": 3}])
+    out = awkward1.rolling(array.x, 2, reducer="mean")
+    assert awkward1.to_list(out) == [[[1.0, 1.5], [3.0]], [], [[4.0, 4.5, 5.5]]]
+
+    regular = awkward1.Array(numpy.arange(12).reshape(3, 4))
+    assert awkward1.to_list(awkward1.rolling(regular, 3, reducer="min")) == [[0, 0, 0, 1], [4, 4, 4, 5], [8, 8, 8, 9]]
+    assert awkward1.to_list(awkward1.rolling(awkward1.Array([[], []]), 2)) == [[], []]
@@ -0,0 +1,43 @@
+# BSD 3-Clause License; see https://github.com/scikit-hep/awkward-1.0/blob/master/LICENSE
+
+from __future__ import absolute_import
+
+import sys
+
+import pytest
+import numpy
+
+import awkward1
+
+def test_empty_positions():
+    array = awkward1.Array([[[1], [2, 3], [], [], [4]], [[10, 20]], [[], [5]]])
+    assert awkward1.to_list(awkward1.sum(array, axis=0)) == [[11, 20], [7, 3], [], [], [4]]
+    assert awkward1.to_list(awkward1.max(array, axis=0)) == [[10, 20], [5, 3], [], [], [4]]
+    assert awkward1.to_list(awkward1.sum(awkward1.Array([[[[2]]], [[]], []]), axis=1)) == [[[2]], [], []]
+    assert awkward1.to_list(awkward1.sum(awkward1.Array([[[1]], [[]], [[2]]]), axis=1)) == [[1], [], [2]]
+    assert awkward1.to_list(awkward1.sum(awkward1.Array([[[1]], [[]], [[2]]]), axis=1, keepdims=True)) == [[[1]], [[]], [[2]]]
+
+def test_one_long_list():
+    # output size scales with the content, not with
+    # (longest list) * (number of outer lists)
+    counts = numpy.full(100000, 2)
+    counts[500] = 100000
+    offsets = numpy.concatenate([[0], numpy.cumsum(counts)])
+    inner = awkward1.layout.ListOffsetArray64(
+        awkward1.layout.Index64(offsets),
+        awkward1.layout.NumpyArray(numpy.arange(offsets[-1], dtype=numpy.float64)),
+    )
+    array = awkward1.Array(awkward1.layout.RegularArray(inner, 1))
+    out = awkward1.sum(array, axis=1)
+    assert len(out) == 100000
+    assert awkward1.to_list(awkward1.num(out, axis=1)[498:503]) == [2, 2, 100000, 2, 2]
+    assert awkward1.to_list(awkward1.sum(array, axis=2)[:2]) == [[1.0], [5.0]]
+
+def test_brute():
+    random = numpy.random.RandomState(12345)
+    lists = [[random.randint(0, 10, random.randint(0, 6)).tolist() for j in range(random.randint(0, 4))] for i in range(50)]
+    expected = []
+    for x in lists:
+        width = max([len(y) for y in x] + [0])
+        expected.append([sum(y[r] for y in x if len(y) > r) for r in range(width)])
+    assert awkward1.to_list(awkward1.sum(awkward1.Array(lists), axis=1)) == expected